@@ -28,6 +28,7 @@
 /* LSMLIB Serial package headers */
 #include "lsm_boundary_conditions.h"
 #include "lsm_macros.h"
+#include "lsm_semi_implicit_curvature.h"
 
 /* Local headers */
 #include "curvature_model_top.h"
@@ -36,6 +37,9 @@
 #define DT_MIN_TO_CORRECT 1e-5
 #define DT_MIN            0.001
 
+#define SEMI_IMPLICIT_CURV_TOL        1e-8
+#define SEMI_IMPLICIT_CURV_MAX_ITERS  500
+
 /* Main loop for constant curvature level set method model in 3D */
 
 void curvatureModelMedium3dMainLoop(
@@ -55,6 +59,9 @@ void curvatureModelMedium3dMainLoop(
  
   LSMLIB_REAL   zero = 0.0;
   LSMLIB_REAL   vel_n, vol_phi, vol_max, vol_phi_prev, rel_vol_diff;
+  LSMLIB_REAL   b_curv;
+  LSMLIB_REAL   alpha_stage1 = 0.0, alpha_stage2 = 0.5;
+  int      use_lse_rhs;
   int      nx, nxy;  
   
   int      bdry_location_idx = 9; /* extrapolate all boundaries */
@@ -97,16 +104,34 @@ void curvatureModelMedium3dMainLoop(
             1.0/((g->dx)[2]*(g->dx)[2]);
   dt_corr *= 2.0*o->b;
   
+  /* with the curvature term treated semi-implicitly, dt is only limited */
+  /* by the interface speed b*kappa (assuming curvature radius O(1))    */
+  if(o->semi_implicit_curv)
+  {
+    dt_corr = (g->dx)[0];
+    if((g->dx)[1] < dt_corr) dt_corr = (g->dx)[1];
+    if((g->dx)[2] < dt_corr) dt_corr = (g->dx)[2];
+    dt_corr = o->b/dt_corr;
+  }
+  
+  /* The explicit scheme advances phi using fused TVD Runge-Kutta stage */
+  /* kernels that never store the RHS of the level set equation; a term */
+  /* is switched off by setting its coefficient to zero.  lse_rhs is    */
+  /* only used by the semi-implicit treatment of the curvature term.   */
+  vel_n = (o->a > 0) ? o->a : zero;
+  b_curv = (o->b > 0) ? o->b : zero;
+  use_lse_rhs = o->semi_implicit_curv && (o->b > 0);
+  
   /* this eps is suggested for Heaviside function in Fedkiw/Osher book */
   eps = 1.5*(g->dx[0]);
-  nx = (g->grid_dims_ghostbox)[0];
-  nxy = (g->grid_dims_ghostbox)[0]*(g->grid_dims_ghostbox)[1];
+  nx = (g->grid_dims_alloc)[0];
+  nxy = (g->grid_dims_alloc)[0]*(g->grid_dims_alloc)[1];
     
   /* compute volume of the pore space */
   LSM3D_VOLUME_REGION_PHI_LESS_THAN_ZERO(&vol_max,
 	        d->mask,
-		&(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		&(g->klo_gb), &(g->khi_gb),
+		&(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		&(g->klo_gb), &(g->khi_alloc),
 		&(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		&(g->klo_fb), &(g->khi_fb),
 		&(g->dx[0]),&(g->dx[1]),&(g->dx[2]),
@@ -115,8 +140,8 @@ void curvatureModelMedium3dMainLoop(
   /* compute volume of the fluid */
   LSM3D_VOLUME_REGION_PHI_LESS_THAN_ZERO(&vol_phi,
 	        d->phi,
-		&(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		&(g->klo_gb), &(g->khi_gb),
+		&(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		&(g->klo_gb), &(g->khi_alloc),
 		&(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		&(g->klo_fb), &(g->khi_fb),
 		&(g->dx[0]),&(g->dx[1]),&(g->dx[2]),
@@ -145,40 +170,39 @@ void curvatureModelMedium3dMainLoop(
       INNER_STEP++;
       TOTAL_STEP++;
       
-      SET_DATA_TO_CONSTANT(d->lse_rhs,g,zero)    
+      if(use_lse_rhs) SET_DATA_TO_CONSTANT(d->lse_rhs,g,zero)
      
       if(o->a > 0)
       {  
          /* Compute upwinding gradient approximations */
           LSM3D_HJ_ENO2(d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
                     d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->D1,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->D2,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		    &(g->klo_fb), &(g->khi_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));   
-         vel_n = o->a;
-	 
-	 LSM3D_ADD_CONST_NORMAL_VEL_TERM_TO_LSE_RHS(d->lse_rhs,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+	 if(use_lse_rhs)
+	   LSM3D_ADD_CONST_NORMAL_VEL_TERM_TO_LSE_RHS(d->lse_rhs,
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &vel_n,
 		    &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		    &(g->klo_fb), &(g->khi_fb));
@@ -186,11 +210,11 @@ void curvatureModelMedium3dMainLoop(
 	 /* figure out dt for hyperbolic term */
 	 LSM3D_COMPUTE_STABLE_CONST_NORMAL_VEL_DT(&dt,&vel_n,
 		    d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_x_minus, d->phi_y_minus,  d->phi_z_minus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		    &(g->klo_fb), &(g->khi_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]),		    
@@ -202,60 +226,61 @@ void curvatureModelMedium3dMainLoop(
       {
 	/* Compute derivatives needed for curvature term*/
 	LSM3D_CENTRAL_GRAD_ORDER2(d->phi_x, d->phi_y, d->phi_z,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_D1_fb), &(g->ihi_D1_fb), 
 		    &(g->jlo_D1_fb), &(g->jhi_D1_fb),
 		    &(g->klo_D1_fb), &(g->khi_D1_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));	
 	LSM3D_CENTRAL_GRAD_ORDER2(d->phi_xx, d->phi_xy, d->phi_xz,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_x,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_D2_fb), &(g->ihi_D2_fb), 
 		    &(g->jlo_D2_fb), &(g->jhi_D2_fb),
 		    &(g->klo_D2_fb), &(g->khi_D2_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));	
 	LSM3D_CENTRAL_GRAD_ORDER2(d->phi_xy, d->phi_yy, d->phi_yz,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_y,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_D2_fb), &(g->ihi_D2_fb), 
 		    &(g->jlo_D2_fb), &(g->jhi_D2_fb),
 		    &(g->klo_D2_fb), &(g->khi_D2_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));
 	LSM3D_CENTRAL_GRAD_ORDER2(d->phi_xz, d->phi_yz, d->phi_zz,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_z,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_D2_fb), &(g->ihi_D2_fb), 
 		    &(g->jlo_D2_fb), &(g->jhi_D2_fb),
 		    &(g->klo_D2_fb), &(g->khi_D2_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));		    
 	
-	LSM3D_ADD_CONST_CURV_TERM_TO_LSE_RHS(d->lse_rhs,
-	            &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_x,d->phi_y,d->phi_z,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_xx,d->phi_xy,d->phi_xz,
-		    d->phi_yy,d->phi_yz,d->phi_zz,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &(o->b),
-		    &(g->ilo_D2_fb), &(g->ihi_D2_fb), 
-		    &(g->jlo_D2_fb), &(g->jhi_D2_fb),
-		    &(g->klo_D2_fb), &(g->khi_D2_fb));
+	if(use_lse_rhs)
+	  LSM3D_ADD_SEMI_IMPLICIT_CURV_CORRECTION_TO_LSE_RHS(d->lse_rhs,
+	              &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		      &(g->klo_gb), &(g->khi_alloc),
+		      d->phi_x,d->phi_y,d->phi_z,
+		      &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		      &(g->klo_gb), &(g->khi_alloc),
+		      d->phi_xx,d->phi_xy,d->phi_xz,
+		      d->phi_yy,d->phi_yz,d->phi_zz,
+		      &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		      &(g->klo_gb), &(g->khi_alloc),
+		      &(o->b),
+		      &(g->ilo_D2_fb), &(g->ihi_D2_fb), 
+		      &(g->jlo_D2_fb), &(g->jhi_D2_fb),
+		      &(g->klo_D2_fb), &(g->khi_D2_fb));
 	 
 	/* correct dt due to parabolic (curvature) term */
         if( o->a > 0 )
@@ -277,134 +302,162 @@ void curvatureModelMedium3dMainLoop(
       if(dt > dt_max) dt_max = dt;
       if(dt < dt_min) dt_min = dt;
       
-      LSM3D_TVD_RK2_STAGE1(d->phi_stage1,
-                   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
-		   d->phi,
-		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
-		   d->lse_rhs,
-		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
-		   &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
-		   &(g->klo_fb), &(g->khi_fb),
-		   &dt);
+      if(use_lse_rhs)
+        LSM3D_TVD_RK2_STAGE1(d->phi_stage1,
+                     &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		     &(g->klo_gb), &(g->khi_alloc),
+		     d->phi,
+		     &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		     &(g->klo_gb), &(g->khi_alloc),
+		     d->lse_rhs,
+		     &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		     &(g->klo_gb), &(g->khi_alloc),
+		     &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
+		     &(g->klo_fb), &(g->khi_fb),
+		     &dt);
+      else
+        LSM3D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV(d->phi_stage1,
+                     &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		     &(g->klo_gb), &(g->khi_alloc),
+		     d->phi,
+		     &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		     &(g->klo_gb), &(g->khi_alloc),
+		     d->phi,
+		     &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		     &(g->klo_gb), &(g->khi_alloc),
+		     d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
+		     &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		     &(g->klo_gb), &(g->khi_alloc),
+		     d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
+		     &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		     &(g->klo_gb), &(g->khi_alloc),
+		     d->phi_x, d->phi_y, d->phi_z,
+		     &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		     &(g->klo_gb), &(g->khi_alloc),
+		     d->phi_xx, d->phi_xy, d->phi_xz,
+		     d->phi_yy, d->phi_yz, d->phi_zz,
+		     &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		     &(g->klo_gb), &(g->khi_alloc),
+		     &vel_n, &b_curv,
+		     &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
+		     &(g->klo_fb), &(g->khi_fb),
+		     &alpha_stage1, &dt);
       /* boundary conditions */	   
       signedLinearExtrapolationBC(d->phi_stage1,g,bdry_location_idx);
       
       /* masking enforced so that the interface stays within pore space */
       if(o->do_mask) IMPOSE_MASK(d->phi_stage1,d->mask,d->phi_stage1,g);   	  
 
-      SET_DATA_TO_CONSTANT(d->lse_rhs,g,zero)
-      
-      if(o->a)
+      if(use_lse_rhs)
+      { /* IMEX Euler step: solve (I - b*dt*Laplacian) phi_next = phi_stage1 */
+        COPY_DATA(d->phi_next,d->phi_stage1,g)
+        if(solveSemiImplicitCurvatureSystem3d(d->phi_next,d->phi_stage1,
+                                 o->b*dt,g,SEMI_IMPLICIT_CURV_TOL,
+                                 SEMI_IMPLICIT_CURV_MAX_ITERS) < 0)
+        {
+          printf("\nSemi-implicit curvature solve did not converge.\n");
+        }
+
+        signedLinearExtrapolationBC(d->phi_next,g,bdry_location_idx);
+        if(o->do_mask) IMPOSE_MASK(d->phi,d->mask,d->phi_next,g)
+        else           COPY_DATA(d->phi,d->phi_next,g)
+
+        dt_sub = dt_sub + dt;
+        continue;
+      }
+
+      if(o->a > 0)
       {
 	  LSM3D_HJ_ENO2(d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
                     d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_stage1,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->D1,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->D2,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		    &(g->klo_fb), &(g->khi_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));
-	 LSM3D_ADD_CONST_NORMAL_VEL_TERM_TO_LSE_RHS(d->lse_rhs,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &vel_n,
-		    &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
-		    &(g->klo_fb), &(g->khi_fb));	    
       }
       
-      if( o->b )
+      if( o->b > 0 )
       {
 	LSM3D_CENTRAL_GRAD_ORDER2(d->phi_x,d->phi_y,d->phi_z,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_stage1,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_D1_fb), &(g->ihi_D1_fb), 
 		    &(g->jlo_D1_fb), &(g->jhi_D1_fb),
 		    &(g->klo_D1_fb), &(g->khi_D1_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));	
 	LSM3D_CENTRAL_GRAD_ORDER2(d->phi_xx,d->phi_xy,d->phi_xz,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_x,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_D2_fb), &(g->ihi_D2_fb), 
 		    &(g->jlo_D2_fb), &(g->jhi_D2_fb),
 		    &(g->klo_D2_fb), &(g->khi_D2_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));	
 	LSM3D_CENTRAL_GRAD_ORDER2(d->phi_xy,d->phi_yy,d->phi_yz,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_y,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_D2_fb), &(g->ihi_D2_fb), 
 		    &(g->jlo_D2_fb), &(g->jhi_D2_fb),
 		    &(g->klo_D2_fb), &(g->khi_D2_fb), 
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));
 	LSM3D_CENTRAL_GRAD_ORDER2(d->phi_xz, d->phi_yz, d->phi_zz,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->phi_z,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_D2_fb), &(g->ihi_D2_fb), 
 		    &(g->jlo_D2_fb), &(g->jhi_D2_fb),
 		    &(g->klo_D2_fb), &(g->khi_D2_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));		    
-	//Compute_and_add_curvature3d_lse_rhs(g,p,curv_tmp,grad_mag2)
-	LSM3D_ADD_CONST_CURV_TERM_TO_LSE_RHS(d->lse_rhs,
-	            &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_x,d->phi_y,d->phi_z,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_xx,d->phi_xy,d->phi_xz,
-		    d->phi_yy,d->phi_yz,d->phi_zz,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &(o->b),
-		    &(g->ilo_D2_fb), &(g->ihi_D2_fb), 
-		    &(g->jlo_D2_fb), &(g->jhi_D2_fb),
-		    &(g->klo_D2_fb), &(g->khi_D2_fb));
       }
      
-      LSM3D_TVD_RK2_STAGE2(d->phi_next,
-                   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
-		   d->phi_stage1,
-		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
+      LSM3D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV(d->phi_next,
+                   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
 		   d->phi,
-		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
-		   d->lse_rhs,
-		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
+		   d->phi_stage1,
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
+		   d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
+		   d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
+		   d->phi_x, d->phi_y, d->phi_z,
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
+		   d->phi_xx, d->phi_xy, d->phi_xz,
+		   d->phi_yy, d->phi_yz, d->phi_zz,
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
+		   &vel_n, &b_curv,
 		   &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		   &(g->klo_fb), &(g->khi_fb),
-		   &dt);
+		   &alpha_stage2, &dt);
 
       /* boundary conditions */
       signedLinearExtrapolationBC(d->phi_next,g,bdry_location_idx);	 
@@ -429,19 +482,19 @@ void curvatureModelMedium3dMainLoop(
     
    /* compute max abs error */
    LSM3D_MAX_NORM_DIFF(&max_abs_err,d->phi,
-            &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-	    &(g->klo_gb), &(g->khi_gb),
+            &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+	    &(g->klo_gb), &(g->khi_alloc),
 	    d->phi_prev,
-	    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-	    &(g->klo_gb), &(g->khi_gb),
+	    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+	    &(g->klo_gb), &(g->khi_alloc),
 	    &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 	    &(g->klo_fb), &(g->khi_fb));
    LSM3D_VOLUME_REGION_PHI_LESS_THAN_ZERO(&vol_phi,
 	    d->phi,
-            &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-	    &(g->klo_gb), &(g->khi_gb),
-            &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-            &(g->klo_gb), &(g->khi_gb),
+            &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+	    &(g->klo_gb), &(g->khi_alloc),
+            &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+            &(g->klo_gb), &(g->khi_alloc),
             &(g->dx[0]),&(g->dx[1]),&(g->dx[2]),
 	    &eps);		    
     
@@ -506,53 +559,53 @@ void reinitializeMedium3d(
     while(t_r < tmax_r )
     {
       LSM3D_HJ_ENO2(d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb),&(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb),&(g->khi_alloc),
                     d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb),&(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb),&(g->khi_alloc),
 		    d->phi,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->D1,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->D2,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		    &(g->klo_fb), &(g->khi_fb),
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));   
 		    		    
       LSM3D_COMPUTE_REINITIALIZATION_EQN_RHS(d->lse_rhs,
-                 &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		 &(g->klo_gb), &(g->khi_gb),
+                 &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		 &(g->klo_gb), &(g->khi_alloc),
 		 d->phi,
-		 &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		 &(g->klo_gb), &(g->khi_gb),
+		 &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		 &(g->klo_gb), &(g->khi_alloc),
 		 d->phi0,
-		 &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		 &(g->klo_gb), &(g->khi_gb),
+		 &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		 &(g->klo_gb), &(g->khi_alloc),
 		 d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-		 &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		 &(g->klo_gb), &(g->khi_gb),
+		 &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		 &(g->klo_gb), &(g->khi_alloc),
 		 d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
-		 &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		 &(g->klo_gb), &(g->khi_gb),
+		 &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		 &(g->klo_gb), &(g->khi_alloc),
 		 &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		 &(g->klo_fb), &(g->khi_fb),
 		 &((g->dx)[0]), &((g->dx)[1]),&((g->dx)[2]),
 		 &use_phi0_for_sign);
  
        LSM3D_TVD_RK2_STAGE1(d->phi_stage1,
-                   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
+                   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
 		   d->phi,
-		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
 		   d->lse_rhs,
-		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
 		   &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		   &(g->klo_fb), &(g->khi_fb),
 		   &dt_r);
@@ -560,55 +613,55 @@ void reinitializeMedium3d(
       signedLinearExtrapolationBC(d->phi_stage1,g,bdry_location_idx);	 	 	    
       
       LSM3D_HJ_ENO2(d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb),&(g->khi_gb),
+                    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb),&(g->khi_alloc),
                     d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb),&(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb),&(g->khi_alloc),
 		    d->phi_stage1,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->D1,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    d->D2,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
+		    &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		    &(g->klo_gb), &(g->khi_alloc),
 		    &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		    &(g->klo_fb), &(g->khi_fb), 
 		    &((g->dx)[0]),&((g->dx)[1]),&((g->dx)[2]));
        LSM3D_COMPUTE_REINITIALIZATION_EQN_RHS(d->lse_rhs,
-                 &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		 &(g->klo_gb), &(g->khi_gb),
+                 &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		 &(g->klo_gb), &(g->khi_alloc),
 		 d->phi_stage1,
-		 &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		 &(g->klo_gb), &(g->khi_gb),
+		 &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		 &(g->klo_gb), &(g->khi_alloc),
 		 d->phi0,
-		 &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		 &(g->klo_gb), &(g->khi_gb),
+		 &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		 &(g->klo_gb), &(g->khi_alloc),
 		 d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-		 &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		 &(g->klo_gb), &(g->khi_gb),
+		 &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		 &(g->klo_gb), &(g->khi_alloc),
 		 d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
-		 &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		 &(g->klo_gb), &(g->khi_gb),
+		 &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		 &(g->klo_gb), &(g->khi_alloc),
 		 &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		 &(g->klo_fb), &(g->khi_fb),
 		 &((g->dx)[0]), &((g->dx)[1]),&((g->dx)[2]),
 		 &use_phi0_for_sign);
 	 
        LSM3D_TVD_RK2_STAGE2(d->phi_next,
-                   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
+                   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
 		   d->phi_stage1,
-		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
 		   d->phi,
-		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
 		   d->lse_rhs,
-		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		   &(g->klo_gb), &(g->khi_gb),
+		   &(g->ilo_gb), &(g->ihi_alloc), &(g->jlo_gb), &(g->jhi_alloc),
+		   &(g->klo_gb), &(g->khi_alloc),
 		   &(g->ilo_fb), &(g->ihi_fb), &(g->jlo_fb), &(g->jhi_fb),
 		   &(g->klo_fb), &(g->khi_fb),
 		   &dt_r);
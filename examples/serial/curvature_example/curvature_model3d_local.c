@@ -27,6 +27,7 @@
 /* LSMLIB Serial package headers */
 #include "lsm_boundary_conditions.h"
 #include "lsm_macros.h"
+#include "lsm_narrow_band.h"
 
 /* Local headers */
 #include "curvature_model_top.h"
@@ -65,6 +66,7 @@ void curvatureModelMedium3dLocalMainLoop(
   LSMLIB_REAL   max_abs_err, eps, eps_stop;
  
   LSMLIB_REAL   zero = 0.0;
+  LSMLIB_REAL   alpha_stage1 = 0.0, alpha_stage2 = 0.5; /* TVD-RK2 weights */
   LSMLIB_REAL   vel_n, vol_phi, vol_max, vol_phi_prev, rel_vol_diff;
   int      i, nx, nxy;  
   
@@ -91,6 +93,8 @@ void curvatureModelMedium3dLocalMainLoop(
   int      n_outer, change_sgn;
   int      n_lo_copy[6], n_hi_copy[6];
   int      change_sgn_steps, grad_phi_ave_steps;
+  LSMLIB_REAL   displacement;
+  NarrowBandManager *nb_manager;
    
   t = 0;
   /* every TPLOT time period we evaluate max. abs. error as well as
@@ -157,6 +161,10 @@ void curvatureModelMedium3dLocalMainLoop(
   /* will need narrow band level 0,1,2,3 */
   level = 3; 
   
+  /* localization: the narrow band is only rebuilt when the interface
+     may have moved out of its inner band */
+  nb_manager = createNarrowBandManager(beta,gamma);
+
   /* localization: reinitialize globally so T0 can be set */
   reinitializeMedium3d(d,g,o,gamma + g->dx[0]); 	 
 
@@ -186,53 +194,52 @@ void curvatureModelMedium3dLocalMainLoop(
       INNER_STEP++;
       TOTAL_STEP++;
       
-       /* localization : determine T0 */	   
-      LSM3D_DETERMINE_NARROW_BAND(d->phi,
-           &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-           &(g->klo_gb), &(g->khi_gb),
-	   d->narrow_band,
-	   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-           &(g->klo_gb), &(g->khi_gb),
-	   d->index_x, d->index_y, d->index_z,
-	   &nlo_index, &nhi_index,	   
-	   d->n_lo,d->n_hi,
-	   d->index_outer_pts,
-	   &nlo_index_outer, &nhi_index_outer,
-	   &(d->nlo_outer_plus),  &(d->nhi_outer_plus),
-	   &(d->nlo_outer_minus), &(d->nhi_outer_minus),
-           &gamma,&beta,&level);
-	   
-     
-      /* mark boundary layers in narrow_band array 
-      *  These layer marks to be used in Fortran functions for checking if the
-      *	 point is in the correct fill box.
-     */     	   	   
-      LSM3D_MARK_NARROW_BAND_BOUNDARY_LAYER(d->narrow_band,
-       	   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-           &(g->klo_gb), &(g->khi_gb),
-	   &(g->ilo_D2_fb), &(g->ihi_D2_fb), &(g->jlo_D2_fb), &(g->jhi_D2_fb),
-           &(g->klo_D2_fb), &(g->khi_D2_fb),
-	   &mark_D2);
-	   
-      LSM3D_MARK_NARROW_BAND_BOUNDARY_LAYER(d->narrow_band,
-       	   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-           &(g->klo_gb), &(g->khi_gb),
-	   &(g->ilo_D1_fb), &(g->ihi_D1_fb), &(g->jlo_D1_fb), &(g->jhi_D1_fb),
-           &(g->klo_D1_fb), &(g->khi_D1_fb),
-	   &mark_D1);
-	   
-      LSM3D_MARK_NARROW_BAND_BOUNDARY_LAYER(d->narrow_band,
-       	   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-           &(g->klo_gb), &(g->khi_gb),
-	   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-           &(g->klo_gb), &(g->khi_gb),
-	   &mark_gb);	   	   
-	   
-      LSM3D_ZERO_OUT_LEVEL_SET_EQN_RHS_LOCAL(d->lse_rhs,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-                    d->index_x, d->index_y, d->index_z,
-		    &(d->n_lo)[0],&(d->n_hi)[0]);
+      if(narrowBandRebuildNeeded(nb_manager))
+      {
+        /* localization : determine T0 */
+        LSM3D_DETERMINE_NARROW_BAND(d->phi,
+             &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+             &(g->klo_gb), &(g->khi_gb),
+             d->narrow_band,
+             &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+             &(g->klo_gb), &(g->khi_gb),
+             d->index_x, d->index_y, d->index_z,
+             &nlo_index, &nhi_index,
+             d->n_lo,d->n_hi,
+             d->index_outer_pts,
+             &nlo_index_outer, &nhi_index_outer,
+             &(d->nlo_outer_plus),  &(d->nhi_outer_plus),
+             &(d->nlo_outer_minus), &(d->nhi_outer_minus),
+             &gamma,&beta,&level);
+
+
+        /* mark boundary layers in narrow_band array
+        *  These layer marks to be used in Fortran functions for checking if the
+        *  point is in the correct fill box.
+         */
+        LSM3D_MARK_NARROW_BAND_BOUNDARY_LAYER(d->narrow_band,
+             &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+             &(g->klo_gb), &(g->khi_gb),
+             &(g->ilo_D2_fb), &(g->ihi_D2_fb), &(g->jlo_D2_fb), &(g->jhi_D2_fb),
+             &(g->klo_D2_fb), &(g->khi_D2_fb),
+             &mark_D2);
+
+        LSM3D_MARK_NARROW_BAND_BOUNDARY_LAYER(d->narrow_band,
+             &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+             &(g->klo_gb), &(g->khi_gb),
+             &(g->ilo_D1_fb), &(g->ihi_D1_fb), &(g->jlo_D1_fb), &(g->jhi_D1_fb),
+             &(g->klo_D1_fb), &(g->khi_D1_fb),
+             &mark_D1);
+
+        LSM3D_MARK_NARROW_BAND_BOUNDARY_LAYER(d->narrow_band,
+             &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+             &(g->klo_gb), &(g->khi_gb),
+             &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+             &(g->klo_gb), &(g->khi_gb),
+             &mark_gb);
+
+        recordNarrowBandRebuild(nb_manager);
+      }
      
       if(o->a > 0)
       {  
@@ -264,22 +271,6 @@ void curvatureModelMedium3dLocalMainLoop(
 	 
 	 vel_n = o->a;
 	 
-	 LSM3D_ADD_CONST_NORMAL_VEL_TERM_TO_LSE_RHS_LOCAL(d->lse_rhs,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &vel_n,
-		    d->index_x, d->index_y, d->index_z,
-		    &(d->n_lo)[0],&(d->n_hi)[0],		    
-                    d->narrow_band,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &mark_fb);
                   
 	 /* figure out time spacing for hyperbolic term */
 	 LSM3D_COMPUTE_STABLE_CONST_NORMAL_VEL_DT_LOCAL(&dt,&vel_n,
@@ -297,7 +288,11 @@ void curvatureModelMedium3dLocalMainLoop(
 		    &(g->klo_gb), &(g->khi_gb),	
 		    &mark_fb);  
       }
-      else dt = tplot;
+      else 
+      {
+        dt = tplot;
+        vel_n = 0.0;
+      }
      
       if( o->b > 0)
       {
@@ -355,23 +350,6 @@ void curvatureModelMedium3dLocalMainLoop(
 		    &(g->klo_gb), &(g->khi_gb),
 		    &mark_D2);
 		    
-	LSM3D_ADD_CONST_CURV_TERM_TO_LSE_RHS_LOCAL(d->lse_rhs,
-	            &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_x,d->phi_y,d->phi_z,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_xx,d->phi_xy,d->phi_xz,
-		    d->phi_yy,d->phi_yz,d->phi_zz,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &(o->b),
-		    d->index_x, d->index_y, d->index_z,
-		    &(d->n_lo)[0], &(d->n_hi)[0],
-                    d->narrow_band,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &mark_fb);
 		    	
 	/* correct dt due to parabolic (curvature) term */
         if( o->a > 0 )
@@ -393,46 +371,45 @@ void curvatureModelMedium3dLocalMainLoop(
       if(dt > dt_max) dt_max = dt;
       if(dt < dt_min) dt_min = dt;
       
-      /* localization: modify equation by a cut-off function */
-      LSM3D_MULTIPLY_CUT_OFF_LSE_RHS_LOCAL(d->phi, d->lse_rhs,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->index_x, d->index_y, d->index_z,
-		    &(d->n_lo)[0],&(d->n_hi)[0],
-		    d->narrow_band,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &mark_fb,
-		    &beta,&gamma);
-      
-      LSM3D_TVD_RK2_STAGE1_LOCAL(d->phi_stage1,
+      /* advance a single TVD-RK stage; the right-hand side (multiplied */
+      /* by the localization cut-off function) is never stored          */
+      LSM3D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV_LOCAL(d->phi_stage1,
                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
 		   &(g->klo_gb), &(g->khi_gb),
 		   d->phi,
 		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
 		   &(g->klo_gb), &(g->khi_gb),
-		   d->lse_rhs,
+		   d->phi,
+		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+		   &(g->klo_gb), &(g->khi_gb),
+		   d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
 		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
 		   &(g->klo_gb), &(g->khi_gb),
-		   &dt,
+		   d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
+		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+		   &(g->klo_gb), &(g->khi_gb),
+		   d->phi_x, d->phi_y, d->phi_z,
+		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+		   &(g->klo_gb), &(g->khi_gb),
+		   d->phi_xx, d->phi_xy, d->phi_xz,
+		   d->phi_yy, d->phi_yz, d->phi_zz,
+		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+		   &(g->klo_gb), &(g->khi_gb),
+		   &vel_n, &(o->b),
+		   &alpha_stage1, &dt,
 		   d->index_x, d->index_y, d->index_z,
 		   &(d->n_lo)[0],&(d->n_hi)[0],
 		   d->narrow_band,
 		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
 		   &(g->klo_gb), &(g->khi_gb),
-		   &mark_fb);	
+		   &mark_fb,
+		   &beta,&gamma);	
 
        /* boundary conditions */
        signedLinearExtrapolationBC(d->phi_stage1,g,bdry_location_idx);
          
       /* masking enforced so that the interface stays within pore space */
       if(o->do_mask) IMPOSE_MASK_LOCAL(d->phi_stage1,d->mask,d->phi_stage1,g,d);       
-
-      LSM3D_ZERO_OUT_LEVEL_SET_EQN_RHS_LOCAL(d->lse_rhs,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-                    d->index_x, d->index_y, d->index_z,
-		    &(d->n_lo)[0],&(d->n_hi)[2]);  
       
       if(o->a)
       {
@@ -461,22 +438,6 @@ void curvatureModelMedium3dLocalMainLoop(
 		    &(g->klo_gb), &(g->khi_gb),
 		    &mark_fb,&mark_D1,&mark_D2);   
 		        
-	 LSM3D_ADD_CONST_NORMAL_VEL_TERM_TO_LSE_RHS_LOCAL(d->lse_rhs,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &vel_n,
-		    d->index_x, d->index_y, d->index_z,
-		    &(d->n_lo)[0],&(d->n_hi)[0],		    
-                    d->narrow_band,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &mark_fb);	    
       }
       
       if( o->b )
@@ -534,58 +495,59 @@ void curvatureModelMedium3dLocalMainLoop(
 		    &(g->klo_gb), &(g->khi_gb),
 		    &mark_D2);
 
-	LSM3D_ADD_CONST_CURV_TERM_TO_LSE_RHS_LOCAL(d->lse_rhs,
-	            &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_x,d->phi_y,d->phi_z,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->phi_xx,d->phi_xy,d->phi_xz,
-		    d->phi_yy,d->phi_yz,d->phi_zz,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &(o->b),
-		    d->index_x, d->index_y, d->index_z,
-		    &(d->n_lo)[0], &(d->n_hi)[0],
-                    d->narrow_band,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &mark_fb);
       }     
      
-      /* localization: modify equation by a cut-off function */
-      LSM3D_MULTIPLY_CUT_OFF_LSE_RHS_LOCAL(d->phi_stage1, d->lse_rhs,
-                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    d->index_x, d->index_y, d->index_z,
-		    &(d->n_lo)[0],&(d->n_hi)[0],		    
-		    d->narrow_band,
-		    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
-		    &(g->klo_gb), &(g->khi_gb),
-		    &mark_fb,&beta,&gamma);
-		    
-      LSM3D_TVD_RK2_STAGE2_LOCAL(d->phi_next,
+      /* advance a single TVD-RK stage; the right-hand side (multiplied */
+      /* by the localization cut-off function) is never stored          */
+      LSM3D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV_LOCAL(d->phi_next,
                    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
 		   &(g->klo_gb), &(g->khi_gb),
+		   d->phi,
+		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+		   &(g->klo_gb), &(g->khi_gb),
 		   d->phi_stage1,
 		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
 		   &(g->klo_gb), &(g->khi_gb),
-		   d->phi,
+		   d->phi_x_plus, d->phi_y_plus, d->phi_z_plus,
 		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
 		   &(g->klo_gb), &(g->khi_gb),
-		   d->lse_rhs,
+		   d->phi_x_minus, d->phi_y_minus, d->phi_z_minus,
+		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+		   &(g->klo_gb), &(g->khi_gb),
+		   d->phi_x, d->phi_y, d->phi_z,
 		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
 		   &(g->klo_gb), &(g->khi_gb),
-		   &dt,
+		   d->phi_xx, d->phi_xy, d->phi_xz,
+		   d->phi_yy, d->phi_yz, d->phi_zz,
+		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+		   &(g->klo_gb), &(g->khi_gb),
+		   &vel_n, &(o->b),
+		   &alpha_stage2, &dt,
 		   d->index_x, d->index_y, d->index_z,
 		   &(d->n_lo)[0],&(d->n_hi)[0],
 		   d->narrow_band,
 		   &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
 		   &(g->klo_gb), &(g->khi_gb),
-		   &mark_fb);
+		   &mark_fb,
+		   &beta,&gamma);
         
       /* boundary conditions */
        signedLinearExtrapolationBC(d->phi_next,g,bdry_location_idx);	 
+      
+      /* localization : bound on interface displacement during this step
+                       (max norm of the change in phi in the narrow band) */
+      LSM3D_MAX_NORM_DIFF_LOCAL(&displacement,d->phi_next,
+            &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+	    &(g->klo_gb), &(g->khi_gb),
+	    d->phi,
+	    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+	    &(g->klo_gb), &(g->khi_gb),
+	    d->index_x, d->index_y, d->index_z,
+            &(d->n_lo)[0],&(d->n_hi)[0],
+            d->narrow_band,
+	    &(g->ilo_gb), &(g->ihi_gb), &(g->jlo_gb), &(g->jhi_gb),
+            &(g->klo_gb), &(g->khi_gb),	
+            &mark_fb);
            
       /* masking enforced so that the interface stays within pore space */
       if(o->do_mask) IMPOSE_MASK_LOCAL(d->phi,d->mask,d->phi_next,g,d)
@@ -605,6 +567,10 @@ void curvatureModelMedium3dLocalMainLoop(
 	    &(d->nlo_outer_plus),  &(d->nhi_outer_plus),
 	    &(d->nlo_outer_minus), &(d->nhi_outer_minus));      
       
+      /* localization : flag narrow band for rebuild if the interface
+                       may have left the inner band */
+      updateNarrowBandManager(nb_manager,displacement,change_sgn);
+      
       if(change_sgn)
       {  /* if the sign changed, the interface is close to the narrow
             band border so reinitialization needs to be triggerred */
@@ -674,6 +640,9 @@ void curvatureModelMedium3dLocalMainLoop(
 	   {
 	      d->n_lo[i] = n_lo_copy[i];  d->n_hi[i] = n_hi_copy[i];
 	   }
+	   
+	   /* narrow band must be consistent with reinitialized phi */
+	   requestNarrowBandRebuild(nb_manager);
        }
     
       dt_sub = dt_sub + dt;
@@ -734,6 +703,9 @@ void curvatureModelMedium3dLocalMainLoop(
   fprintf(fp_out,"\nTotal steps %d   Reinit. steps %d  (change sign %d, grad_phi_ave %d)",
          TOTAL_STEP, reinit_steps,change_sgn_steps,grad_phi_ave_steps);
   fprintf(fp_out,"\nReinitialized on average every %d steps.\n",ave_reinit_steps); 
+  printNarrowBandManagerStatistics(nb_manager,fp_out);
+  
+  destroyNarrowBandManager(nb_manager);
   
 }
 
@@ -19,6 +19,7 @@
 #include "lsm_initialization3d.h"
 
 /*LSMLIB Serial headers */
+#include "lsm_async_output.h"
 #include "lsm_macros.h"
 #include "lsm_grid.h"
 
@@ -48,6 +49,8 @@ int  curvatureModelTop(
   int     n1[3], n2[3], i;
   char    fname[256];
   FILE    *fp_out; 
+  /* background writer for output of data arrays */
+  LSM_AsyncWriter *writer = NULL;
   
   LSMLIB_REAL    normalx, normaly, normalz;
   LSMLIB_REAL    pointx, pointy, pointz;
@@ -70,7 +73,7 @@ int  curvatureModelTop(
      pointx  = (grid->x_lo[0]) + 20 * (grid->dx)[0];
      pointy = pointz = 0.0; 
      
-     data_arrays->phi = (LSMLIB_REAL *)calloc(grid->num_gridpts,sizeof(LSMLIB_REAL));
+     data_arrays->phi = (LSMLIB_REAL *)calloc(grid->num_gridpts_alloc,sizeof(LSMLIB_REAL));
      createPlane(data_arrays->phi,normalx,normaly,normalz,pointx,pointy,
                                                                   pointz,grid);    					
      if(options->do_mask)
@@ -101,6 +104,18 @@ int  curvatureModelTop(
 	   return 1;			  
 	}
      }
+     
+     /* Add padding to input data arrays (see createMaskThroatFromSpheres3d) */
+     if(options->narrow_band == 0)
+     {
+        setGridAllocationPadding(grid,LSM_GRID_ALIGNMENT);
+        data_arrays->phi = (LSMLIB_REAL *)realloc(data_arrays->phi,
+                              grid->num_gridpts_alloc*sizeof(LSMLIB_REAL));
+        data_arrays->mask = (LSMLIB_REAL *)realloc(data_arrays->mask,
+                              grid->num_gridpts_alloc*sizeof(LSMLIB_REAL));
+        addDataArrayPadding(data_arrays->phi,data_arrays->phi,grid);
+        addDataArrayPadding(data_arrays->mask,data_arrays->mask,grid);
+     }
   }   
   
   /* Open output file */
@@ -121,12 +136,15 @@ int  curvatureModelTop(
   */
   if( options->save_data )
   {
+    /* data arrays are written while the simulation runs */
+    writer = createAsyncWriter(0,0);
+    
     sprintf(fname,"%s/data_init",options->path);
-    writeDataArray(data_arrays->phi,grid,fname,GZIP);
+    writeDataArrayAsync(writer,data_arrays->phi,grid,fname,GZIP);
     sprintf(fname,"%s/grid",options->path);
     writeGridToBinaryFile(grid,fname,GZIP);
     sprintf(fname,"%s/mask",options->path);
-    writeDataArray(data_arrays->mask,grid,fname,GZIP);
+    writeDataArrayAsync(writer,data_arrays->mask,grid,fname,GZIP);
   }
   
   setArrayAllocationCurvatureModel(options,data_arrays);
@@ -145,7 +163,10 @@ int  curvatureModelTop(
   if( options->save_data )
   {
     sprintf(fname,"%s/data_final",options->path);
-    writeDataArray(data_arrays->phi,grid,fname,GZIP);    
+    writeDataArrayAsync(writer,data_arrays->phi,grid,fname,GZIP);    
+    
+    /* wait for output to complete */
+    destroyAsyncWriter(writer);
   }  
  
   /* Clean up memory */
@@ -172,47 +193,32 @@ void setArrayAllocationCurvatureModel(
      Options *options,
      LSM_DataArrays *data_arrays)
 {  
-    if(options->narrow_band == 0)
-    { /* No need for narrow band (localization) storage */
-       data_arrays->narrow_band = (unsigned char *)NULL;
-       data_arrays->index_x = (int *)NULL;
-       data_arrays->index_y = (int *)NULL;
-       data_arrays->index_z = (int *)NULL;
-       data_arrays->index_outer_pts = (int *)NULL;
-    }
-        
-    if(options->b == 0)
-    { /* Second order derivatives will (presumably) not be used */
-       data_arrays->phi_xx = data_arrays->phi_xy = data_arrays->phi_yy = (LSMLIB_REAL *)NULL;
-       data_arrays->phi_zz = data_arrays->phi_xz = data_arrays->phi_yz = (LSMLIB_REAL *)NULL;
-    }
-        
-    if(options->a == 0)
-    { /* Upwinding derivatives will (presumably) not be used */
-       data_arrays->phi_x_minus  = data_arrays->phi_x_plus = (LSMLIB_REAL *)NULL;
-       data_arrays->phi_y_minus  = data_arrays->phi_y_plus = (LSMLIB_REAL *)NULL;
-       data_arrays->phi_z_minus  = data_arrays->phi_z_plus = (LSMLIB_REAL *)NULL;
-    }
+    LSM_DataArraysFeatures features;
 
-    if( options->accuracy_id != 2 )
-    { /* 3rd order differences used only for HJ ENO3 */
-       data_arrays->D3 = (LSMLIB_REAL *)NULL;
-    }
+    initializeLSMDataArraysFeatures(&features);
+    features.accuracy = options->accuracy_id;
 
-    if( options->accuracy_id <= MEDIUM )
-    {
-       data_arrays->phi_stage2 = (LSMLIB_REAL *)NULL;
-    } 
+    /* No need for narrow band (localization) storage */
+    features.localization = options->narrow_band;
 
-    if( options->do_reinit == 0)
-    {
-       data_arrays->phi0 = (LSMLIB_REAL *)NULL;
-    }
+    /* Second order derivatives will (presumably) not be used */
+    features.second_derivatives = (options->b != 0);
+
+    /* Upwinding derivatives will (presumably) not be used */
+    features.upwind_derivatives = (options->a != 0);
+
+    features.reinitialization = options->do_reinit;
+
+    /* lse_rhs is only used by the semi-implicit treatment of the   */
+    /* curvature term (otherwise the evolution uses fused TVD       */
+    /* Runge-Kutta stage kernels) and by reinitialization           */
+    features.rhs_storage = (!options->narrow_band)
+                        && options->semi_implicit_curv && (options->b > 0);
 
     /* Curvature model does not assume external velocity */
-    data_arrays->external_velocity_x = (LSMLIB_REAL *)NULL;
-    data_arrays->external_velocity_y = (LSMLIB_REAL *)NULL;
-    data_arrays->external_velocity_z = (LSMLIB_REAL *)NULL;
+    features.velocity_type = LSM_NORMAL_VELOCITY;
+
+    setLSMDataArraysFeatures(data_arrays,&features);
 }
 
 /*  createMaskThroatFromSpheres3d()
@@ -249,8 +255,14 @@ void setArrayAllocationCurvatureModel(
       x_lo[1] = -3*r/4;    x_hi[1] = 3*r/4;
       x_lo[2] =  0;        x_hi[2] = r;
       grid = createGridSetDx(dim,options->dx,x_lo,x_hi,options->accuracy_id);
+      
+      /* Align rows of data arrays.  Padding is not used with narrow 
+         banding because the localization kernels loop over the entire
+         ghostbox. */
+      if(options->narrow_band == 0)
+         setGridAllocationPadding(grid,LSM_GRID_ALIGNMENT);
       	 
-      mask = (LSMLIB_REAL*) malloc((grid->num_gridpts)*sizeof(LSMLIB_REAL));   
+      mask = (LSMLIB_REAL*) malloc((grid->num_gridpts_alloc)*sizeof(LSMLIB_REAL));   
       
       n = 3; /* number of spheres */
       
@@ -72,6 +72,7 @@ Options *createOptionsDefault(void)
   /* User additions */
   
   options->print_details = 1;
+  options->semi_implicit_curv = 0;
   
   /* end User additions */
     
@@ -107,6 +108,7 @@ Options *copyOptions(Options *options_src)
   /* User additions */
   
   options->print_details = options_src->print_details;
+  options->semi_implicit_curv = options_src->semi_implicit_curv;
     
   /* end User additions */
     
@@ -269,6 +271,18 @@ Options *createOptionsFromInputFile(char *filename)
 	  options->print_details =  1;
        }    
     }
+    else if( c == 's' && (tolower(line[n+1]) == 'e') )
+    {  /* 'semi_implicit_curv' */
+       sscanf(line+n,"%*s %d ",&tmp1);
+       if( (tmp1 == 0) || (tmp1 == 1))
+           options->semi_implicit_curv = tmp1;
+       else
+       {
+	  printf("\nIncorrect semi_implicit_curv option %d, set to default.\n",
+	                                                           tmp1);
+	  options->semi_implicit_curv =  0;
+       }    
+    }
     
     /* end User additions */
   }
@@ -307,6 +321,8 @@ void  printOptions(Options *options,FILE *fp)
   /* User additions */
   fprintf(fp,"  print_details %4d [ print details (1) or not (0)   ]\n",
                                                         options->print_details);
+  fprintf(fp,"  semi_implicit_curv %d [ semi-implicit curvature (1) or not (0) ]\n",
+                                                   options->semi_implicit_curv);
   /* end User additions */
 }
 
@@ -71,6 +71,9 @@ typedef struct _Options
    /* User additions */
    
    int    print_details;    /* whether to print details (1) or not (0) */  
+   int    semi_implicit_curv; /* treat curvature term semi-implicitly (1)
+                                or explicitly (0); only used by the
+                                full grid (narrow_band 0) version */
    
    /* end User additions */
 
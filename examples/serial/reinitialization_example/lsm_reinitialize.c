@@ -15,6 +15,7 @@
 
 /* Local headers */
 #include "LSMLIB_config.h"
+#include "lsm_async_output.h"
 #include "lsm_data_arrays.h"
 #include "lsm_macros.h"
 #include "lsm_options.h"
@@ -88,6 +89,8 @@ void reinitializeTop(
   int    idx, tmp_grid_dims1[3], tmp_grid_dims2[3], i;
   char    filename[256];
   FILE    *fp_out;                               
+  /* background writer for output of data arrays */
+  LSM_AsyncWriter *writer = NULL;
   
   time(&time0);
   
@@ -176,8 +179,11 @@ void reinitializeTop(
   /* save data if desired */
   if( options->save_data )
   {
+    /* data is written while the reinitialization runs */
+    writer = createAsyncWriter(0,0);
+    
     sprintf(filename,"%sdata_init",options->path);
-    writeDataArray(p->phi,g,filename,GZIP);
+    writeDataArrayAsync(writer,p->phi,g,filename,GZIP);
     fprintf(fp_out,"\nInitial level set function output to binary file %s",
                                                                      filename);
     sprintf(filename,"%sgrid",options->path);
@@ -192,16 +198,19 @@ void reinitializeTop(
   if( options->save_data )
   {
     sprintf(filename,"%sdata_final",options->path);
-    writeDataArray(p->phi,g,filename,GZIP);
+    writeDataArrayAsync(writer,p->phi,g,filename,GZIP);
     fprintf(fp_out,"\nFinal level set function output to binary file %s",
                                                                      filename);
     if(options->do_mask)
     {
       sprintf(filename,"%smask",options->path);
-      writeDataArray(p->mask,g,filename,GZIP);
+      writeDataArrayAsync(writer,p->mask,g,filename,GZIP);
       fprintf(fp_out,"\nMask level set function output to binary file %s",
                                                                      filename);
     }  
+    
+    /* wait for output to complete */
+    destroyAsyncWriter(writer);
   }  
  
   /* clean up memory */
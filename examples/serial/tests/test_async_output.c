@@ -0,0 +1,111 @@
+/*
+ * File:        test_async_output.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Round-trip test for asynchronous output of data arrays.
+ */
+
+/*
+ * This program requests a sequence of asynchronous writes of a data
+ * array that is modified immediately after each request (as in a time
+ * loop) and checks that each file holds the data array at the time of
+ * the request.  The limits on the number and memory of pending writes
+ * are small enough that requests must wait for the output thread.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "LSMLIB_config.h"
+#include "lsm_async_output.h"
+#include "lsm_data_arrays.h"
+#include "lsm_file.h"
+#include "lsm_grid.h"
+#include "test_utilities.h"
+
+#define NUM_WRITES  8
+
+static void setData(LSMLIB_REAL *data, int num_gridpts, int step)
+{
+  int idx;
+  for (idx = 0; idx < num_gridpts; idx++) {
+    data[idx] = cos(0.05*idx + step) - 0.1*step;
+  }
+}
+
+int main(void)
+{
+  Grid *grid;
+  LSM_AsyncWriter *writer;
+  LSMLIB_REAL *data, *expected, *data_from_file;
+  LSMLIB_REAL x_lo[3] = {-1.0, -1.0, -1.0};
+  LSMLIB_REAL x_hi[3] = {1.0, 1.0, 1.0};
+  LSMLIB_REAL threshold = 0.5, threshold_from_file;
+  int grid_dims[3] = {24, 20, 16};
+  int grid_dims_from_file[3];
+  int step, idx;
+  long long data_size;
+  char file_name[256], test_name[256];
+  int num_failures = 0;
+
+  grid = createGridSetGridDims(3, grid_dims, x_lo, x_hi, MEDIUM);
+  data_size = grid->num_gridpts*sizeof(LSMLIB_REAL);
+  data = (LSMLIB_REAL *) malloc(data_size);
+  expected = (LSMLIB_REAL *) malloc(data_size);
+
+  /* at most two pending writes and 1.5 data arrays of buffer memory */
+  writer = createAsyncWriter(2, 3*data_size/2);
+
+  printf("Asynchronous output\n");
+  for (step = 0; step < NUM_WRITES; step++) {
+    setData(data, grid->num_gridpts, step);
+    sprintf(file_name, "test_async_output_%d.dat", step);
+    if (step % 2 == 0) {
+      writeDataArrayAsync(writer, data, grid, file_name,
+                          (step % 4 == 0) ? NO_ZIP : GZIP);
+    } else {
+      writeDataArrayNarrowBandAsync(writer, data, grid, threshold,
+                                    file_name, NO_ZIP);
+    }
+
+    /* overwrite the data array before the write completes */
+    for (idx = 0; idx < grid->num_gridpts; idx++) data[idx] = -999.0;
+  }
+  destroyAsyncWriter(writer);
+
+  for (step = 0; step < NUM_WRITES; step++) {
+    setData(expected, grid->num_gridpts, step);
+    if (step % 4 == 2) {
+      sprintf(file_name, "test_async_output_%d.dat.gz", step);
+    } else {
+      sprintf(file_name, "test_async_output_%d.dat", step);
+    }
+
+    if (step % 2 == 0) {
+      sprintf(test_name, "writeDataArrayAsync() (step %d)", step);
+      data_from_file = readDataArray(grid_dims_from_file, file_name);
+    } else {
+      sprintf(test_name, "writeDataArrayNarrowBandAsync() (step %d)", step);
+      data_from_file = readDataArrayNarrowBand(
+        grid_dims_from_file, &threshold_from_file, file_name);
+      for (idx = 0; idx < grid->num_gridpts; idx++) {
+        if (expected[idx] >= threshold) expected[idx] = threshold;
+        if (expected[idx] <= -threshold) expected[idx] = -threshold;
+      }
+    }
+
+    num_failures += checkDataArray(test_name, data_from_file, expected,
+                                   grid->num_gridpts);
+    free(data_from_file);
+    remove(file_name);
+  }
+
+  free(expected);
+  free(data);
+  destroyGrid(grid);
+
+  return finishTests(num_failures);
+}
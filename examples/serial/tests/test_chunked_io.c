@@ -0,0 +1,223 @@
+/*
+ * File:        test_chunked_io.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Round-trip test for chunked data files.
+ */
+
+/*
+ * This program writes a 3D data array to chunked data files (with and
+ * without compression) and checks that
+ *  - the Grid stored in the file matches the original Grid,
+ *  - the full data array, a sub-box, and a z-slice read from the file
+ *    match the original data array,
+ *  - repeatedly rewritten sub-boxes are read back correctly and the
+ *    rewritten chunks reuse their space in the file, and
+ *  - padded data arrays (see setGridAllocationPadding()) are written
+ *    without their padding.
+ *
+ * The chunk size is chosen so that the grid does not divide evenly
+ * into chunks.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "LSMLIB_config.h"
+#include "lsm_chunked_io.h"
+#include "lsm_data_arrays.h"
+#include "lsm_file.h"
+#include "lsm_grid.h"
+#include "test_utilities.h"
+
+static int checkGrid(char *test_name, Grid *grid, Grid *expected)
+{
+  int dir;
+  int num_errors = 0;
+  for (dir = 0; dir < 3; dir++) {
+    if ( (grid->grid_dims_ghostbox[dir] != expected->grid_dims_ghostbox[dir])
+      || (grid->dx[dir] != expected->dx[dir])
+      || (grid->x_lo[dir] != expected->x_lo[dir]) ) num_errors++;
+  }
+  if ( (grid->num_dims != expected->num_dims)
+    || (grid->ilo_fb != expected->ilo_fb)
+    || (grid->khi_fb != expected->khi_fb)
+    || (grid->num_gridpts != expected->num_gridpts) ) num_errors++;
+
+  /* the Grid read from the file describes unpadded data arrays */
+  if (grid->num_gridpts_alloc != grid->num_gridpts) num_errors++;
+
+  return checkCondition(test_name, num_errors == 0);
+}
+
+/* extract the sub-box [lo,hi] of a data array laid out as the ghostbox */
+static void extractBox(LSMLIB_REAL *box_data, LSMLIB_REAL *data,
+                       Grid *grid, int *lo, int *hi)
+{
+  int i, j, k;
+  int nx = grid->grid_dims_ghostbox[0];
+  int ny = grid->grid_dims_ghostbox[1];
+  int idx = 0;
+  for (k = lo[2]; k <= hi[2]; k++) {
+    for (j = lo[1]; j <= hi[1]; j++) {
+      for (i = lo[0]; i <= hi[0]; i++) {
+        box_data[idx++] = data[i + nx*(j + ny*k)];
+      }
+    }
+  }
+}
+
+int main(void)
+{
+  Grid *grid, *grid_from_file;
+  LSM_ChunkedFile *chunked_file;
+  LSMLIB_REAL *data, *data_from_file, *box_data, *expected, *padded_data;
+  LSMLIB_REAL x_lo[3] = {-1.0, -1.0, -1.0};
+  LSMLIB_REAL x_hi[3] = {1.0, 1.0, 1.0};
+  int grid_dims[3] = {21, 17, 13};
+  int chunk_dims[3] = {8, 8, 8};
+  int box_lo[3] = {3, 5, 2};
+  int box_hi[3] = {14, 9, 11};
+  int zip_status, pass;
+  int i, j, k, idx, nx, ny, nz, box_size;
+  long file_size[2];
+  char file_name[] = "test_chunked_io.dat";
+  int num_failures = 0;
+
+  grid = createGridSetGridDims(3, grid_dims, x_lo, x_hi, MEDIUM);
+  nx = grid->grid_dims_ghostbox[0];
+  ny = grid->grid_dims_ghostbox[1];
+  nz = grid->grid_dims_ghostbox[2];
+
+  data = (LSMLIB_REAL *) malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  data_from_file =
+    (LSMLIB_REAL *) malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  box_data = (LSMLIB_REAL *) malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  expected = (LSMLIB_REAL *) malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  for (idx = 0; idx < grid->num_gridpts; idx++) {
+    data[idx] = sin(0.1*idx) + 0.001*idx;
+  }
+
+  for (zip_status = NO_ZIP; zip_status <= GZIP; zip_status++) {
+
+    printf("Chunked data files (%s)\n",
+           zip_status == GZIP ? "GZIP" : "NO_ZIP");
+
+    writeDataArrayChunked(data, grid, file_name, chunk_dims, zip_status);
+    chunked_file = openChunkedFile(file_name);
+    if (!chunked_file) {
+      num_failures += checkCondition("open chunked file", 0);
+      continue;
+    }
+
+    grid_from_file = readGridFromChunkedFile(chunked_file);
+    num_failures += checkGrid("Grid stored in file", grid_from_file, grid);
+    destroyGrid(grid_from_file);
+
+    for (idx = 0; idx < grid->num_gridpts; idx++) data_from_file[idx] = 0;
+    box_lo[0] = box_lo[1] = box_lo[2] = 0;
+    box_hi[0] = nx-1; box_hi[1] = ny-1; box_hi[2] = nz-1;
+    readChunkedFileBox(chunked_file, data_from_file, box_lo, box_hi);
+    num_failures += checkDataArray("full data array", data_from_file, data,
+                                grid->num_gridpts);
+
+    box_lo[0] = 3;  box_lo[1] = 5; box_lo[2] = 2;
+    box_hi[0] = 14; box_hi[1] = 9; box_hi[2] = 11;
+    box_size = (box_hi[0]-box_lo[0]+1)*(box_hi[1]-box_lo[1]+1)
+             * (box_hi[2]-box_lo[2]+1);
+    readChunkedFileBox(chunked_file, data_from_file, box_lo, box_hi);
+    extractBox(box_data, data, grid, box_lo, box_hi);
+    num_failures += checkDataArray("sub-box", data_from_file, box_data,
+                                box_size);
+
+    k = 9;
+    readChunkedFileZSlice(chunked_file, data_from_file, k);
+    num_failures += checkDataArray("z-slice", data_from_file, data + nx*ny*k,
+                                nx*ny);
+
+    closeChunkedFile(chunked_file);
+
+    /* rewrite a sub-box several times */
+    for (pass = 0; pass < 2; pass++) {
+      chunked_file = createChunkedFile(file_name, grid, chunk_dims,
+                                       zip_status);
+      box_lo[0] = box_lo[1] = box_lo[2] = 0;
+      box_hi[0] = nx-1; box_hi[1] = ny-1; box_hi[2] = nz-1;
+      writeChunkedFileBox(chunked_file, data, box_lo, box_hi);
+
+      box_lo[0] = 3;  box_lo[1] = 5; box_lo[2] = 2;
+      box_hi[0] = 14; box_hi[1] = 9; box_hi[2] = 11;
+      for (i = 0; i < 5*pass; i++) {
+        for (idx = 0; idx < box_size; idx++) {
+          box_data[idx] = (LSMLIB_REAL) (i*box_size + idx);
+        }
+        writeChunkedFileBox(chunked_file, box_data, box_lo, box_hi);
+      }
+      closeChunkedFile(chunked_file);
+
+      file_size[pass] = 0;
+      {
+        FILE *fp = fopen(file_name, "rb");
+        if (fp) {
+          fseek(fp, 0, SEEK_END);
+          file_size[pass] = ftell(fp);
+          fclose(fp);
+        }
+      }
+    }
+
+    /* expected data array after the rewrites */
+    for (idx = 0; idx < grid->num_gridpts; idx++) {
+      expected[idx] = data[idx];
+    }
+    idx = 0;
+    for (k = box_lo[2]; k <= box_hi[2]; k++) {
+      for (j = box_lo[1]; j <= box_hi[1]; j++) {
+        for (i = box_lo[0]; i <= box_hi[0]; i++) {
+          expected[i + nx*(j + ny*k)] = box_data[idx++];
+        }
+      }
+    }
+    chunked_file = openChunkedFile(file_name);
+    box_lo[0] = box_lo[1] = box_lo[2] = 0;
+    box_hi[0] = nx-1; box_hi[1] = ny-1; box_hi[2] = nz-1;
+    readChunkedFileBox(chunked_file, data_from_file, box_lo, box_hi);
+    closeChunkedFile(chunked_file);
+    num_failures += checkDataArray("rewritten sub-box", data_from_file,
+                                expected, grid->num_gridpts);
+
+    /* uncompressed chunks always fit in their original space */
+    if (zip_status == NO_ZIP) {
+      num_failures += checkCondition("rewritten chunks reuse space",
+                                     file_size[1] == file_size[0]);
+    }
+  }
+
+  /* padded data arrays */
+  printf("Padded data arrays\n");
+  setGridAllocationPadding(grid, LSM_GRID_ALIGNMENT);
+  padded_data =
+    (LSMLIB_REAL *) malloc(grid->num_gridpts_alloc*sizeof(LSMLIB_REAL));
+  addDataArrayPadding(padded_data, data, grid);
+  writeDataArrayChunked(padded_data, grid, file_name, NULL, NO_ZIP);
+  chunked_file = openChunkedFile(file_name);
+  box_lo[0] = box_lo[1] = box_lo[2] = 0;
+  box_hi[0] = nx-1; box_hi[1] = ny-1; box_hi[2] = nz-1;
+  readChunkedFileBox(chunked_file, data_from_file, box_lo, box_hi);
+  closeChunkedFile(chunked_file);
+  num_failures += checkDataArray("padded data array", data_from_file, data,
+                              grid->num_gridpts);
+
+  remove(file_name);
+  free(padded_data);
+  free(expected);
+  free(box_data);
+  free(data_from_file);
+  free(data);
+  destroyGrid(grid);
+
+  return finishTests(num_failures);
+}
@@ -0,0 +1,150 @@
+/*
+ * File:        test_compressed_io.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Round-trip test for compressed data files.
+ */
+
+/*
+ * This program writes a 3D data array and its Grid to gzip-compressed
+ * files and checks that
+ *  - only the compressed files (<name>.gz) are left on disk and they
+ *    start with the gzip header,
+ *  - the data array and the Grid read from the compressed files match
+ *    the originals and the compressed files are kept after reading,
+ *  - data files compressed by the external gzip program (as written
+ *    by earlier versions of LSMLIB) are read correctly, and
+ *  - LSM_FILE streams handle sequences of writes and reads.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "LSMLIB_config.h"
+#include "lsm_data_arrays.h"
+#include "lsm_file.h"
+#include "lsm_grid.h"
+#include "test_utilities.h"
+
+/* returns 1 if the file exists */
+static int fileExists(char *file_name)
+{
+  FILE *fp = fopen(file_name,"rb");
+  if (!fp) return 0;
+  fclose(fp);
+  return 1;
+}
+
+/* returns 1 if the file starts with the gzip header (0x1f 0x8b) */
+static int isGzipFile(char *file_name)
+{
+  unsigned char magic[2] = {0, 0};
+  FILE *fp = fopen(file_name,"rb");
+  if (!fp) return 0;
+  fread(magic, 1, 2, fp);
+  fclose(fp);
+  return (magic[0] == 0x1f) && (magic[1] == 0x8b);
+}
+
+int main(void)
+{
+  Grid *grid, *grid_from_file;
+  LSM_FILE *fp;
+  LSMLIB_REAL *data, *data_from_file;
+  LSMLIB_REAL x_lo[3] = {-1.0, -1.0, -1.0};
+  LSMLIB_REAL x_hi[3] = {1.0, 1.0, 1.0};
+  int grid_dims[3] = {25, 19, 14};
+  int grid_dims_from_file[3];
+  int header[2] = {7, 11}, header_from_file[2];
+  char command[256];
+  int idx, num_read;
+  int num_failures = 0;
+
+  grid = createGridSetGridDims(3, grid_dims, x_lo, x_hi, MEDIUM);
+  data = (LSMLIB_REAL *)malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  for (idx = 0; idx < grid->num_gridpts; idx++) {
+    data[idx] = sin(0.01*idx) + 0.001*idx;
+  }
+
+  printf("Compressed data files\n");
+
+  /* data array */
+  remove("test_compressed_io.dat");
+  remove("test_compressed_io.dat.gz");
+  writeDataArray(data, grid, "test_compressed_io.dat", GZIP);
+  num_failures += checkCondition("writeDataArray() leaves only .gz file",
+    !fileExists("test_compressed_io.dat")
+    && isGzipFile("test_compressed_io.dat.gz"));
+
+  data_from_file = readDataArray(grid_dims_from_file,
+                                 "test_compressed_io.dat.gz");
+  num_failures += checkDataArray("readDataArray()",
+    data_from_file, data, grid->num_gridpts);
+  num_failures += checkCondition("readDataArray() keeps .gz file",
+    !fileExists("test_compressed_io.dat")
+    && isGzipFile("test_compressed_io.dat.gz"));
+  free(data_from_file);
+
+  /* Grid */
+  remove("test_compressed_io.grid.gz");
+  writeGridToBinaryFile(grid, "test_compressed_io.grid", GZIP);
+  grid_from_file = readGridFromBinaryFile("test_compressed_io.grid.gz");
+  num_failures += checkCondition("writeGridToBinaryFile()/"
+                                 "readGridFromBinaryFile()",
+    grid_from_file
+    && (grid_from_file->num_dims == grid->num_dims)
+    && (grid_from_file->num_gridpts == grid->num_gridpts)
+    && (grid_from_file->grid_dims_ghostbox[0] == grid->grid_dims_ghostbox[0])
+    && (grid_from_file->grid_dims_ghostbox[1] == grid->grid_dims_ghostbox[1])
+    && (grid_from_file->grid_dims_ghostbox[2] == grid->grid_dims_ghostbox[2])
+    && (grid_from_file->dx[0] == grid->dx[0])
+    && (grid_from_file->x_lo[2] == grid->x_lo[2]));
+  if (grid_from_file) destroyGrid(grid_from_file);
+
+  /* data file compressed by the external gzip program */
+  remove("test_compressed_io_legacy.dat.gz");
+  writeDataArray(data, grid, "test_compressed_io_legacy.dat", NO_ZIP);
+  sprintf(command,"gzip -f %s","test_compressed_io_legacy.dat");
+  if (system(command) == 0) {
+    data_from_file = readDataArray(grid_dims_from_file,
+                                   "test_compressed_io_legacy.dat.gz");
+    num_failures += checkDataArray("readDataArray() (external gzip)",
+      data_from_file, data, grid->num_gridpts);
+    free(data_from_file);
+  } else {
+    printf("  %-60s %s\n", "readDataArray() (external gzip)", "skipped");
+  }
+
+  /* sequence of writes and reads on an LSM_FILE stream */
+  fp = openLSMFileForWriting("test_compressed_io_stream.dat", GZIP);
+  writeLSMFile(header, sizeof(int), 2, fp);
+  writeLSMFile(data, sizeof(LSMLIB_REAL), grid->num_gridpts, fp);
+  closeLSMFile(fp);
+
+  data_from_file =
+    (LSMLIB_REAL *)malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  fp = openLSMFileForReading("test_compressed_io_stream.dat.gz");
+  num_read = fp ? readLSMFile(header_from_file, sizeof(int), 2, fp) : 0;
+  num_failures += checkCondition("readLSMFile() (header)",
+    (num_read == 2) && (header_from_file[0] == header[0])
+    && (header_from_file[1] == header[1]));
+  num_read = fp ? readLSMFile(data_from_file, sizeof(LSMLIB_REAL),
+                              grid->num_gridpts, fp) : 0;
+  num_failures += checkCondition("readLSMFile() (data array)",
+    num_read == grid->num_gridpts);
+  num_failures += checkDataArray("readLSMFile() (data array values)",
+    data_from_file, data, grid->num_gridpts);
+  num_read = fp ? readLSMFile(header_from_file, sizeof(int), 1, fp) : 1;
+  num_failures += checkCondition("readLSMFile() (end of file)",
+    num_read == 0);
+  closeLSMFile(fp);
+  free(data_from_file);
+
+  free(data);
+  destroyGrid(grid);
+
+  return finishTests(num_failures);
+}
@@ -0,0 +1,179 @@
+/*
+ * File:        test_data_array_view.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Test for views of application-owned data arrays.
+ */
+
+/*
+ * This program checks that the functions that accept an
+ * LSM_DataArrayView give the same results as the corresponding
+ * functions for data arrays laid out as specified by the Grid:
+ *  - copyArrayToDataArrayView() followed by copyDataArrayViewToArray()
+ *    recovers the original data array,
+ *  - the boundary condition *View() functions applied to a strided
+ *    view fill the ghostcells in the same way as the functions for
+ *    contiguous data arrays, and
+ *  - computeDistanceFunctionView() applied to strided and contiguous
+ *    views gives the same distance function as
+ *    computeDistanceFunction3d().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "LSMLIB_config.h"
+#include "lsm_boundary_conditions.h"
+#include "lsm_data_array_view.h"
+#include "lsm_fast_marching_method.h"
+#include "lsm_grid.h"
+#include "test_utilities.h"
+
+/* set phi in the interior and garbage in the ghostcells */
+static void setPhi(LSMLIB_REAL *phi, Grid *grid)
+{
+  int i, j, k, idx;
+  int nx = grid->grid_dims_ghostbox[0];
+  int ny = grid->grid_dims_ghostbox[1];
+  int nz = grid->grid_dims_ghostbox[2];
+  int ng = grid->ilo_fb - grid->ilo_gb;
+  LSMLIB_REAL x, y, z;
+
+  for (k = 0; k < nz; k++) {
+    for (j = 0; j < ny; j++) {
+      for (i = 0; i < nx; i++) {
+        idx = i + nx*(j + ny*k);
+        if ( (i < ng) || (i >= nx-ng) || (j < ng) || (j >= ny-ng)
+          || (k < ng) || (k >= nz-ng) ) {
+          phi[idx] = 1000.0 + idx;
+        } else {
+          x = grid->x_lo_ghostbox[0] + i*grid->dx[0];
+          y = grid->x_lo_ghostbox[1] + j*grid->dx[1];
+          z = grid->x_lo_ghostbox[2] + k*grid->dx[2];
+          phi[idx] = (x-0.2)*(x-0.2) + 2.0*y*y + (z+0.1)*(z+0.1) - 0.25;
+        }
+      }
+    }
+  }
+}
+
+int main(void)
+{
+  Grid *grid;
+  LSM_DataArrayView phi_view, dist_view;
+  LSMLIB_REAL *phi, *dist, *expected, *phi_strided, *dist_strided;
+  LSMLIB_REAL x_lo[3] = {-1.0, -1.0, -1.0};
+  LSMLIB_REAL x_hi[3] = {1.0, 1.0, 1.0};
+  int grid_dims[3] = {25, 19, 14};
+  int strides[3];
+  int nx, ny, nz, num_alloc, bc, bdry, n, err;
+  char test_name[256];
+  char *bc_names[4] = {"linearExtrapolationBCView()",
+                       "signedLinearExtrapolationBCView()",
+                       "copyExtrapolationBCView()",
+                       "homogeneousNeumannBCView()"};
+  int bdry_locations[3] = {ALL_BOUNDARIES, X_HI, Y_LO_AND_Y_HI};
+  int num_failures = 0;
+
+  grid = createGridSetGridDims(3, grid_dims, x_lo, x_hi, MEDIUM);
+  nx = grid->grid_dims_ghostbox[0];
+  ny = grid->grid_dims_ghostbox[1];
+  nz = grid->grid_dims_ghostbox[2];
+
+  phi = (LSMLIB_REAL *) malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  dist = (LSMLIB_REAL *) malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  expected = (LSMLIB_REAL *) malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+
+  /* application-owned data arrays with padded rows and planes */
+  strides[0] = 1;
+  strides[1] = nx + 5;
+  strides[2] = strides[1]*(ny + 3);
+  num_alloc = strides[2]*nz;
+  phi_strided = (LSMLIB_REAL *) malloc(num_alloc*sizeof(LSMLIB_REAL));
+  dist_strided = (LSMLIB_REAL *) malloc(num_alloc*sizeof(LSMLIB_REAL));
+  for (n = 0; n < num_alloc; n++) {
+    phi_strided[n] = -12345.0;
+    dist_strided[n] = -12345.0;
+  }
+
+  printf("Data array views\n");
+
+  err = initializeDataArrayView(&phi_view, phi_strided, grid, NULL,
+                                strides);
+  err += initializeDataArrayView(&dist_view, dist_strided, grid, NULL,
+                                 strides);
+  num_failures += checkCondition("initializeDataArrayView()",
+    !err && !dataArrayViewIsContiguous(&phi_view));
+
+  /* copy to and from a strided view */
+  setPhi(phi, grid);
+  copyArrayToDataArrayView(&phi_view, phi);
+  copyDataArrayViewToArray(expected, &phi_view);
+  num_failures += checkDataArray("copy to and from strided view", expected,
+                              phi, grid->num_gridpts);
+
+  /* boundary conditions */
+  for (bc = 0; bc < 4; bc++) {
+    for (n = 0; n < 3; n++) {
+      bdry = bdry_locations[n];
+
+      setPhi(expected, grid);
+      setPhi(phi, grid);
+      copyArrayToDataArrayView(&phi_view, phi);
+      switch (bc) {
+        case 0:
+          linearExtrapolationBC(expected, grid, bdry);
+          linearExtrapolationBCView(&phi_view, grid, bdry);
+          break;
+        case 1:
+          signedLinearExtrapolationBC(expected, grid, bdry);
+          signedLinearExtrapolationBCView(&phi_view, grid, bdry);
+          break;
+        case 2:
+          copyExtrapolationBC(expected, grid, bdry);
+          copyExtrapolationBCView(&phi_view, grid, bdry);
+          break;
+        default:
+          homogeneousNeumannBC(expected, grid, bdry);
+          homogeneousNeumannBCView(&phi_view, grid, bdry);
+      }
+      copyDataArrayViewToArray(phi, &phi_view);
+      sprintf(test_name, "%s (boundary location %d)", bc_names[bc], bdry);
+      num_failures += checkDataArray(test_name, phi, expected,
+                                  grid->num_gridpts);
+    }
+  }
+
+  /* distance function: contiguous data arrays */
+  setPhi(phi, grid);
+  copyExtrapolationBC(phi, grid, ALL_BOUNDARIES);
+  computeDistanceFunction3d(expected, phi, NULL, 2,
+                            grid->grid_dims_ghostbox, grid->dx);
+
+  /* distance function: strided views */
+  copyArrayToDataArrayView(&phi_view, phi);
+  computeDistanceFunctionView(&dist_view, &phi_view, NULL, 2, grid);
+  copyDataArrayViewToArray(dist, &dist_view);
+  num_failures += checkDataArray("computeDistanceFunctionView() (strided)",
+                              dist, expected, grid->num_gridpts);
+
+  /* distance function: contiguous views (used in place) */
+  initializeDataArrayView(&phi_view, phi, grid, NULL, NULL);
+  initializeDataArrayView(&dist_view, dist, grid, NULL, NULL);
+  for (n = 0; n < grid->num_gridpts; n++) dist[n] = 0.0;
+  computeDistanceFunctionView(&dist_view, &phi_view, NULL, 2, grid);
+  num_failures += checkDataArray("computeDistanceFunctionView() (contiguous)",
+                              dist, expected, grid->num_gridpts);
+
+  free(dist_strided);
+  free(phi_strided);
+  free(expected);
+  free(dist);
+  free(phi);
+  destroyGrid(grid);
+
+  return finishTests(num_failures);
+}
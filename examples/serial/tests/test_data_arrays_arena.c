@@ -0,0 +1,171 @@
+/*
+ * File:        test_data_arrays_arena.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Test for allocation of LSM_DataArrays from an arena.
+ */
+
+/*
+ * This program allocates the data arrays of an LSM_DataArrays structure
+ * for a reduced set of features on a padded 3D grid and checks that
+ *  - the data arrays required by the features are allocated, aligned
+ *    to LSM_DATA_ARRAYS_ALIGNMENT bytes, and zero-initialized,
+ *  - the data arrays that are not required are not allocated,
+ *  - the allocated data arrays do not overlap, and
+ *  - a data array from the arena survives a round trip through
+ *    writeDataArray() and readDataArray().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "LSMLIB_config.h"
+#include "lsm_data_arrays.h"
+#include "lsm_file.h"
+#include "lsm_grid.h"
+#include "test_utilities.h"
+
+int main(void)
+{
+  Grid *grid;
+  LSM_DataArrays *lsm_data_arrays;
+  LSM_DataArraysFeatures features;
+  LSMLIB_REAL x_lo[3] = {-1.0, -1.0, -1.0};
+  LSMLIB_REAL x_hi[3] = {1.0, 1.0, 1.0};
+  int grid_dims[3] = {30, 22, 18};
+  int grid_dims_from_file[3];
+  LSMLIB_REAL *required[20];
+  void *skipped[10];
+  LSMLIB_REAL *phi_unpadded, *data_from_file;
+  int num_required, num_skipped;
+  int n, idx, num_errors;
+  char file_name[] = "test_data_arrays_arena.dat";
+  int num_failures = 0;
+
+  grid = createGridSetGridDims(3, grid_dims, x_lo, x_hi, MEDIUM);
+  setGridAllocationPadding(grid, LSM_GRID_ALIGNMENT);
+
+  /* second-order calculation with normal velocity only */
+  initializeLSMDataArraysFeatures(&features);
+  features.accuracy = MEDIUM;
+  features.second_derivatives = 0;
+  features.velocity_type = LSM_NORMAL_VELOCITY;
+  features.localization = 0;
+  features.reinitialization = 0;
+  features.mask = 0;
+  features.solid = 0;
+  features.extra_storage = 0;
+
+  lsm_data_arrays = allocateLSMDataArrays();
+  setLSMDataArraysFeatures(lsm_data_arrays, &features);
+  allocateMemoryForLSMDataArrays(lsm_data_arrays, grid);
+
+  num_required = 0;
+  required[num_required++] = lsm_data_arrays->phi;
+  required[num_required++] = lsm_data_arrays->phi_stage1;
+  required[num_required++] = lsm_data_arrays->phi_next;
+  required[num_required++] = lsm_data_arrays->phi_prev;
+  required[num_required++] = lsm_data_arrays->lse_rhs;
+  required[num_required++] = lsm_data_arrays->phi_x_plus;
+  required[num_required++] = lsm_data_arrays->phi_x_minus;
+  required[num_required++] = lsm_data_arrays->phi_y_plus;
+  required[num_required++] = lsm_data_arrays->phi_y_minus;
+  required[num_required++] = lsm_data_arrays->phi_z_plus;
+  required[num_required++] = lsm_data_arrays->phi_z_minus;
+  required[num_required++] = lsm_data_arrays->D1;
+  required[num_required++] = lsm_data_arrays->D2;
+  required[num_required++] = lsm_data_arrays->normal_velocity;
+
+  num_skipped = 0;
+  skipped[num_skipped++] = lsm_data_arrays->phi_stage2;
+  skipped[num_skipped++] = lsm_data_arrays->D3;
+  skipped[num_skipped++] = lsm_data_arrays->phi_xx;
+  skipped[num_skipped++] = lsm_data_arrays->external_velocity_x;
+  skipped[num_skipped++] = lsm_data_arrays->phi0;
+  skipped[num_skipped++] = lsm_data_arrays->mask;
+  skipped[num_skipped++] = lsm_data_arrays->phi_extra;
+  skipped[num_skipped++] = lsm_data_arrays->narrow_band;
+  skipped[num_skipped++] = lsm_data_arrays->solid_normal_x;
+
+  printf("LSM_DataArrays arena\n");
+
+  /* required data arrays are allocated, aligned, and zero-initialized */
+  num_errors = 0;
+  for (n = 0; n < num_required; n++) {
+    if (!required[n]) {
+      num_errors++;
+      continue;
+    }
+    if (((size_t) required[n]) % LSM_DATA_ARRAYS_ALIGNMENT != 0) {
+      num_errors++;
+    }
+    for (idx = 0; idx < grid->num_gridpts_alloc; idx++) {
+      if (required[n][idx] != 0) {
+        num_errors++;
+        break;
+      }
+    }
+  }
+  num_failures += checkCondition(
+    "required data arrays allocated and aligned", num_errors == 0);
+
+  /* data arrays that are not required are not allocated */
+  num_errors = 0;
+  for (n = 0; n < num_skipped; n++) {
+    if (skipped[n]) num_errors++;
+  }
+  num_failures += checkCondition(
+    "data arrays not required are not allocated", num_errors == 0);
+
+  /* data arrays do not overlap */
+  for (n = 0; n < num_required; n++) {
+    for (idx = 0; idx < grid->num_gridpts_alloc; idx++) {
+      required[n][idx] = (LSMLIB_REAL) (n + 1);
+    }
+  }
+  num_errors = 0;
+  for (n = 0; n < num_required; n++) {
+    for (idx = 0; idx < grid->num_gridpts_alloc; idx++) {
+      if (required[n][idx] != (LSMLIB_REAL) (n + 1)) {
+        num_errors++;
+        break;
+      }
+    }
+  }
+  num_failures += checkCondition(
+    "data arrays do not overlap", num_errors == 0);
+
+  /* round trip of a padded data array from the arena */
+  for (idx = 0; idx < grid->num_gridpts_alloc; idx++) {
+    lsm_data_arrays->phi[idx] = sin(0.01*idx);
+  }
+  phi_unpadded =
+    (LSMLIB_REAL *) malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  removeDataArrayPadding(phi_unpadded, lsm_data_arrays->phi, grid);
+  writeDataArray(lsm_data_arrays->phi, grid, file_name, NO_ZIP);
+  data_from_file = readDataArray(grid_dims_from_file, file_name);
+  num_errors = 0;
+  if (!data_from_file) {
+    num_errors++;
+  } else {
+    for (idx = 0; idx < grid->num_gridpts; idx++) {
+      if (data_from_file[idx] != phi_unpadded[idx]) {
+        num_errors++;
+        break;
+      }
+    }
+  }
+  num_failures += checkCondition(
+    "writeDataArray()/readDataArray() round trip", num_errors == 0);
+  remove(file_name);
+
+  free(data_from_file);
+  free(phi_unpadded);
+  destroyLSMDataArrays(lsm_data_arrays);
+  destroyGrid(grid);
+
+  return finishTests(num_failures);
+}
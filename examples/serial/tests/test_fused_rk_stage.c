@@ -0,0 +1,287 @@
+/*
+ * File:        test_fused_rk_stage.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Test for the fused TVD Runge-Kutta stage kernels.
+ */
+
+/*
+ * This program advances 2D data arrays through single TVD Runge-Kutta
+ * stages with the fused stage kernels (which never store the RHS of
+ * the level set equation) and checks that they agree with the
+ * LSM2D_ADD_*_TO_LSE_RHS() and LSM2D_TVD_RK*() kernels for
+ *  - an advection term (second stage of TVD-RK2),
+ *  - a normal velocity term (second stage of TVD-RK3),
+ *  - constant normal velocity and curvature terms (forward Euler
+ *    step and third stage of TVD-RK3), and
+ *  - the normal velocity term computed in place (u_out = u_stage).
+ *
+ * Values outside of the fillbox must not be modified.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "LSMLIB_config.h"
+#include "lsm_level_set_evolution2d.h"
+#include "lsm_tvd_runge_kutta2d.h"
+#include "test_utilities.h"
+
+#define NX 21
+#define NY 17
+#define NUM_GRIDPTS (NX*NY)
+
+/* returns the max norm of data - expected */
+static LSMLIB_REAL maxDifference(LSMLIB_REAL *data, LSMLIB_REAL *expected)
+{
+  LSMLIB_REAL err, max_err = 0.0;
+  int idx;
+
+  for (idx = 0; idx < NUM_GRIDPTS; idx++) {
+    err = fabs(data[idx] - expected[idx]);
+    if (err > max_err) max_err = err;
+  }
+
+  return max_err;
+}
+
+/* sets data to a smooth function that changes sign */
+static void setDataArray(LSMLIB_REAL *data, LSMLIB_REAL a, LSMLIB_REAL b)
+{
+  int idx;
+
+  for (idx = 0; idx < NUM_GRIDPTS; idx++) {
+    data[idx] = sin(a*idx + b) + 0.1*cos(0.37*idx);
+  }
+}
+
+/* copies src to dst */
+static void copyDataArray(LSMLIB_REAL *dst, LSMLIB_REAL *src)
+{
+  int idx;
+
+  for (idx = 0; idx < NUM_GRIDPTS; idx++) dst[idx] = src[idx];
+}
+
+int main(void)
+{
+  LSMLIB_REAL *u_cur, *u_stage, *u_out, *u_expected, *rhs;
+  LSMLIB_REAL *phi_x, *phi_y, *phi_x_plus, *phi_y_plus;
+  LSMLIB_REAL *phi_x_minus, *phi_y_minus;
+  LSMLIB_REAL *phi_xx, *phi_xy, *phi_yy;
+  LSMLIB_REAL *vel_x, *vel_y, *vel_n;
+  LSMLIB_REAL dt = 0.05, alpha, vel_n_const, b;
+  LSMLIB_REAL tol = 1.0e-13;
+  int ilo_gb = 0, ihi_gb = NX-1, jlo_gb = 0, jhi_gb = NY-1;
+  int ilo_fb = 3, ihi_fb = NX-4, jlo_fb = 3, jhi_fb = NY-4;
+  int num_failures = 0;
+
+  u_cur = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  u_stage = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  u_out = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  u_expected = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  rhs = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  phi_x = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  phi_y = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  phi_x_plus = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  phi_y_plus = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  phi_x_minus = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  phi_y_minus = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  phi_xx = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  phi_xy = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  phi_yy = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  vel_x = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  vel_y = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+  vel_n = (LSMLIB_REAL *)malloc(NUM_GRIDPTS*sizeof(LSMLIB_REAL));
+
+  setDataArray(u_cur, 0.011, 0.2);
+  setDataArray(u_stage, 0.013, -0.4);
+  setDataArray(phi_x, 0.07, 0.1);
+  setDataArray(phi_y, 0.05, 1.3);
+  setDataArray(phi_x_plus, 0.03, 0.5);
+  setDataArray(phi_y_plus, 0.09, -1.1);
+  setDataArray(phi_x_minus, 0.02, 2.0);
+  setDataArray(phi_y_minus, 0.06, 0.7);
+  setDataArray(phi_xx, 0.04, -0.3);
+  setDataArray(phi_xy, 0.08, 0.9);
+  setDataArray(phi_yy, 0.015, 1.7);
+  setDataArray(vel_x, 0.025, -2.2);
+  setDataArray(vel_y, 0.035, 0.6);
+  setDataArray(vel_n, 0.045, 1.1);
+
+  printf("Fused TVD Runge-Kutta stage kernels\n");
+
+  /* advection term, second stage of TVD-RK2 */
+  LSM2D_ZERO_OUT_LEVEL_SET_EQN_RHS(rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb);
+  LSM2D_ADD_ADVECTION_TERM_TO_LSE_RHS(
+    rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x, phi_y, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    vel_x, vel_y, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb);
+  copyDataArray(u_expected, u_cur);
+  LSM2D_TVD_RK2_STAGE2(
+    u_expected, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_stage, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_cur, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb,
+    &dt);
+
+  alpha = 0.5;
+  copyDataArray(u_out, u_cur);
+  LSM2D_TVD_RK_STAGE_ADVECTION(
+    u_out, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_cur, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_stage, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x, phi_y, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    vel_x, vel_y, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb,
+    &alpha, &dt);
+  num_failures += checkCondition("LSM2D_TVD_RK_STAGE_ADVECTION()",
+    maxDifference(u_out, u_expected) < tol);
+
+  /* normal velocity term, second stage of TVD-RK3 */
+  LSM2D_ZERO_OUT_LEVEL_SET_EQN_RHS(rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb);
+  LSM2D_ADD_NORMAL_VEL_TERM_TO_LSE_RHS(
+    rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_plus, phi_y_plus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_minus, phi_y_minus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    vel_n, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb);
+  copyDataArray(u_expected, u_cur);
+  LSM2D_TVD_RK3_STAGE2(
+    u_expected, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_stage, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_cur, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb,
+    &dt);
+
+  alpha = 0.75;
+  copyDataArray(u_out, u_cur);
+  LSM2D_TVD_RK_STAGE_NORMAL_VEL(
+    u_out, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_cur, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_stage, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_plus, phi_y_plus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_minus, phi_y_minus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    vel_n, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb,
+    &alpha, &dt);
+  num_failures += checkCondition("LSM2D_TVD_RK_STAGE_NORMAL_VEL()",
+    maxDifference(u_out, u_expected) < tol);
+
+  /* normal velocity term computed in place (forward Euler step) */
+  copyDataArray(u_expected, u_stage);
+  LSM2D_TVD_RK2_STAGE1(
+    u_expected, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_stage, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb,
+    &dt);
+
+  alpha = 0.0;
+  copyDataArray(u_out, u_stage);
+  LSM2D_TVD_RK_STAGE_NORMAL_VEL(
+    u_out, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_cur, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_out, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_plus, phi_y_plus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_minus, phi_y_minus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    vel_n, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb,
+    &alpha, &dt);
+  num_failures += checkCondition("LSM2D_TVD_RK_STAGE_NORMAL_VEL() (in place)",
+    maxDifference(u_out, u_expected) < tol);
+
+  /* constant normal velocity and curvature terms */
+  vel_n_const = 0.8;
+  b = 0.3;
+  LSM2D_ZERO_OUT_LEVEL_SET_EQN_RHS(rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb);
+  LSM2D_ADD_CONST_NORMAL_VEL_TERM_TO_LSE_RHS(
+    rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_plus, phi_y_plus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_minus, phi_y_minus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &vel_n_const,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb);
+  LSM2D_ADD_CONST_CURV_TERM_TO_LSE_RHS(
+    rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x, phi_y, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_xx, phi_xy, phi_yy, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &b,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb);
+
+  copyDataArray(u_expected, u_stage);
+  LSM2D_TVD_RK2_STAGE1(
+    u_expected, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_stage, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb,
+    &dt);
+
+  alpha = 0.0;
+  copyDataArray(u_out, u_stage);
+  LSM2D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV(
+    u_out, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_cur, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_stage, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_plus, phi_y_plus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_minus, phi_y_minus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x, phi_y, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_xx, phi_xy, phi_yy, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &vel_n_const, &b,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb,
+    &alpha, &dt);
+  num_failures += checkCondition(
+    "LSM2D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV() (RK1)",
+    maxDifference(u_out, u_expected) < tol);
+
+  copyDataArray(u_expected, u_cur);
+  LSM2D_TVD_RK3_STAGE3(
+    u_expected, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_stage, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_cur, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    rhs, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb,
+    &dt);
+
+  alpha = 1.0/3.0;
+  copyDataArray(u_out, u_cur);
+  LSM2D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV(
+    u_out, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_cur, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    u_stage, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_plus, phi_y_plus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x_minus, phi_y_minus, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_x, phi_y, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    phi_xx, phi_xy, phi_yy, &ilo_gb, &ihi_gb, &jlo_gb, &jhi_gb,
+    &vel_n_const, &b,
+    &ilo_fb, &ihi_fb, &jlo_fb, &jhi_fb,
+    &alpha, &dt);
+  num_failures += checkCondition(
+    "LSM2D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV() (RK3)",
+    maxDifference(u_out, u_expected) < tol);
+
+  free(u_cur);
+  free(u_stage);
+  free(u_out);
+  free(u_expected);
+  free(rhs);
+  free(phi_x);
+  free(phi_y);
+  free(phi_x_plus);
+  free(phi_y_plus);
+  free(phi_x_minus);
+  free(phi_y_minus);
+  free(phi_xx);
+  free(phi_xy);
+  free(phi_yy);
+  free(vel_x);
+  free(vel_y);
+  free(vel_n);
+
+  return finishTests(num_failures);
+}
@@ -0,0 +1,170 @@
+/*
+ * File:        test_grid_padding.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Test for padded allocation extents of Grids.
+ */
+
+/*
+ * This program pads the allocation extents of 2D and 3D grids and
+ * checks that
+ *  - rows start at multiples of the alignment and the allocation
+ *    extents contain the ghostbox,
+ *  - distances between rows and xy-planes are not multiples of the
+ *    page size for power-of-two grid sizes,
+ *  - the upper limits of the allocated index space (ihi_alloc, etc.)
+ *    match the allocation extents,
+ *  - the padding is kept by setIndexSpaceLimits() and copyGrid(), and
+ *    removed by setGridAllocationPadding() with a zero alignment, and
+ *  - data arrays survive a round trip through addDataArrayPadding()
+ *    and removeDataArrayPadding().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "LSMLIB_config.h"
+#include "lsm_data_arrays.h"
+#include "lsm_grid.h"
+#include "test_utilities.h"
+
+#define PAGE_SIZE  4096
+
+static int checkAllocationExtents(Grid *grid, int alignment)
+{
+  int pad = alignment/sizeof(LSMLIB_REAL);
+  int num_gridpts_alloc = 1;
+  int i;
+
+  for (i = 0; i < grid->num_dims; i++) {
+    if ((grid->grid_dims_alloc)[i] < (grid->grid_dims_ghostbox)[i]) {
+      return 0;
+    }
+    num_gridpts_alloc *= (grid->grid_dims_alloc)[i];
+  }
+
+  if ((grid->grid_dims_alloc)[0] % pad != 0) return 0;
+  if ( ((grid->grid_dims_alloc)[0]*sizeof(LSMLIB_REAL)) % PAGE_SIZE == 0 ) {
+    return 0;
+  }
+  if ( (grid->num_dims == 3) &&
+       ( ((grid->grid_dims_alloc)[0]*(grid->grid_dims_alloc)[1]
+          *sizeof(LSMLIB_REAL)) % PAGE_SIZE == 0 ) ) {
+    return 0;
+  }
+
+  return (grid->alloc_alignment == alignment)
+      && (grid->num_gridpts_alloc == num_gridpts_alloc)
+      && (grid->ihi_alloc == grid->ilo_gb + (grid->grid_dims_alloc)[0] - 1)
+      && (grid->jhi_alloc == grid->jlo_gb + (grid->grid_dims_alloc)[1] - 1)
+      && ( (grid->num_dims == 2) ||
+           (grid->khi_alloc == grid->klo_gb + (grid->grid_dims_alloc)[2] - 1) );
+}
+
+static int checkPaddingRoundTrip(char *test_name, Grid *grid)
+{
+  LSMLIB_REAL *data, *unpadded_data, *expected;
+  int nx = (grid->grid_dims_ghostbox)[0];
+  int nxy = nx*(grid->grid_dims_ghostbox)[1];
+  int nx_alloc = (grid->grid_dims_alloc)[0];
+  int nxy_alloc = nx_alloc*(grid->grid_dims_alloc)[1];
+  int idx, i, j, k;
+  int num_failures = 0;
+
+  data = (LSMLIB_REAL *)malloc(grid->num_gridpts_alloc*sizeof(LSMLIB_REAL));
+  unpadded_data = (LSMLIB_REAL *)malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  expected = (LSMLIB_REAL *)malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+
+  for (idx = 0; idx < grid->num_gridpts; idx++) {
+    expected[idx] = (LSMLIB_REAL) idx;
+    data[idx] = expected[idx];
+  }
+
+  /* pad in place, then check the location of the last grid point */
+  addDataArrayPadding(data, data, grid);
+  i = nx - 1;
+  j = (grid->grid_dims_ghostbox)[1] - 1;
+  k = (grid->num_dims == 3) ? (grid->grid_dims_ghostbox)[2] - 1 : 0;
+  num_failures += checkCondition("padded layout",
+    data[i + j*nx_alloc + k*nxy_alloc] == expected[i + j*nx + k*nxy]);
+
+  removeDataArrayPadding(unpadded_data, data, grid);
+  num_failures += checkDataArray(test_name, unpadded_data, expected,
+                                 grid->num_gridpts);
+
+  free(data);
+  free(unpadded_data);
+  free(expected);
+
+  return num_failures;
+}
+
+int main(void)
+{
+  Grid *grid, *grid_copy;
+  LSMLIB_REAL x_lo[3] = {-1.0, -1.0, -1.0};
+  LSMLIB_REAL x_hi[3] = {1.0, 1.0, 1.0};
+  int grid_dims_3d[3] = {30, 22, 18};
+  int grid_dims_2d[2] = {45, 37};
+  int grid_dims_pow2[3] = {0, 0, 4};
+  int num_gridpts;
+  int num_failures = 0;
+
+  printf("Padded grids\n");
+
+  /* 3D grid */
+  grid = createGridSetGridDims(3, grid_dims_3d, x_lo, x_hi, MEDIUM);
+  num_gridpts = grid->num_gridpts;
+  setGridAllocationPadding(grid, LSM_GRID_ALIGNMENT);
+  num_failures += checkCondition("allocation extents (3D)",
+    checkAllocationExtents(grid, LSM_GRID_ALIGNMENT)
+    && (grid->num_gridpts == num_gridpts));
+  num_failures += checkPaddingRoundTrip(
+    "add/removeDataArrayPadding() (3D)", grid);
+
+  setIndexSpaceLimits(HIGH, grid);
+  num_failures += checkCondition("setIndexSpaceLimits() keeps padding",
+    checkAllocationExtents(grid, LSM_GRID_ALIGNMENT));
+
+  grid_copy = copyGrid(grid);
+  num_failures += checkCondition("copyGrid() keeps padding",
+    checkAllocationExtents(grid_copy, LSM_GRID_ALIGNMENT)
+    && (grid_copy->grid_dims_alloc[0] == grid->grid_dims_alloc[0])
+    && (grid_copy->grid_dims_alloc[1] == grid->grid_dims_alloc[1])
+    && (grid_copy->grid_dims_alloc[2] == grid->grid_dims_alloc[2]));
+  destroyGrid(grid_copy);
+
+  setGridAllocationPadding(grid, 0);
+  num_failures += checkCondition("zero alignment removes padding",
+    (grid->alloc_alignment == 0)
+    && (grid->num_gridpts_alloc == grid->num_gridpts)
+    && (grid->ihi_alloc == grid->ihi_gb)
+    && (grid->jhi_alloc == grid->jhi_gb)
+    && (grid->khi_alloc == grid->khi_gb));
+  destroyGrid(grid);
+
+  /* 2D grid */
+  grid = createGridSetGridDims(2, grid_dims_2d, x_lo, x_hi, HIGH);
+  setGridAllocationPadding(grid, LSM_GRID_ALIGNMENT);
+  num_failures += checkCondition("allocation extents (2D)",
+    checkAllocationExtents(grid, LSM_GRID_ALIGNMENT));
+  num_failures += checkPaddingRoundTrip(
+    "add/removeDataArrayPadding() (2D)", grid);
+  destroyGrid(grid);
+
+  /* 3D grid whose ghostbox rows (2*PAGE_SIZE bytes) and xy-planes */
+  /* (64 rows) have sizes that are multiples of the page size      */
+  grid_dims_pow2[0] = 2*PAGE_SIZE/sizeof(LSMLIB_REAL) - 6;
+  grid_dims_pow2[1] = 64 - 6;
+  grid = createGridSetGridDims(3, grid_dims_pow2, x_lo, x_hi, MEDIUM);
+  setGridAllocationPadding(grid, LSM_GRID_ALIGNMENT);
+  num_failures += checkCondition("allocation extents (power-of-two sizes)",
+    checkAllocationExtents(grid, LSM_GRID_ALIGNMENT));
+  num_failures += checkPaddingRoundTrip(
+    "add/removeDataArrayPadding() (power-of-two sizes)", grid);
+  destroyGrid(grid);
+
+  return finishTests(num_failures);
+}
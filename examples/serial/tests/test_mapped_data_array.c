@@ -0,0 +1,116 @@
+/*
+ * File:        test_mapped_data_array.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Round-trip test for memory-mapped data array files.
+ */
+
+/*
+ * This program writes a padded 3D data array with writeDataArrayAligned()
+ * and checks that
+ *  - the memory-mapped data array has the dimensions of the ghostbox,
+ *    is aligned to LSM_ALIGNED_HEADER_SIZE bytes, and matches the
+ *    original data array without its padding,
+ *  - changes to a copy-on-write mapping do not modify the file while
+ *    changes to a write-back mapping do,
+ *  - readDataArray() reads files written by writeDataArrayAligned(),
+ *    and
+ *  - mapDataArray() rejects files written by writeDataArray().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "LSMLIB_config.h"
+#include "lsm_data_arrays.h"
+#include "lsm_file.h"
+#include "lsm_grid.h"
+#include "test_utilities.h"
+
+int main(void)
+{
+  Grid *grid;
+  LSM_MappedDataArray *mapped_array;
+  LSMLIB_REAL *data, *padded_data, *data_from_file;
+  LSMLIB_REAL x_lo[3] = {-1.0, -1.0, -1.0};
+  LSMLIB_REAL x_hi[3] = {1.0, 1.0, 1.0};
+  int grid_dims[3] = {27, 20, 15};
+  int grid_dims_from_file[3];
+  char file_name[] = "test_mapped_data_array.dat";
+  char legacy_file_name[] = "test_mapped_data_array_legacy.dat";
+  int idx;
+  int num_failures = 0;
+
+  grid = createGridSetGridDims(3, grid_dims, x_lo, x_hi, MEDIUM);
+  setGridAllocationPadding(grid, LSM_GRID_ALIGNMENT);
+
+  data = (LSMLIB_REAL *)malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  for (idx = 0; idx < grid->num_gridpts; idx++) {
+    data[idx] = cos(0.02*idx) - 0.001*idx;
+  }
+  padded_data =
+    (LSMLIB_REAL *)malloc(grid->num_gridpts_alloc*sizeof(LSMLIB_REAL));
+  addDataArrayPadding(padded_data, data, grid);
+
+  printf("Memory-mapped data arrays\n");
+
+  writeDataArrayAligned(padded_data, grid, file_name);
+
+  /* copy-on-write mapping */
+  mapped_array = mapDataArray(file_name, 0);
+  num_failures += checkCondition("mapDataArray() dimensions and alignment",
+    mapped_array
+    && (mapped_array->grid_dims_ghostbox[0] == grid->grid_dims_ghostbox[0])
+    && (mapped_array->grid_dims_ghostbox[1] == grid->grid_dims_ghostbox[1])
+    && (mapped_array->grid_dims_ghostbox[2] == grid->grid_dims_ghostbox[2])
+    && (mapped_array->num_gridpts == grid->num_gridpts)
+    && ((size_t)mapped_array->data % LSM_ALIGNED_HEADER_SIZE == 0));
+  num_failures += checkDataArray("mapDataArray()",
+    mapped_array ? mapped_array->data : NULL, data, grid->num_gridpts);
+  if (mapped_array) {
+    mapped_array->data[0] += 1.0;
+    unmapDataArray(mapped_array);
+  }
+
+  data_from_file = readDataArray(grid_dims_from_file, file_name);
+  num_failures += checkDataArray("copy-on-write mapping leaves file unchanged",
+    data_from_file, data, grid->num_gridpts);
+  num_failures += checkCondition("readDataArray() dimensions",
+    data_from_file
+    && (grid_dims_from_file[0] == grid->grid_dims_ghostbox[0])
+    && (grid_dims_from_file[1] == grid->grid_dims_ghostbox[1])
+    && (grid_dims_from_file[2] == grid->grid_dims_ghostbox[2]));
+  free(data_from_file);
+
+  /* write-back mapping */
+  mapped_array = mapDataArray(file_name, 1);
+  if (mapped_array) {
+    for (idx = 0; idx < mapped_array->num_gridpts; idx++) {
+      mapped_array->data[idx] *= 2.0;
+    }
+    unmapDataArray(mapped_array);
+  }
+  for (idx = 0; idx < grid->num_gridpts; idx++) {
+    data[idx] *= 2.0;
+  }
+  data_from_file = readDataArray(grid_dims_from_file, file_name);
+  num_failures += checkDataArray("write-back mapping updates file",
+    data_from_file, data, grid->num_gridpts);
+  free(data_from_file);
+
+  /* files written by writeDataArray() cannot be mapped */
+  writeDataArray(padded_data, grid, legacy_file_name, NO_ZIP);
+  mapped_array = mapDataArray(legacy_file_name, 0);
+  num_failures += checkCondition("mapDataArray() rejects writeDataArray() file",
+    mapped_array == NULL);
+  if (mapped_array) unmapDataArray(mapped_array);
+
+  free(data);
+  free(padded_data);
+  destroyGrid(grid);
+
+  return finishTests(num_failures);
+}
@@ -0,0 +1,98 @@
+/*
+ * File:        test_narrow_band_manager.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Test for the narrow band rebuild criteria.
+ */
+
+/*
+ * This program drives a NarrowBandManager through a sequence of time
+ * steps and checks that
+ *  - a rebuild is required before the first time step,
+ *  - no rebuild is required right after a rebuild is recorded,
+ *  - the interface displacement accumulates across time steps and
+ *    triggers a rebuild when it reaches beta,
+ *  - a sign change in the outer layer triggers a rebuild, and
+ *  - requested rebuilds are honored,
+ * and that each kind of rebuild is counted in the statistics.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "LSMLIB_config.h"
+#include "lsm_narrow_band.h"
+#include "test_utilities.h"
+
+int main(void)
+{
+  NarrowBandManager *nb_manager;
+  LSMLIB_REAL beta = 0.5;
+  LSMLIB_REAL gamma = 0.75;
+  int rebuild_needed;
+  int step;
+  int num_failures = 0;
+
+  printf("Narrow band manager\n");
+
+  nb_manager = createNarrowBandManager(beta, gamma);
+
+  num_failures += checkCondition("rebuild required before first step",
+    narrowBandRebuildNeeded(nb_manager));
+
+  recordNarrowBandRebuild(nb_manager);
+  num_failures += checkCondition("no rebuild required after rebuild",
+    !narrowBandRebuildNeeded(nb_manager));
+
+  /* displacement of 0.2 per step (with alternating signs) reaches */
+  /* beta = 0.5 on the third step                                   */
+  rebuild_needed = 0;
+  for (step = 0; step < 2; step++) {
+    rebuild_needed |= updateNarrowBandManager(nb_manager,
+      (step % 2 == 0) ? 0.2 : -0.2, 0);
+  }
+  num_failures += checkCondition("displacement below beta",
+    !rebuild_needed && !narrowBandRebuildNeeded(nb_manager));
+
+  rebuild_needed = updateNarrowBandManager(nb_manager, 0.2, 0);
+  num_failures += checkCondition("displacement reaching beta",
+    rebuild_needed && narrowBandRebuildNeeded(nb_manager)
+    && (nb_manager->num_displacement_rebuilds == 1));
+
+  /* displacement is reset by a rebuild */
+  recordNarrowBandRebuild(nb_manager);
+  rebuild_needed = updateNarrowBandManager(nb_manager, 0.2, 0);
+  num_failures += checkCondition("displacement reset by rebuild",
+    !rebuild_needed && (nb_manager->displacement == 0.2));
+
+  /* sign change in the outer layer */
+  rebuild_needed = updateNarrowBandManager(nb_manager, 0.0, 1);
+  num_failures += checkCondition("sign change in outer layer",
+    rebuild_needed && (nb_manager->num_sign_change_rebuilds == 1));
+
+  /* rebuilds that are still pending are not counted again */
+  rebuild_needed = updateNarrowBandManager(nb_manager, 1.0, 1);
+  num_failures += checkCondition("pending rebuild counted once",
+    rebuild_needed
+    && (nb_manager->num_sign_change_rebuilds == 1)
+    && (nb_manager->num_displacement_rebuilds == 1));
+
+  /* requested rebuild */
+  recordNarrowBandRebuild(nb_manager);
+  requestNarrowBandRebuild(nb_manager);
+  requestNarrowBandRebuild(nb_manager);
+  num_failures += checkCondition("requested rebuild",
+    narrowBandRebuildNeeded(nb_manager)
+    && (nb_manager->num_requested_rebuilds == 1));
+
+  recordNarrowBandRebuild(nb_manager);
+  num_failures += checkCondition("rebuild statistics",
+    (nb_manager->num_rebuilds == 4) && (nb_manager->num_steps == 6)
+    && (nb_manager->num_steps_since_rebuild == 0));
+
+  destroyNarrowBandManager(nb_manager);
+
+  return finishTests(num_failures);
+}
@@ -0,0 +1,103 @@
+/*
+ * File:        test_narrow_band_snapshot.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Round-trip test for narrow band snapshots.
+ */
+
+/*
+ * This program writes the signed distance function for a circle to
+ * narrow band snapshot files (with and without compression) and checks
+ * that the level set function reconstructed by readDataArrayNarrowBand()
+ * and by readDataArray()
+ *  - is identical to the original level set function inside of the
+ *    narrow band (|phi| < threshold) and
+ *  - is equal to +/- threshold (with the sign of the original level set
+ *    function) outside of the narrow band.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "LSMLIB_config.h"
+#include "lsm_data_arrays.h"
+#include "lsm_file.h"
+#include "lsm_grid.h"
+#include "test_utilities.h"
+
+int main(void)
+{
+  Grid *grid;
+  LSMLIB_REAL *phi, *expected, *data;
+  LSMLIB_REAL x_lo[2] = {-1.0, -1.0};
+  LSMLIB_REAL x_hi[2] = {1.0, 1.0};
+  LSMLIB_REAL threshold = 0.2;
+  LSMLIB_REAL threshold_from_file;
+  LSMLIB_REAL x, y;
+  int grid_dims[2] = {64, 48};
+  int grid_dims_from_file[3];
+  int i, j, idx, nx, ny, zip_status;
+  char file_name[] = "test_narrow_band_snapshot.dat";
+  char zipped_file_name[] = "test_narrow_band_snapshot.dat.gz";
+  char *input_file_name;
+  int num_failures = 0;
+
+  grid = createGridSetGridDims(2, grid_dims, x_lo, x_hi, HIGH);
+  nx = grid->grid_dims_ghostbox[0];
+  ny = grid->grid_dims_ghostbox[1];
+
+  phi = (LSMLIB_REAL *) malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  for (j = 0; j < ny; j++) {
+    for (i = 0; i < nx; i++) {
+      idx = i + nx*j;
+      x = grid->x_lo_ghostbox[0] + i*grid->dx[0];
+      y = grid->x_lo_ghostbox[1] + j*grid->dx[1];
+      phi[idx] = sqrt((x-0.1)*(x-0.1) + y*y) - 0.5;
+    }
+  }
+
+  /* values outside of the narrow band are reconstructed as +/- threshold */
+  expected = (LSMLIB_REAL *) malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+  for (idx = 0; idx < grid->num_gridpts; idx++) {
+    if (fabs(phi[idx]) < threshold) {
+      expected[idx] = phi[idx];
+    } else {
+      expected[idx] = (phi[idx] > 0) ? threshold : -threshold;
+    }
+  }
+
+  for (zip_status = NO_ZIP; zip_status <= GZIP; zip_status++) {
+
+    printf("Narrow band snapshots (%s)\n",
+           zip_status == GZIP ? "GZIP" : "NO_ZIP");
+
+    writeDataArrayNarrowBand(phi, grid, threshold, file_name, zip_status);
+    input_file_name = (zip_status == GZIP) ? zipped_file_name : file_name;
+
+    data = readDataArrayNarrowBand(grid_dims_from_file,
+                                   &threshold_from_file, input_file_name);
+    num_failures += checkCondition("readDataArrayNarrowBand() header",
+      data && (grid_dims_from_file[0] == nx)
+           && (grid_dims_from_file[1] == ny)
+           && (threshold_from_file == threshold) );
+    num_failures += checkDataArray("readDataArrayNarrowBand()", data,
+                                   expected, grid->num_gridpts);
+    free(data);
+
+    data = readDataArray(grid_dims_from_file, input_file_name);
+    num_failures += checkDataArray("readDataArray()", data, expected,
+                                   grid->num_gridpts);
+    free(data);
+
+    remove(input_file_name);
+  }
+
+  free(expected);
+  free(phi);
+  destroyGrid(grid);
+
+  return finishTests(num_failures);
+}
@@ -0,0 +1,160 @@
+/*
+ * File:        test_semi_implicit_curvature.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Test for the semi-implicit curvature solvers.
+ */
+
+/*
+ * This program solves (I - b*dt*Laplacian) phi = f for a quadratic
+ * phi, whose discrete Laplacian is exact, on 2D and 3D grids with
+ * b*dt much larger than dx^2 (i.e. far beyond the explicit time step
+ * limit) and checks that
+ *  - the conjugate gradient iteration converges and recovers phi,
+ *  - the ghostcell values of phi are held fixed, and
+ *  - a negative value is returned when the iteration does not
+ *    converge within the maximum number of iterations.
+ *
+ * The 3D grid has different grid spacings in each direction and padded
+ * allocation extents (see setGridAllocationPadding()).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "LSMLIB_config.h"
+#include "lsm_grid.h"
+#include "lsm_semi_implicit_curvature.h"
+#include "test_utilities.h"
+
+/* quadratic test function; its 2nd-order discrete Laplacian is exact */
+static LSMLIB_REAL quadratic(LSMLIB_REAL x, LSMLIB_REAL y, LSMLIB_REAL z)
+{
+  return x*x + 2.0*y*y + 0.5*z*z + x*y - y*z + 0.3*x;
+}
+
+/* sets phi_exact and f = phi_exact - b_dt*Laplacian(phi_exact) at */
+/* all grid points and phi = phi_exact in the ghostcells, 0 in the */
+/* fillbox                                                          */
+static void setUpSystem(LSMLIB_REAL *phi, LSMLIB_REAL *phi_exact,
+                        LSMLIB_REAL *f, LSMLIB_REAL b_dt, Grid *grid)
+{
+  int nx = grid->grid_dims_alloc[0];
+  int nxy = nx*grid->grid_dims_alloc[1];
+  int nz = (grid->num_dims == 3) ? grid->grid_dims_ghostbox[2] : 1;
+  LSMLIB_REAL dz = (grid->num_dims == 3) ? grid->dx[2] : 0.0;
+  LSMLIB_REAL laplacian = 2.0 + 4.0 + ((grid->num_dims == 3) ? 1.0 : 0.0);
+  int i, j, k, idx, in_fillbox;
+
+  for (k = 0; k < nz; k++) {
+    for (j = 0; j < grid->grid_dims_ghostbox[1]; j++) {
+      for (i = 0; i < grid->grid_dims_ghostbox[0]; i++) {
+        idx = i + j*nx + k*nxy;
+        phi_exact[idx] = quadratic(i*grid->dx[0], j*grid->dx[1], k*dz);
+        f[idx] = phi_exact[idx] - b_dt*laplacian;
+
+        in_fillbox = (i >= grid->ilo_fb) && (i <= grid->ihi_fb)
+                  && (j >= grid->jlo_fb) && (j <= grid->jhi_fb)
+                  && ( (grid->num_dims == 2) ||
+                       ((k >= grid->klo_fb) && (k <= grid->khi_fb)) );
+        phi[idx] = in_fillbox ? 0.0 : phi_exact[idx];
+      }
+    }
+  }
+}
+
+/* returns the max norm of phi - phi_exact over the ghostbox */
+static LSMLIB_REAL maxError(LSMLIB_REAL *phi, LSMLIB_REAL *phi_exact,
+                            Grid *grid)
+{
+  int nx = grid->grid_dims_alloc[0];
+  int nxy = nx*grid->grid_dims_alloc[1];
+  int nz = (grid->num_dims == 3) ? grid->grid_dims_ghostbox[2] : 1;
+  LSMLIB_REAL err, max_err = 0.0;
+  int i, j, k, idx;
+
+  for (k = 0; k < nz; k++) {
+    for (j = 0; j < grid->grid_dims_ghostbox[1]; j++) {
+      for (i = 0; i < grid->grid_dims_ghostbox[0]; i++) {
+        idx = i + j*nx + k*nxy;
+        err = fabs(phi[idx] - phi_exact[idx]);
+        if (err > max_err) max_err = err;
+      }
+    }
+  }
+
+  return max_err;
+}
+
+static int checkSolver(char *test_name, Grid *grid, LSMLIB_REAL b_dt)
+{
+  LSMLIB_REAL *phi, *phi_exact, *f;
+  LSMLIB_REAL tol = 1.0e-12;
+  int num_iters;
+  int num_failures = 0;
+  char name[256];
+
+  phi = (LSMLIB_REAL *)malloc(grid->num_gridpts_alloc*sizeof(LSMLIB_REAL));
+  phi_exact =
+    (LSMLIB_REAL *)malloc(grid->num_gridpts_alloc*sizeof(LSMLIB_REAL));
+  f = (LSMLIB_REAL *)malloc(grid->num_gridpts_alloc*sizeof(LSMLIB_REAL));
+
+  /* converged solve */
+  setUpSystem(phi, phi_exact, f, b_dt, grid);
+  if (grid->num_dims == 3) {
+    num_iters = solveSemiImplicitCurvatureSystem3d(phi, f, b_dt, grid,
+                                                   tol, 1000);
+  } else {
+    num_iters = solveSemiImplicitCurvatureSystem2d(phi, f, b_dt, grid,
+                                                   tol, 1000);
+  }
+  sprintf(name, "%s converges", test_name);
+  num_failures += checkCondition(name, num_iters > 0);
+  sprintf(name, "%s solution", test_name);
+  num_failures += checkCondition(name, maxError(phi, phi_exact, grid) < 1.0e-8);
+
+  /* iteration stopped before convergence */
+  setUpSystem(phi, phi_exact, f, b_dt, grid);
+  if (grid->num_dims == 3) {
+    num_iters = solveSemiImplicitCurvatureSystem3d(phi, f, b_dt, grid,
+                                                   tol, 2);
+  } else {
+    num_iters = solveSemiImplicitCurvatureSystem2d(phi, f, b_dt, grid,
+                                                   tol, 2);
+  }
+  sprintf(name, "%s max_iters reached", test_name);
+  num_failures += checkCondition(name, num_iters < 0);
+
+  free(phi);
+  free(phi_exact);
+  free(f);
+
+  return num_failures;
+}
+
+int main(void)
+{
+  Grid *grid;
+  LSMLIB_REAL x_lo[3] = {-1.0, -1.0, -1.0};
+  LSMLIB_REAL x_hi[3] = {1.0, 1.0, 1.0};
+  int grid_dims_2d[2] = {40, 32};
+  int grid_dims_3d[3] = {24, 18, 14};
+  int num_failures = 0;
+
+  printf("Semi-implicit curvature solvers\n");
+
+  /* b*dt = 100 dx^2 */
+  grid = createGridSetGridDims(2, grid_dims_2d, x_lo, x_hi, MEDIUM);
+  num_failures += checkSolver("2D", grid, 100.0*grid->dx[0]*grid->dx[0]);
+  destroyGrid(grid);
+
+  grid = createGridSetGridDims(3, grid_dims_3d, x_lo, x_hi, MEDIUM);
+  setGridAllocationPadding(grid, LSM_GRID_ALIGNMENT);
+  num_failures += checkSolver("3D", grid, 100.0*grid->dx[0]*grid->dx[0]);
+  destroyGrid(grid);
+
+  return finishTests(num_failures);
+}
@@ -0,0 +1,234 @@
+/*
+ * File:        test_semi_lagrangian_patches.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Test for the semi-Lagrangian advection kernel on
+ *              multiple patches.
+ */
+
+/*
+ * This program advects a 2D level set function in a rotating velocity
+ * field with LSM2D_SEMI_LAGRANGIAN_ADVECTION_STEP() at CFL number 2.5
+ * on a single patch and on two patches whose ghostcells are filled
+ * from each other (as in the parallel LevelSetFunctionIntegrator) and
+ * checks that
+ *  - a single semi-Lagrangian step and
+ *  - a full BFECC step (three semi-Lagrangian steps)
+ * give identical results when the level set function has int(CFL)+1
+ * ghostcells and the velocity has int(CFL/2)+1 ghostcells.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "LSMLIB_config.h"
+#include "lsm_semi_lagrangian2d.h"
+#include "test_utilities.h"
+
+#define NX 32
+#define NY 24
+#define CFL 2.5
+#define U_GHOSTCELL_WIDTH ((int) CFL + 1)
+#define VEL_GHOSTCELL_WIDTH ((int) (0.5*CFL) + 1)
+
+/* patch of the grid with its own copies of u and the velocity */
+typedef struct {
+  int ilo_fb, ihi_fb, jlo_fb, jhi_fb;
+  int ilo_gb, ihi_gb, jlo_gb, jhi_gb;
+  int ilo_vel_gb, ihi_vel_gb, jlo_vel_gb, jhi_vel_gb;
+  LSMLIB_REAL *u[3];  /* u_(0), u_(1), u_(2) of the BFECC step */
+  LSMLIB_REAL *vel_x, *vel_y;
+} TestPatch;
+
+/* ghostbox of the whole grid */
+#define ILO_GB (-U_GHOSTCELL_WIDTH)
+#define IHI_GB (NX-1+U_GHOSTCELL_WIDTH)
+#define JLO_GB (-U_GHOSTCELL_WIDTH)
+#define JHI_GB (NY-1+U_GHOSTCELL_WIDTH)
+#define NX_GB (IHI_GB-ILO_GB+1)
+#define GLOBAL_IDX(i,j) (((i)-ILO_GB) + ((j)-JLO_GB)*NX_GB)
+
+static LSMLIB_REAL dx = 1.0/NX;
+
+static LSMLIB_REAL initialLevelSetFunction(int i, int j)
+{
+  LSMLIB_REAL x = (i+0.5)*dx - 0.6, y = (j+0.5)*dx - 0.4;
+  return sqrt(x*x + y*y) - 0.2;
+}
+
+static void createPatch(TestPatch *patch, int ilo, int ihi)
+{
+  int i, j, k, num_gridpts, num_gridpts_vel;
+
+  patch->ilo_fb = ilo;
+  patch->ihi_fb = ihi;
+  patch->jlo_fb = 0;
+  patch->jhi_fb = NY-1;
+  patch->ilo_gb = ilo - U_GHOSTCELL_WIDTH;
+  patch->ihi_gb = ihi + U_GHOSTCELL_WIDTH;
+  patch->jlo_gb = JLO_GB;
+  patch->jhi_gb = JHI_GB;
+  patch->ilo_vel_gb = ilo - VEL_GHOSTCELL_WIDTH;
+  patch->ihi_vel_gb = ihi + VEL_GHOSTCELL_WIDTH;
+  patch->jlo_vel_gb = -VEL_GHOSTCELL_WIDTH;
+  patch->jhi_vel_gb = NY-1+VEL_GHOSTCELL_WIDTH;
+
+  num_gridpts = (patch->ihi_gb-patch->ilo_gb+1)
+              * (patch->jhi_gb-patch->jlo_gb+1);
+  for (k = 0; k < 3; k++) {
+    patch->u[k] = (LSMLIB_REAL *)malloc(num_gridpts*sizeof(LSMLIB_REAL));
+  }
+  for (j = patch->jlo_gb; j <= patch->jhi_gb; j++) {
+    for (i = patch->ilo_gb; i <= patch->ihi_gb; i++) {
+      patch->u[0][(i-patch->ilo_gb) + (j-patch->jlo_gb)
+                  *(patch->ihi_gb-patch->ilo_gb+1)] =
+        initialLevelSetFunction(i,j);
+    }
+  }
+
+  /* rotation about the center of the domain */
+  num_gridpts_vel = (patch->ihi_vel_gb-patch->ilo_vel_gb+1)
+                  * (patch->jhi_vel_gb-patch->jlo_vel_gb+1);
+  patch->vel_x = (LSMLIB_REAL *)malloc(num_gridpts_vel*sizeof(LSMLIB_REAL));
+  patch->vel_y = (LSMLIB_REAL *)malloc(num_gridpts_vel*sizeof(LSMLIB_REAL));
+  for (j = patch->jlo_vel_gb; j <= patch->jhi_vel_gb; j++) {
+    for (i = patch->ilo_vel_gb; i <= patch->ihi_vel_gb; i++) {
+      k = (i-patch->ilo_vel_gb)
+        + (j-patch->jlo_vel_gb)*(patch->ihi_vel_gb-patch->ilo_vel_gb+1);
+      patch->vel_x[k] = -((j+0.5)*dx - 0.5*NY*dx);
+      patch->vel_y[k] = (i+0.5)*dx - 0.5;
+    }
+  }
+}
+
+static void destroyPatch(TestPatch *patch)
+{
+  int k;
+  for (k = 0; k < 3; k++) free(patch->u[k]);
+  free(patch->vel_x);
+  free(patch->vel_y);
+}
+
+/* copies the fillboxes of the patches into the whole grid, sets */
+/* the ghostcells of the grid by constant extrapolation and fills  */
+/* the ghostcells of the patches from the grid                     */
+static void fillGhostCells(TestPatch *patches, int num_patches, int reg,
+                           LSMLIB_REAL *u_global)
+{
+  int i, j, i_src, j_src, p, nx;
+  TestPatch *patch;
+
+  for (p = 0; p < num_patches; p++) {
+    patch = &patches[p];
+    nx = patch->ihi_gb-patch->ilo_gb+1;
+    for (j = patch->jlo_fb; j <= patch->jhi_fb; j++) {
+      for (i = patch->ilo_fb; i <= patch->ihi_fb; i++) {
+        u_global[GLOBAL_IDX(i,j)] =
+          patch->u[reg][(i-patch->ilo_gb) + (j-patch->jlo_gb)*nx];
+      }
+    }
+  }
+
+  for (j = JLO_GB; j <= JHI_GB; j++) {
+    for (i = ILO_GB; i <= IHI_GB; i++) {
+      i_src = (i < 0) ? 0 : ((i > NX-1) ? NX-1 : i);
+      j_src = (j < 0) ? 0 : ((j > NY-1) ? NY-1 : j);
+      u_global[GLOBAL_IDX(i,j)] = u_global[GLOBAL_IDX(i_src,j_src)];
+    }
+  }
+
+  for (p = 0; p < num_patches; p++) {
+    patch = &patches[p];
+    nx = patch->ihi_gb-patch->ilo_gb+1;
+    for (j = patch->jlo_gb; j <= patch->jhi_gb; j++) {
+      for (i = patch->ilo_gb; i <= patch->ihi_gb; i++) {
+        patch->u[reg][(i-patch->ilo_gb) + (j-patch->jlo_gb)*nx] =
+          u_global[GLOBAL_IDX(i,j)];
+      }
+    }
+  }
+}
+
+/* takes num_steps of the three semi-Lagrangian steps of a BFECC */
+/* step; u_global holds the result of the last step               */
+static void advancePatches(TestPatch *patches, int num_patches,
+                           int num_steps, LSMLIB_REAL dt,
+                           LSMLIB_REAL *u_global)
+{
+  static const LSMLIB_REAL bfecc_alpha[3] = {0.0, 1.5, 0.0};
+  static const LSMLIB_REAL bfecc_dt_sign[3] = {1.0, -1.0, 1.0};
+  static const int u_in_reg[3] = {0, 1, 2};
+  static const int u_next_reg[3] = {1, 2, 0};
+  LSMLIB_REAL dt_step;
+  TestPatch *patch;
+  int step, p;
+
+  for (step = 0; step < num_steps; step++) {
+    dt_step = bfecc_dt_sign[step]*dt;
+    for (p = 0; p < num_patches; p++) {
+      patch = &patches[p];
+      LSM2D_SEMI_LAGRANGIAN_ADVECTION_STEP(
+        patch->u[u_next_reg[step]],
+        &patch->ilo_gb, &patch->ihi_gb, &patch->jlo_gb, &patch->jhi_gb,
+        patch->u[0],
+        &patch->ilo_gb, &patch->ihi_gb, &patch->jlo_gb, &patch->jhi_gb,
+        patch->u[u_in_reg[step]],
+        &patch->ilo_gb, &patch->ihi_gb, &patch->jlo_gb, &patch->jhi_gb,
+        patch->vel_x, patch->vel_y,
+        &patch->ilo_vel_gb, &patch->ihi_vel_gb,
+        &patch->jlo_vel_gb, &patch->jhi_vel_gb,
+        &patch->ilo_fb, &patch->ihi_fb, &patch->jlo_fb, &patch->jhi_fb,
+        &dx, &dx, &bfecc_alpha[step], &dt_step);
+    }
+    fillGhostCells(patches, num_patches, u_next_reg[step], u_global);
+  }
+}
+
+static int checkPatches(char *test_name, int num_steps, LSMLIB_REAL dt)
+{
+  TestPatch one_patch, two_patches[2];
+  LSMLIB_REAL *u_one_patch, *u_two_patches;
+  int num_gridpts_global = NX_GB*(JHI_GB-JLO_GB+1);
+  int num_failures;
+
+  u_one_patch =
+    (LSMLIB_REAL *)malloc(num_gridpts_global*sizeof(LSMLIB_REAL));
+  u_two_patches =
+    (LSMLIB_REAL *)malloc(num_gridpts_global*sizeof(LSMLIB_REAL));
+
+  createPatch(&one_patch, 0, NX-1);
+  advancePatches(&one_patch, 1, num_steps, dt, u_one_patch);
+
+  createPatch(&two_patches[0], 0, NX/2-1);
+  createPatch(&two_patches[1], NX/2, NX-1);
+  advancePatches(two_patches, 2, num_steps, dt, u_two_patches);
+
+  num_failures = checkDataArray(test_name, u_two_patches, u_one_patch,
+                                num_gridpts_global);
+
+  destroyPatch(&one_patch);
+  destroyPatch(&two_patches[0]);
+  destroyPatch(&two_patches[1]);
+  free(u_one_patch);
+  free(u_two_patches);
+
+  return num_failures;
+}
+
+int main(void)
+{
+  /* max(|vel_x|,|vel_y|) = 0.5 */
+  LSMLIB_REAL dt = CFL*dx/0.5;
+  int num_failures = 0;
+
+  printf("Semi-Lagrangian advection on multiple patches\n");
+
+  num_failures += checkPatches("two patches vs. one patch (SL step)", 1, dt);
+  num_failures += checkPatches("two patches vs. one patch (BFECC step)",
+                               3, dt);
+
+  return finishTests(num_failures);
+}
@@ -0,0 +1,45 @@
+/*
+ * File:        test_utilities.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Helper functions shared by the serial test programs
+ */
+
+#include <stdio.h>
+#include "test_utilities.h"
+
+int checkCondition(char *test_name, int passed)
+{
+  printf("  %-60s %s\n", test_name, passed ? "ok" : "FAILED");
+  return (passed ? 0 : 1);
+}
+
+int checkDataArray(char *test_name, LSMLIB_REAL *data, 
+                   LSMLIB_REAL *expected, int num_values)
+{
+  int idx;
+
+  if (!data) return checkCondition(test_name, 0);
+
+  for (idx = 0; idx < num_values; idx++) {
+    if (data[idx] != expected[idx]) {
+      checkCondition(test_name, 0);
+      printf("    value %d is %g instead of %g\n", idx, 
+             (double) data[idx], (double) expected[idx]);
+      return 1;
+    }
+  }
+  return checkCondition(test_name, 1);
+}
+
+int finishTests(int num_failures)
+{
+  if (num_failures > 0) {
+    printf("%d check(s) failed\n", num_failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * File:        test_utilities.h
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Header file for helper functions shared by the serial 
+ *              test programs
+ */
+
+#ifndef included_test_utilities_h
+#define included_test_utilities_h
+
+#include "LSMLIB_config.h"
+
+/*!
+ * checkCondition() reports the result of a single check.
+ *
+ * Arguments:
+ *  - test_name (in):  description of the check
+ *  - passed (in):     nonzero if the check passed
+ *
+ * Return value:       0 if the check passed; 1 otherwise
+ *
+ */
+int checkCondition(char *test_name, int passed);
+
+/*!
+ * checkDataArray() checks that two data arrays are identical and 
+ * reports the result.
+ *
+ * Arguments:
+ *  - test_name (in):   description of the check
+ *  - data (in):        data array to check
+ *  - expected (in):    expected values
+ *  - num_values (in):  number of values to compare
+ *
+ * Return value:        0 if the data arrays are identical; 1 otherwise
+ *
+ * NOTES:
+ *  - data may be NULL (e.g. if it could not be read from a file), in 
+ *    which case the check fails.
+ *
+ */
+int checkDataArray(char *test_name, LSMLIB_REAL *data, 
+                   LSMLIB_REAL *expected, int num_values);
+
+/*!
+ * finishTests() reports the number of failed checks.
+ *
+ * Arguments:
+ *  - num_failures (in):  number of failed checks
+ *
+ * Return value:          exit status for the test program (0 if all 
+ *                        checks passed; 1 otherwise)
+ *
+ */
+int finishTests(int num_failures);
+
+#endif
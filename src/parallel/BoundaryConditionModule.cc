@@ -64,8 +64,12 @@ d_geom_periodic_dirs(rhs.d_geom_periodic_dirs)
   d_patch_hierarchy = rhs.d_patch_hierarchy;
   d_boundary_boxes.setNull(); 
   d_touches_boundary.setNull();
+  d_boundary_patches.setNull();
+  d_boundary_fill_boxes.setNull();
   d_boundary_boxes = rhs.d_boundary_boxes;
   d_touches_boundary = rhs.d_touches_boundary;
+  d_boundary_patches = rhs.d_boundary_patches;
+  d_boundary_fill_boxes = rhs.d_boundary_fill_boxes;
 }
 
 
@@ -85,8 +89,10 @@ void BoundaryConditionModule<DIM>::imposeBoundaryConditions(
 
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
 
-    for (PatchLevelIterator<DIM> pi(level); pi; pi++) { // loop over patches
-      const int patch_num = *pi;
+    // loop over local patches touching boundary of computational domain
+    const Array<int>& boundary_patches = d_boundary_patches[ln];
+    for (int k = 0; k < boundary_patches.getSize(); k++) {
+      const int patch_num = boundary_patches[k];
       Pointer< Patch<DIM> > patch = level->getPatch(patch_num);
       if ( patch.isNull() ) {
         TBOX_ERROR(  "BoundaryConditionModule::"
@@ -95,19 +101,89 @@ void BoundaryConditionModule<DIM>::imposeBoundaryConditions(
                   << endl);
       }
 
-      // check that patch touches boundary of computational domain
-      if ( d_touches_boundary[ln][patch_num] ) {
+      imposeBoundaryConditionsOnPatch(
+        *patch,
+        phi_handle,
+        lower_bc,
+        upper_bc,
+        spatial_derivative_type,
+        spatial_derivative_order,
+        component); 
+
+    } // end loop over Patches
+
+  } // end loop over PatchLevels
+
+}
+
+
+/* imposeBoundaryConditions() */
+template <int DIM>
+void BoundaryConditionModule<DIM>::imposeBoundaryConditions(
+  const int phi_handle,
+  const Array< IntVector<DIM> >& lower_bc_phi,
+  const Array< IntVector<DIM> >& upper_bc_phi,
+  const int psi_handle,
+  const Array< IntVector<DIM> >& lower_bc_psi,
+  const Array< IntVector<DIM> >& upper_bc_psi,
+  const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+  const int spatial_derivative_order,
+  const int coarsest_level,
+  const int finest_level)
+{
+  // when all components share the same boundary conditions, fill all
+  // of them in a single traversal of the boundary boxes (component = -1)
+  const bool fuse_phi_components = 
+    haveUniformBoundaryConditions(lower_bc_phi, upper_bc_phi);
+  const bool fuse_psi_components = (psi_handle >= 0) &&
+    haveUniformBoundaryConditions(lower_bc_psi, upper_bc_psi);
+
+  // loop over hierarchy and impose boundary conditions
+  const int finest_ln = (finest_level < 0) ?
+    d_patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
+
+    Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
 
+    // loop over local patches touching boundary of computational domain
+    const Array<int>& boundary_patches = d_boundary_patches[ln];
+    for (int k = 0; k < boundary_patches.getSize(); k++) {
+      const int patch_num = boundary_patches[k];
+      Pointer< Patch<DIM> > patch = level->getPatch(patch_num);
+      if ( patch.isNull() ) {
+        TBOX_ERROR(  "BoundaryConditionModule::"
+                  << "imposeBoundaryConditions(): "
+                  << "Cannot find patch. Null patch pointer."
+                  << endl);
+      }
+
+      // impose boundary conditions on phi
+      if (fuse_phi_components) {
         imposeBoundaryConditionsOnPatch(
-          *patch,
-          phi_handle,
-          lower_bc,
-          upper_bc,
-          spatial_derivative_type,
-          spatial_derivative_order,
-          component); 
+          *patch, phi_handle, lower_bc_phi[0], upper_bc_phi[0],
+          spatial_derivative_type, spatial_derivative_order, -1);
+      } else {
+        for (int comp = 0; comp < lower_bc_phi.getSize(); comp++) {
+          imposeBoundaryConditionsOnPatch(
+            *patch, phi_handle, lower_bc_phi[comp], upper_bc_phi[comp],
+            spatial_derivative_type, spatial_derivative_order, comp);
+        }
+      }
 
-      } // end case: Patch touches boundary
+      // impose boundary conditions on psi
+      if (psi_handle >= 0) {
+        if (fuse_psi_components) {
+          imposeBoundaryConditionsOnPatch(
+            *patch, psi_handle, lower_bc_psi[0], upper_bc_psi[0],
+            spatial_derivative_type, spatial_derivative_order, -1);
+        } else {
+          for (int comp = 0; comp < lower_bc_psi.getSize(); comp++) {
+            imposeBoundaryConditionsOnPatch(
+              *patch, psi_handle, lower_bc_psi[comp], upper_bc_psi[comp],
+              spatial_derivative_type, spatial_derivative_order, comp);
+          }
+        }
+      }
 
     } // end loop over Patches
 
@@ -195,8 +271,10 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCs(
 
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
 
-    for (PatchLevelIterator<DIM> pi(level); pi; pi++) { // loop over patches
-      const int patch_num = *pi;
+    // loop over local patches touching boundary of computational domain
+    const Array<int>& boundary_patches = d_boundary_patches[ln];
+    for (int k = 0; k < boundary_patches.getSize(); k++) {
+      const int patch_num = boundary_patches[k];
       Pointer< Patch<DIM> > patch = level->getPatch(patch_num);
       if ( patch.isNull() ) {
         TBOX_ERROR(  "BoundaryConditionModule::"
@@ -205,16 +283,11 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCs(
                   << endl);
       }
 
-      // check that patch touches boundary of computational domain
-      if ( d_touches_boundary[ln][patch_num] ) {
-
-        imposeAntiPeriodicBCsOnPatch(*patch,
-                                     phi_handle,
-                                     lower_bc,
-                                     upper_bc,
-                                     component);
-
-      } // end case: Patch touches boundary of computational domain
+      imposeAntiPeriodicBCsOnPatch(*patch,
+                                   phi_handle,
+                                   lower_bc,
+                                   upper_bc,
+                                   component);
 
     } // end loop over Patches
   } // end loop over PatchLevels
@@ -248,15 +321,9 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
               << endl );
   }
 
-  // get PatchGeometry
-  Pointer< CartesianPatchGeometry<DIM> > patch_geom = 
-    patch.getPatchGeometry();  
-
-  // get interior box for patch (used to compute boundary fill box)
-  Box<DIM> interior_box(patch.getBox());
-
-  // get ghostcell width to fill
-  IntVector<DIM> phi_ghost_width_to_fill = phi_data->getGhostCellWidth();
+  // get ghost box for phi
+  // NOTE: the boundary fill boxes are precomputed by
+  //       resetHierarchyConfiguration() for d_ghostcell_width
   Box<DIM> phi_ghostbox = phi_data->getGhostBox();
 
   // get data components
@@ -274,6 +341,8 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
      */
     const Array< BoundaryBox<DIM> > face_bdry = 
       d_boundary_boxes[level_num][DIM*patch_num];
+    const Array< Box<DIM> >& face_fill_boxes = 
+      d_boundary_fill_boxes[level_num][DIM*patch_num];
     for (int i = 0; i < face_bdry.getSize(); i++) {
 
       // check that boundary is a periodic boundary for level
@@ -285,8 +354,7 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
         /*
          * impose anti-periodic boundary conditions for phi 
          */
-        Box<DIM> phi_fillbox = patch_geom->getBoundaryFillBox(
-          face_bdry[i], interior_box, phi_ghost_width_to_fill);
+        const Box<DIM>& phi_fillbox = face_fill_boxes[i];
         int phi_ghostbox_num_cells_x = phi_ghostbox.numberCells(0);
         int phi_ghostbox_num_cells_y = phi_ghostbox.numberCells(1);
         IntVector<DIM> phi_ghostbox_lower = phi_ghostbox.lower();
@@ -329,6 +397,8 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
      */
     const Array< BoundaryBox<DIM> > edge_bdry = 
       d_boundary_boxes[level_num][DIM*patch_num+1];
+    const Array< Box<DIM> >& edge_fill_boxes = 
+      d_boundary_fill_boxes[level_num][DIM*patch_num+1];
     for (int i = 0; i < edge_bdry.getSize(); i++) {
 
       // check that boundary is a periodic boundary for level
@@ -370,8 +440,7 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
         /*
          * impose anti-periodic boundary conditions for phi 
          */
-        Box<DIM> phi_fillbox = patch_geom->getBoundaryFillBox(
-          edge_bdry[i], interior_box, phi_ghost_width_to_fill);
+        const Box<DIM>& phi_fillbox = edge_fill_boxes[i];
         int phi_ghostbox_num_cells_x = phi_ghostbox.numberCells(0);
         int phi_ghostbox_num_cells_y = phi_ghostbox.numberCells(1);
         IntVector<DIM> phi_ghostbox_lower = phi_ghostbox.lower();
@@ -413,6 +482,8 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
      */
     const Array< BoundaryBox<DIM> > node_bdry = 
       d_boundary_boxes[level_num][DIM*patch_num+2];
+    const Array< Box<DIM> >& node_fill_boxes = 
+      d_boundary_fill_boxes[level_num][DIM*patch_num+2];
     for (int i = 0; i < node_bdry.getSize(); i++) {
 
       // check that boundary is a periodic boundary for level
@@ -429,8 +500,7 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
         /*
          * impose anti-periodic boundary conditions for phi 
          */
-        Box<DIM> phi_fillbox = patch_geom->getBoundaryFillBox(
-          node_bdry[i], interior_box, phi_ghost_width_to_fill);
+        const Box<DIM>& phi_fillbox = node_fill_boxes[i];
         int phi_ghostbox_num_cells_x = phi_ghostbox.numberCells(0);
         int phi_ghostbox_num_cells_y = phi_ghostbox.numberCells(1);
         IntVector<DIM> phi_ghostbox_lower = phi_ghostbox.lower();
@@ -492,6 +562,8 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
      */
     const Array< BoundaryBox<DIM> > edge_bdry = 
       d_boundary_boxes[level_num][DIM*patch_num];
+    const Array< Box<DIM> >& edge_fill_boxes = 
+      d_boundary_fill_boxes[level_num][DIM*patch_num];
     for (int i = 0; i < edge_bdry.getSize(); i++) {
 
       // check that boundary is a periodic boundary for level
@@ -503,8 +575,7 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
         /*
          * impose anti-periodic boundary conditions for phi 
          */
-        Box<DIM> phi_fillbox = patch_geom->getBoundaryFillBox(
-          edge_bdry[i], interior_box, phi_ghost_width_to_fill);
+        const Box<DIM>& phi_fillbox = edge_fill_boxes[i];
         int phi_ghostbox_num_cells_x = phi_ghostbox.numberCells(0);
         IntVector<DIM> phi_ghostbox_lower = phi_ghostbox.lower();
 
@@ -541,6 +612,8 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
      */
     const Array< BoundaryBox<DIM> > node_bdry = 
       d_boundary_boxes[level_num][DIM*patch_num+1];
+    const Array< Box<DIM> >& node_fill_boxes = 
+      d_boundary_fill_boxes[level_num][DIM*patch_num+1];
     for (int i = 0; i < node_bdry.getSize(); i++) {
 
       // check that boundary is a periodic boundary for level
@@ -557,8 +630,7 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
         /*
          * impose anti-periodic boundary conditions for phi 
          */
-        Box<DIM> phi_fillbox = patch_geom->getBoundaryFillBox(
-          node_bdry[i], interior_box, phi_ghost_width_to_fill);
+        const Box<DIM>& phi_fillbox = node_fill_boxes[i];
         int phi_ghostbox_num_cells_x = phi_ghostbox.numberCells(0);
         IntVector<DIM> phi_ghostbox_lower = phi_ghostbox.lower();
 
@@ -614,6 +686,8 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
      */
     const Array< BoundaryBox<DIM> > node_bdry = 
       d_boundary_boxes[level_num][DIM*patch_num];
+    const Array< Box<DIM> >& node_fill_boxes = 
+      d_boundary_fill_boxes[level_num][DIM*patch_num];
     for (int i = 0; i < node_bdry.getSize(); i++) {
 
       // check that boundary is a periodic boundary for level
@@ -625,8 +699,7 @@ void BoundaryConditionModule<DIM>::imposeAntiPeriodicBCsOnPatch(
         /*
          * impose anti-periodic boundary conditions for phi 
          */
-        Box<DIM> phi_fillbox = patch_geom->getBoundaryFillBox(
-          node_bdry[i], interior_box, phi_ghost_width_to_fill);
+        const Box<DIM>& phi_fillbox = node_fill_boxes[i];
         IntVector<DIM> phi_ghostbox_lower = phi_ghostbox.lower();
 
         IntVector<DIM> fillbox_lower = phi_fillbox.lower();
@@ -699,8 +772,10 @@ void BoundaryConditionModule<DIM>::imposeHomogeneousNeumannBCs(
 
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
 
-    for (PatchLevelIterator<DIM> pi(level); pi; pi++) { // loop over patches
-      const int patch_num = *pi;
+    // loop over local patches touching boundary of computational domain
+    const Array<int>& boundary_patches = d_boundary_patches[ln];
+    for (int k = 0; k < boundary_patches.getSize(); k++) {
+      const int patch_num = boundary_patches[k];
       Pointer< Patch<DIM> > patch = level->getPatch(patch_num);
       if ( patch.isNull() ) {
         TBOX_ERROR(  "BoundaryConditionModule::"
@@ -709,18 +784,13 @@ void BoundaryConditionModule<DIM>::imposeHomogeneousNeumannBCs(
                   << endl);
       }
 
-      // check that patch touches boundary of computational domain
-      if ( d_touches_boundary[ln][patch_num] ) {
-
-        imposeHomogeneousNeumannBCsOnPatch(*patch,
-                                           phi_handle,
-                                           lower_bc,
-                                           upper_bc,
-                                           spatial_derivative_type,
-                                           spatial_derivative_order,
-                                           component);
-
-      } // end check: Patch touches computational boundary
+      imposeHomogeneousNeumannBCsOnPatch(*patch,
+                                         phi_handle,
+                                         lower_bc,
+                                         upper_bc,
+                                         spatial_derivative_type,
+                                         spatial_derivative_order,
+                                         component);
 
     } // end loop over Patches
   } // end loop over PatchLevels
@@ -1152,8 +1222,10 @@ void BoundaryConditionModule<DIM>::imposeLinearExtrapolationBCs(
 
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
 
-    for (PatchLevelIterator<DIM> pi(level); pi; pi++) { // loop over patches
-      const int patch_num = *pi;
+    // loop over local patches touching boundary of computational domain
+    const Array<int>& boundary_patches = d_boundary_patches[ln];
+    for (int k = 0; k < boundary_patches.getSize(); k++) {
+      const int patch_num = boundary_patches[k];
       Pointer< Patch<DIM> > patch = level->getPatch(patch_num);
       if ( patch.isNull() ) {
         TBOX_ERROR(  "BoundaryConditionModule::"
@@ -1162,16 +1234,11 @@ void BoundaryConditionModule<DIM>::imposeLinearExtrapolationBCs(
                   << endl);
       }
 
-      // check that patch touches boundary of computational domain
-      if ( d_touches_boundary[ln][patch_num] ) {
-
-        imposeLinearExtrapolationBCsOnPatch(*patch,
-                                            phi_handle,
-                                            lower_bc,
-                                            upper_bc,
-                                            component);
-
-      } // end check: Patch touches computational boundary
+      imposeLinearExtrapolationBCsOnPatch(*patch,
+                                          phi_handle,
+                                          lower_bc,
+                                          upper_bc,
+                                          component);
 
     } // end loop over Patches
   } // end loop over PatchLevels
@@ -1328,8 +1395,10 @@ void BoundaryConditionModule<DIM>::imposeSignedLinearExtrapolationBCs(
 
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
 
-    for (PatchLevelIterator<DIM> pi(level); pi; pi++) { // loop over patches
-      const int patch_num = *pi;
+    // loop over local patches touching boundary of computational domain
+    const Array<int>& boundary_patches = d_boundary_patches[ln];
+    for (int k = 0; k < boundary_patches.getSize(); k++) {
+      const int patch_num = boundary_patches[k];
       Pointer< Patch<DIM> > patch = level->getPatch(patch_num);
       if ( patch.isNull() ) {
         TBOX_ERROR(  "BoundaryConditionModule::"
@@ -1338,16 +1407,11 @@ void BoundaryConditionModule<DIM>::imposeSignedLinearExtrapolationBCs(
                   << endl);
       }
 
-      // check that patch touches boundary of computational domain
-      if ( d_touches_boundary[ln][patch_num] ) {
-
-        imposeSignedLinearExtrapolationBCsOnPatch(*patch,
-                                                  phi_handle,
-                                                  lower_bc,
-                                                  upper_bc,
-                                                  component);
-
-      } // end check: Patch touches computational boundary
+      imposeSignedLinearExtrapolationBCsOnPatch(*patch,
+                                                phi_handle,
+                                                lower_bc,
+                                                upper_bc,
+                                                component);
 
     } // end loop over Patches
   } // end loop over PatchLevels
@@ -1516,6 +1580,8 @@ void BoundaryConditionModule<DIM>::resetHierarchyConfiguration(
     d_geom_periodic_dirs = zero_int_vect;
     d_boundary_boxes.setNull();
     d_touches_boundary.setNull();
+    d_boundary_patches.setNull();
+    d_boundary_fill_boxes.setNull();
 
     return;
   }
@@ -1523,6 +1589,8 @@ void BoundaryConditionModule<DIM>::resetHierarchyConfiguration(
   // resize output arrays 
   d_boundary_boxes.resizeArray(num_levels);
   d_touches_boundary.resizeArray(num_levels);
+  d_boundary_patches.resizeArray(num_levels);
+  d_boundary_fill_boxes.resizeArray(num_levels);
 
   // get grid geometry
   Pointer< GridGeometry<DIM> > grid_geometry = 
@@ -1585,9 +1653,58 @@ void BoundaryConditionModule<DIM>::resetHierarchyConfiguration(
       true);  // true indicates that boundary boxes should be computed for
               // ALL patches (including those touching periodic boundaries)
 
+    // cache the local patches that touch the boundary of the 
+    // computational domain along with the ghost cell boxes to fill 
+    // for each of their boundary boxes
+    int num_boundary_patches = 0;
+    for (PatchLevelIterator<DIM> pi(level); pi; pi++) { // loop over patches
+      if ( d_touches_boundary[ln][*pi] ) num_boundary_patches++;
+    }
+    d_boundary_patches[ln].resizeArray(num_boundary_patches);
+    d_boundary_fill_boxes[ln].resizeArray(DIM*num_patches);
+
+    int boundary_patch_idx = 0;
+    for (PatchLevelIterator<DIM> pi(level); pi; pi++) { // loop over patches
+      const int patch_num = *pi;
+      if ( !d_touches_boundary[ln][patch_num] ) continue;
+      d_boundary_patches[ln][boundary_patch_idx++] = patch_num;
+
+      Pointer< Patch<DIM> > patch = level->getPatch(patch_num);
+      Pointer< CartesianPatchGeometry<DIM> > patch_geom = 
+        patch->getPatchGeometry();  
+      const Box<DIM>& interior_box = patch->getBox();
+      for (int bdry_type = 0; bdry_type < DIM; bdry_type++) {
+        const Array< BoundaryBox<DIM> >& bdry = 
+          d_boundary_boxes[ln][DIM*patch_num+bdry_type];
+        Array< Box<DIM> >& fill_boxes = 
+          d_boundary_fill_boxes[ln][DIM*patch_num+bdry_type];
+        fill_boxes.resizeArray(bdry.getSize());
+        for (int i = 0; i < bdry.getSize(); i++) {
+          fill_boxes[i] = patch_geom->getBoundaryFillBox(
+            bdry[i], interior_box, d_ghostcell_width);
+        }
+      }
+    } // end loop over Patches
+
   } // end loop over PatchLevels
 }
 
+
+/* haveUniformBoundaryConditions() */
+template <int DIM>
+bool BoundaryConditionModule<DIM>::haveUniformBoundaryConditions(
+  const Array< IntVector<DIM> >& lower_bc,
+  const Array< IntVector<DIM> >& upper_bc)
+{
+  for (int comp = 1; comp < lower_bc.getSize(); comp++) {
+    if ( (lower_bc[comp] != lower_bc[0]) || 
+         (upper_bc[comp] != upper_bc[0]) ) {
+      return false;
+    }
+  }
+  return true;
+}
+
 } // end LSMLIB namespace
 
 #endif
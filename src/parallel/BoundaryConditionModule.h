@@ -247,6 +247,62 @@ public:
     const int component = -1);
 
 
+  /*!
+   * imposeBoundaryConditions() imposes boundary conditions on all of
+   * the components of phi (and psi) on the entire PatchHierarchy 
+   * using a single pass over the patches that touch the boundary of 
+   * the computational domain.  Components with identical boundary
+   * conditions are filled together so that the boundary boxes of each 
+   * patch are only traversed once per distinct set of boundary 
+   * conditions.
+   *
+   * Arguments:
+   *  - phi_handle (in):                PatchData handle for phi
+   *  - lower_bc_phi (in):              lower boundary conditions for 
+   *                                    each component of phi
+   *  - upper_bc_phi (in):              upper boundary conditions for 
+   *                                    each component of phi
+   *  - psi_handle (in):                PatchData handle for psi
+   *                                    (ignored if negative)
+   *  - lower_bc_psi (in):              lower boundary conditions for 
+   *                                    each component of psi
+   *  - upper_bc_psi (in):              upper boundary conditions for 
+   *                                    each component of psi
+   *  - spatial_derivative_type (in):   type of spatial derivative 
+   *                                    calculation
+   *  - spatial_derivative_order (in):  order of spatial derivative
+   *  - coarsest_level (in):            coarsest level of hierarchy on
+   *                                    which to impose boundary 
+   *                                    conditions (default = 0)
+   *  - finest_level (in):              finest level of hierarchy on
+   *                                    which to impose boundary 
+   *                                    conditions (default = -1, i.e. 
+   *                                    finest level of hierarchy)
+   *
+   * Return value:                      none
+   *
+   * NOTES:
+   *  - The number of components of phi (and psi) is taken to be the
+   *    size of lower_bc_phi (and lower_bc_psi).
+   *
+   *  - The results are identical to calling the single-component 
+   *    version of imposeBoundaryConditions() for each component of
+   *    phi and psi.
+   *
+   */
+  virtual void imposeBoundaryConditions(
+    const int phi_handle,
+    const Array< IntVector<DIM> >& lower_bc_phi,
+    const Array< IntVector<DIM> >& upper_bc_phi,
+    const int psi_handle,
+    const Array< IntVector<DIM> >& lower_bc_psi,
+    const Array< IntVector<DIM> >& upper_bc_psi,
+    const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+    const int spatial_derivative_order,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
+
+
   /*!
    * imposeBoundaryConditionsOnPatch() imposes the specified boundary 
    * conditions for phi on the specified patch.
@@ -772,7 +828,10 @@ public:
    * The SAMRAI library internally carries out the same calculation, 
    * but it is necessary to repeat this calculation in order to 
    * impose anti-periodic boundary conditions at periodic boundaries 
-   * across which level set functions change sign.
+   * across which level set functions change sign.  The list of local
+   * patches touching the boundary of the computational domain and the
+   * ghost cell boxes to fill for each boundary box are also cached so 
+   * that boundary conditions are only imposed on those patches.
    *
    * Arguments:
    *  - patch_hierarchy (in):        PatchHierarchy to reconfigure
@@ -823,6 +882,8 @@ public:
     d_geom_periodic_dirs = rhs.d_geom_periodic_dirs;
     d_boundary_boxes = rhs.d_boundary_boxes;
     d_touches_boundary = rhs.d_touches_boundary;
+    d_boundary_patches = rhs.d_boundary_patches;
+    d_boundary_fill_boxes = rhs.d_boundary_fill_boxes;
     return *this;
   }
 
@@ -887,6 +948,22 @@ public:
     const int bdry_location_idx,
     const Box<DIM>& ghostbox);
   
+  /*!
+   * haveUniformBoundaryConditions() determines whether all components 
+   * of a field have the same boundary conditions.
+   *
+   * Arguments:
+   *  - lower_bc (in):  lower boundary conditions for each component
+   *  - upper_bc (in):  upper boundary conditions for each component
+   *
+   * Return value:      true if the boundary conditions for all 
+   *                    components are identical; false otherwise
+   *
+   */
+  static bool haveUniformBoundaryConditions(
+    const Array< IntVector<DIM> >& lower_bc,
+    const Array< IntVector<DIM> >& upper_bc);
+
   //! @}
 
 
@@ -906,6 +983,11 @@ protected:
   IntVector<DIM> d_geom_periodic_dirs;
   Array< Array< Array< BoundaryBox<DIM> > > > d_boundary_boxes;
   Array< Array<bool> > d_touches_boundary;
+
+  // local patches touching the boundary of the computational domain
+  // and the ghost cell boxes to fill for each of their boundary boxes
+  Array< Array<int> > d_boundary_patches;
+  Array< Array< Array< Box<DIM> > > > d_boundary_fill_boxes;
   
 };
 
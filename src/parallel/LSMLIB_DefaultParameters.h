@@ -20,7 +20,17 @@
 #define LSM_DEFAULT_SPATIAL_DERIVATIVE_WENO_ORDER        (5)
 #define LSM_DEFAULT_SPATIAL_DERIVATIVE_ENO_ORDER         (3)
 #define LSM_DEFAULT_TVD_RUNGE_KUTTA_ORDER                (3)
+#define LSM_DEFAULT_USE_LOW_STORAGE_RUNGE_KUTTA          (false)
+#define LSM_DEFAULT_USE_SEMI_LAGRANGIAN_ADVECTION        (false)
+#define LSM_DEFAULT_SEMI_LAGRANGIAN_CFL_NUMBER           (5.0)
+#define LSM_DEFAULT_USE_VELOCITY_TIME_INTERPOLATION      (false)
 #define LSM_DEFAULT_CFL_NUMBER                           (0.5)
+#define LSM_DEFAULT_SKIP_CONVERGED_PATCHES               (false)
+#define LSM_DEFAULT_USE_WIDE_GHOST_REGIONS               (false)
+#define LSM_DEFAULT_REINITIALIZATION_GRAD_PHI_TOL        (0.0)
+#define LSM_DEFAULT_REINITIALIZATION_GRAD_PHI_BAND_CELLS (3)
+#define LSM_DEFAULT_USE_PERSISTENT_SCRATCH_DATA         (true)
+#define LSM_DEFAULT_REUSE_GHOST_CELL_DATA               (false)
 #define LSM_DEFAULT_VERBOSE_MODE                         (false)
 
 #endif
@@ -13,6 +13,7 @@
 
 // System Headers
 #include <float.h>
+#include <math.h>
 #include <sstream>
 
 #include "LevelSetFunctionIntegrator.h" 
@@ -27,8 +28,11 @@
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CoarsenOperator.h"
 #include "PatchLevel.h"
 #include "RefineOperator.h"
+#include "TimeInterpolateOperator.h"
+#include "Variable.h"
 #include "VariableContext.h"
 #include "VariableDatabase.h"
 #include "tbox/RestartManager.h"
@@ -49,6 +53,7 @@ extern "C" {
   #include "lsm_utilities1d.h"
   #include "lsm_utilities2d.h"
   #include "lsm_utilities3d.h"
+  #include "lsm_samrai_f77_utilities.h"
 }
 
 // SAMRAI namespaces
@@ -69,8 +74,10 @@ using namespace pdat;
 #define LSM_DEFAULT_ORTHOGONALIZATION_MAX_ITERS          (25)
 #define LSM_DEFAULT_USE_AMR                              (false)
 #define LSM_DEFAULT_REGRID_INTERVAL                      (5)  // KTC - ADJUST
+#define LSM_DEFAULT_USE_INTERFACE_PROXIMITY_REGRID       (false)
 #define LSM_DEFAULT_TAG_BUFFER_WIDTH                     (2)  // KTC - ADJUST
 #define LSM_DEFAULT_REFINEMENT_CUTOFF_VALUE              (1.0)  // KTC - ADJUST
+#define LSM_DEFAULT_USE_SUBCYCLING                       (false)
 #define LSM_DEFAULT_VERBOSE_MODE                         (false)
 #define LSM_STOP_TOLERANCE_MAX_ITERATIONS                (1000)
 
@@ -97,6 +104,7 @@ LevelSetFunctionIntegrator<DIM>::LevelSetFunctionIntegrator(
   const int codimension,
   const string& object_name) 
 :
+  d_psi_old_handle(-1),
   d_grad_psi_plus_handle(-1),
   d_grad_psi_minus_handle(-1),
   d_grad_psi_upwind_handle(-1),
@@ -172,14 +180,66 @@ LevelSetFunctionIntegrator<DIM>::LevelSetFunctionIntegrator(
   }
   getFromInput(input_db, is_from_restart);
 
+  // set allocation policy for toolbox scratch data
+  LevelSetMethodToolbox<DIM>::setUsePersistentScratchData(
+    d_use_persistent_scratch_data);
+
+  // semi-Lagrangian advection is only valid for pure advection problems
+  if ( d_use_semi_lagrangian_advection &&
+       ( !d_lsm_velocity_field_strategy->providesExternalVelocityField() ||
+         d_lsm_velocity_field_strategy->providesNormalVelocityField() ) ) {
+    TBOX_ERROR(  d_object_name 
+              << "::LevelSetFunctionIntegrator(): "
+              << "semi-Lagrangian advection requires an external "
+              << "velocity field and no normal velocity field."
+              << endl );
+  }
+
+  // the fused TVD Runge-Kutta stage kernels evaluate the RHS of the 
+  // level set equation in place when it consists of a single advection 
+  // or normal velocity term, so the RHS is never stored
+  d_use_fused_tvd_rk_stages = (DIM > 1) && 
+    ( d_lsm_velocity_field_strategy->providesExternalVelocityField() != 
+      d_lsm_velocity_field_strategy->providesNormalVelocityField() );
+
+  // set number of level set function registers used by time integration
+  // NOTE: the low-storage SSP Runge-Kutta methods only require the 
+  //       current level set function and a single stage register.
+  //       the semi-Lagrangian BFECC step requires the current level 
+  //       set function and two intermediate registers.
+  if (d_use_semi_lagrangian_advection) {
+    d_num_rk_registers = 3;
+  } else if (d_use_low_storage_runge_kutta && 
+             (d_tvd_runge_kutta_order > 1)) {
+    d_num_rk_registers = 2;
+  } else {
+    d_num_rk_registers = d_tvd_runge_kutta_order;
+  }
+
   // initialize current time, integrator step and counter variables
   if (!is_from_restart) {
     d_current_time = d_start_time;
     d_num_integration_steps_taken = 0;
     d_regrid_count = 0;
+    d_interface_displacement_since_regrid = 0.0;
     d_reinitialization_count = 0;
     d_orthogonalization_count = 0;
   }
+  d_max_interface_speed = -1.0;  // unknown until computeStableDt() is called
+  d_num_reinitializations = 0;
+  d_num_reinitializations_skipped = 0;
+  d_grad_phi_deviation = -1.0;  // unknown until computeStableDt() is called
+  d_ghost_cells_current = false;
+  d_num_ghost_fills_skipped = 0;
+  d_num_cached_velocity_fields = -1;  // cache is registered on first use
+  d_num_velocity_computations = 0;
+  d_num_velocity_computations_skipped = 0;
+
+  // the time advance updates all levels unless finer levels are 
+  // subcycled (finest level number < 0 indicates the finest level in 
+  // the PatchHierarchy until resetHierarchyConfiguration() is called)
+  d_coarsest_active_level = 0;
+  d_finest_active_level = -1;
 
   // initialize variables and communication objects
   initializeVariables();
@@ -258,7 +318,11 @@ LevelSetFunctionIntegrator<DIM>::~LevelSetFunctionIntegrator()
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
     level->deallocatePatchData(d_solution_variables); 
     level->deallocatePatchData(d_persistent_variables); 
+    level->deallocatePatchData(d_compute_stable_dt_scratch_variables); 
+    level->deallocatePatchData(d_time_advance_scratch_variables); 
+    level->deallocatePatchData(d_velocity_cache_variables); 
   }
+  LevelSetMethodToolbox<DIM>::deallocateScratchData(d_patch_hierarchy);
 
 }
 
@@ -283,6 +347,16 @@ LevelSetFunctionIntegrator<DIM>::printClassData(
   os << "d_spatial_derivative_type = " << d_spatial_derivative_type << endl;
   os << "d_spatial_derivative_order = " << d_spatial_derivative_order << endl;
   os << "d_tvd_runge_kutta_order = " << d_tvd_runge_kutta_order << endl;
+  os << "d_use_low_storage_runge_kutta = " 
+     << d_use_low_storage_runge_kutta << endl;
+  os << "d_use_fused_tvd_rk_stages = " 
+     << d_use_fused_tvd_rk_stages << endl;
+  os << "d_use_semi_lagrangian_advection = " 
+     << d_use_semi_lagrangian_advection << endl;
+  os << "d_semi_lagrangian_cfl_number = " 
+     << d_semi_lagrangian_cfl_number << endl;
+  os << "d_use_velocity_time_interpolation = " 
+     << (d_use_velocity_time_interpolation ? "true" : "false") << endl;
   os << "d_reinitialization_interval = " 
      << d_reinitialization_interval << endl;
   os << "d_reinitialization_stop_tol = " 
@@ -291,6 +365,10 @@ LevelSetFunctionIntegrator<DIM>::printClassData(
      << d_reinitialization_stop_dist << endl;
   os << "d_reinitialization_max_iters = " 
      << d_reinitialization_max_iters << endl;
+  os << "d_reinitialization_grad_phi_tol = " 
+     << d_reinitialization_grad_phi_tol << endl;
+  os << "d_reinitialization_grad_phi_band_cells = " 
+     << d_reinitialization_grad_phi_band_cells << endl;
   os << "d_orthogonalization_interval = " 
      << d_orthogonalization_interval << endl;
   os << "d_orthogonalization_stop_tol = " 
@@ -303,9 +381,17 @@ LevelSetFunctionIntegrator<DIM>::printClassData(
   os << "AMR parameters" << endl;
   os << "--------------" << endl;
   os << "d_use_AMR = " << (d_use_AMR ? "true" : "false") << endl;
+  os << "d_use_persistent_scratch_data = " 
+     << (d_use_persistent_scratch_data ? "true" : "false") << endl;
+  os << "d_reuse_ghost_cell_data = " 
+     << (d_reuse_ghost_cell_data ? "true" : "false") << endl;
   os << "d_regrid_interval = " << d_regrid_interval << endl;
+  os << "d_use_interface_proximity_regrid = " 
+     << (d_use_interface_proximity_regrid ? "true" : "false") << endl;
   os << "d_tag_buffer_width = " << d_tag_buffer_width << endl;
   os << "d_refinement_cutoff_value = " << d_refinement_cutoff_value << endl;
+  os << "d_use_subcycling = " 
+     << (d_use_subcycling ? "true" : "false") << endl;
 
   os << "PatchData Handles" << endl;
   os << "-----------------" << endl;
@@ -321,8 +407,18 @@ LevelSetFunctionIntegrator<DIM>::printClassData(
   os << "-------------" << endl;
   os << "d_current_time = " << d_current_time << endl;
   os << "d_reinitialization_count = " << d_reinitialization_count << endl;
+  os << "d_num_reinitializations = " << d_num_reinitializations << endl;
+  os << "d_num_reinitializations_skipped = " 
+     << d_num_reinitializations_skipped << endl;
   os << "d_orthogonalization_count = " << d_orthogonalization_count << endl;
   os << "d_regrid_count = " << d_regrid_count << endl;
+  os << "d_interface_displacement_since_regrid = " 
+     << d_interface_displacement_since_regrid << endl;
+  os << "d_num_ghost_fills_skipped = " << d_num_ghost_fills_skipped << endl;
+  os << "d_num_velocity_computations = " 
+     << d_num_velocity_computations << endl;
+  os << "d_num_velocity_computations_skipped = " 
+     << d_num_velocity_computations_skipped << endl;
 
   os << "Object Pointers" << endl;
   os << "---------------" << endl;
@@ -361,43 +457,43 @@ LSMLIB_REAL LevelSetFunctionIntegrator<DIM>::computeStableDt()
    * NOTE: advection_dt and normal_vel_dt are only used if the respective
    *       velocity fields are provided by the 
    *       LevelSetMethodVelocityFieldStrategy.
+   *
+   * NOTE: when finer levels are subcycled, the dt values are computed 
+   *       separately on each level and multiplied by the number of 
+   *       time steps taken on that level per time step on the coarsest
+   *       level.
    */
   LSMLIB_REAL max_advection_dt = LSMLIB_REAL_MAX;
   LSMLIB_REAL max_normal_vel_dt = LSMLIB_REAL_MAX;
+  LSMLIB_REAL max_level_dt = LSMLIB_REAL_MAX;
   LSMLIB_REAL max_user_specified_dt = LSMLIB_REAL_MAX;
 
   // allocate scratch space
   const int num_levels = d_patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    Pointer< PatchLevel<DIM> > level = 
-      d_patch_hierarchy->getPatchLevel(ln);
-    level->allocatePatchData( d_compute_stable_dt_scratch_variables );
-  }
+  allocateScratchData(d_compute_stable_dt_scratch_variables);
+
+  // set up level ranges over which the dt values are computed
+  const bool use_subcycling = d_use_subcycling && (num_levels > 1);
+  const int num_level_ranges = use_subcycling ? num_levels : 1;
  
   // fill boundary data to for phi/psi to be used for computing
   // velocity field
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    // NOTE: true indicates that physical boundary conditions should
-    //       be set.
-    d_fill_bdry_sched_compute_stable_dt[ln]->fillData(d_current_time,true);
-  }
-  for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
-    d_bc_module->imposeBoundaryConditions(
-      d_phi_handles[0],
-      d_lower_bc_phi[comp], 
-      d_upper_bc_phi[comp], 
-      d_spatial_derivative_type,
-      d_spatial_derivative_order,
-      comp);
-    if (d_codimension == 2) {
-      d_bc_module->imposeBoundaryConditions(
-        d_psi_handles[0],
-        d_lower_bc_psi[comp], 
-        d_upper_bc_psi[comp], 
-        d_spatial_derivative_type,
-        d_spatial_derivative_order,
-        comp);
+  // NOTE: when reuse_ghost_cell_data is TRUE, this fill is elided if 
+  //       it would be redundant (i.e. the ghost cells filled at the end
+  //       of the previous time step are still current).  The fill 
+  //       itself is unchanged and completes before any patch data is 
+  //       used.
+  if (d_reuse_ghost_cell_data && d_ghost_cells_current) {
+    d_num_ghost_fills_skipped++;
+  } else {
+    for ( int ln=0 ; ln < num_levels; ln++ ) {
+      // NOTE: true indicates that physical boundary conditions should
+      //       be set.
+      d_fill_bdry_sched_compute_stable_dt[ln]->fillData(d_current_time,
+                                                        true);
     }
+    imposeLevelSetFunctionBoundaryConditions(0);
+    d_ghost_cells_current = true;
   }
 
   // loop over PatchHierarchy and compute the maximum stable
@@ -405,6 +501,8 @@ LSMLIB_REAL LevelSetFunctionIntegrator<DIM>::computeStableDt()
   for ( int ln=0 ; ln < num_levels; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
+    const int num_steps_on_level = 
+      use_subcycling ? getNumberOfStepsOnLevel(ln) : 1;
 
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
@@ -425,6 +523,7 @@ LSMLIB_REAL LevelSetFunctionIntegrator<DIM>::computeStableDt()
           *patch,
           this,
           d_lsm_velocity_field_strategy);
+      user_specified_dt_on_patch *= num_steps_on_level;
 
       // update max_user_specified_dt
       if ( (max_user_specified_dt > user_specified_dt_on_patch)  &&
@@ -443,6 +542,9 @@ LSMLIB_REAL LevelSetFunctionIntegrator<DIM>::computeStableDt()
 
     max_stable_dt = max_user_specified_dt;
 
+    // the velocity field is not examined, so the interface speed is unknown
+    d_max_interface_speed = -1.0;
+
     if (d_verbose_mode) {
       pout << endl;
       pout << d_object_name << "::computeStableDt():" << endl;
@@ -455,38 +557,13 @@ LSMLIB_REAL LevelSetFunctionIntegrator<DIM>::computeStableDt()
 
       // compute the velocity field for calculation of 
       // advection_dt and normal_vel_dt
-      d_lsm_velocity_field_strategy->computeVelocityField(
+      setVelocityField(
         d_current_time, 
         d_phi_handles[0], d_psi_handles[0],
         comp);
-  
-      /*
-       *  If necessary, compute the maximum CFL-based advection dt 
-       *  on the current patch
-       */
-      if (d_lsm_velocity_field_strategy->providesExternalVelocityField()) {
-        LSMLIB_REAL max_advection_dt_for_component = 
-          LevelSetMethodToolbox<DIM>::computeStableAdvectionDt(
-            d_patch_hierarchy,
-            d_lsm_velocity_field_strategy->
-              getExternalVelocityFieldPatchDataHandle(comp),
-            d_control_volume_handle,
-            d_cfl_number);
 
-        if ( (max_advection_dt > max_advection_dt_for_component) &&
-             (max_advection_dt_for_component > 0) ) {
-          max_advection_dt = max_advection_dt_for_component;
-        }
-
-      } // end advection velocity dt calculation
-
-      /*
-       *  If necessary, compute the maximum CFL-based normal velocity
-       *  dt on the current patch
-       */
+      // compute spatial derivatives for calculation of normal_vel_dt
       if (d_lsm_velocity_field_strategy->providesNormalVelocityField()) {
-  
-        // compute normal velocity dt for phi
         LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
           d_patch_hierarchy,
           d_spatial_derivative_type,
@@ -495,61 +572,137 @@ LSMLIB_REAL LevelSetFunctionIntegrator<DIM>::computeStableDt()
           d_grad_phi_minus_handle,
           d_phi_handles[0],
           comp);
-  
-        LSMLIB_REAL max_phi_normal_vel_dt_for_component = 
-          LevelSetMethodToolbox<DIM>::computeStableNormalVelocityDt(
-            d_patch_hierarchy,
-            d_lsm_velocity_field_strategy->
-              getNormalVelocityFieldPatchDataHandle(PHI, comp),
-            d_grad_phi_plus_handle,
-            d_grad_phi_minus_handle,
-            d_control_volume_handle,
-            d_cfl_number);
-  
-        if ( (max_normal_vel_dt > max_phi_normal_vel_dt_for_component) &&
-             (max_phi_normal_vel_dt_for_component > 0) ) {
-          max_normal_vel_dt = max_phi_normal_vel_dt_for_component;
-        }
 
         if (d_codimension == 2) {
-          // compute normal velocity dt for psi
           LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
-          d_patch_hierarchy,
-          d_spatial_derivative_type,
-          d_spatial_derivative_order,
-          d_grad_psi_plus_handle,
-          d_grad_psi_minus_handle,
-          d_psi_handles[0],
-          comp);
+            d_patch_hierarchy,
+            d_spatial_derivative_type,
+            d_spatial_derivative_order,
+            d_grad_psi_plus_handle,
+            d_grad_psi_minus_handle,
+            d_psi_handles[0],
+            comp);
+        }
+      }
+
+      // loop over level ranges (a single level range containing the 
+      // entire PatchHierarchy unless finer levels are subcycled)
+      for (int lr = 0; lr < num_level_ranges; lr++) {
+
+        const int coarsest_ln = use_subcycling ? lr : 0;
+        const int finest_ln = use_subcycling ? lr : -1;
+        const int num_steps_on_level = 
+          use_subcycling ? getNumberOfStepsOnLevel(lr) : 1;
+
+        /*
+         *  If necessary, compute the maximum CFL-based advection dt 
+         *  on the current level range
+         */
+        if (d_lsm_velocity_field_strategy->providesExternalVelocityField()) {
+          // NOTE: the semi-Lagrangian step is not subject to the usual
+          //       advective CFL restriction, so a separate (larger) CFL 
+          //       number is used to limit the departure point distance
+          const LSMLIB_REAL cfl_number = d_use_semi_lagrangian_advection ?
+            d_semi_lagrangian_cfl_number : d_cfl_number;
+          LSMLIB_REAL max_advection_dt_for_component = 
+            LevelSetMethodToolbox<DIM>::computeStableAdvectionDt(
+              d_patch_hierarchy,
+              d_lsm_velocity_field_strategy->
+                getExternalVelocityFieldPatchDataHandle(comp),
+              d_control_volume_handle,
+              cfl_number,
+              false,  // reduction is done below
+              coarsest_ln, finest_ln);
+
+          if ( (max_advection_dt > max_advection_dt_for_component) &&
+               (max_advection_dt_for_component > 0) ) {
+            max_advection_dt = max_advection_dt_for_component;
+          }
+          if ( (max_level_dt > 
+                num_steps_on_level*max_advection_dt_for_component) &&
+               (max_advection_dt_for_component > 0) ) {
+            max_level_dt = num_steps_on_level*max_advection_dt_for_component;
+          }
+
+        } // end advection velocity dt calculation
+
+        /*
+         *  If necessary, compute the maximum CFL-based normal velocity
+         *  dt on the current level range
+         */
+        if (d_lsm_velocity_field_strategy->providesNormalVelocityField()) {
   
-          LSMLIB_REAL max_psi_normal_vel_dt_for_component = 
+          // compute normal velocity dt for phi
+          LSMLIB_REAL max_phi_normal_vel_dt_for_component = 
             LevelSetMethodToolbox<DIM>::computeStableNormalVelocityDt(
               d_patch_hierarchy,
               d_lsm_velocity_field_strategy->
-                getNormalVelocityFieldPatchDataHandle(PSI, comp),
-              d_grad_psi_plus_handle,
-              d_grad_psi_minus_handle,
+                getNormalVelocityFieldPatchDataHandle(PHI, comp),
+              d_grad_phi_plus_handle,
+              d_grad_phi_minus_handle,
               d_control_volume_handle,
-              d_cfl_number);
+              d_cfl_number,
+              false,  // reduction is done below
+              coarsest_ln, finest_ln);
+  
+          if ( (max_normal_vel_dt > max_phi_normal_vel_dt_for_component) &&
+               (max_phi_normal_vel_dt_for_component > 0) ) {
+            max_normal_vel_dt = max_phi_normal_vel_dt_for_component;
+          }
+          if ( (max_level_dt > 
+                num_steps_on_level*max_phi_normal_vel_dt_for_component) &&
+               (max_phi_normal_vel_dt_for_component > 0) ) {
+            max_level_dt = 
+              num_steps_on_level*max_phi_normal_vel_dt_for_component;
+          }
 
-          if ( (max_normal_vel_dt > max_psi_normal_vel_dt_for_component) &&
-               (max_psi_normal_vel_dt_for_component > 0) ) {
-            max_normal_vel_dt = max_psi_normal_vel_dt_for_component;
+          if (d_codimension == 2) {
+            // compute normal velocity dt for psi
+            LSMLIB_REAL max_psi_normal_vel_dt_for_component = 
+              LevelSetMethodToolbox<DIM>::computeStableNormalVelocityDt(
+                d_patch_hierarchy,
+                d_lsm_velocity_field_strategy->
+                  getNormalVelocityFieldPatchDataHandle(PSI, comp),
+                d_grad_psi_plus_handle,
+                d_grad_psi_minus_handle,
+                d_control_volume_handle,
+                d_cfl_number,
+                false,  // reduction is done below
+                coarsest_ln, finest_ln);
+
+            if ( (max_normal_vel_dt > max_psi_normal_vel_dt_for_component) &&
+                 (max_psi_normal_vel_dt_for_component > 0) ) {
+              max_normal_vel_dt = max_psi_normal_vel_dt_for_component;
+            }
+            if ( (max_level_dt > 
+                  num_steps_on_level*max_psi_normal_vel_dt_for_component) &&
+                 (max_psi_normal_vel_dt_for_component > 0) ) {
+              max_level_dt = 
+                num_steps_on_level*max_psi_normal_vel_dt_for_component;
+            }
           }
-        }
   
-      } // end normal velocity dt calculation
+        } // end normal velocity dt calculation
+
+      } // end loop over level ranges
 
     } // end loop over components of level set functions
   
   
     /*
      * compute max_stable_dt
+     * NOTE: max_level_dt is the smaller of advection_dt and 
+     *       normal_vel_dt unless finer levels are subcycled
      */
-    max_stable_dt = max_advection_dt;
-
-    // take max_normal_vel_dt if it is smaller 
-    if (max_normal_vel_dt < max_stable_dt) max_stable_dt = max_normal_vel_dt;
+    max_stable_dt = max_level_dt;
+
+    // the low-storage SSP Runge-Kutta methods have an SSP coefficient
+    // of 2 (i.e. each stage is a forward Euler step of size dt/2), 
+    // so they remain stable for twice the forward Euler time step
+    if ( !d_use_semi_lagrangian_advection && 
+         d_use_low_storage_runge_kutta && (d_tvd_runge_kutta_order > 1) ) {
+      max_stable_dt *= 2.0;
+    }
   
     // take physics_dt if it is smaller 
     LSMLIB_REAL physics_dt = d_lsm_velocity_field_strategy->computeStableDt();
@@ -559,12 +712,78 @@ LSMLIB_REAL LevelSetFunctionIntegrator<DIM>::computeStableDt()
 
     /*
      * Take the minimum across all processors.
-     * NOTE:  this reduction takes care of two important cases:
+     * NOTE:  the advection and normal velocity dt values computed above
+     *        are local to this processor, so they are reduced together
+     *        with max_stable_dt in a single batch of reductions.
+     *        The reduction of max_stable_dt takes care of two important 
+     *        cases:
      *        (1) max_user_specified_dt is smallest and 
      *        (2) the concrete subclass of LevelSetMethodVelocityFieldStrategy
      *            physics_dt forgets to do a reduction
+     * NOTE:  only the values added here are removed from the batch 
+     *        afterwards, so values added by the application are preserved.
      */
-    max_stable_dt = tbox::MPI::minReduction(max_stable_dt);
+    const int batch_start = 
+      LevelSetMethodToolbox<DIM>::getReductionBatchSize();
+    const int max_advection_dt_idx = 
+      LevelSetMethodToolbox<DIM>::addToReductionBatch(
+        max_advection_dt, LevelSetMethodToolbox<DIM>::REDUCTION_MIN);
+    const int max_normal_vel_dt_idx = 
+      LevelSetMethodToolbox<DIM>::addToReductionBatch(
+        max_normal_vel_dt, LevelSetMethodToolbox<DIM>::REDUCTION_MIN);
+    const int max_stable_dt_idx = 
+      LevelSetMethodToolbox<DIM>::addToReductionBatch(
+        max_stable_dt, LevelSetMethodToolbox<DIM>::REDUCTION_MIN);
+
+    // when the next time step is a candidate step for adaptive
+    // reinitialization, the sums used to measure the drift of the level
+    // set functions from distance functions are reduced in the same batch
+    const bool measure_grad_phi_deviation = 
+      d_use_reinitialization && d_use_adaptive_reinitialization &&
+      (0 == (d_reinitialization_count+1) % d_reinitialization_interval);
+    Array<LSMLIB_REAL> grad_phi_deviation_sums;
+    int grad_phi_deviation_sums_idx = -1;
+    if (measure_grad_phi_deviation) {
+      accumulateGradPhiDeviationSums(grad_phi_deviation_sums);
+      for (int i = 0; i < grad_phi_deviation_sums.getSize(); i++) {
+        const int idx = LevelSetMethodToolbox<DIM>::addToReductionBatch(
+          grad_phi_deviation_sums[i], 
+          LevelSetMethodToolbox<DIM>::REDUCTION_SUM);
+        if (i == 0) grad_phi_deviation_sums_idx = idx;
+      }
+    }
+
+    LevelSetMethodToolbox<DIM>::completeReductionBatch();
+    max_advection_dt = 
+      LevelSetMethodToolbox<DIM>::getReducedValue(max_advection_dt_idx);
+    max_normal_vel_dt = 
+      LevelSetMethodToolbox<DIM>::getReducedValue(max_normal_vel_dt_idx);
+    max_stable_dt = 
+      LevelSetMethodToolbox<DIM>::getReducedValue(max_stable_dt_idx);
+    if (measure_grad_phi_deviation) {
+      for (int i = 0; i < grad_phi_deviation_sums.getSize(); i++) {
+        grad_phi_deviation_sums[i] = 
+          LevelSetMethodToolbox<DIM>::getReducedValue(
+            grad_phi_deviation_sums_idx + i);
+      }
+      d_grad_phi_deviation = 
+        computeMaxGradPhiDeviation(grad_phi_deviation_sums);
+    }
+    LevelSetMethodToolbox<DIM>::truncateReductionBatch(batch_start);
+
+    // bound on the number of grid cells (on any level) that the zero 
+    // level set can cross per unit time.  The stable dt computations 
+    // return cfl_number divided by the max over all cells of 
+    // sum_i |V_i|/dx_i (or the normal velocity analog).
+    d_max_interface_speed = 0.0;
+    if (max_advection_dt < LSMLIB_REAL_MAX) {
+      const LSMLIB_REAL cfl_number = d_use_semi_lagrangian_advection ?
+        d_semi_lagrangian_cfl_number : d_cfl_number;
+      d_max_interface_speed += cfl_number/max_advection_dt;
+    }
+    if (max_normal_vel_dt < LSMLIB_REAL_MAX) {
+      d_max_interface_speed += d_cfl_number/max_normal_vel_dt;
+    }
 
     if (d_verbose_mode) {
       pout << endl;
@@ -576,12 +795,8 @@ LSMLIB_REAL LevelSetFunctionIntegrator<DIM>::computeStableDt()
 
   } // end case: user_specified_dt not provided
 
-  // deallocate patch data that was allocated for the time advance
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    Pointer< PatchLevel<DIM> > level 
-      = d_patch_hierarchy->getPatchLevel(ln);
-    level->deallocatePatchData( d_compute_stable_dt_scratch_variables );
-  }
+  // release patch data that was allocated for computing the stable dt
+  releaseScratchData(d_compute_stable_dt_scratch_variables);
 
   return max_stable_dt;
 }
@@ -596,63 +811,57 @@ bool LevelSetFunctionIntegrator<DIM>::advanceLevelSetFunctions(
   const int num_levels = d_patch_hierarchy->getNumberLevels();
   
   // if this is the first time step, synchronize data across processors 
-  // NOTE:  normally this is done at the end of the time advance
-  if (d_current_time == d_start_time) {
+  // NOTE:  normally this is done at the end of the time advance.
+  //        when reuse_ghost_cell_data is TRUE, the synchronization is 
+  //        elided if the ghost cells are known to be current and
+  //        performed otherwise.
+  const bool fill_ghost_cells = d_reuse_ghost_cell_data ? 
+    !d_ghost_cells_current : (d_current_time == d_start_time);
+  if (fill_ghost_cells) {
     for ( int ln=0 ; ln < num_levels; ln++ ) {
       // NOTE: true indicates that physical boundary conditions should
       //       be set.
       d_fill_bdry_sched_time_advance[0][ln]
        ->fillData(d_current_time,true);
     }
-    for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
-      d_bc_module->imposeBoundaryConditions(
-        d_phi_handles[0],
-        d_lower_bc_phi[comp], 
-        d_upper_bc_phi[comp], 
-        d_spatial_derivative_type,
-        d_spatial_derivative_order,
-        comp);
-      if (d_codimension == 2) {
-        d_bc_module->imposeBoundaryConditions(
-          d_psi_handles[0],
-          d_lower_bc_psi[comp], 
-          d_upper_bc_psi[comp], 
-          d_spatial_derivative_type,
-          d_spatial_derivative_order,
-          comp);
-      }
-    }
+    imposeLevelSetFunctionBoundaryConditions(0);
+  } else if (d_reuse_ghost_cell_data) {
+    d_num_ghost_fills_skipped++;
   } // end synchronization of data for initial time step
 
   // allocate scratch space
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    Pointer< PatchLevel<DIM> > level = 
-      d_patch_hierarchy->getPatchLevel(ln);
-    level->allocatePatchData( d_time_advance_scratch_variables );
-  }
+  allocateScratchData(d_time_advance_scratch_variables);
+
+  // the time advance only updates the interior of the level set 
+  // functions
+  d_ghost_cells_current = false;
  
-  // advance level set equation using TVD Runge-Kutta 
-  switch(d_tvd_runge_kutta_order) {
-    case 1: { // first-order TVD RK (e.g. Forward Euler)
-      advanceLevelSetEqnUsingTVDRK1(dt);
-      break;
-    }
-    case 2: { // second-order TVD RK 
-      advanceLevelSetEqnUsingTVDRK2(dt);
-      break;
-    }
-    case 3: { // third-order TVD RK 
+  if (d_use_subcycling && (num_levels > 1)) {
 
-      advanceLevelSetEqnUsingTVDRK3(dt);
-      break;
-    }
-    default: { // UNSUPPORTED ORDER
-      TBOX_ERROR(  d_object_name
-                << "::advanceLevelSetFunctions(): " 
-                << "Unsupported TVD Runge-Kutta order.  "
-                << "Only TVD-RK1, TVD-RK2, and TVD-RK3 supported."
-                << endl);
-    }
+    // advance the coarsest level and (recursively) advance the finer 
+    // levels using smaller time steps
+    const LSMLIB_REAL start_time = d_current_time;
+    advanceLevel(0, start_time, dt);
+
+    // restore the time at the beginning of the time step and the levels
+    // updated by the time advance
+    d_current_time = start_time;
+    d_coarsest_active_level = 0;
+    d_finest_active_level = num_levels-1;
+
+  } else {
+
+    advanceLevelSetEqn(dt);
+
+  }
+
+  // velocity fields cached at the end of the time step were computed 
+  // from the predicted level set functions, so they are only reused 
+  // in later time steps if the velocity does not depend on the level 
+  // set functions
+  if (d_lsm_velocity_field_strategy->
+        velocityFieldDependsOnLevelSetFunctions()) {
+    invalidateVelocityFieldCache();
   }
 
   // increment reinitialization and orthogonalization counters
@@ -687,21 +896,57 @@ bool LevelSetFunctionIntegrator<DIM>::advanceLevelSetFunctions(
               (0 == d_reinitialization_count % d_reinitialization_interval) )
   {
     // case: reinitialization step, but not an orthogonalization step
-    reinitializeLevelSetFunctions(PHI);
-    if (d_codimension == 2) {
-      reinitializeLevelSetFunctions(PSI);
+    //       (when adaptive reinitialization is used, this is only a
+    //       candidate step)
+    if (reinitializationNeeded()) {
+      reinitializeLevelSetFunctions(PHI);
+      if (d_codimension == 2) {
+        reinitializeLevelSetFunctions(PSI);
+      }
+      d_num_reinitializations++;
+    } else {
+      d_num_reinitializations_skipped++;
+    }
+
+    if (d_verbose_mode && d_use_adaptive_reinitialization) {
+      pout << d_object_name << "::advanceLevelSetFunctions(): "
+           << "reinitializations = " << d_num_reinitializations
+           << ", skipped = " << d_num_reinitializations_skipped << endl;
     }
 
     // reset reinitialization counter 
     d_reinitialization_count = 0;
   } 
 
+  // the drift measured by computeStableDt() is only used during the 
+  // time step that it was measured for
+  d_grad_phi_deviation = -1.0;
+
   // determine if patch hierarchy needs to be regridded
-  // KTC - DO SOMETHING SMARTER
-  // regrid patch hierachy
   bool regrid_needed = false;
-  if (0 == d_regrid_count%d_regrid_interval) 
-  {
+  if (d_use_interface_proximity_regrid && (d_max_interface_speed >= 0)) {
+
+    // regrid when the zero level set could leave the buffer of cells
+    // around the cells tagged for refinement during the next time step
+    const LSMLIB_REAL step_displacement = dt*d_max_interface_speed;
+    d_interface_displacement_since_regrid += step_displacement;
+    if (d_interface_displacement_since_regrid + step_displacement 
+        >= d_tag_buffer_width) {
+      regrid_needed = true;
+      d_interface_displacement_since_regrid = 0.0;
+    }
+    d_regrid_count = regrid_needed ? 1 : d_regrid_count+1;
+
+    if (d_verbose_mode) {
+      pout << d_object_name << "::advanceLevelSetFunctions(): "
+           << "interface displacement since regrid = " 
+           << d_interface_displacement_since_regrid << " cells"
+           << (regrid_needed ? " (regrid needed)" : "") << endl;
+    }
+
+  } else if (0 == d_regrid_count%d_regrid_interval) {
+    // fall back to the fixed regridding interval when the interface
+    // speed is not known (e.g. user-specified dt)
     regrid_needed = true;
     d_regrid_count = 1;
   } else {
@@ -712,12 +957,8 @@ bool LevelSetFunctionIntegrator<DIM>::advanceLevelSetFunctions(
   d_current_time += dt;
   d_num_integration_steps_taken++;
 
-  // deallocate patch data that was allocated for the time advance
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    Pointer< PatchLevel<DIM> > level 
-      = d_patch_hierarchy->getPatchLevel(ln);
-    level->deallocatePatchData( d_time_advance_scratch_variables );
-  }
+  // release patch data that was allocated for the time advance
+  releaseScratchData(d_time_advance_scratch_variables);
 
   // synchronize data across processors
   for ( int ln=0 ; ln < num_levels; ln++ ) {
@@ -726,111 +967,647 @@ bool LevelSetFunctionIntegrator<DIM>::advanceLevelSetFunctions(
     d_fill_bdry_sched_time_advance[0][ln]
      ->fillData(d_current_time,true);
   }
-  for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
-    d_bc_module->imposeBoundaryConditions(
-      d_phi_handles[0],
-      d_lower_bc_phi[comp], 
-      d_upper_bc_phi[comp], 
-      d_spatial_derivative_type,
-      d_spatial_derivative_order,
-      comp);
-    if (d_codimension == 2) {
-      d_bc_module->imposeBoundaryConditions(
-        d_psi_handles[0],
-        d_lower_bc_psi[comp], 
-        d_upper_bc_psi[comp], 
-        d_spatial_derivative_type,
-        d_spatial_derivative_order,
-        comp);
-    }
-  }
+  imposeLevelSetFunctionBoundaryConditions(0);
+  d_ghost_cells_current = true;
 
-  // reinitialize level set functions to approximate distance functions
   return regrid_needed;
 }
 
 
-/* preprocessInitializeVelocityField() */
+/* advanceLevelSetEqn() */
 template <int DIM> 
-void LevelSetFunctionIntegrator<DIM>::preprocessInitializeVelocityField(
-  int& phi_handle,
-  int& psi_handle,
-  const Pointer< PatchHierarchy<DIM> > hierarchy,
-  const int level_number)
+void LevelSetFunctionIntegrator<DIM>::advanceLevelSetEqn(
+  const LSMLIB_REAL dt)
 {
-  Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(level_number);
+  // advance level set equation using semi-Lagrangian advection, 
+  // low-storage SSP Runge-Kutta or TVD Runge-Kutta 
+  if (d_use_semi_lagrangian_advection) {
+    advanceLevelSetEqnUsingSemiLagrangian(dt);
+  } else if (d_use_low_storage_runge_kutta && 
+             (d_tvd_runge_kutta_order > 1)) {
+    advanceLevelSetEqnUsingLowStorageSSPRK(dt);
+  } else {
+    switch(d_tvd_runge_kutta_order) {
+      case 1: { // first-order TVD RK (e.g. Forward Euler)
+        advanceLevelSetEqnUsingTVDRK1(dt);
+        break;
+      }
+      case 2: { // second-order TVD RK 
+        advanceLevelSetEqnUsingTVDRK2(dt);
+        break;
+      }
+      case 3: { // third-order TVD RK 
 
-  // fill scratch data
-  Pointer< RefineSchedule<DIM> > sched =
-    d_fill_new_level->createSchedule(level, level_number-1, hierarchy, this);
-  sched->fillData(d_current_time,true);
+        advanceLevelSetEqnUsingTVDRK3(dt);
+        break;
+      }
+      default: { // UNSUPPORTED ORDER
+        TBOX_ERROR(  d_object_name
+                  << "::advanceLevelSetEqn(): " 
+                  << "Unsupported TVD Runge-Kutta order.  "
+                  << "Only TVD-RK1, TVD-RK2, and TVD-RK3 supported."
+                  << endl);
+      }
+    }
+  }
+}
 
-  phi_handle = d_phi_handles[0]; 
-  psi_handle = d_psi_handles[0]; 
+
+/* advanceLevel() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::advanceLevel(
+  const int ln,
+  const LSMLIB_REAL time,
+  const LSMLIB_REAL dt)
+{
+  Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
+  const int finest_level = d_patch_hierarchy->getFinestLevelNumber();
+
+  // save level set functions at the beginning of the time step so that 
+  // ghost cells on the next finer level can be interpolated in time
+  if (ln < finest_level) {
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      Pointer< Patch<DIM> > patch = level->getPatch(*pi);
+      patch->getPatchData(d_phi_old_handle)->copy(
+        *(patch->getPatchData(d_phi_handles[0])) );
+      if (d_codimension == 2) {
+        patch->getPatchData(d_psi_old_handle)->copy(
+          *(patch->getPatchData(d_psi_handles[0])) );
+      }
+    }
+    level->setTime(time, d_subcycle_old_variables);
+  }
+  level->setTime(time, d_solution_variables);
+
+  // restrict the time advance to the current level
+  d_coarsest_active_level = ln;
+  d_finest_active_level = ln;
+  d_current_time = time;
+
+  // fill ghost cells at the beginning of the time step
+  // NOTE: ghost cells on the coarsest level are filled by 
+  //       advanceLevelSetFunctions()
+  if (ln > 0) {
+    fillLevelSetFunctionGhostCells(0, time);
+  }
+
+  advanceLevelSetEqn(dt);
+  level->setTime(time+dt, d_solution_variables);
+
+  // velocity fields cached at the end of the time step on this level 
+  // were computed from the predicted level set functions, so they are
+  // not reused at the beginning of the next (sub)step if the velocity
+  // depends on the level set functions
+  if (d_lsm_velocity_field_strategy->
+        velocityFieldDependsOnLevelSetFunctions()) {
+    invalidateVelocityFieldCache();
+  }
+
+  if (ln < finest_level) {
+
+    // advance the next finer level to time+dt
+    const int num_steps = d_patch_hierarchy->getPatchLevel(ln+1)
+                            ->getRatioToCoarserLevel().max();
+    const LSMLIB_REAL fine_dt = dt/num_steps;
+    for (int step = 0; step < num_steps; step++) {
+      advanceLevel(ln+1, time + step*fine_dt, fine_dt);
+    }
+
+    // synchronize the current level with the next finer level
+    d_coarsen_sched_level_set[ln+1]->coarsenData();
+  }
 }
 
 
-/* postprocessInitializeVelocityField() */
+/* getNumberOfStepsOnLevel() */
 template <int DIM> 
-void LevelSetFunctionIntegrator<DIM>::postprocessInitializeVelocityField(
-  const Pointer< PatchHierarchy<DIM> > hierarchy,
-  const int level_number)
+int LevelSetFunctionIntegrator<DIM>::getNumberOfStepsOnLevel(
+  const int ln) const
 {
+  int num_steps = 1;
+  for (int level_num = 1; level_num <= ln; level_num++) {
+    num_steps *= d_patch_hierarchy->getPatchLevel(level_num)
+                   ->getRatioToCoarserLevel().max();
+  }
+  return num_steps;
 }
 
 
-/* putToDatabase() */
+/* allocateScratchData() */
 template <int DIM> 
-void LevelSetFunctionIntegrator<DIM>::putToDatabase(Pointer<Database> db)
+void LevelSetFunctionIntegrator<DIM>::allocateScratchData(
+  const ComponentSelector& scratch_variables)
 {
-#ifdef DEBUG_CHECK_ASSERTIONS
-   assert(!db.isNull());
-#endif
+  const int num_levels = d_patch_hierarchy->getNumberLevels();
+  if (!d_use_persistent_scratch_data) {
+    for ( int ln=0 ; ln < num_levels; ln++ ) {
+      Pointer< PatchLevel<DIM> > level = 
+        d_patch_hierarchy->getPatchLevel(ln);
+      level->allocatePatchData( scratch_variables );
+    }
+    return;
+  }
 
-   // write out version information
-   db->putInteger("LEVEL_SET_METHOD_INTEGRATOR_VERSION",
-                   LEVEL_SET_METHOD_INTEGRATOR_VERSION);
+  // only allocate scratch data on patches where it is not already 
+  // allocated (i.e. on patches created since the last time step)
+  const int num_components = scratch_variables.getSize();
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+    Pointer< PatchLevel<DIM> > level = 
+      d_patch_hierarchy->getPatchLevel(ln);
 
-  /*
-   * Write user-specified parameters to database
-   */
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      Pointer< Patch<DIM> > patch = level->getPatch(*pi);
+      for (int id = 0; id < num_components; id++) {
+        if ( scratch_variables.isSet(id) && !patch->checkAllocated(id) ) {
+          patch->allocatePatchData(id);
+        }
+      }
+    }
+  }
+}
 
-  // read in level set parameters
-  db->putDouble("d_start_time", d_start_time);
-  db->putDouble("d_end_time", d_end_time);
-  db->putDouble("d_cfl_number", d_cfl_number);
 
-  db->putInteger("d_spatial_derivative_type", d_spatial_derivative_type);
-  db->putInteger("d_spatial_derivative_order", d_spatial_derivative_order);
-  db->putInteger("d_tvd_runge_kutta_order", d_tvd_runge_kutta_order);
+/* releaseScratchData() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::releaseScratchData(
+  const ComponentSelector& scratch_variables)
+{
+  if (d_use_persistent_scratch_data) return;
 
-  db->putInteger("d_reinitialization_interval", d_reinitialization_interval);
-  db->putDouble("d_reinitialization_stop_tol", d_reinitialization_stop_tol);
-  db->putDouble("d_reinitialization_stop_dist", d_reinitialization_stop_dist);
-  db->putInteger("d_reinitialization_max_iters", d_reinitialization_max_iters);
-  db->putInteger("d_orthogonalization_interval", d_orthogonalization_interval);
-  db->putDouble("d_orthogonalization_stop_tol", d_orthogonalization_stop_tol);
-  db->putDouble("d_orthogonalization_stop_dist", 
-                  d_orthogonalization_stop_dist);
-  db->putInteger("d_orthogonalization_max_iters", 
-                  d_orthogonalization_max_iters);
+  const int num_levels = d_patch_hierarchy->getNumberLevels();
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+    Pointer< PatchLevel<DIM> > level = 
+      d_patch_hierarchy->getPatchLevel(ln);
+    level->deallocatePatchData( scratch_variables );
+  }
+}
 
-  db->putBool("d_use_AMR", d_use_AMR); 
-  db->putInteger("d_regrid_interval", d_regrid_interval);
-  db->putInteger("d_tag_buffer_width", d_tag_buffer_width);
-  db->putDouble("d_refinement_cutoff_value", d_refinement_cutoff_value);
 
-  db->putBool("d_verbose_mode", d_verbose_mode); 
+/* setVelocityField() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::setVelocityField(
+  const LSMLIB_REAL time,
+  const int phi_handle,
+  const int psi_handle,
+  const int component)
+{
+  // the velocity fields are only required on the levels updated by 
+  // the time advance
+  const int coarsest_ln = d_coarsest_active_level;
+  const int finest_ln = (d_finest_active_level < 0) ?
+    d_patch_hierarchy->getFinestLevelNumber() : d_finest_active_level;
+
+  if (!d_use_velocity_time_interpolation) {
+    d_lsm_velocity_field_strategy->computeVelocityFieldOnLevels(
+      time, phi_handle, psi_handle, component, coarsest_ln, finest_ln);
+    return;
+  }
+
+  allocateVelocityFieldCache();
 
   /*
-   * Write state parameters to database
+   * find the interpolation weight of the newer cached velocity field
+   * on each level (negative if the velocity field is not available 
+   * from the cache) and the range of levels on which the velocity 
+   * field must be computed
    */
-  db->putDouble("d_current_time", d_current_time);
-  db->putInteger("d_num_integration_steps_taken", 
-    d_num_integration_steps_taken);
+  vector<LSMLIB_REAL> theta(finest_ln+1, -1.0);
+  int compute_coarsest_ln = finest_ln+1;
+  int compute_finest_ln = coarsest_ln-1;
+  for ( int ln=coarsest_ln ; ln <= finest_ln; ln++ ) {
+    const int num_entries = d_num_velocity_cache_entries[component][ln];
+    const int newer = d_velocity_cache_newer_slot[component][ln];
+    const LSMLIB_REAL old_time = 
+      d_velocity_cache_times[1-newer][component][ln];
+    const LSMLIB_REAL new_time = d_velocity_cache_times[newer][component][ln];
+
+    // NOTE: stage times are computed from d_current_time and dt, so 
+    //       they are only compared to the cached times up to roundoff
+    const LSMLIB_REAL time_tol = 
+      10.0*LSMLIB_REAL_EPSILON*(1.0 + fabs(time) + fabs(new_time));
+
+    if ( (num_entries > 0) && (fabs(time - new_time) <= time_tol) ) {
+      // reuse the most recently computed velocity field
+      theta[ln] = 1.0;
+    } else if ( (num_entries > 1) && (time > old_time - time_tol) && 
+                (time < new_time) ) {
+      // interpolate between the cached velocity fields
+      theta[ln] = (time - old_time)/(new_time - old_time);
+      if (theta[ln] < 0.0) theta[ln] = 0.0;
+    } else {
+      if (compute_coarsest_ln > ln) compute_coarsest_ln = ln;
+      if (compute_finest_ln < ln) compute_finest_ln = ln;
+    }
+  }
+
+  // compute the velocity fields (with a single call for all levels 
+  // that require them) and add them to the cache
+  if (compute_coarsest_ln <= compute_finest_ln) {
+    d_lsm_velocity_field_strategy->computeVelocityFieldOnLevels(
+      time, phi_handle, psi_handle, component, 
+      compute_coarsest_ln, compute_finest_ln);
+    d_num_velocity_computations++;
+
+    for ( int ln=compute_coarsest_ln ; ln <= compute_finest_ln; ln++ ) {
+      cacheVelocityField(time, component, ln);
+    }
+  } else {
+    d_num_velocity_computations_skipped++;
+  }
+
+  // set the velocity fields from the cache on the remaining levels
+  for ( int ln=coarsest_ln ; ln <= finest_ln; ln++ ) {
+    if ( (ln < compute_coarsest_ln) || (ln > compute_finest_ln) ) {
+      interpolateVelocityFieldCache(theta[ln], component, ln);
+    }
+  }
+}
+
+
+/* cacheVelocityField() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::cacheVelocityField(
+  const LSMLIB_REAL time,
+  const int component,
+  const int ln)
+{
+  // the newer cache entry becomes the older one if the velocity field 
+  // was computed at a later time; otherwise restart the cache
+  int& newer = d_velocity_cache_newer_slot[component][ln];
+  int& num_entries = d_num_velocity_cache_entries[component][ln];
+  if ( (num_entries > 0) && 
+       (time > d_velocity_cache_times[newer][component][ln]) ) {
+    newer = 1 - newer;
+    num_entries = 2;
+  } else {
+    num_entries = 1;
+  }
+  d_velocity_cache_times[newer][component][ln] = time;
+
+  // copy velocity fields into the cache
+  const int first = component*d_num_cached_velocity_fields;
+  const int last = first + d_num_cached_velocity_fields;
+  Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
+  typename PatchLevel<DIM>::Iterator pi;
+  for (pi.initialize(level); pi; pi++) { // loop over patches
+    Pointer< Patch<DIM> > patch = level->getPatch(*pi);
+    for (int k = first; k < last; k++) {
+      patch->getPatchData(d_velocity_cache_handles[newer][k])->copy(
+        *(patch->getPatchData(d_velocity_field_handles[k])) );
+    }
+  }
+}
+
+
+/* allocateVelocityFieldCache() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::allocateVelocityFieldCache()
+{
+  // register cache PatchData
+  // NOTE: this is deferred until the velocity field is first required
+  //       because the LevelSetMethodVelocityFieldStrategy is not 
+  //       required to provide valid PatchData handles at the time
+  //       that the LevelSetFunctionIntegrator is constructed
+  if (d_num_cached_velocity_fields < 0) {
+
+    d_num_cached_velocity_fields = 0;
+    for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
+      if (d_lsm_velocity_field_strategy->providesExternalVelocityField()) {
+        d_velocity_field_handles.push_back(d_lsm_velocity_field_strategy->
+          getExternalVelocityFieldPatchDataHandle(comp));
+      }
+      if (d_lsm_velocity_field_strategy->providesNormalVelocityField()) {
+        d_velocity_field_handles.push_back(d_lsm_velocity_field_strategy->
+          getNormalVelocityFieldPatchDataHandle(PHI, comp));
+        if (d_codimension == 2) {
+          d_velocity_field_handles.push_back(d_lsm_velocity_field_strategy->
+            getNormalVelocityFieldPatchDataHandle(PSI, comp));
+        }
+      }
+    }
+    d_num_cached_velocity_fields = 
+      d_velocity_field_handles.size()/d_num_level_set_fcn_components;
+
+    // NOTE: separate cache PatchData is registered for each component
+    //       because the LevelSetMethodVelocityFieldStrategy may use the
+    //       same PatchData for the velocity fields of all components
+    VariableDatabase<DIM>* var_db = VariableDatabase<DIM>::getDatabase();
+    for (unsigned int k = 0; k < d_velocity_field_handles.size(); k++) {
+      Pointer< Variable<DIM> > velocity_variable;
+      var_db->mapIndexToVariable(d_velocity_field_handles[k], 
+                                 velocity_variable);
+      for (int i = 0; i < 2; i++) {
+        const int cache_handle = var_db->registerClonedPatchDataIndex(
+          velocity_variable, d_velocity_field_handles[k]);
+        d_velocity_cache_handles[i].push_back(cache_handle);
+        d_velocity_cache_variables.setFlag(cache_handle);
+      }
+    }
+
+    d_velocity_cache_times[0].resize(d_num_level_set_fcn_components);
+    d_velocity_cache_times[1].resize(d_num_level_set_fcn_components);
+    d_velocity_cache_newer_slot.resize(d_num_level_set_fcn_components);
+    d_num_velocity_cache_entries.resize(d_num_level_set_fcn_components);
+  }
+
+  // add cache entries for levels created since the last time step
+  const int num_levels = d_patch_hierarchy->getNumberLevels();
+  for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
+    d_velocity_cache_times[0][comp].resize(num_levels, 0.0);
+    d_velocity_cache_times[1][comp].resize(num_levels, 0.0);
+    d_velocity_cache_newer_slot[comp].resize(num_levels, 1);
+    d_num_velocity_cache_entries[comp].resize(num_levels, 0);
+  }
+
+  // only allocate cache data on patches where it is not already 
+  // allocated (i.e. on patches created since the last time step)
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+    Pointer< PatchLevel<DIM> > level = 
+      d_patch_hierarchy->getPatchLevel(ln);
+
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      Pointer< Patch<DIM> > patch = level->getPatch(*pi);
+      for (int i = 0; i < 2; i++) {
+        for (unsigned int k = 0; k < d_velocity_cache_handles[i].size(); 
+             k++) {
+          const int id = d_velocity_cache_handles[i][k];
+          if (!patch->checkAllocated(id)) patch->allocatePatchData(id);
+        }
+      }
+    }
+  }
+}
+
+
+/* interpolateVelocityFieldCache() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::interpolateVelocityFieldCache(
+  const LSMLIB_REAL theta,
+  const int component,
+  const int ln)
+{
+  const int first = component*d_num_cached_velocity_fields;
+  const int last = first + d_num_cached_velocity_fields;
+  const int newer = d_velocity_cache_newer_slot[component][ln];
+
+  Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
+
+  typename PatchLevel<DIM>::Iterator pi;
+  for (pi.initialize(level); pi; pi++) { // loop over patches
+    Pointer< Patch<DIM> > patch = level->getPatch(*pi);
+
+    for (int k = first; k < last; k++) {
+      Pointer< CellData<DIM,LSMLIB_REAL> > vel_data =
+        patch->getPatchData( d_velocity_field_handles[k] );
+      Pointer< CellData<DIM,LSMLIB_REAL> > old_vel_data =
+        patch->getPatchData( d_velocity_cache_handles[1-newer][k] );
+      Pointer< CellData<DIM,LSMLIB_REAL> > new_vel_data =
+        patch->getPatchData( d_velocity_cache_handles[newer][k] );
+
+      // copy cached data directly when no interpolation is required
+      // (ghostcells of the cached data may not be initialized)
+      if (theta == 1.0) {
+        vel_data->copy(*new_vel_data);
+        continue;
+      } else if (theta == 0.0) {
+        vel_data->copy(*old_vel_data);
+        continue;
+      }
+
+      // NOTE: the cache PatchData is cloned from the velocity field
+      //       PatchData, so the data arrays have identical layouts
+      LSMLIB_REAL* vel = vel_data->getPointer(0);
+      const LSMLIB_REAL* old_vel = old_vel_data->getPointer(0);
+      const LSMLIB_REAL* new_vel = new_vel_data->getPointer(0);
+      const int num_values = 
+        vel_data->getGhostBox().size()*vel_data->getDepth();
+      for (int i = 0; i < num_values; i++) {
+        vel[i] = (1.0-theta)*old_vel[i] + theta*new_vel[i];
+      }
+    }
+
+  }  // end loop over patches
+}
+
+
+/* reinitializationNeeded() */
+template <int DIM> 
+bool LevelSetFunctionIntegrator<DIM>::reinitializationNeeded()
+{
+  if (!d_use_adaptive_reinitialization) return true;
+
+  // use the drift measured by computeStableDt() at the beginning of the 
+  // time step if it is available; otherwise, measure it now
+  LSMLIB_REAL max_deviation = d_grad_phi_deviation;
+  d_grad_phi_deviation = -1.0;
+  if (max_deviation < 0) {
+    Array<LSMLIB_REAL> sums;
+    accumulateGradPhiDeviationSums(sums);
+    tbox::MPI::sumReduction(sums.getPointer(), sums.getSize());
+    max_deviation = computeMaxGradPhiDeviation(sums);
+  }
+
+  if (d_verbose_mode) {
+    pout << d_object_name << "::reinitializationNeeded(): "
+         << "average | |grad(phi)| - 1 | = " << max_deviation << endl;
+  }
+
+  return (max_deviation > d_reinitialization_grad_phi_tol);
+}
+
+
+/* accumulateGradPhiDeviationSums() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::accumulateGradPhiDeviationSums(
+  Array<LSMLIB_REAL>& sums)
+{
+  const double* dx_coarsest = d_grid_geometry->getDx();
+
+  // accumulate deviation sums and cell counts for each level set 
+  // function and component: 
+  //   sums[2*idx] = sum of | |grad(phi)| - 1 |, sums[2*idx+1] = count
+  // NOTE: coarse cells covered by finer levels have zero control volume
+  //       (see LevelSetMethodToolbox::computeControlVolumes()), so they
+  //       are excluded by computeGradPhiDeviationSums()
+  const int num_fcns = (d_codimension == 2) ? 2 : 1;
+  const int num_sums = 2*num_fcns*d_num_level_set_fcn_components;
+  sums.resizeArray(num_sums);
+  for (int i = 0; i < num_sums; i++) sums[i] = 0.0;
+
+  const int num_levels = d_patch_hierarchy->getNumberLevels();
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+
+    Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
+
+    // compute width of band about the zero level set using the grid
+    // spacing on the current level
+    const IntVector<DIM> ratio = level->getRatio();
+    LSMLIB_REAL min_dx = dx_coarsest[0]/ratio(0);
+    for (int dim = 1; dim < DIM; dim++) {
+      if (min_dx > dx_coarsest[dim]/ratio(dim)) {
+        min_dx = dx_coarsest[dim]/ratio(dim);
+      }
+    }
+    const LSMLIB_REAL band_width = 
+      d_reinitialization_grad_phi_band_cells*min_dx;
+    
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      const int pn = *pi;
+      Pointer< Patch<DIM> > patch = level->getPatch(pn);
+      if ( patch.isNull() ) {
+        TBOX_ERROR(  d_object_name
+                  << "::accumulateGradPhiDeviationSums(): "
+                  << "Cannot find patch. Null patch pointer."
+                  << endl);
+      }
+
+      for (int fcn = 0; fcn < num_fcns; fcn++) {
+        const int phi_handle = (fcn == 0) ? d_phi_handles[0]
+                                          : d_psi_handles[0];
+        for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
+          const int idx = fcn*d_num_level_set_fcn_components + comp;
+          LSMLIB_REAL deviation_sum = 0.0;
+          LSMLIB_REAL num_cells_in_band = 0.0;
+          LevelSetMethodToolbox<DIM>::computeGradPhiDeviationSums(
+            deviation_sum,
+            num_cells_in_band,
+            patch,
+            phi_handle,
+            d_control_volume_handle,
+            band_width,
+            comp);
+          sums[2*idx] += deviation_sum;
+          sums[2*idx+1] += num_cells_in_band;
+        }
+      }
+
+    } // end loop over patches in level
+  } // end loop over levels in hierarchy
+}
+
+
+/* computeMaxGradPhiDeviation() */
+template <int DIM> 
+LSMLIB_REAL LevelSetFunctionIntegrator<DIM>::computeMaxGradPhiDeviation(
+  const Array<LSMLIB_REAL>& sums)
+{
+  // maximum of the band averages over level set functions and components
+  LSMLIB_REAL max_deviation = 0.0;
+  for (int idx = 0; idx < sums.getSize()/2; idx++) {
+    if (sums[2*idx+1] > 0.0) {
+      const LSMLIB_REAL ave_deviation = sums[2*idx]/sums[2*idx+1];
+      if (max_deviation < ave_deviation) max_deviation = ave_deviation;
+    }
+  }
+  return max_deviation;
+}
+
+
+/* preprocessInitializeVelocityField() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::preprocessInitializeVelocityField(
+  int& phi_handle,
+  int& psi_handle,
+  const Pointer< PatchHierarchy<DIM> > hierarchy,
+  const int level_number)
+{
+  Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(level_number);
+
+  // fill scratch data
+  Pointer< RefineSchedule<DIM> > sched =
+    d_fill_new_level->createSchedule(level, level_number-1, hierarchy, this);
+  sched->fillData(d_current_time,true);
+
+  phi_handle = d_phi_handles[0]; 
+  psi_handle = d_psi_handles[0]; 
+}
+
+
+/* postprocessInitializeVelocityField() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::postprocessInitializeVelocityField(
+  const Pointer< PatchHierarchy<DIM> > hierarchy,
+  const int level_number)
+{
+}
+
+
+/* putToDatabase() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::putToDatabase(Pointer<Database> db)
+{
+#ifdef DEBUG_CHECK_ASSERTIONS
+   assert(!db.isNull());
+#endif
+
+   // write out version information
+   db->putInteger("LEVEL_SET_METHOD_INTEGRATOR_VERSION",
+                   LEVEL_SET_METHOD_INTEGRATOR_VERSION);
+
+  /*
+   * Write user-specified parameters to database
+   */
+
+  // read in level set parameters
+  db->putDouble("d_start_time", d_start_time);
+  db->putDouble("d_end_time", d_end_time);
+  db->putDouble("d_cfl_number", d_cfl_number);
+
+  db->putInteger("d_spatial_derivative_type", d_spatial_derivative_type);
+  db->putInteger("d_spatial_derivative_order", d_spatial_derivative_order);
+  db->putInteger("d_tvd_runge_kutta_order", d_tvd_runge_kutta_order);
+  db->putBool("d_use_low_storage_runge_kutta", 
+              d_use_low_storage_runge_kutta);
+  db->putBool("d_use_semi_lagrangian_advection", 
+              d_use_semi_lagrangian_advection);
+  db->putDouble("d_semi_lagrangian_cfl_number", 
+                d_semi_lagrangian_cfl_number);
+
+  db->putInteger("d_reinitialization_interval", d_reinitialization_interval);
+  db->putDouble("d_reinitialization_stop_tol", d_reinitialization_stop_tol);
+  db->putDouble("d_reinitialization_stop_dist", d_reinitialization_stop_dist);
+  db->putInteger("d_reinitialization_max_iters", d_reinitialization_max_iters);
+  db->putDouble("d_reinitialization_grad_phi_tol", 
+                d_reinitialization_grad_phi_tol);
+  db->putInteger("d_reinitialization_grad_phi_band_cells", 
+                 d_reinitialization_grad_phi_band_cells);
+  db->putInteger("d_orthogonalization_interval", d_orthogonalization_interval);
+  db->putDouble("d_orthogonalization_stop_tol", d_orthogonalization_stop_tol);
+  db->putDouble("d_orthogonalization_stop_dist", 
+                  d_orthogonalization_stop_dist);
+  db->putInteger("d_orthogonalization_max_iters", 
+                  d_orthogonalization_max_iters);
+
+  db->putBool("d_use_AMR", d_use_AMR); 
+  db->putInteger("d_regrid_interval", d_regrid_interval);
+  db->putBool("d_use_interface_proximity_regrid", 
+              d_use_interface_proximity_regrid);
+  db->putInteger("d_tag_buffer_width", d_tag_buffer_width);
+  db->putDouble("d_refinement_cutoff_value", d_refinement_cutoff_value);
+  db->putBool("d_use_subcycling", d_use_subcycling);
+
+  db->putBool("d_use_persistent_scratch_data", 
+              d_use_persistent_scratch_data); 
+  db->putBool("d_reuse_ghost_cell_data", d_reuse_ghost_cell_data); 
+  db->putBool("d_use_velocity_time_interpolation", 
+              d_use_velocity_time_interpolation); 
+  db->putBool("d_verbose_mode", d_verbose_mode); 
+
+  /*
+   * Write state parameters to database
+   */
+  db->putDouble("d_current_time", d_current_time);
+  db->putInteger("d_num_integration_steps_taken", 
+    d_num_integration_steps_taken);
   db->putInteger("d_reinitialization_count", d_reinitialization_count);
   db->putInteger("d_orthogonalization_count", d_orthogonalization_count);
   db->putInteger("d_regrid_count", d_regrid_count);
+  db->putDouble("d_interface_displacement_since_regrid", 
+                d_interface_displacement_since_regrid);
 
   db->putBool("d_use_reinitialization", d_use_reinitialization);
   db->putBool("d_use_reinitialization_stop_tol", 
@@ -1010,54 +1787,105 @@ void LevelSetFunctionIntegrator<DIM>::applyGradientDetector(
                 << endl );
     }
 
+    // NOTE: for codimension-one problems, phi is used in place of psi
+    //       so that cells are tagged based on |phi| alone
     Pointer< CellData<DIM,LSMLIB_REAL> > phi_data = 
       patch->getPatchData( d_phi_handles[0] );
-    Pointer< CellData<DIM,LSMLIB_REAL> > psi_data;
+    Pointer< CellData<DIM,LSMLIB_REAL> > psi_data = phi_data;
     if (d_codimension == 2) {
       psi_data = patch->getPatchData( d_psi_handles[0] );
     }
     Pointer< CellData<DIM,int> > tag_data = 
       patch->getPatchData( tag_index );
 
+    // phi and psi are defined with the same ghostcell width
     Box<DIM> phi_ghostbox = phi_data->getGhostBox();
     const IntVector<DIM> phi_gb_lower = phi_ghostbox.lower();
     const IntVector<DIM> phi_gb_upper = phi_ghostbox.upper();
 
-    Box<DIM> psi_ghostbox = psi_data->getGhostBox();
-    const IntVector<DIM> psi_gb_lower = psi_ghostbox.lower();
-    const IntVector<DIM> psi_gb_upper = psi_ghostbox.upper();
-
-    Box<DIM> tag_box = tag_data->getBox();
-    const IntVector<DIM> tag_box_lower = tag_box.lower();
-    const IntVector<DIM> tag_box_upper = tag_box.upper();
-
     Box<DIM> tag_ghostbox = tag_data->getGhostBox();
     const IntVector<DIM> tag_gb_lower = tag_ghostbox.lower();
     const IntVector<DIM> tag_gb_upper = tag_ghostbox.upper();
 
-/* KTC - FIX ME
-#if DIM==2
-    setrefinementtags_(
-      tag_data->getPointer(),
-      level_set_data->getPointer(),
-      &tag_ghostbox_lower[0],
-      &tag_ghostbox_upper[0],
-      &tag_ghostbox_lower[1],
-      &tag_ghostbox_upper[1],
-      &level_set_ghostbox_lower[0],
-      &level_set_ghostbox_upper[0],
-      &level_set_ghostbox_lower[1],
-      &level_set_ghostbox_upper[1],
-      &tag_box_lower[0],
-      &tag_box_upper[0],
-      &tag_box_lower[1],
-      &tag_box_upper[1],
-      &d_refinement_cutoff_value);
-#endif
+    // only cells in the interior of the patch are tagged
+    Box<DIM> fillbox = tag_data->getBox();
+    const IntVector<DIM> fillbox_lower = fillbox.lower();
+    const IntVector<DIM> fillbox_upper = fillbox.upper();
 
-#if DIM==3
-#endif
-*/
+    int* tags = tag_data->getPointer();
+
+    // tag cells near the zero level set of any component
+    for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
+
+      LSMLIB_REAL* phi = phi_data->getPointer(comp);
+      LSMLIB_REAL* psi = psi_data->getPointer(comp);
+
+      if (DIM == 3) {
+
+        LSM3D_SAMRAI_UTILITIES_TAG_CELLS(
+          tags,
+          &tag_gb_lower[0],
+          &tag_gb_upper[0],
+          &tag_gb_lower[1],
+          &tag_gb_upper[1],
+          &tag_gb_lower[2],
+          &tag_gb_upper[2],
+          phi, psi,
+          &phi_gb_lower[0],
+          &phi_gb_upper[0],
+          &phi_gb_lower[1],
+          &phi_gb_upper[1],
+          &phi_gb_lower[2],
+          &phi_gb_upper[2],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &fillbox_lower[1],
+          &fillbox_upper[1],
+          &fillbox_lower[2],
+          &fillbox_upper[2],
+          &d_refinement_cutoff_value);
+
+      } else if (DIM == 2) {
+
+        LSM2D_SAMRAI_UTILITIES_TAG_CELLS(
+          tags,
+          &tag_gb_lower[0],
+          &tag_gb_upper[0],
+          &tag_gb_lower[1],
+          &tag_gb_upper[1],
+          phi, psi,
+          &phi_gb_lower[0],
+          &phi_gb_upper[0],
+          &phi_gb_lower[1],
+          &phi_gb_upper[1],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &fillbox_lower[1],
+          &fillbox_upper[1],
+          &d_refinement_cutoff_value);
+
+      } else if (DIM == 1) {
+
+        LSM1D_SAMRAI_UTILITIES_TAG_CELLS(
+          tags,
+          &tag_gb_lower[0],
+          &tag_gb_upper[0],
+          phi, psi,
+          &phi_gb_lower[0],
+          &phi_gb_upper[0],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &d_refinement_cutoff_value);
+
+      } else {  // Unsupported dimension
+        TBOX_ERROR(  d_object_name 
+                  << "::applyGradientDetector(): "
+                  << "Invalid value of DIM.  "
+                  << "Only DIM = 1, 2, and 3 are supported."
+                  << endl);
+      } // end switch over dimension (DIM) of calculation
+
+    } // end loop over components
 
   } // end loop over patches
 
@@ -1083,9 +1911,19 @@ void LevelSetFunctionIntegrator<DIM>::resetHierarchyConfiguration(
 
   int num_levels = hierarchy->getNumberLevels();
 
+  // ghost cells on new levels have not been filled
+  d_ghost_cells_current = false;
+
+  // the cells tagged for refinement have been recomputed around the
+  // current location of the zero level set
+  d_interface_displacement_since_regrid = 0.0;
+
+  // cached velocity fields are not defined on new patches
+  invalidateVelocityFieldCache();
+
   // reset communications schedules used to fill boundary data 
   // during time advance
-  for (int k = 0; k < d_tvd_runge_kutta_order; k++) {
+  for (int k = 0; k < d_num_rk_registers; k++) {
     d_fill_bdry_sched_time_advance[k].resizeArray(num_levels);
 
     for (int ln = coarsest_level; ln <= finest_level; ln++) {
@@ -1102,6 +1940,44 @@ void LevelSetFunctionIntegrator<DIM>::resetHierarchyConfiguration(
     } // end loop over levels
   } // end loop over TVD Runge-Kutta stages
 
+  // reset communications schedules used to fill boundary data with
+  // time interpolation when finer levels are subcycled
+  if (d_use_subcycling) {
+    for (int k = 0; k < d_num_rk_registers; k++) {
+      d_fill_bdry_sched_subcycle[k].resizeArray(num_levels);
+
+      for (int ln = coarsest_level; ln <= finest_level; ln++) {
+        Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(ln);
+        d_fill_bdry_sched_subcycle[k][ln] =
+          d_fill_bdry_subcycle[k]->createSchedule(level,
+                                                  ln-1,
+                                                  hierarchy,
+                                                  this);
+      } // end loop over levels
+    } // end loop over TVD Runge-Kutta stages
+  }
+
+  // reset communications schedules used to synchronize coarser levels
+  // with finer levels when finer levels are subcycled
+  // NOTE: d_coarsen_sched_level_set[ln] coarsens level ln onto 
+  //       level ln-1
+  if (d_use_subcycling) {
+    d_coarsen_sched_level_set.resizeArray(num_levels);
+    for (int ln = (coarsest_level > 0 ? coarsest_level : 1); 
+         ln <= finest_level; ln++) {
+      Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(ln);
+      Pointer< PatchLevel<DIM> > coarser_level = 
+        hierarchy->getPatchLevel(ln-1);
+      d_coarsen_sched_level_set[ln] =
+        d_coarsen_level_set->createSchedule(coarser_level, level, this);
+    } // end loop over levels
+  }
+
+  // the time advance updates all levels unless finer levels are 
+  // subcycled
+  d_coarsest_active_level = 0;
+  d_finest_active_level = hierarchy->getFinestLevelNumber();
+
   // reset communications schedules used to fill boundary data when
   // computing the stable dt 
   d_fill_bdry_sched_compute_stable_dt.resizeArray(num_levels);
@@ -1133,6 +2009,10 @@ void LevelSetFunctionIntegrator<DIM>::resetHierarchyConfiguration(
   LevelSetMethodToolbox<DIM>::computeControlVolumes(
     hierarchy, d_control_volume_handle);
 
+  // the drift of the level set functions measured on the old hierarchy
+  // is no longer valid
+  d_grad_phi_deviation = -1.0;
+
   // create anti-periodic boundary condition plan
   d_bc_module->resetHierarchyConfiguration(
     d_patch_hierarchy,
@@ -1156,33 +2036,51 @@ void LevelSetFunctionIntegrator<DIM>::advanceLevelSetEqnUsingTVDRK1(
   for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
 
     // compute velocity field for current stage
-    d_lsm_velocity_field_strategy->computeVelocityField(
+    setVelocityField(
       d_current_time, 
       d_phi_handles[rk_stage],
       d_psi_handles[rk_stage],
       comp);
 
     // advance phi through TVD-RK1 step 
-    computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
-                               comp);
-    LevelSetMethodToolbox<DIM>::TVDRK1Step(
-      d_patch_hierarchy,
-      d_phi_handles[0], 
-      d_phi_handles[rk_stage], 
-      d_rhs_phi_handle, dt,
-      comp, comp, 0); // components of PatchData to use in TVD-RK1 step
+    if (d_use_fused_tvd_rk_stages) {
+      advanceLevelSetEqnUsingFusedTVDRKStage(PHI,
+        d_phi_handles[0],
+        d_phi_handles[rk_stage],
+        d_phi_handles[rk_stage],
+        0.0, dt, comp);
+    } else {
+      computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
+                                 comp);
+      LevelSetMethodToolbox<DIM>::TVDRK1Step(
+        d_patch_hierarchy,
+        d_phi_handles[0], 
+        d_phi_handles[rk_stage], 
+        d_rhs_phi_handle, dt,
+        comp, comp, 0,  // components of PatchData to use in TVD-RK1 step
+        d_coarsest_active_level, d_finest_active_level);
+    }
 
     if (d_codimension == 2) {
 
       // advance psi through TVD-RK1 step 
-      computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
-                                 comp);
-      LevelSetMethodToolbox<DIM>::TVDRK1Step(
-        d_patch_hierarchy,
-        d_psi_handles[0], 
-        d_psi_handles[rk_stage], 
-        d_rhs_psi_handle, dt,
-        comp, comp, 0); // components of PatchData to use in TVD-RK1 step
+      if (d_use_fused_tvd_rk_stages) {
+        advanceLevelSetEqnUsingFusedTVDRKStage(PSI,
+          d_psi_handles[0],
+          d_psi_handles[rk_stage],
+          d_psi_handles[rk_stage],
+          0.0, dt, comp);
+      } else {
+        computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
+                                   comp);
+        LevelSetMethodToolbox<DIM>::TVDRK1Step(
+          d_patch_hierarchy,
+          d_psi_handles[0], 
+          d_psi_handles[rk_stage], 
+          d_rhs_psi_handle, dt,
+          comp, comp, 0,  // components of PatchData to use in TVD-RK1 step
+          d_coarsest_active_level, d_finest_active_level);
+      }
 
     } // end codimension-two case
 
@@ -1205,35 +2103,55 @@ void LevelSetFunctionIntegrator<DIM>::advanceLevelSetEqnUsingTVDRK2(
   for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
 
     // compute velocity field for current stage
-    d_lsm_velocity_field_strategy->computeVelocityField(
+    setVelocityField(
       d_current_time, 
       d_phi_handles[rk_stage],
       d_psi_handles[rk_stage],
       comp);
 
     // advance phi through the first stage of TVD-RK2 
-    computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
-                               comp);
-    LevelSetMethodToolbox<DIM>::TVDRK2Stage1(
-      d_patch_hierarchy,
-      d_phi_handles[rk_stage+1],
-      d_phi_handles[rk_stage],
-      d_rhs_phi_handle, dt,
-      comp, comp, 0); // components of PatchData to use in first 
-                      // stage TVD-RK2 step
-
-    if (d_codimension == 2) {
-
-      // advance psi through the first stage of TVD-RK2 
-      computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
+    if (d_use_fused_tvd_rk_stages) {
+      advanceLevelSetEqnUsingFusedTVDRKStage(PHI,
+        d_phi_handles[rk_stage+1],
+        d_phi_handles[rk_stage],
+        d_phi_handles[rk_stage],
+        0.0, dt, comp);
+    } else {
+      computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
                                  comp);
       LevelSetMethodToolbox<DIM>::TVDRK2Stage1(
         d_patch_hierarchy,
-        d_psi_handles[rk_stage+1],
-        d_psi_handles[rk_stage],
-        d_rhs_psi_handle, dt,
-        comp, comp, 0); // components of PatchData to use in first 
+        d_phi_handles[rk_stage+1],
+        d_phi_handles[rk_stage],
+        d_rhs_phi_handle, dt,
+        comp, comp, 0,  // components of PatchData to use in first 
                         // stage TVD-RK2 step
+        0,  // fillbox_growth
+        d_coarsest_active_level, d_finest_active_level);
+    }
+
+    if (d_codimension == 2) {
+
+      // advance psi through the first stage of TVD-RK2 
+      if (d_use_fused_tvd_rk_stages) {
+        advanceLevelSetEqnUsingFusedTVDRKStage(PSI,
+          d_psi_handles[rk_stage+1],
+          d_psi_handles[rk_stage],
+          d_psi_handles[rk_stage],
+          0.0, dt, comp);
+      } else {
+        computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
+                                   comp);
+        LevelSetMethodToolbox<DIM>::TVDRK2Stage1(
+          d_patch_hierarchy,
+          d_psi_handles[rk_stage+1],
+          d_psi_handles[rk_stage],
+          d_rhs_psi_handle, dt,
+          comp, comp, 0,  // components of PatchData to use in first 
+                          // stage TVD-RK2 step
+          0,  // fillbox_growth
+          d_coarsest_active_level, d_finest_active_level);
+      }
     }
   } // end loop over vector level set function
 
@@ -1246,67 +2164,61 @@ void LevelSetFunctionIntegrator<DIM>::advanceLevelSetEqnUsingTVDRK2(
   rk_stage = 1;
 
   // fill scratch space for second stage of time advance
-  const int num_levels = d_patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    // NOTE: true indicates that physical boundary conditions should
-    //       be set.
-    d_fill_bdry_sched_time_advance[rk_stage][ln]
-     ->fillData(d_current_time,true);
-  }
-  for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
-    d_bc_module->imposeBoundaryConditions(
-      d_phi_handles[rk_stage],
-      d_lower_bc_phi[comp], 
-      d_upper_bc_phi[comp], 
-      d_spatial_derivative_type,
-      d_spatial_derivative_order,
-      comp);
-    if (d_codimension == 2) {
-      d_bc_module->imposeBoundaryConditions(
-        d_psi_handles[rk_stage],
-        d_lower_bc_psi[comp], 
-        d_upper_bc_psi[comp], 
-        d_spatial_derivative_type,
-        d_spatial_derivative_order,
-        comp);
-    }
-  }
+  fillLevelSetFunctionGhostCells(rk_stage, d_current_time+dt);
 
   // loop over components of vector level set function
   for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
 
     // compute velocity field for current stage
-    d_lsm_velocity_field_strategy->computeVelocityField(
+    setVelocityField(
       d_current_time+dt, 
       d_phi_handles[rk_stage],
       d_psi_handles[rk_stage],
       comp);
 
     // advance phi through the second stage of TVD-RK2 
-    computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
-                               comp);
-    LevelSetMethodToolbox<DIM>::TVDRK2Stage2(
-      d_patch_hierarchy,
-      d_phi_handles[0],
-      d_phi_handles[rk_stage],
-      d_phi_handles[0],
-      d_rhs_phi_handle, dt,
-      comp, comp, comp, 0); // components of PatchData to use in final 
-                            // stage of TVD-RK2 step
-
-    if (d_codimension == 2) {
-
-      // advance psi through the second stage of TVD-RK2 
-      computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
+    if (d_use_fused_tvd_rk_stages) {
+      advanceLevelSetEqnUsingFusedTVDRKStage(PHI,
+        d_phi_handles[0],
+        d_phi_handles[rk_stage],
+        d_phi_handles[0],
+        0.5, dt, comp);
+    } else {
+      computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
                                  comp);
       LevelSetMethodToolbox<DIM>::TVDRK2Stage2(
         d_patch_hierarchy,
-        d_psi_handles[0],
-        d_psi_handles[rk_stage],
-        d_psi_handles[0],
-        d_rhs_psi_handle, dt,
-        comp, comp, comp, 0); // components of PatchData to use in final 
+        d_phi_handles[0],
+        d_phi_handles[rk_stage],
+        d_phi_handles[0],
+        d_rhs_phi_handle, dt,
+        comp, comp, comp, 0,  // components of PatchData to use in final 
                               // stage of TVD-RK2 step
+        d_coarsest_active_level, d_finest_active_level);
+    }
+
+    if (d_codimension == 2) {
+
+      // advance psi through the second stage of TVD-RK2 
+      if (d_use_fused_tvd_rk_stages) {
+        advanceLevelSetEqnUsingFusedTVDRKStage(PSI,
+          d_psi_handles[0],
+          d_psi_handles[rk_stage],
+          d_psi_handles[0],
+          0.5, dt, comp);
+      } else {
+        computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
+                                   comp);
+        LevelSetMethodToolbox<DIM>::TVDRK2Stage2(
+          d_patch_hierarchy,
+          d_psi_handles[0],
+          d_psi_handles[rk_stage],
+          d_psi_handles[0],
+          d_rhs_psi_handle, dt,
+          comp, comp, comp, 0,  // components of PatchData to use in final 
+                                // stage of TVD-RK2 step
+          d_coarsest_active_level, d_finest_active_level);
+      }
     }
   } // end loop over components of vector level set function
 
@@ -1329,184 +2241,813 @@ void LevelSetFunctionIntegrator<DIM>::advanceLevelSetEqnUsingTVDRK3(
   for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
 
     // compute velocity field for current stage
-    d_lsm_velocity_field_strategy->computeVelocityField(
+    setVelocityField(
       d_current_time,
       d_phi_handles[rk_stage],
       d_psi_handles[rk_stage],
       comp);
 
     // advance phi through the first stage of TVD-RK3
-    computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
-                               comp);
-    LevelSetMethodToolbox<DIM>::TVDRK3Stage1(
-      d_patch_hierarchy,
-      d_phi_handles[rk_stage+1],
-      d_phi_handles[rk_stage],
-      d_rhs_phi_handle, dt,
-      comp, comp, 0); // components of PatchData to use in first stage 
-                      // of TVD-RK3 step
+    if (d_use_fused_tvd_rk_stages) {
+      advanceLevelSetEqnUsingFusedTVDRKStage(PHI,
+        d_phi_handles[rk_stage+1],
+        d_phi_handles[rk_stage],
+        d_phi_handles[rk_stage],
+        0.0, dt, comp);
+    } else {
+      computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
+                                 comp);
+      LevelSetMethodToolbox<DIM>::TVDRK3Stage1(
+        d_patch_hierarchy,
+        d_phi_handles[rk_stage+1],
+        d_phi_handles[rk_stage],
+        d_rhs_phi_handle, dt,
+        comp, comp, 0,  // components of PatchData to use in first stage 
+                        // of TVD-RK3 step
+        0,  // fillbox_growth
+        d_coarsest_active_level, d_finest_active_level);
+    }
 
     if (d_codimension == 2) {
   
       // advance psi through the first stage of TVD-RK3
-      computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
+      if (d_use_fused_tvd_rk_stages) {
+        advanceLevelSetEqnUsingFusedTVDRKStage(PSI,
+          d_psi_handles[rk_stage+1],
+          d_psi_handles[rk_stage],
+          d_psi_handles[rk_stage],
+          0.0, dt, comp);
+      } else {
+        computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
+                                   comp);
+        LevelSetMethodToolbox<DIM>::TVDRK3Stage1(
+          d_patch_hierarchy,
+          d_psi_handles[rk_stage+1],
+          d_psi_handles[rk_stage],
+          d_rhs_psi_handle, dt,
+          comp, comp, 0,  // components of PatchData to use in first stage 
+                          // of TVD-RK3 step
+          0,  // fillbox_growth
+          d_coarsest_active_level, d_finest_active_level);
+      }
+    }
+  } // end loop over vector level set function
+
+  // } end Stage 1
+
+
+  // { begin Stage 2
+
+  // advance TVD RK3 stage counter
+  rk_stage = 1;
+
+  // fill scratch space for second stage of time advance
+  fillLevelSetFunctionGhostCells(rk_stage, d_current_time+dt);
+
+  // loop over components of vector level set function
+  for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
+
+    // compute velocity field for current stage
+    setVelocityField(
+      d_current_time+dt,
+      d_phi_handles[rk_stage],
+      d_psi_handles[rk_stage],
+      comp);
+
+    // advance phi through the second stage of TVD-RK3
+    if (d_use_fused_tvd_rk_stages) {
+      advanceLevelSetEqnUsingFusedTVDRKStage(PHI,
+        d_phi_handles[rk_stage+1],
+        d_phi_handles[rk_stage],
+        d_phi_handles[rk_stage-1],
+        0.75, dt, comp);
+    } else {
+      computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
                                  comp);
-      LevelSetMethodToolbox<DIM>::TVDRK3Stage1(
+      LevelSetMethodToolbox<DIM>::TVDRK3Stage2(
         d_patch_hierarchy,
-        d_psi_handles[rk_stage+1],
-        d_psi_handles[rk_stage],
-        d_rhs_psi_handle, dt,
-        comp, comp, 0); // components of PatchData to use in first stage 
-                        // of TVD-RK3 step
+        d_phi_handles[rk_stage+1],
+        d_phi_handles[rk_stage],
+        d_phi_handles[rk_stage-1],
+        d_rhs_phi_handle, dt,
+        comp, comp, comp, 0,  // components of PatchData to use in second 
+                              // stage of TVD-RK3 step
+        0,  // fillbox_growth
+        d_coarsest_active_level, d_finest_active_level);
+    }
+
+    if (d_codimension == 2) {
+
+      // advance psi through the second stage of TVD-RK3
+      if (d_use_fused_tvd_rk_stages) {
+        advanceLevelSetEqnUsingFusedTVDRKStage(PSI,
+          d_psi_handles[rk_stage+1],
+          d_psi_handles[rk_stage],
+          d_psi_handles[rk_stage-1],
+          0.75, dt, comp);
+      } else {
+        computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
+                                   comp);
+        LevelSetMethodToolbox<DIM>::TVDRK3Stage2(
+          d_patch_hierarchy,
+          d_psi_handles[rk_stage+1],
+          d_psi_handles[rk_stage],
+          d_psi_handles[rk_stage-1],
+          d_rhs_psi_handle, dt,
+          comp, comp, comp, 0,  // components of PatchData to use in second 
+                                // stage of TVD-RK3 step
+          0,  // fillbox_growth
+          d_coarsest_active_level, d_finest_active_level);
+      }
+    }
+  } // end loop over vector level set function
+
+  // } end Stage 2
+
+
+  // { begin Stage 3
+
+  // advance TVD RK3 stage counter
+  rk_stage = 2;
+
+  // fill scratch space for third stage of time advance
+  fillLevelSetFunctionGhostCells(rk_stage, d_current_time+0.5*dt);
+
+  // loop over components of vector level set function
+  for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
+
+    // compute velocity field for current stage
+    setVelocityField(
+      d_current_time+0.5*dt,
+      d_phi_handles[rk_stage],
+      d_psi_handles[rk_stage],
+      comp);
+
+    // advance phi through the second stage of TVD-RK3
+    if (d_use_fused_tvd_rk_stages) {
+      advanceLevelSetEqnUsingFusedTVDRKStage(PHI,
+        d_phi_handles[0],
+        d_phi_handles[rk_stage],
+        d_phi_handles[0],
+        1.0/3.0, dt, comp);
+    } else {
+      computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
+                                 comp);
+      LevelSetMethodToolbox<DIM>::TVDRK3Stage3(
+        d_patch_hierarchy,
+        d_phi_handles[0],
+        d_phi_handles[rk_stage],
+        d_phi_handles[0],
+        d_rhs_phi_handle, dt,
+        comp, comp, comp, 0,  // components of PatchData to use in final 
+                              // stage of TVD-RK3 step
+        d_coarsest_active_level, d_finest_active_level);
+    }
+
+    if (d_codimension == 2) {
+  
+      // advance psi through the second stage of TVD-RK3
+      if (d_use_fused_tvd_rk_stages) {
+        advanceLevelSetEqnUsingFusedTVDRKStage(PSI,
+          d_psi_handles[0],
+          d_psi_handles[rk_stage],
+          d_psi_handles[0],
+          1.0/3.0, dt, comp);
+      } else {
+        computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
+                                   comp);
+        LevelSetMethodToolbox<DIM>::TVDRK3Stage3(
+          d_patch_hierarchy,
+          d_psi_handles[0],
+          d_psi_handles[rk_stage],
+          d_psi_handles[0],
+          d_rhs_psi_handle, dt,
+          comp, comp, comp, 0,  // components of PatchData to use in final 
+                                // stage of TVD-RK3 step
+          d_coarsest_active_level, d_finest_active_level);
+      }
     }
   } // end loop over vector level set function
+  
+  // } end Stage 3
+}
+
+
+/* advanceLevelSetEqnUsingLowStorageSSPRK() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::advanceLevelSetEqnUsingLowStorageSSPRK(
+  const LSMLIB_REAL dt)
+{
+  /*
+   * Every stage of the low-storage SSP Runge-Kutta methods is a 
+   * forward Euler step of size dt/2 blended with the solution at 
+   * the beginning of the time step:
+   *
+   *   u_(k) = alpha_k u_(0) + (1 - alpha_k) ( u_(k-1) + dt/2 L(u_(k-1)) )
+   *
+   * SSP(3,2):  alpha = (0, 0, 1/3),      stage times = (0, 1/2, 1)
+   * SSP(4,3):  alpha = (0, 0, 2/3, 0),   stage times = (0, 1/2, 1, 1/2)
+   *
+   * u_(0) is stored in d_phi_handles[0] and all intermediate stages are 
+   * stored (in place) in d_phi_handles[1].  The final stage overwrites 
+   * d_phi_handles[0].
+   */
+  static const LSMLIB_REAL ssp_rk2_alpha[3] = {0.0, 0.0, 1.0/3.0};
+  static const LSMLIB_REAL ssp_rk2_time[3]  = {0.0, 0.5, 1.0};
+  static const LSMLIB_REAL ssp_rk3_alpha[4] = {0.0, 0.0, 2.0/3.0, 0.0};
+  static const LSMLIB_REAL ssp_rk3_time[4]  = {0.0, 0.5, 1.0, 0.5};
+
+  int num_stages;
+  const LSMLIB_REAL *alpha;
+  const LSMLIB_REAL *stage_time;
+  if (d_tvd_runge_kutta_order == 2) {
+    num_stages = 3;
+    alpha = ssp_rk2_alpha;
+    stage_time = ssp_rk2_time;
+  } else {
+    num_stages = 4;
+    alpha = ssp_rk3_alpha;
+    stage_time = ssp_rk3_time;
+  }
+  const LSMLIB_REAL dt_stage = 0.5*dt;
+
+  for (int stage = 0; stage < num_stages; stage++) {
+
+    // registers holding u at the beginning and end of the stage
+    const int u_stage_reg = (stage == 0) ? 0 : 1;
+    const int u_next_reg = (stage == num_stages-1) ? 0 : 1;
+
+    // fill scratch space for the current stage
+    // NOTE: u_(0) was filled before the time advance
+    if (stage > 0) {
+      fillLevelSetFunctionGhostCells(u_stage_reg,
+        d_current_time + stage_time[stage]*dt);
+    }
+
+    // loop over components of vector level set function
+    for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
+
+      // compute velocity field for current stage
+      setVelocityField(
+        d_current_time + stage_time[stage]*dt,
+        d_phi_handles[u_stage_reg],
+        d_psi_handles[u_stage_reg],
+        comp);
+
+      // advance phi through the current stage
+      if (d_use_fused_tvd_rk_stages) {
+        advanceLevelSetEqnUsingFusedTVDRKStage(PHI,
+          d_phi_handles[u_next_reg],
+          d_phi_handles[u_stage_reg],
+          d_phi_handles[0],
+          alpha[stage], dt_stage, comp);
+      } else {
+        computeLevelSetEquationRHS(PHI,d_phi_handles[u_stage_reg],
+                                   comp);
+        LevelSetMethodToolbox<DIM>::SSPRKStage(
+          d_patch_hierarchy,
+          d_phi_handles[u_next_reg],
+          d_phi_handles[u_stage_reg],
+          d_phi_handles[0],
+          d_rhs_phi_handle, alpha[stage], dt_stage,
+          comp, comp, comp, 0,  // components of PatchData to use in
+                                // SSP Runge-Kutta stage
+          d_coarsest_active_level, d_finest_active_level);
+      }
+
+      if (d_codimension == 2) {
+
+        // advance psi through the current stage
+        if (d_use_fused_tvd_rk_stages) {
+          advanceLevelSetEqnUsingFusedTVDRKStage(PSI,
+            d_psi_handles[u_next_reg],
+            d_psi_handles[u_stage_reg],
+            d_psi_handles[0],
+            alpha[stage], dt_stage, comp);
+        } else {
+          computeLevelSetEquationRHS(PSI,d_psi_handles[u_stage_reg],
+                                     comp);
+          LevelSetMethodToolbox<DIM>::SSPRKStage(
+            d_patch_hierarchy,
+            d_psi_handles[u_next_reg],
+            d_psi_handles[u_stage_reg],
+            d_psi_handles[0],
+            d_rhs_psi_handle, alpha[stage], dt_stage,
+            comp, comp, comp, 0,  // components of PatchData to use in
+                                  // SSP Runge-Kutta stage
+            d_coarsest_active_level, d_finest_active_level);
+        }
+      }
+    } // end loop over components of vector level set function
+
+  } // end loop over stages
+}
+
+
+/* advanceLevelSetEqnUsingFusedTVDRKStage() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::advanceLevelSetEqnUsingFusedTVDRKStage(
+  const LEVEL_SET_FCN_TYPE level_set_fcn,
+  const int u_next_handle,
+  const int u_stage_handle,
+  const int u_cur_handle,
+  const LSMLIB_REAL alpha,
+  const LSMLIB_REAL dt,
+  const int component)
+{
+  const bool use_advection = 
+    d_lsm_velocity_field_strategy->providesExternalVelocityField();
+
+  int grad_phi_upwind_handle;
+  int grad_phi_plus_handle;
+  int grad_phi_minus_handle;
+  if (level_set_fcn == PHI) {
+    grad_phi_upwind_handle = d_grad_phi_upwind_handle;
+    grad_phi_plus_handle = d_grad_phi_plus_handle;
+    grad_phi_minus_handle = d_grad_phi_minus_handle;
+  } else {
+    grad_phi_upwind_handle = d_grad_psi_upwind_handle;
+    grad_phi_plus_handle = d_grad_psi_plus_handle;
+    grad_phi_minus_handle = d_grad_psi_minus_handle;
+  } 
+
+  // compute spatial derivatives of u_stage
+  int velocity_handle;
+  if (use_advection) {
+    velocity_handle = d_lsm_velocity_field_strategy->
+      getExternalVelocityFieldPatchDataHandle(component);
+    LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
+      d_patch_hierarchy,
+      d_spatial_derivative_type,
+      d_spatial_derivative_order,
+      grad_phi_upwind_handle,
+      u_stage_handle,
+      velocity_handle,
+      component,
+      d_coarsest_active_level,
+      d_finest_active_level);
+  } else {
+    velocity_handle = d_lsm_velocity_field_strategy->
+      getNormalVelocityFieldPatchDataHandle(level_set_fcn, component);
+    LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
+      d_patch_hierarchy,
+      d_spatial_derivative_type,
+      d_spatial_derivative_order,
+      grad_phi_plus_handle,
+      grad_phi_minus_handle,
+      u_stage_handle,
+      component,
+      d_coarsest_active_level,
+      d_finest_active_level);
+  }
+
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 2) || (DIM > 3) ) {
+    TBOX_ERROR(  d_object_name 
+              << "::advanceLevelSetEqnUsingFusedTVDRKStage(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 2 and 3 are supported."
+              << endl);
+  }
+
+  // loop over PatchHierarchy and advance the level set function 
+  // through the stage by calling Fortran subroutines
+  for ( int ln=d_coarsest_active_level ; ln<=d_finest_active_level ; ln++ ) {
+
+    Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
+    
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      const int pn = *pi;
+      Pointer< Patch<DIM> > patch = level->getPatch(pn);
+      if ( patch.isNull() ) {
+        TBOX_ERROR(  d_object_name 
+                  << "::advanceLevelSetEqnUsingFusedTVDRKStage(): "
+                  << "Cannot find patch. Null patch pointer."
+                  << endl);
+      }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
+
+      // get pointers to data and index space ranges
+      Pointer< CellData<DIM,LSMLIB_REAL> > u_next_data =
+        patch->getPatchData( u_next_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > u_stage_data =
+        patch->getPatchData( u_stage_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > u_cur_data =
+        patch->getPatchData( u_cur_handle );
+
+      Box<DIM> u_next_ghostbox = u_next_data->getGhostBox();
+      const IntVector<DIM> u_next_ghostbox_lower = u_next_ghostbox.lower();
+      const IntVector<DIM> u_next_ghostbox_upper = u_next_ghostbox.upper();
 
-  // } end Stage 1
+      Box<DIM> u_stage_ghostbox = u_stage_data->getGhostBox();
+      const IntVector<DIM> u_stage_ghostbox_lower = u_stage_ghostbox.lower();
+      const IntVector<DIM> u_stage_ghostbox_upper = u_stage_ghostbox.upper();
 
+      Box<DIM> u_cur_ghostbox = u_cur_data->getGhostBox();
+      const IntVector<DIM> u_cur_ghostbox_lower = u_cur_ghostbox.lower();
+      const IntVector<DIM> u_cur_ghostbox_upper = u_cur_ghostbox.upper();
 
-  // { begin Stage 2
+      // fill box
+      Box<DIM> fillbox = u_next_data->getBox();
+      const IntVector<DIM> fillbox_lower = fillbox.lower();
+      const IntVector<DIM> fillbox_upper = fillbox.upper();
 
-  // advance TVD RK3 stage counter
-  rk_stage = 1;
+      LSMLIB_REAL* u_next = u_next_data->getPointer(component);
+      LSMLIB_REAL* u_stage = u_stage_data->getPointer(component);
+      LSMLIB_REAL* u_cur = u_cur_data->getPointer(component);
 
-  // fill scratch space for second stage of time advance
-  const int num_levels = d_patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    // NOTE: true indicates that physical boundary conditions should
-    //       be set.
-    d_fill_bdry_sched_time_advance[rk_stage][ln]
-     ->fillData(d_current_time,true);
-  }
-  for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
-    d_bc_module->imposeBoundaryConditions(
-      d_phi_handles[rk_stage],
-      d_lower_bc_phi[comp], 
-      d_upper_bc_phi[comp], 
-      d_spatial_derivative_type,
-      d_spatial_derivative_order,
-      comp);
-    if (d_codimension == 2) {
-      d_bc_module->imposeBoundaryConditions(
-        d_psi_handles[rk_stage],
-        d_lower_bc_psi[comp], 
-        d_upper_bc_psi[comp], 
-        d_spatial_derivative_type,
-        d_spatial_derivative_order,
-        comp);
-    }
-  }
+      if (use_advection) {
 
-  // loop over components of vector level set function
-  for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
+        Pointer< CellData<DIM,LSMLIB_REAL> > grad_phi_upwind_data =
+          patch->getPatchData( grad_phi_upwind_handle );
+        Pointer< CellData<DIM,LSMLIB_REAL> > velocity_data =
+          patch->getPatchData( velocity_handle );
 
-    // compute velocity field for current stage
-    d_lsm_velocity_field_strategy->computeVelocityField(
-      d_current_time+dt,
-      d_phi_handles[rk_stage],
-      d_psi_handles[rk_stage],
-      comp);
+        Box<DIM> grad_phi_upwind_ghostbox = 
+          grad_phi_upwind_data->getGhostBox();
+        const IntVector<DIM> grad_phi_upwind_ghostbox_lower = 
+          grad_phi_upwind_ghostbox.lower();
+        const IntVector<DIM> grad_phi_upwind_ghostbox_upper = 
+          grad_phi_upwind_ghostbox.upper();
 
-    // advance phi through the second stage of TVD-RK3
-    computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
-                               comp);
-    LevelSetMethodToolbox<DIM>::TVDRK3Stage2(
-      d_patch_hierarchy,
-      d_phi_handles[rk_stage+1],
-      d_phi_handles[rk_stage],
-      d_phi_handles[rk_stage-1],
-      d_rhs_phi_handle, dt,
-      comp, comp, comp, 0); // components of PatchData to use in second 
-                            // stage of TVD-RK3 step
+        Box<DIM> vel_ghostbox = velocity_data->getGhostBox();
+        const IntVector<DIM> vel_ghostbox_lower = vel_ghostbox.lower();
+        const IntVector<DIM> vel_ghostbox_upper = vel_ghostbox.upper();
 
-    if (d_codimension == 2) {
+        LSMLIB_REAL* grad_phi_upwind[LSM_DIM_MAX];
+        LSMLIB_REAL* vel[LSM_DIM_MAX];
+        for (int dim = 0; dim < DIM; dim++) {
+          grad_phi_upwind[dim] = grad_phi_upwind_data->getPointer(dim);
+          vel[dim] = velocity_data->getPointer(dim);
+        }
 
-      // advance psi through the second stage of TVD-RK3
-      computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
-                                 comp);
-      LevelSetMethodToolbox<DIM>::TVDRK3Stage2(
-        d_patch_hierarchy,
-        d_psi_handles[rk_stage+1],
-        d_psi_handles[rk_stage],
-        d_psi_handles[rk_stage-1],
-        d_rhs_psi_handle, dt,
-        comp, comp, comp, 0); // components of PatchData to use in second 
-                              // stage of TVD-RK3 step
-    }
-  } // end loop over vector level set function
+        if (DIM == 3) {
+
+          LSM3D_TVD_RK_STAGE_ADVECTION(
+            u_next,
+            &u_next_ghostbox_lower[0],
+            &u_next_ghostbox_upper[0],
+            &u_next_ghostbox_lower[1],
+            &u_next_ghostbox_upper[1],
+            &u_next_ghostbox_lower[2],
+            &u_next_ghostbox_upper[2],
+            u_cur,
+            &u_cur_ghostbox_lower[0],
+            &u_cur_ghostbox_upper[0],
+            &u_cur_ghostbox_lower[1],
+            &u_cur_ghostbox_upper[1],
+            &u_cur_ghostbox_lower[2],
+            &u_cur_ghostbox_upper[2],
+            u_stage,
+            &u_stage_ghostbox_lower[0],
+            &u_stage_ghostbox_upper[0],
+            &u_stage_ghostbox_lower[1],
+            &u_stage_ghostbox_upper[1],
+            &u_stage_ghostbox_lower[2],
+            &u_stage_ghostbox_upper[2],
+            grad_phi_upwind[0], grad_phi_upwind[1], grad_phi_upwind[2],
+            &grad_phi_upwind_ghostbox_lower[0],
+            &grad_phi_upwind_ghostbox_upper[0],
+            &grad_phi_upwind_ghostbox_lower[1],
+            &grad_phi_upwind_ghostbox_upper[1],
+            &grad_phi_upwind_ghostbox_lower[2],
+            &grad_phi_upwind_ghostbox_upper[2],
+            vel[0], vel[1], vel[2],
+            &vel_ghostbox_lower[0],
+            &vel_ghostbox_upper[0],
+            &vel_ghostbox_lower[1],
+            &vel_ghostbox_upper[1],
+            &vel_ghostbox_lower[2],
+            &vel_ghostbox_upper[2],
+            &fillbox_lower[0],
+            &fillbox_upper[0],
+            &fillbox_lower[1],
+            &fillbox_upper[1],
+            &fillbox_lower[2],
+            &fillbox_upper[2],
+            &alpha, &dt);
+
+        } else {  // DIM == 2 (other values are rejected before the loop)
+
+          LSM2D_TVD_RK_STAGE_ADVECTION(
+            u_next,
+            &u_next_ghostbox_lower[0],
+            &u_next_ghostbox_upper[0],
+            &u_next_ghostbox_lower[1],
+            &u_next_ghostbox_upper[1],
+            u_cur,
+            &u_cur_ghostbox_lower[0],
+            &u_cur_ghostbox_upper[0],
+            &u_cur_ghostbox_lower[1],
+            &u_cur_ghostbox_upper[1],
+            u_stage,
+            &u_stage_ghostbox_lower[0],
+            &u_stage_ghostbox_upper[0],
+            &u_stage_ghostbox_lower[1],
+            &u_stage_ghostbox_upper[1],
+            grad_phi_upwind[0], grad_phi_upwind[1],
+            &grad_phi_upwind_ghostbox_lower[0],
+            &grad_phi_upwind_ghostbox_upper[0],
+            &grad_phi_upwind_ghostbox_lower[1],
+            &grad_phi_upwind_ghostbox_upper[1],
+            vel[0], vel[1],
+            &vel_ghostbox_lower[0],
+            &vel_ghostbox_upper[0],
+            &vel_ghostbox_lower[1],
+            &vel_ghostbox_upper[1],
+            &fillbox_lower[0],
+            &fillbox_upper[0],
+            &fillbox_lower[1],
+            &fillbox_upper[1],
+            &alpha, &dt);
+
+        } // end switch over dimension (DIM) of calculation
+
+      } else { // normal velocity
+
+        Pointer< CellData<DIM,LSMLIB_REAL> > normal_velocity_data =
+          patch->getPatchData( velocity_handle );
+        Pointer< CellData<DIM,LSMLIB_REAL> > grad_phi_plus_data =
+          patch->getPatchData( grad_phi_plus_handle );
+        Pointer< CellData<DIM,LSMLIB_REAL> > grad_phi_minus_data =
+          patch->getPatchData( grad_phi_minus_handle );
+
+        Box<DIM> grad_phi_plus_ghostbox = grad_phi_plus_data->getGhostBox();
+        const IntVector<DIM> grad_phi_plus_ghostbox_lower = 
+          grad_phi_plus_ghostbox.lower();
+        const IntVector<DIM> grad_phi_plus_ghostbox_upper = 
+          grad_phi_plus_ghostbox.upper();
+        Box<DIM> grad_phi_minus_ghostbox = grad_phi_minus_data->getGhostBox();
+        const IntVector<DIM> grad_phi_minus_ghostbox_lower = 
+          grad_phi_minus_ghostbox.lower();
+        const IntVector<DIM> grad_phi_minus_ghostbox_upper = 
+          grad_phi_minus_ghostbox.upper();
+
+        Box<DIM> vel_ghostbox = normal_velocity_data->getGhostBox();
+        const IntVector<DIM> vel_ghostbox_lower = vel_ghostbox.lower();
+        const IntVector<DIM> vel_ghostbox_upper = vel_ghostbox.upper();
+
+        LSMLIB_REAL* grad_phi_plus[LSM_DIM_MAX];
+        LSMLIB_REAL* grad_phi_minus[LSM_DIM_MAX];
+        LSMLIB_REAL* vel = normal_velocity_data->getPointer();
+        for (int dim = 0; dim < DIM; dim++) {
+          grad_phi_plus[dim] = grad_phi_plus_data->getPointer(dim);
+          grad_phi_minus[dim] = grad_phi_minus_data->getPointer(dim);
+        }
 
-  // } end Stage 2
+        if (DIM == 3) {
+
+          LSM3D_TVD_RK_STAGE_NORMAL_VEL(
+            u_next,
+            &u_next_ghostbox_lower[0],
+            &u_next_ghostbox_upper[0],
+            &u_next_ghostbox_lower[1],
+            &u_next_ghostbox_upper[1],
+            &u_next_ghostbox_lower[2],
+            &u_next_ghostbox_upper[2],
+            u_cur,
+            &u_cur_ghostbox_lower[0],
+            &u_cur_ghostbox_upper[0],
+            &u_cur_ghostbox_lower[1],
+            &u_cur_ghostbox_upper[1],
+            &u_cur_ghostbox_lower[2],
+            &u_cur_ghostbox_upper[2],
+            u_stage,
+            &u_stage_ghostbox_lower[0],
+            &u_stage_ghostbox_upper[0],
+            &u_stage_ghostbox_lower[1],
+            &u_stage_ghostbox_upper[1],
+            &u_stage_ghostbox_lower[2],
+            &u_stage_ghostbox_upper[2],
+            grad_phi_plus[0], grad_phi_plus[1], grad_phi_plus[2],
+            &grad_phi_plus_ghostbox_lower[0],
+            &grad_phi_plus_ghostbox_upper[0],
+            &grad_phi_plus_ghostbox_lower[1],
+            &grad_phi_plus_ghostbox_upper[1],
+            &grad_phi_plus_ghostbox_lower[2],
+            &grad_phi_plus_ghostbox_upper[2],
+            grad_phi_minus[0], grad_phi_minus[1], grad_phi_minus[2],
+            &grad_phi_minus_ghostbox_lower[0],
+            &grad_phi_minus_ghostbox_upper[0],
+            &grad_phi_minus_ghostbox_lower[1],
+            &grad_phi_minus_ghostbox_upper[1],
+            &grad_phi_minus_ghostbox_lower[2],
+            &grad_phi_minus_ghostbox_upper[2],
+            vel,
+            &vel_ghostbox_lower[0],
+            &vel_ghostbox_upper[0],
+            &vel_ghostbox_lower[1],
+            &vel_ghostbox_upper[1],
+            &vel_ghostbox_lower[2],
+            &vel_ghostbox_upper[2],
+            &fillbox_lower[0],
+            &fillbox_upper[0],
+            &fillbox_lower[1],
+            &fillbox_upper[1],
+            &fillbox_lower[2],
+            &fillbox_upper[2],
+            &alpha, &dt);
+
+        } else {  // DIM == 2 (other values are rejected before the loop)
+
+          LSM2D_TVD_RK_STAGE_NORMAL_VEL(
+            u_next,
+            &u_next_ghostbox_lower[0],
+            &u_next_ghostbox_upper[0],
+            &u_next_ghostbox_lower[1],
+            &u_next_ghostbox_upper[1],
+            u_cur,
+            &u_cur_ghostbox_lower[0],
+            &u_cur_ghostbox_upper[0],
+            &u_cur_ghostbox_lower[1],
+            &u_cur_ghostbox_upper[1],
+            u_stage,
+            &u_stage_ghostbox_lower[0],
+            &u_stage_ghostbox_upper[0],
+            &u_stage_ghostbox_lower[1],
+            &u_stage_ghostbox_upper[1],
+            grad_phi_plus[0], grad_phi_plus[1],
+            &grad_phi_plus_ghostbox_lower[0],
+            &grad_phi_plus_ghostbox_upper[0],
+            &grad_phi_plus_ghostbox_lower[1],
+            &grad_phi_plus_ghostbox_upper[1],
+            grad_phi_minus[0], grad_phi_minus[1],
+            &grad_phi_minus_ghostbox_lower[0],
+            &grad_phi_minus_ghostbox_upper[0],
+            &grad_phi_minus_ghostbox_lower[1],
+            &grad_phi_minus_ghostbox_upper[1],
+            vel,
+            &vel_ghostbox_lower[0],
+            &vel_ghostbox_upper[0],
+            &vel_ghostbox_lower[1],
+            &vel_ghostbox_upper[1],
+            &fillbox_lower[0],
+            &fillbox_upper[0],
+            &fillbox_lower[1],
+            &fillbox_upper[1],
+            &alpha, &dt);
+
+        } // end switch over dimension (DIM) of calculation
+
+      } // end switch over velocity type
+
+    } // end threaded loop over patches in level
+  } // end loop over levels in hierarchy
+}
 
 
-  // { begin Stage 3
+/* advanceLevelSetEqnUsingSemiLagrangian() */
+template <int DIM>
+void LevelSetFunctionIntegrator<DIM>::advanceLevelSetEqnUsingSemiLagrangian(
+  const LSMLIB_REAL dt)
+{
+  /*
+   * The back and forth error compensation and correction (BFECC) step
+   * consists of three semi-Lagrangian steps:
+   *
+   *   u_(1) = SL(u_(0); dt)                       (forward)
+   *   u_(2) = 3/2 u_(0) - 1/2 SL(u_(1); -dt)      (backward + correction)
+   *   u(t+dt) = SL(u_(2); dt)                     (forward)
+   *
+   * u_(0), u_(1) and u_(2) are stored in d_phi_handles[0], [1] and [2].
+   * The velocity field is evaluated at the midpoint of the time step
+   * for all three steps.  u_(1) approximates u(t+dt) and u_(2) 
+   * approximates u(t).
+   */
+  static const LSMLIB_REAL bfecc_alpha[3] = {0.0, 1.5, 0.0};
+  static const LSMLIB_REAL bfecc_dt_sign[3] = {1.0, -1.0, 1.0};
+  static const int u_in_reg[3] = {0, 1, 2};
+  static const int u_next_reg[3] = {1, 2, 0};
+  static const LSMLIB_REAL u_in_time[3] = {0.0, 1.0, 0.0};
+
+  for (int step = 0; step < 3; step++) {
+
+    // fill ghostcells for the input of the current step
+    // NOTE: u_(0) was filled before the time advance
+    if (step > 0) {
+      fillLevelSetFunctionGhostCells(u_in_reg[step],
+        d_current_time + u_in_time[step]*dt);
+    }
 
-  // advance TVD RK3 stage counter
-  rk_stage = 2;
+    // loop over components of vector level set function
+    for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
 
-  // fill scratch space for second stage of time advance
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    // NOTE: true indicates that physical boundary conditions should
-    //       be set.
-    d_fill_bdry_sched_time_advance[rk_stage][ln]
-     ->fillData(d_current_time,true);
-  }
-  for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
-    d_bc_module->imposeBoundaryConditions(
-      d_phi_handles[rk_stage],
-      d_lower_bc_phi[comp], 
-      d_upper_bc_phi[comp], 
-      d_spatial_derivative_type,
-      d_spatial_derivative_order,
-      comp);
-    if (d_codimension == 2) {
-      d_bc_module->imposeBoundaryConditions(
-        d_psi_handles[rk_stage],
-        d_lower_bc_psi[comp], 
-        d_upper_bc_psi[comp], 
-        d_spatial_derivative_type,
-        d_spatial_derivative_order,
+      // compute velocity field at the midpoint of the time step
+      setVelocityField(
+        d_current_time + 0.5*dt,
+        d_phi_handles[0],
+        d_psi_handles[0],
         comp);
-    }
-  }
+      const int velocity_handle = d_lsm_velocity_field_strategy->
+        getExternalVelocityFieldPatchDataHandle(comp);
+
+      // the velocity is interpolated at the midpoints of characteristics
+      // that extend up to semi_lagrangian_cfl_number grid cells outside 
+      // of the patch, so it must be set in int(CFL/2)+1 ghostcells
+      // (the velocity ghostcells are not filled by the integrator)
+      const int vel_ghostcell_width_needed = 
+        ((int) (0.5*d_semi_lagrangian_cfl_number)) + 1;
+      const IntVector<DIM> vel_ghostcell_width = 
+        VariableDatabase<DIM>::getDatabase()->getPatchDescriptor()
+          ->getPatchDataFactory(velocity_handle)->getGhostCellWidth();
+      for (int dim = 0; dim < DIM; dim++) {
+        if (vel_ghostcell_width(dim) < vel_ghostcell_width_needed) {
+          TBOX_ERROR(  d_object_name
+                    << "::advanceLevelSetEqnUsingSemiLagrangian(): "
+                    << "semi_lagrangian_cfl_number = " 
+                    << d_semi_lagrangian_cfl_number
+                    << " requires an external velocity field with at "
+                    << "least " << vel_ghostcell_width_needed 
+                    << " ghostcells (found " << vel_ghostcell_width(dim)
+                    << ")."
+                    << endl);
+        }
+      }
 
-  // loop over components of vector level set function
-  for (int comp = 0; comp < d_num_level_set_fcn_components; comp++) {
+      // advance phi through the current step
+      LevelSetMethodToolbox<DIM>::semiLagrangianAdvectionStep(
+        d_patch_hierarchy,
+        d_phi_handles[u_next_reg[step]],
+        d_phi_handles[0],
+        d_phi_handles[u_in_reg[step]],
+        velocity_handle,
+        bfecc_alpha[step], bfecc_dt_sign[step]*dt,
+        comp, comp, comp,   // components of PatchData to use in
+                            // semi-Lagrangian step
+        d_coarsest_active_level, d_finest_active_level);
 
-    // compute velocity field for current stage
-    d_lsm_velocity_field_strategy->computeVelocityField(
-      d_current_time+0.5*dt,
-      d_phi_handles[rk_stage],
-      d_psi_handles[rk_stage],
-      comp);
+      if (d_codimension == 2) {
 
-    // advance phi through the second stage of TVD-RK3
-    computeLevelSetEquationRHS(PHI,d_phi_handles[rk_stage],
-                               comp);
-    LevelSetMethodToolbox<DIM>::TVDRK3Stage3(
-      d_patch_hierarchy,
-      d_phi_handles[0],
-      d_phi_handles[rk_stage],
-      d_phi_handles[0],
-      d_rhs_phi_handle, dt,
-      comp, comp, comp, 0); // components of PatchData to use in final 
-                            // stage of TVD-RK3 step
+        // advance psi through the current step
+        LevelSetMethodToolbox<DIM>::semiLagrangianAdvectionStep(
+          d_patch_hierarchy,
+          d_psi_handles[u_next_reg[step]],
+          d_psi_handles[0],
+          d_psi_handles[u_in_reg[step]],
+          velocity_handle,
+          bfecc_alpha[step], bfecc_dt_sign[step]*dt,
+          comp, comp, comp,   // components of PatchData to use in
+                              // semi-Lagrangian step
+          d_coarsest_active_level, d_finest_active_level);
+      }
+    } // end loop over components of vector level set function
 
-    if (d_codimension == 2) {
-  
-      // advance psi through the second stage of TVD-RK3
-      computeLevelSetEquationRHS(PSI,d_psi_handles[rk_stage],
-                                 comp);
-      LevelSetMethodToolbox<DIM>::TVDRK3Stage3(
-        d_patch_hierarchy,
-        d_psi_handles[0],
-        d_psi_handles[rk_stage],
-        d_psi_handles[0],
-        d_rhs_psi_handle, dt,
-        comp, comp, comp, 0); // components of PatchData to use in final 
-                              // stage of TVD-RK3 step
+  } // end loop over BFECC steps
+}
+
+
+/* imposeLevelSetFunctionBoundaryConditions() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::imposeLevelSetFunctionBoundaryConditions(
+  const int reg)
+{
+  // impose boundary conditions on all components of phi and psi in
+  // a single pass over the PatchHierarchy
+  d_bc_module->imposeBoundaryConditions(
+    d_phi_handles[reg],
+    d_lower_bc_phi, 
+    d_upper_bc_phi, 
+    (d_codimension == 2) ? d_psi_handles[reg] : -1,
+    d_lower_bc_psi, 
+    d_upper_bc_psi, 
+    d_spatial_derivative_type,
+    d_spatial_derivative_order,
+    d_coarsest_active_level,
+    d_finest_active_level);
+}
+
+
+/* fillLevelSetFunctionGhostCells() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::fillLevelSetFunctionGhostCells(
+  const int reg,
+  const LSMLIB_REAL time)
+{
+  for ( int ln=d_coarsest_active_level ; ln<=d_finest_active_level ; ln++ ) {
+    // NOTE: true indicates that physical boundary conditions should
+    //       be set.
+    if (d_use_subcycling && (ln > 0)) {
+      // ghost cells at coarse-fine boundaries are interpolated in time
+      // between the old and new level set functions on the coarser level
+      d_fill_bdry_sched_subcycle[reg][ln]->fillData(time,true);
+    } else {
+      d_fill_bdry_sched_time_advance[reg][ln]->fillData(time,true);
     }
-  } // end loop over vector level set function
-  
-  // } end Stage 3
+  }
+  imposeLevelSetFunctionBoundaryConditions(reg);
 }
 
 
@@ -1527,13 +3068,25 @@ void LevelSetFunctionIntegrator<DIM>::computeLevelSetEquationRHS(
     rhs_handle = d_rhs_psi_handle;
   } 
 
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  d_object_name 
+              << "::computeLevelSetEquationRHS(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
+
   // loop over PatchHierarchy and zero out the RHS for level set 
   // equation by calling Fortran routines
-  const int num_levels = d_patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  for ( int ln=d_coarsest_active_level ; ln<=d_finest_active_level ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -1544,6 +3097,15 @@ void LevelSetFunctionIntegrator<DIM>::computeLevelSetEquationRHS(
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       // get pointers to data and index space ranges
       Pointer< CellData<DIM,LSMLIB_REAL> > rhs_data =
@@ -1576,22 +3138,16 @@ void LevelSetFunctionIntegrator<DIM>::computeLevelSetEquationRHS(
           &rhs_ghostbox_lower[1],
           &rhs_ghostbox_upper[1]);
 
-      } else if (DIM == 1) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
 
         LSM1D_ZERO_OUT_LEVEL_SET_EQN_RHS(
           rhs,
           &rhs_ghostbox_lower[0],
           &rhs_ghostbox_upper[0]);
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  d_object_name 
-                  << "::computeLevelSetEquationRHS(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
       } // end switch over dimension (DIM) of calculation
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
   } // end loop over levels in hierarchy
 
   // invoke addAdvectionTermToLevelSetEquationRHS() if necessary
@@ -1637,15 +3193,29 @@ void LevelSetFunctionIntegrator<DIM>::addAdvectionTermToLevelSetEquationRHS(
     grad_phi_upwind_handle,
     phi_handle,
     velocity_handle,
-    component); 
+    component,
+    d_coarsest_active_level,
+    d_finest_active_level);
+
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  d_object_name 
+              << "::addAdvectionTermToLevelSetEquationRHS(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
 
   // loop over PatchHierarchy and add contribution of advection term 
   // to level set equation RHS by calling Fortran subroutines
-  const int num_levels = d_patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  for ( int ln=d_coarsest_active_level ; ln<=d_finest_active_level ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -1656,6 +3226,15 @@ void LevelSetFunctionIntegrator<DIM>::addAdvectionTermToLevelSetEquationRHS(
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       // get pointers to data and index space ranges
       Pointer< CellData<DIM,LSMLIB_REAL> > rhs_data =
@@ -1746,7 +3325,7 @@ void LevelSetFunctionIntegrator<DIM>::addAdvectionTermToLevelSetEquationRHS(
           &fillbox_lower[1],
           &fillbox_upper[1]);
 
-      } else if (DIM == 1) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
 
         LSM1D_ADD_ADVECTION_TERM_TO_LSE_RHS(
           rhs,
@@ -1761,15 +3340,9 @@ void LevelSetFunctionIntegrator<DIM>::addAdvectionTermToLevelSetEquationRHS(
           &fillbox_lower[0],
           &fillbox_upper[0]);
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  d_object_name 
-                  << "::addAdvectionTermToLevelSetEquationRHS(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
       } // end switch over dimension (DIM) of calculation
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
   } // end loop over levels in hierarchy
 }
 
@@ -1805,15 +3378,29 @@ void LevelSetFunctionIntegrator<DIM>::addNormalVelocityTermToLevelSetEquationRHS
     grad_phi_plus_handle,
     grad_phi_minus_handle,
     phi_handle,
-    component); 
+    component,
+    d_coarsest_active_level,
+    d_finest_active_level);
+
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  d_object_name 
+              << "::addNormalVelocityTermToLevelSetEquationRHS(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
 
   // loop over PatchHierarchy and add contribution of normal velocity 
   // term to level set equation RHS by calling Fortran subroutines
-  const int num_levels = d_patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  for ( int ln=d_coarsest_active_level ; ln<=d_finest_active_level ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -1824,6 +3411,15 @@ void LevelSetFunctionIntegrator<DIM>::addNormalVelocityTermToLevelSetEquationRHS
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       // get pointers to data and index space ranges
       Pointer< CellData<DIM,LSMLIB_REAL> > rhs_data =
@@ -1935,7 +3531,7 @@ void LevelSetFunctionIntegrator<DIM>::addNormalVelocityTermToLevelSetEquationRHS
           &fillbox_lower[1],
           &fillbox_upper[1]);
 
-      } else if (DIM == 1) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
 
         LSM1D_ADD_NORMAL_VEL_TERM_TO_LSE_RHS(
           rhs,
@@ -1953,25 +3549,43 @@ void LevelSetFunctionIntegrator<DIM>::addNormalVelocityTermToLevelSetEquationRHS
           &fillbox_lower[0],
           &fillbox_upper[0]);
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  d_object_name 
-                  << "::addNormalVelocityTermToLevelSetEquationRHS(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
       } // end switch over dimension (DIM) of calculation
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
   } // end loop over levels in hierarchy
 }
 
 
+/* invalidateGhostCellData() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::invalidateGhostCellData()
+{
+  d_ghost_cells_current = false;
+}
+
+
+/* invalidateVelocityFieldCache() */
+template <int DIM> 
+void LevelSetFunctionIntegrator<DIM>::invalidateVelocityFieldCache()
+{
+  for (unsigned int comp = 0; 
+       comp < d_num_velocity_cache_entries.size(); comp++) {
+    d_num_velocity_cache_entries[comp].assign(
+      d_num_velocity_cache_entries[comp].size(), 0);
+  }
+}
+
+
 /* reinitializeLevelSetFunctions() */
 template <int DIM> 
 void LevelSetFunctionIntegrator<DIM>::reinitializeLevelSetFunctions(
   const LEVEL_SET_FCN_TYPE level_set_fcn,
   const int max_iterations)
 {
+  // reinitialization only updates the interior of the level set 
+  // functions
+  d_ghost_cells_current = false;
+
   if (level_set_fcn == PHI) {
     for (int comp=0; comp < d_num_level_set_fcn_components; comp++) {
       d_phi_reinitialization_alg->
@@ -2001,6 +3615,10 @@ void LevelSetFunctionIntegrator<DIM>::orthogonalizeLevelSetFunctions(
   const int max_reinit_iterations,
   const int max_ortho_iterations)
 {
+  // orthogonalization only updates the interior of the level set 
+  // functions
+  d_ghost_cells_current = false;
+
   if (level_set_fcn == PHI) {
     reinitializeLevelSetFunctions(PSI, max_reinit_iterations);
     for (int comp=0; comp < d_num_level_set_fcn_components; comp++) {
@@ -2054,6 +3672,15 @@ void LevelSetFunctionIntegrator<DIM>::initializeVariables()
               << endl );
   }
 
+  // the departure points of the semi-Lagrangian step may lie up to
+  // semi_lagrangian_cfl_number grid cells away from the patch interior
+  if (d_use_semi_lagrangian_advection) {
+    int sl_ghostcell_width = ((int) d_semi_lagrangian_cfl_number) + 1;
+    if (sl_ghostcell_width > scratch_ghostcell_width) {
+      scratch_ghostcell_width = sl_ghostcell_width;
+    }
+  }
+
   d_level_set_ghostcell_width = IntVector<DIM>(scratch_ghostcell_width);
   IntVector<DIM> zero_ghostcell_width(0);
 
@@ -2063,6 +3690,7 @@ void LevelSetFunctionIntegrator<DIM>::initializeVariables()
   // get contexts used by level set method algorithm
   Pointer<VariableContext> current_context = var_db->getContext("CURRENT");
   Pointer<VariableContext> scratch_context = var_db->getContext("SCRATCH");
+  Pointer<VariableContext> old_context = var_db->getContext("OLD");
   Pointer<VariableContext> upwind_context = var_db->getContext("UPWIND");
   Pointer<VariableContext> plus_context = var_db->getContext("PLUS_DERIVATIVE");
   Pointer<VariableContext> minus_context = 
@@ -2074,6 +3702,7 @@ void LevelSetFunctionIntegrator<DIM>::initializeVariables()
   d_reinitialization_scratch_variables.clrAllFlags();
   d_orthogonalization_scratch_variables.clrAllFlags();
   d_time_advance_scratch_variables.clrAllFlags();
+  d_subcycle_old_variables.clrAllFlags();
   d_persistent_variables.clrAllFlags();
 
 
@@ -2097,7 +3726,7 @@ void LevelSetFunctionIntegrator<DIM>::initializeVariables()
   }
  
   // reserve memory for scratch variable PatchData Handles
-  d_phi_handles.reserve(d_tvd_runge_kutta_order);
+  d_phi_handles.reserve(d_num_rk_registers);
 
   // phi - "CURRENT" context for time advance
   d_phi_handles[0] = var_db->registerVariableAndContext(
@@ -2105,7 +3734,7 @@ void LevelSetFunctionIntegrator<DIM>::initializeVariables()
   d_solution_variables.setFlag(d_phi_handles[0]);
 
   // phi - "SCRATCH" context for time advance
-  for (int k=1; k < d_tvd_runge_kutta_order; k++) {
+  for (int k=1; k < d_num_rk_registers; k++) {
     stringstream context_name("");
     context_name << "TVD_RK_SCRATCH_" << k;
     d_phi_handles[k] = var_db->registerVariableAndContext(
@@ -2115,6 +3744,16 @@ void LevelSetFunctionIntegrator<DIM>::initializeVariables()
     d_time_advance_scratch_variables.setFlag(d_phi_handles[k]);
   }
 
+  // phi - "OLD" context for time interpolation when subcycling
+  // NOTE: the ghostcell width matches the "CURRENT" context so that
+  //       both may be used as sources for time interpolation
+  d_phi_old_handle = var_db->registerVariableAndContext(
+    phi_variable, old_context, d_level_set_ghostcell_width);
+  if (d_use_subcycling) {
+    d_time_advance_scratch_variables.setFlag(d_phi_old_handle);
+    d_subcycle_old_variables.setFlag(d_phi_old_handle);
+  }
+
   // upwind grad(phi)
   d_grad_phi_upwind_handle = var_db->registerVariableAndContext(
     grad_phi_variable, upwind_context, zero_ghostcell_width);
@@ -2148,14 +3787,16 @@ void LevelSetFunctionIntegrator<DIM>::initializeVariables()
   }
   d_rhs_phi_handle = var_db->registerVariableAndContext(
     rhs_phi_variable, scratch_context, zero_ghostcell_width);
-  d_time_advance_scratch_variables.setFlag(d_rhs_phi_handle);
+  if (!d_use_fused_tvd_rk_stages) {
+    d_time_advance_scratch_variables.setFlag(d_rhs_phi_handle);
+  }
 
 
   /* 
    * Initialize psi variables for codimension-two problems
    */
   // reserve memory for scratch variable PatchData Handles
-  d_psi_handles.reserve(d_tvd_runge_kutta_order);
+  d_psi_handles.reserve(d_num_rk_registers);
 
   if (d_codimension == 2) {
 
@@ -2181,7 +3822,7 @@ void LevelSetFunctionIntegrator<DIM>::initializeVariables()
     d_solution_variables.setFlag(d_psi_handles[0]);
 
     // psi - "SCRATCH" context for time advance
-    for (int k=1; k < d_tvd_runge_kutta_order; k++) {
+    for (int k=1; k < d_num_rk_registers; k++) {
       stringstream context_name("");
       context_name << "TVD_RK_SCRATCH_" << k;
       d_psi_handles[k] = var_db->registerVariableAndContext(
@@ -2191,6 +3832,14 @@ void LevelSetFunctionIntegrator<DIM>::initializeVariables()
       d_time_advance_scratch_variables.setFlag(d_psi_handles[k]); 
     }
 
+    // psi - "OLD" context for time interpolation when subcycling
+    d_psi_old_handle = var_db->registerVariableAndContext(
+      psi_variable, old_context, d_level_set_ghostcell_width);
+    if (d_use_subcycling) {
+      d_time_advance_scratch_variables.setFlag(d_psi_old_handle);
+      d_subcycle_old_variables.setFlag(d_psi_old_handle);
+    }
+
     // upwind grad(psi)
     d_grad_psi_upwind_handle = var_db->registerVariableAndContext(
       grad_psi_variable, upwind_context, zero_ghostcell_width);
@@ -2224,11 +3873,13 @@ void LevelSetFunctionIntegrator<DIM>::initializeVariables()
     }
     d_rhs_psi_handle = var_db->registerVariableAndContext(
       rhs_psi_variable, scratch_context, zero_ghostcell_width);
-    d_time_advance_scratch_variables.setFlag(d_rhs_psi_handle);
+    if (!d_use_fused_tvd_rk_stages) {
+      d_time_advance_scratch_variables.setFlag(d_rhs_psi_handle);
+    }
 
   } else { // set PatchData handles for filling psi scratch data to -1 
            // (a bogus value)
-    for (int k=0; k < d_tvd_runge_kutta_order; k++) 
+    for (int k=0; k < d_num_rk_registers; k++) 
       d_psi_handles[k] = -1;
   }
 
@@ -2298,10 +3949,10 @@ void LevelSetFunctionIntegrator<DIM>::initializeCommunicationObjects()
 
   // set up objects for filling boundary data during the 
   // time advance of the level set functions
-  d_fill_bdry_time_advance.resizeArray(d_tvd_runge_kutta_order);
-  d_fill_bdry_sched_time_advance.resizeArray(d_tvd_runge_kutta_order);
+  d_fill_bdry_time_advance.resizeArray(d_num_rk_registers);
+  d_fill_bdry_sched_time_advance.resizeArray(d_num_rk_registers);
 
-  for (int k = 0; k < d_tvd_runge_kutta_order; k++) {
+  for (int k = 0; k < d_num_rk_registers; k++) {
     d_fill_bdry_time_advance[k] = new RefineAlgorithm<DIM>;
 
     // empty out the boundary bdry fill schedules 
@@ -2323,6 +3974,66 @@ void LevelSetFunctionIntegrator<DIM>::initializeCommunicationObjects()
 
   } // end loop setting up data transfers for TVD Runge-Kutta time advance
 
+  // set up objects for filling boundary data during the time advance
+  // when finer levels are subcycled.  ghost cells at coarse-fine 
+  // boundaries are interpolated in time between the old and current 
+  // level set functions on the coarser level.
+  if (d_use_subcycling) {
+    Pointer< TimeInterpolateOperator<DIM> > time_interp_op =
+      d_grid_geometry->lookupTimeInterpolateOperator(
+        VariableDatabase<DIM>::getDatabase()->getVariable("phi (LSMLIB)"),
+        "STD_LINEAR_TIME_INTERPOLATE");
+
+    d_fill_bdry_subcycle.resizeArray(d_num_rk_registers);
+    d_fill_bdry_sched_subcycle.resizeArray(d_num_rk_registers);
+
+    for (int k = 0; k < d_num_rk_registers; k++) {
+      d_fill_bdry_subcycle[k] = new RefineAlgorithm<DIM>;
+
+      // empty out the boundary bdry fill schedules 
+      d_fill_bdry_sched_subcycle[k].setNull();
+
+      d_fill_bdry_subcycle[k]->registerRefine(
+        d_phi_handles[k], 
+        d_phi_handles[k], 
+        d_phi_old_handle, 
+        d_phi_handles[0], 
+        d_phi_handles[k], 
+        refine_op,
+        time_interp_op);
+      if (d_codimension == 2) {
+        d_fill_bdry_subcycle[k]->registerRefine(
+          d_psi_handles[k], 
+          d_psi_handles[k], 
+          d_psi_old_handle, 
+          d_psi_handles[0], 
+          d_psi_handles[k], 
+          refine_op,
+          time_interp_op);
+      }  
+    }
+  }
+
+  // set up objects for synchronizing coarser levels with finer levels
+  // by replacing the level set functions on coarser levels with the 
+  // volume-weighted average of the level set functions on finer levels
+  // when finer levels are subcycled
+  if (d_use_subcycling) {
+    Pointer< CoarsenOperator<DIM> > coarsen_op =
+      d_grid_geometry->lookupCoarsenOperator(
+        VariableDatabase<DIM>::getDatabase()->getVariable("phi (LSMLIB)"),
+        "CONSERVATIVE_COARSEN");
+
+    d_coarsen_level_set = new CoarsenAlgorithm<DIM>;
+    d_coarsen_sched_level_set.setNull();
+    d_coarsen_level_set->registerCoarsen(
+      d_phi_handles[0], d_phi_handles[0], coarsen_op);
+    if (d_codimension == 2) {
+      d_coarsen_level_set->registerCoarsen(
+        d_psi_handles[0], d_psi_handles[0], coarsen_op);
+    }
+  }
+
 }
 
 
@@ -2363,6 +4074,32 @@ void LevelSetFunctionIntegrator<DIM>::getFromInput(
                                 (d_codimension == 2) );
   }
 
+  // adaptive reinitialization parameters
+  if (is_from_restart) {
+    if (db->keyExists("reinitialization_grad_phi_tol")) {
+      d_reinitialization_grad_phi_tol = 
+        db->getDouble("reinitialization_grad_phi_tol");
+    }
+    if (db->keyExists("reinitialization_grad_phi_band_cells")) {
+      d_reinitialization_grad_phi_band_cells = 
+        db->getInteger("reinitialization_grad_phi_band_cells");
+    }
+  } else {
+    d_reinitialization_grad_phi_tol = db->getDoubleWithDefault(
+      "reinitialization_grad_phi_tol", 
+      LSM_DEFAULT_REINITIALIZATION_GRAD_PHI_TOL);
+    d_reinitialization_grad_phi_band_cells = db->getIntegerWithDefault(
+      "reinitialization_grad_phi_band_cells", 
+      LSM_DEFAULT_REINITIALIZATION_GRAD_PHI_BAND_CELLS);
+  }
+  if (d_reinitialization_grad_phi_band_cells < 1) {
+    TBOX_ERROR(  d_object_name
+              << "::getFromInput(): "
+              << "reinitialization_grad_phi_band_cells must be positive."
+              << endl);
+  }
+  d_use_adaptive_reinitialization = (d_reinitialization_grad_phi_tol > 0);
+
   if (is_from_restart) {
 
     if (db->keyExists("reinitialization_stop_tol")) {
@@ -2462,6 +4199,40 @@ void LevelSetFunctionIntegrator<DIM>::getFromInput(
     d_orthogonalization_max_iters = LSM_DEFAULT_ORTHOGONALIZATION_MAX_ITERS;
   }
 
+  // get scratch data allocation policy
+  if (is_from_restart) {
+    if (db->keyExists("use_persistent_scratch_data")) {
+      d_use_persistent_scratch_data = 
+        db->getBool("use_persistent_scratch_data");
+    }
+  } else {
+    d_use_persistent_scratch_data = db->getBoolWithDefault(
+      "use_persistent_scratch_data", 
+      LSM_DEFAULT_USE_PERSISTENT_SCRATCH_DATA);
+  } 
+
+  // get ghost cell data reuse policy
+  if (is_from_restart) {
+    if (db->keyExists("reuse_ghost_cell_data")) {
+      d_reuse_ghost_cell_data = db->getBool("reuse_ghost_cell_data");
+    }
+  } else {
+    d_reuse_ghost_cell_data = db->getBoolWithDefault(
+      "reuse_ghost_cell_data", LSM_DEFAULT_REUSE_GHOST_CELL_DATA);
+  } 
+
+  // get velocity field caching policy
+  if (is_from_restart) {
+    if (db->keyExists("use_velocity_time_interpolation")) {
+      d_use_velocity_time_interpolation = 
+        db->getBool("use_velocity_time_interpolation");
+    }
+  } else {
+    d_use_velocity_time_interpolation = db->getBoolWithDefault(
+      "use_velocity_time_interpolation", 
+      LSM_DEFAULT_USE_VELOCITY_TIME_INTERPOLATION);
+  } 
+
   // get verbose mode
   if (is_from_restart) {
     if (db->keyExists("verbose_mode")) d_verbose_mode = 
@@ -2498,6 +4269,15 @@ void LevelSetFunctionIntegrator<DIM>::getFromInput(
     }
     d_tvd_runge_kutta_order = db->getIntegerWithDefault(
       "tvd_runge_kutta_order", LSM_DEFAULT_TVD_RUNGE_KUTTA_ORDER);
+    d_use_low_storage_runge_kutta = db->getBoolWithDefault(
+      "use_low_storage_runge_kutta", 
+      LSM_DEFAULT_USE_LOW_STORAGE_RUNGE_KUTTA);
+    d_use_semi_lagrangian_advection = db->getBoolWithDefault(
+      "use_semi_lagrangian_advection", 
+      LSM_DEFAULT_USE_SEMI_LAGRANGIAN_ADVECTION);
+    d_semi_lagrangian_cfl_number = db->getDoubleWithDefault(
+      "semi_lagrangian_cfl_number", 
+      LSM_DEFAULT_SEMI_LAGRANGIAN_CFL_NUMBER);
 
     // check that spatial derivative type, spatial derivative order,
     // and TVD Runge-Kutta order are valid.
@@ -2526,7 +4306,14 @@ void LevelSetFunctionIntegrator<DIM>::getFromInput(
               << "Only TVD-RK1, TVD-RK2, and TVD-RK3 supported."
               << endl );
     }
-  
+    if ( d_use_semi_lagrangian_advection &&
+         (d_semi_lagrangian_cfl_number <= 0.0) ) {
+      TBOX_ERROR(d_object_name
+              << "::getFromInput(): "
+              << "semi_lagrangian_cfl_number must be positive."
+              << endl );
+    }
+
     // read in boundary conditions
     for (int comp=0; comp < d_num_level_set_fcn_components; comp++) {
       stringstream lower_bc_phi_key;
@@ -2577,10 +4364,15 @@ void LevelSetFunctionIntegrator<DIM>::getFromInput(
     d_use_AMR = db->getBoolWithDefault("use_AMR", LSM_DEFAULT_USE_AMR);
     d_regrid_interval = db->getIntegerWithDefault("regrid_interval", 
       LSM_DEFAULT_REGRID_INTERVAL);
+    d_use_interface_proximity_regrid = db->getBoolWithDefault(
+      "use_interface_proximity_regrid", 
+      LSM_DEFAULT_USE_INTERFACE_PROXIMITY_REGRID);
     d_tag_buffer_width = db->getIntegerWithDefault("tag_buffer_width", 
       LSM_DEFAULT_TAG_BUFFER_WIDTH);
     d_refinement_cutoff_value = db->getDoubleWithDefault(
       "refinement_cutoff_value", LSM_DEFAULT_REFINEMENT_CUTOFF_VALUE);
+    d_use_subcycling = db->getBoolWithDefault("use_subcycling", 
+      LSM_DEFAULT_USE_SUBCYCLING);
   } // end case (NOT FROM RESTART)
 
 }
@@ -2629,11 +4421,44 @@ void LevelSetFunctionIntegrator<DIM>::getFromRestart()
     (SPATIAL_DERIVATIVE_TYPE) db->getInteger("d_spatial_derivative_type");
   d_spatial_derivative_order = db->getInteger("d_spatial_derivative_order");
   d_tvd_runge_kutta_order = db->getInteger("d_tvd_runge_kutta_order");
+  // NOTE: newer parameters may be missing from older restart files
+  if (db->keyExists("d_use_low_storage_runge_kutta")) {
+    d_use_low_storage_runge_kutta = 
+      db->getBool("d_use_low_storage_runge_kutta");
+  } else {
+    d_use_low_storage_runge_kutta = LSM_DEFAULT_USE_LOW_STORAGE_RUNGE_KUTTA;
+  }
+  if (db->keyExists("d_use_semi_lagrangian_advection")) {
+    d_use_semi_lagrangian_advection = 
+      db->getBool("d_use_semi_lagrangian_advection");
+  } else {
+    d_use_semi_lagrangian_advection = LSM_DEFAULT_USE_SEMI_LAGRANGIAN_ADVECTION;
+  }
+  if (db->keyExists("d_semi_lagrangian_cfl_number")) {
+    d_semi_lagrangian_cfl_number = 
+      db->getDouble("d_semi_lagrangian_cfl_number");
+  } else {
+    d_semi_lagrangian_cfl_number = LSM_DEFAULT_SEMI_LAGRANGIAN_CFL_NUMBER;
+  }
 
   d_reinitialization_interval = db->getInteger("d_reinitialization_interval");
   d_reinitialization_stop_tol = db->getDouble("d_reinitialization_stop_tol");
   d_reinitialization_stop_dist = db->getDouble("d_reinitialization_stop_dist");
   d_reinitialization_max_iters= db->getInteger("d_reinitialization_max_iters");
+  if (db->keyExists("d_reinitialization_grad_phi_tol")) {
+    d_reinitialization_grad_phi_tol = 
+      db->getDouble("d_reinitialization_grad_phi_tol");
+  } else {
+    d_reinitialization_grad_phi_tol = LSM_DEFAULT_REINITIALIZATION_GRAD_PHI_TOL;
+  }
+  if (db->keyExists("d_reinitialization_grad_phi_band_cells")) {
+    d_reinitialization_grad_phi_band_cells = 
+      db->getInteger("d_reinitialization_grad_phi_band_cells");
+  } else {
+    d_reinitialization_grad_phi_band_cells = 
+      LSM_DEFAULT_REINITIALIZATION_GRAD_PHI_BAND_CELLS;
+  }
+  d_use_adaptive_reinitialization = (d_reinitialization_grad_phi_tol > 0);
   d_orthogonalization_interval = db->getInteger("d_orthogonalization_interval");
   d_orthogonalization_stop_tol = db->getDouble("d_orthogonalization_stop_tol");
   d_orthogonalization_stop_dist = 
@@ -2643,9 +4468,39 @@ void LevelSetFunctionIntegrator<DIM>::getFromRestart()
 
   d_use_AMR = db->getBool("d_use_AMR");
   d_regrid_interval = db->getInteger("d_regrid_interval");
+  if (db->keyExists("d_use_interface_proximity_regrid")) {
+    d_use_interface_proximity_regrid = 
+      db->getBool("d_use_interface_proximity_regrid");
+  } else {
+    d_use_interface_proximity_regrid = 
+      LSM_DEFAULT_USE_INTERFACE_PROXIMITY_REGRID;
+  }
   d_tag_buffer_width = db->getInteger("d_tag_buffer_width");
   d_refinement_cutoff_value = db->getDouble("d_refinement_cutoff_value");
+  if (db->keyExists("d_use_subcycling")) {
+    d_use_subcycling = db->getBool("d_use_subcycling");
+  } else {
+    d_use_subcycling = LSM_DEFAULT_USE_SUBCYCLING;
+  }
 
+  if (db->keyExists("d_use_persistent_scratch_data")) {
+    d_use_persistent_scratch_data = 
+      db->getBool("d_use_persistent_scratch_data");
+  } else {
+    d_use_persistent_scratch_data = LSM_DEFAULT_USE_PERSISTENT_SCRATCH_DATA;
+  }
+  if (db->keyExists("d_reuse_ghost_cell_data")) {
+    d_reuse_ghost_cell_data = db->getBool("d_reuse_ghost_cell_data");
+  } else {
+    d_reuse_ghost_cell_data = LSM_DEFAULT_REUSE_GHOST_CELL_DATA;
+  }
+  if (db->keyExists("d_use_velocity_time_interpolation")) {
+    d_use_velocity_time_interpolation = 
+      db->getBool("d_use_velocity_time_interpolation");
+  } else {
+    d_use_velocity_time_interpolation = 
+      LSM_DEFAULT_USE_VELOCITY_TIME_INTERPOLATION;
+  }
   d_verbose_mode = db->getBool("d_verbose_mode");
 
   /*
@@ -2656,6 +4511,12 @@ void LevelSetFunctionIntegrator<DIM>::getFromRestart()
   d_reinitialization_count = db->getInteger("d_reinitialization_count");
   d_orthogonalization_count = db->getInteger("d_orthogonalization_count");
   d_regrid_count = db->getInteger("d_regrid_count");
+  if (db->keyExists("d_interface_displacement_since_regrid")) {
+    d_interface_displacement_since_regrid = 
+      db->getDouble("d_interface_displacement_since_regrid");
+  } else {
+    d_interface_displacement_since_regrid = 0.0;
+  }
 
   d_use_reinitialization = db->getBool("d_use_reinitialization");
   d_use_reinitialization_stop_tol = 
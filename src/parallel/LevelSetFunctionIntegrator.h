@@ -56,9 +56,61 @@
  * - spatial_derivative_order    = order of spatial derivative (default = 5)
  * - tvd_runge_kutta_order       = order of Runge-Kutta time integration 
  *                                 (default = 3)
+ * - use_low_storage_runge_kutta = TRUE if the low-storage strong stability
+ *                                 preserving Runge-Kutta method of order 
+ *                                 tvd_runge_kutta_order (SSP(3,2) or 
+ *                                 SSP(4,3)) should be used in place of
+ *                                 the standard TVD Runge-Kutta method 
+ *                                 (default = FALSE)
+ * - use_semi_lagrangian_advection
+ *                               = TRUE if the level set functions should be
+ *                                 advanced using an unconditionally stable
+ *                                 semi-Lagrangian BFECC step in place of 
+ *                                 the Runge-Kutta method.  Only valid for
+ *                                 problems driven by an external velocity
+ *                                 field alone (default = FALSE)
+ * - semi_lagrangian_cfl_number  = CFL number used to compute the advection
+ *                                 time step when semi-Lagrangian advection
+ *                                 is used.  The external velocity field 
+ *                                 must be registered with (and set in) 
+ *                                 at least int(CFL/2)+1 ghostcells; the
+ *                                 time advance is aborted otherwise 
+ *                                 (default = 5.0)
+ * - use_velocity_time_interpolation
+ *                               = TRUE if the velocity field should only be
+ *                                 computed when it is required at a time 
+ *                                 later than the most recently computed
+ *                                 velocity field.  The velocity fields at
+ *                                 the two most recent computation times 
+ *                                 are cached, and the velocity field for 
+ *                                 intermediate times (e.g. the final stage
+ *                                 of TVD-RK3) is linearly interpolated in
+ *                                 time.  Only appropriate when the 
+ *                                 velocity field varies slowly with the 
+ *                                 level set functions.  Velocity fields
+ *                                 are only reused across time steps if
+ *                                 LevelSetMethodVelocityFieldStrategy::
+ *                                 velocityFieldDependsOnLevelSetFunctions()
+ *                                 returns false (default = FALSE)
  * - reinitialization_interval   = interval between reinitialization 
  *                                 (default = 10)
  *                                 (reinitialization disabled if <= 0)
+ * - reinitialization_grad_phi_tol
+ *                               = tolerance on the average of 
+ *                                 | |grad(phi)| - 1 | over a band about 
+ *                                 the zero level set.  When positive,
+ *                                 reinitialization is adaptive:  every
+ *                                 reinitialization_interval steps the
+ *                                 drift of the level set functions from 
+ *                                 distance functions is measured and 
+ *                                 reinitialization is only carried out
+ *                                 if it exceeds the tolerance
+ *                                 (default = 0, i.e. always reinitialize)
+ * - reinitialization_grad_phi_band_cells
+ *                               = half-width (in grid cells on each 
+ *                                 level) of the band about the zero level
+ *                                 set used to measure the drift of 
+ *                                 |grad(phi)| (default = 3)
  * - reinitialization_stop_tol   = stopping criterion for termination of 
  *                                 evolution of reinitialization equation.
  *                                 Reinitialization stops when the max norm
@@ -155,14 +207,44 @@
  *
  * - use_AMR                     = TRUE if AMR should be used (default = FALSE)
  * - regrid_interval             = regridding interval (default = 5)
+ * - use_interface_proximity_regrid
+ *                               = TRUE if regridding should only be 
+ *                                 requested when the zero level set may
+ *                                 leave the buffer of cells around the
+ *                                 cells tagged for refinement.  In this
+ *                                 case, regrid_interval is only used 
+ *                                 when the interface speed is unknown 
+ *                                 (e.g. when a user-specified dt is 
+ *                                 used).  (default = FALSE)
  * - tag_buffer_width            = number of buffer cells to use around
  *                                 cells tagged for refinement
  *                                 (default = 2)
- * - refinement_cutoff_value     = cutoff value for distance function
- *                                 (default = 1.0)
+ * - refinement_cutoff_value     = cutoff value for distance function.
+ *                                 Cells where |phi| (and |psi| for 
+ *                                 codimension-two problems) is less
+ *                                 than the cutoff value are tagged for
+ *                                 refinement (default = 1.0)
+ * - use_subcycling              = TRUE if finer levels should be 
+ *                                 advanced using smaller time steps 
+ *                                 than coarser levels and coarser levels
+ *                                 should be synchronized with finer 
+ *                                 levels (default = FALSE)
  *
  * <h4> Miscellaneous Parameters: </h4>
  *
+ * - use_persistent_scratch_data = TRUE if scratch PatchData (for the 
+ *                                 time advance, the stable dt 
+ *                                 computation and LevelSetMethodToolbox
+ *                                 calls) should be kept allocated between
+ *                                 time steps.  Scratch data is then only
+ *                                 allocated on patches created by 
+ *                                 regridding (default = TRUE)
+ * - reuse_ghost_cell_data       = TRUE if redundant ghost cell fills 
+ *                                 should be elided, i.e. the ghost cells
+ *                                 filled at the end of a time step are
+ *                                 reused by computeStableDt() and the 
+ *                                 next time step instead of being filled
+ *                                 again (default = FALSE)
  * - verbose_mode                = TRUE if status should be output during
  *                                 integration (default = FALSE)
  *
@@ -170,6 +252,8 @@
  * the values from the restart file:  
  *    end_time,
  *    reinitialization_interval,
+ *    reinitialization_grad_phi_tol,
+ *    reinitialization_grad_phi_band_cells,
  *    reinitialization_stop_tol,
  *    reinitialization_stop_dist,
  *    reinitialization_max_iters,
@@ -177,6 +261,9 @@
  *    orthogonalization_stop_tol,
  *    orthogonalization_stop_dist,
  *    orthogonalization_max_iters,
+ *    use_persistent_scratch_data,
+ *    reuse_ghost_cell_data,
+ *    use_velocity_time_interpolation,
  *    verbose_mode
  * 
  * 
@@ -197,10 +284,43 @@
  *    -#  when no stopping criteria are supplied, the maximum number of
  *        time steps taken defaults to 25.
  *
+ *  - Adaptive reinitialization requires only one global reduction per
+ *    check.  The number of reinitializations carried out and skipped
+ *    is reported in verbose mode and by printClassData().
+ *
  *  - The reinitialization (and orthogonalization for codimension-two
  *    problems) process uses the same order TVD Runge-Kutta as specified
  *    for the time evolution of the level set equation(s).
  *
+ *  - The low-storage SSP Runge-Kutta methods only store the current 
+ *    level set function and a single stage (the standard TVD-RK3
+ *    method stores two stages) and allow time steps twice as large as 
+ *    the forward Euler time step.  Because the stages are updated in 
+ *    place one component at a time, the velocity field for a component 
+ *    of a vector level set function should not depend on the other 
+ *    components when this option is used.  The reinitialization and 
+ *    orthogonalization processes still use the standard TVD Runge-Kutta 
+ *    methods.
+ *
+ *  - reuse_ghost_cell_data is an optional redundant-fill elision:  it
+ *    only skips the ghost cell fill at the start of a time step (and in
+ *    computeStableDt()) when the level set functions have not changed 
+ *    since the fill at the end of the previous time step.  It reduces 
+ *    the number of fills per time step but does not change how a fill 
+ *    is carried out.  Applications that modify the level set functions
+ *    between time steps must call invalidateGhostCellData() when this 
+ *    option is enabled.
+ *
+ *  - When LSMLIB is configured with --enable-openmp, the patch loops
+ *    that compute the RHS of the level set equation and advance the 
+ *    level set functions through Runge-Kutta stages (including the 
+ *    fused stages) are distributed among threads on each MPI process.
+ *    All scratch PatchData used by these loops is allocated before 
+ *    the time advance.  Patch loops that call methods of the 
+ *    LevelSetMethodVelocityFieldStrategy or LevelSetMethodPatchStrategy
+ *    (e.g. the user-specified dt computation in computeStableDt()) 
+ *    remain serial because these methods may not be thread-safe.
+ *
  *  - This class takes care of making sure that the scratch spaces
  *    for the level set functions have sufficient ghost cells to 
  *    carry out the spatial derivative calculations.
@@ -234,8 +354,33 @@
  *      boundary condition will be overwritten by specified boundary
  *      condition type.
  *
- *  - AMR is currently UNAVAILABLE.  It is still in the development 
- *    stages.
+ *  - When use_subcycling is TRUE, each level takes r time steps for 
+ *    every time step on the next coarser level, where r is the 
+ *    (maximum) refinement ratio between the levels.  The time step 
+ *    returned by computeStableDt() is the time step for the coarsest
+ *    level.  Ghost cells at coarse-fine boundaries are linearly 
+ *    interpolated in time between the level set functions at the 
+ *    beginning and end of the time step on the coarser level, and the 
+ *    level set functions on coarser levels are replaced by the 
+ *    volume-weighted average of the level set functions on finer 
+ *    levels at the end of each coarse time step.  When use_subcycling
+ *    is FALSE, all levels are advanced together and the coarser levels
+ *    are not modified by the finer levels.  Regridding, 
+ *    reinitialization and orthogonalization only occur at the end of 
+ *    time steps on the coarsest level.
+ *
+ *  - When use_subcycling is TRUE, the velocity fields are recomputed
+ *    on the level being advanced at every Runge-Kutta stage of every 
+ *    substep (see LevelSetMethodVelocityFieldStrategy::
+ *    computeVelocityFieldOnLevels()), so they are evaluated at the 
+ *    correct times.  However, the level set functions in the ghost 
+ *    cells at coarse-fine boundaries (and any velocity field computed
+ *    from them) are only linearly interpolated in time, so near 
+ *    coarse-fine boundaries the substeps are at most second-order 
+ *    accurate in time regardless of tvd_runge_kutta_order.  With
+ *    use_velocity_time_interpolation, velocity fields that depend on 
+ *    the level set functions are recomputed at the start of every 
+ *    substep rather than reused from the end of the previous one.
  *
  */
 
@@ -615,11 +760,54 @@ public:
    *                 this time step; false otherwise.
    *
    * NOTES:
-   *  - AMR is NOT yet implemented, so advanceLevelSetFunctions() 
-   *    currently always returns false.
+   *  - When use_subcycling is TRUE, dt is the time increment for the
+   *    coarsest level.  Finer levels are advanced using smaller time 
+   *    steps (see class documentation).
+   *  - When use_interface_proximity_regrid is set, regridding is
+   *    requested only when the bound on the distance (in grid cells)
+   *    traveled by the zero level set since the last regrid could
+   *    exceed tag_buffer_width after the next time step.  The bound 
+   *    is accumulated from dt and the maximum interface speed found 
+   *    by computeStableDt().
    *
    */
   virtual bool advanceLevelSetFunctions(const LSMLIB_REAL dt);
+
+  /*!
+   * invalidateGhostCellData() informs the integrator that the 
+   * level set functions have been modified outside of the integrator, 
+   * so that the ghost cells must be refilled before they are next used.
+   * 
+   * Arguments:      none
+   *
+   * Return value:   none
+   *
+   * NOTES:
+   *  - Only required when reuse_ghost_cell_data is TRUE and phi (or 
+   *    psi) is changed directly through its PatchData handle.  If it
+   *    is not called, the next time step uses stale ghost cells.
+   *
+   */
+  virtual void invalidateGhostCellData();
+
+  /*!
+   * invalidateVelocityFieldCache() informs the integrator that the 
+   * cached velocity fields are out of date, so that the velocity field
+   * is recomputed the next time that it is required.
+   * 
+   * Arguments:      none
+   *
+   * Return value:   none
+   *
+   * NOTES:
+   *  - Only has an effect when use_velocity_time_interpolation is TRUE.
+   *  - Should be called when the data that determines the velocity 
+   *    field (e.g. the state of a coupled flow solver) is changed 
+   *    outside of the LevelSetMethodVelocityFieldStrategy::
+   *    computeVelocityField() method.
+   *
+   */
+  virtual void invalidateVelocityFieldCache();
  
   //! @}
 
@@ -1186,6 +1374,52 @@ protected:
    *
    ****************************************************************/
 
+  /*!
+   * advanceLevelSetEqn() advances the level set functions on the 
+   * active levels of the PatchHierarchy using the time integration 
+   * method selected in the input database.
+   *
+   * Arguments:     
+   *  - dt (in):         time increment to advance the level set functions
+   *
+   * Return value:       none
+   *
+   * NOTES:
+   *  - The ghost cells of the level set functions must be filled 
+   *    before advanceLevelSetEqn() is called.
+   *
+   */
+  virtual void advanceLevelSetEqn(
+    const LSMLIB_REAL dt);
+
+  /*!
+   * advanceLevel() advances the level set functions on the specified
+   * level from time to time+dt and then recursively advances the 
+   * finer levels to time+dt using r time steps of size dt/r (where r 
+   * is the refinement ratio to the next finer level).  After the finer
+   * levels have been advanced, the level set functions on the 
+   * specified level are replaced by the volume-weighted average of 
+   * the level set functions on the next finer level.
+   *
+   * Arguments:     
+   *  - ln (in):         level number
+   *  - time (in):       time at the beginning of the time step
+   *  - dt (in):         time increment to advance the level set functions
+   *
+   * Return value:       none
+   *
+   * NOTES:
+   *  - advanceLevel() is only used when use_subcycling is TRUE.
+   *
+   *  - advanceLevel() sets the active levels to ln and d_current_time 
+   *    to time.  The caller is responsible for restoring them.
+   *
+   */
+  virtual void advanceLevel(
+    const int ln,
+    const LSMLIB_REAL time,
+    const LSMLIB_REAL dt);
+
   /*!
    * advanceLevelSetEqnUsingTVDRK*() advances the level set functions
    * using the level set equation using a first-, second-, or third-order 
@@ -1204,6 +1438,318 @@ protected:
   virtual void advanceLevelSetEqnUsingTVDRK3(
     const LSMLIB_REAL dt);
 
+  /*!
+   * advanceLevelSetEqnUsingLowStorageSSPRK() advances the level set 
+   * functions using the level set equation using a low-storage 
+   * second-order (SSP(3,2)) or third-order (SSP(4,3)) strong stability 
+   * preserving Runge-Kutta step.  Only a single stage register is 
+   * used in addition to the current level set functions.
+   *
+   * Arguments:     
+   *  - dt (in):         time increment to advance the level set functions
+   *
+   * Return value:       none
+   *
+   */
+  virtual void advanceLevelSetEqnUsingLowStorageSSPRK(
+    const LSMLIB_REAL dt);
+
+  /*!
+   * advanceLevelSetEqnUsingFusedTVDRKStage() advances a single 
+   * component of the level set function through one stage of a 
+   * TVD (or low-storage SSP) Runge-Kutta step:
+   *
+   *   u_next = alpha u_cur + (1 - alpha) ( u_stage + dt L(u_stage) )
+   *
+   * The RHS L(u_stage) of the level set equation is evaluated inside 
+   * the Fortran stage kernels, so it is never stored.  This method is 
+   * only used when the level set equation has a single advection or 
+   * normal velocity term (and DIM = 2 or 3).
+   *
+   * Arguments:     
+   *  - level_set_fcn (in):  level set function to advance
+   *                         (i.e. PHI or PSI)
+   *  - u_next_handle (in):  PatchData handle for u at the end of 
+   *                         the stage
+   *  - u_stage_handle (in): PatchData handle for u at the beginning 
+   *                         of the stage
+   *  - u_cur_handle (in):   PatchData handle for u at the beginning 
+   *                         of the time step
+   *  - alpha (in):          weight of u_cur
+   *  - dt (in):             step size for the stage
+   *  - component (in):      component of level set function to advance
+   *                         (default = 0)
+   *
+   * Return value:           none
+   *
+   * NOTES:
+   *  - u_next_handle may be the same as u_stage_handle or 
+   *    u_cur_handle.
+   *
+   */
+  virtual void advanceLevelSetEqnUsingFusedTVDRKStage(
+    const LEVEL_SET_FCN_TYPE level_set_fcn,
+    const int u_next_handle,
+    const int u_stage_handle,
+    const int u_cur_handle,
+    const LSMLIB_REAL alpha,
+    const LSMLIB_REAL dt,
+    const int component = 0);
+
+  /*!
+   * advanceLevelSetEqnUsingSemiLagrangian() advances the level set 
+   * functions using a semi-Lagrangian step with back and forth error 
+   * compensation and correction (BFECC).  The time step is not limited
+   * by the usual advective CFL condition, so this method is only used
+   * when the level set functions are advected by an external velocity 
+   * field.
+   *
+   * Arguments:     
+   *  - dt (in):         time increment to advance the level set functions
+   *
+   * Return value:       none
+   *
+   */
+  virtual void advanceLevelSetEqnUsingSemiLagrangian(
+    const LSMLIB_REAL dt);
+
+  /*!
+   * reinitializationNeeded() determines whether the level set functions
+   * have drifted far enough from distance functions to require 
+   * reinitialization.  The drift is measured as the maximum (over
+   * level set functions and components) of the average of 
+   * | |grad(phi)| - 1 | over a band about the zero level set.
+   *
+   * Arguments:      none
+   *
+   * Return value:   true if the drift exceeds 
+   *                 reinitialization_grad_phi_tol or adaptive 
+   *                 reinitialization is not being used; false otherwise
+   *
+   * NOTES:
+   *  - When computeStableDt() is called before a candidate step for
+   *    reinitialization, it reduces the sums for all level set functions
+   *    and components in the same batch of reductions as the stable 
+   *    time step, so no additional reduction is needed.  In this case,
+   *    the drift is measured at the beginning of the time step rather
+   *    than at the end, so reinitialization lags the drift by at most
+   *    one time step.  Otherwise, the sums are combined into a single
+   *    reduction across processors.
+   *  - Coarse cells covered by finer levels are excluded because their
+   *    control volumes are zero.
+   *
+   */
+  virtual bool reinitializationNeeded();
+
+  /*!
+   * accumulateGradPhiDeviationSums() computes the sums (local to this
+   * processor) used to measure the drift of the level set functions
+   * from distance functions.
+   *
+   * Arguments:
+   *  - sums (out):   sums[2*idx] is the sum of | |grad(phi)| - 1 | and
+   *                  sums[2*idx+1] is the number of cells in the band 
+   *                  about the zero level set for the idx-th level set 
+   *                  function and component
+   *
+   * Return value:    none
+   *
+   */
+  virtual void accumulateGradPhiDeviationSums(Array<LSMLIB_REAL>& sums);
+
+  /*!
+   * computeMaxGradPhiDeviation() computes the maximum (over level set 
+   * functions and components) of the band-averaged | |grad(phi)| - 1 |
+   * from the sums computed by accumulateGradPhiDeviationSums().
+   *
+   * Arguments:
+   *  - sums (in):    sums reduced across all processors
+   *
+   * Return value:    maximum band-averaged | |grad(phi)| - 1 |
+   *
+   */
+  virtual LSMLIB_REAL computeMaxGradPhiDeviation(
+    const Array<LSMLIB_REAL>& sums);
+
+  /*!
+   * allocateScratchData() allocates the specified scratch PatchData
+   * on all levels of the PatchHierarchy.  When persistent scratch data 
+   * is used, data is only allocated on patches where it is not already
+   * allocated.
+   *
+   * Arguments:     
+   *  - scratch_variables (in):  scratch PatchData to allocate
+   *
+   * Return value:               none
+   *
+   */
+  virtual void allocateScratchData(
+    const ComponentSelector& scratch_variables);
+
+  /*!
+   * releaseScratchData() deallocates the specified scratch PatchData
+   * on all levels of the PatchHierarchy unless persistent scratch data
+   * is used.
+   *
+   * Arguments:     
+   *  - scratch_variables (in):  scratch PatchData to release
+   *
+   * Return value:               none
+   *
+   */
+  virtual void releaseScratchData(
+    const ComponentSelector& scratch_variables);
+
+  /*!
+   * setVelocityField() sets the velocity fields provided by the 
+   * LevelSetMethodVelocityFieldStrategy for the specified time on 
+   * the levels updated by the time advance (a single level when finer 
+   * levels are subcycled).
+   *
+   * When use_velocity_time_interpolation is FALSE, the velocity fields
+   * are always computed by the LevelSetMethodVelocityFieldStrategy.
+   * Otherwise, the velocity fields on each level are:
+   *
+   *  - copied from the cache if time is equal to the time of the most
+   *    recently computed velocity fields;
+   *
+   *  - linearly interpolated in time from the cache if time lies 
+   *    between the times of the two most recently computed velocity 
+   *    fields;
+   *
+   *  - computed by the LevelSetMethodVelocityFieldStrategy and added
+   *    to the cache otherwise.
+   *
+   * Arguments:     
+   *  - time (in):        time at which the velocity field is required
+   *  - phi_handle (in):  PatchData handle for phi
+   *  - psi_handle (in):  PatchData handle for psi
+   *  - component (in):   component of vector level set function for 
+   *                      which to set the velocity fields
+   *
+   * Return value:        none
+   *
+   * NOTES:
+   *  - Only the data in the external and normal velocity field 
+   *    PatchData is cached.  
+   *
+   *  - The cache is kept separately for each level, so the velocity
+   *    fields cached for a level remain valid while other levels are
+   *    advanced.
+   *
+   */
+  virtual void setVelocityField(
+    const LSMLIB_REAL time,
+    const int phi_handle,
+    const int psi_handle,
+    const int component);
+
+  /*!
+   * allocateVelocityFieldCache() allocates the PatchData for the 
+   * velocity field cache on all patches where it is not already 
+   * allocated.  The first time that it is called, the cache PatchData
+   * handles are registered with the VariableDatabase.
+   *
+   * Arguments:      none
+   *
+   * Return value:   none
+   *
+   */
+  virtual void allocateVelocityFieldCache();
+
+  /*!
+   * interpolateVelocityFieldCache() sets the velocity fields provided
+   * by the LevelSetMethodVelocityFieldStrategy for the specified 
+   * component to 
+   *
+   *   (1 - theta) * (older cached velocity field) 
+   *   + theta * (newer cached velocity field)
+   *
+   * on all patches (including ghostcells) of the specified level.
+   *
+   * Arguments:     
+   *  - theta (in):      interpolation weight of the newer cached 
+   *                     velocity field (between 0 and 1)
+   *  - component (in):  component of vector level set function for 
+   *                     which to set the velocity fields
+   *  - ln (in):         level number
+   *
+   * Return value:       none
+   *
+   */
+  virtual void interpolateVelocityFieldCache(
+    const LSMLIB_REAL theta,
+    const int component,
+    const int ln);
+
+  /*!
+   * cacheVelocityField() adds the velocity fields provided by the 
+   * LevelSetMethodVelocityFieldStrategy for the specified component
+   * and level to the cache as the velocity fields at the specified 
+   * time.
+   *
+   * Arguments:     
+   *  - time (in):       time at which the velocity fields were computed
+   *  - component (in):  component of vector level set function 
+   *  - ln (in):         level number
+   *
+   * Return value:       none
+   *
+   */
+  virtual void cacheVelocityField(
+    const LSMLIB_REAL time,
+    const int component,
+    const int ln);
+
+  /*!
+   * imposeLevelSetFunctionBoundaryConditions() imposes the boundary 
+   * conditions for all components of phi (and psi for codimension-two
+   * problems) in the specified register using a single pass over the 
+   * PatchHierarchy.
+   *
+   * Arguments:     
+   *  - reg (in):  index into d_phi_handles and d_psi_handles of the
+   *               data on which to impose boundary conditions
+   *
+   * Return value: none
+   *
+   */
+  virtual void imposeLevelSetFunctionBoundaryConditions(const int reg);
+
+  /*!
+   * fillLevelSetFunctionGhostCells() fills the ghost cells for all 
+   * components of phi (and psi for codimension-two problems) in the 
+   * specified register on the active levels and imposes the boundary 
+   * conditions.  When use_subcycling is TRUE, the ghost cells at 
+   * coarse-fine boundaries are interpolated in time on the coarser 
+   * level.
+   *
+   * Arguments:     
+   *  - reg (in):   index into d_phi_handles and d_psi_handles of the
+   *                data to fill
+   *  - time (in):  time at which to fill ghost cells
+   *
+   * Return value:  none
+   *
+   */
+  virtual void fillLevelSetFunctionGhostCells(
+    const int reg,
+    const LSMLIB_REAL time);
+
+  /*!
+   * getNumberOfStepsOnLevel() returns the number of time steps taken
+   * on the specified level for every time step on the coarsest level
+   * when use_subcycling is TRUE.
+   *
+   * Arguments:     
+   *  - ln (in):    level number
+   *
+   * Return value:  product of the (maximum) refinement ratios between 
+   *                levels 1 through ln
+   *
+   */
+  int getNumberOfStepsOnLevel(const int ln) const;
+
   /*!
    * computeLevelSetEquationRHS() computes the right-hand side of 
    * the level set equation when it is written in the form:
@@ -1222,6 +1768,12 @@ protected:
    *
    * Return value:           none
    *
+   * NOTES:
+   *  - When the level set equation has a single advection or normal
+   *    velocity term (and DIM = 2 or 3), the time advance uses 
+   *    advanceLevelSetEqnUsingFusedTVDRKStage() and this method is 
+   *    not called.
+   *
    */
   virtual void computeLevelSetEquationRHS(
     const LEVEL_SET_FCN_TYPE level_set_fcn,
@@ -1387,6 +1939,22 @@ protected:
   int d_spatial_derivative_order;       // order of spatial derivative
   int d_tvd_runge_kutta_order;          // order of TVD Runge-Kutta time 
                                         //   integration
+  bool d_use_low_storage_runge_kutta;  // true if low-storage SSP 
+                                        //   Runge-Kutta should be used
+  bool d_use_fused_tvd_rk_stages;      // true if the RHS of the level 
+                                        //   set equation is evaluated 
+                                        //   inside the TVD Runge-Kutta 
+                                        //   stage kernels
+  bool d_use_semi_lagrangian_advection; // true if semi-Lagrangian BFECC
+                                        //   advection should be used
+  LSMLIB_REAL d_semi_lagrangian_cfl_number;  // CFL number for semi-Lagrangian
+                                        //   advection
+  bool d_use_velocity_time_interpolation; // true if velocity fields should
+                                        //   be cached and interpolated in
+                                        //   time
+  int d_num_rk_registers;               // number of level set function
+                                        //   registers used by time 
+                                        //   integration
   int d_reinitialization_interval;      // interval between reinitialization
   LSMLIB_REAL d_reinitialization_stop_tol;   // stopping criterion for termination
                                         //   of evolution of reinitialization 
@@ -1404,6 +1972,12 @@ protected:
                                         //   distance
   int d_reinitialization_max_iters;     // maximum number of time steps 
                                         //   for reinitialization iteration
+  LSMLIB_REAL d_reinitialization_grad_phi_tol; // tolerance on band-averaged
+                                        //   | |grad(phi)| - 1 | that 
+                                        //   triggers reinitialization
+  int d_reinitialization_grad_phi_band_cells; // half-width of band (in
+                                        //   grid cells) used to measure
+                                        //   the drift of |grad(phi)|
   int d_orthogonalization_interval;     // interval between orthogonalizing
                                         //   phi and psi for codim-two problems
   LSMLIB_REAL d_orthogonalization_stop_tol;  // stopping criterion for termination
@@ -1426,11 +2000,21 @@ protected:
   // AMR parameters
   bool d_use_AMR;                       // true if AMR should be used
   int d_regrid_interval;                // regridding interval
+  bool d_use_interface_proximity_regrid; // true if regridding should 
+                                        //   be triggered by the motion 
+                                        //   of the zero level set
   int d_tag_buffer_width;               // number of buffer cells to use around
                                         //   cells tagged for refinement
   LSMLIB_REAL d_refinement_cutoff_value;     // cutoff value for distance function
+  bool d_use_subcycling;                // true if finer levels should be 
+                                        //   advanced using smaller time 
+                                        //   steps
 
   // Miscellaneous parameters
+  bool d_use_persistent_scratch_data;   // true if scratch data should be
+                                        //   kept allocated between steps
+  bool d_reuse_ghost_cell_data;         // true if redundant ghost cell 
+                                        //   fills should be elided
   bool d_verbose_mode;                  // true if status information should
                                         //   be output
 
@@ -1488,6 +2072,11 @@ protected:
   vector<int> d_phi_handles;
   vector<int> d_psi_handles;
 
+  // level set functions at the beginning of the time step on a level
+  // (only allocated when use_subcycling is TRUE)
+  int d_phi_old_handle;
+  int d_psi_old_handle;
+
   // forward and backward spatial derivatives
   int d_grad_phi_plus_handle;
   int d_grad_psi_plus_handle;
@@ -1515,10 +2104,39 @@ protected:
    */
   ComponentSelector d_solution_variables;
   ComponentSelector d_time_advance_scratch_variables;
+  ComponentSelector d_subcycle_old_variables;
   ComponentSelector d_compute_stable_dt_scratch_variables;
   ComponentSelector d_reinitialization_scratch_variables;
   ComponentSelector d_orthogonalization_scratch_variables;
   ComponentSelector d_persistent_variables;
+  ComponentSelector d_velocity_cache_variables;
+
+  /*
+   * Velocity field cache (only used when use_velocity_time_interpolation
+   * is TRUE)
+   */
+
+  // number of velocity fields cached for each component of the level
+  // set functions (negative until the cache PatchData is registered)
+  int d_num_cached_velocity_fields;
+
+  // PatchData handles for the velocity fields provided by the
+  // LevelSetMethodVelocityFieldStrategy and for their cached values.
+  // NOTE:  the k-th velocity field for component comp of the level 
+  //        set functions is at index 
+  //        (comp*d_num_cached_velocity_fields + k).  The cached values 
+  //        are stored in two slots, d_velocity_cache_handles[0] and
+  //        d_velocity_cache_handles[1].
+  vector<int> d_velocity_field_handles;
+  vector<int> d_velocity_cache_handles[2];
+
+  // times of the cached velocity fields in each slot, the slot (0 or 1)
+  // holding the newer cached velocity fields, and the number of valid 
+  // cache entries (0, 1, or 2) for each component and level
+  // NOTE:  indexed by [component][level number]
+  vector< vector<LSMLIB_REAL> > d_velocity_cache_times[2];
+  vector< vector<int> > d_velocity_cache_newer_slot;
+  vector< vector<int> > d_num_velocity_cache_entries;
 
 
   /* internal state  variables */
@@ -1528,19 +2146,41 @@ protected:
   bool d_use_reinitialization_stop_tol;
   bool d_use_reinitialization_stop_dist;
   bool d_use_reinitialization_max_iters;
+  bool d_use_adaptive_reinitialization;
   bool d_use_orthogonalization;
   bool d_use_orthogonalization_stop_tol;
   bool d_use_orthogonalization_stop_dist;
   bool d_use_orthogonalization_max_iters;
 
+  // range of levels updated by the time advance (a single level when
+  // finer levels are subcycled)
+  int d_coarsest_active_level;
+  int d_finest_active_level;
+
   // counter variables
   LSMLIB_REAL d_current_time;
   int d_num_integration_steps_taken;
   int d_reinitialization_count;
+  int d_num_reinitializations;
+  int d_num_reinitializations_skipped;
+  LSMLIB_REAL d_grad_phi_deviation;     // drift of |grad(phi)| measured
+                                        //   by computeStableDt() for the
+                                        //   current time step (negative
+                                        //   if unknown)
+  bool d_ghost_cells_current;           // true if ghost cells of phi/psi 
+                                        //   are consistent with interior
+  int d_num_ghost_fills_skipped;
+  int d_num_velocity_computations;
+  int d_num_velocity_computations_skipped;
   int d_orthogonalization_count;
   LEVEL_SET_FCN_TYPE d_orthogonalization_evolved_field;
   int d_regrid_count;
 
+  // bounds on the number of grid cells crossed by the zero level set 
+  // since the last regrid and per unit time (negative if unknown)
+  LSMLIB_REAL d_interface_displacement_since_regrid;
+  LSMLIB_REAL d_max_interface_speed;
+
   /*
    * Boundary condition objects
    */
@@ -1568,6 +2208,17 @@ protected:
   Array< Array< Pointer< RefineSchedule<DIM> > > > 
     d_fill_bdry_sched_time_advance;
 
+  // for filling bdry data with time interpolation at coarse-fine 
+  // boundaries when finer levels are subcycled
+  Array< Pointer< RefineAlgorithm<DIM> > > d_fill_bdry_subcycle;
+  Array< Array< Pointer< RefineSchedule<DIM> > > > 
+    d_fill_bdry_sched_subcycle;
+
+  // for synchronizing coarser levels with finer levels
+  // (only used when use_subcycling is TRUE)
+  Pointer< CoarsenAlgorithm<DIM> > d_coarsen_level_set;
+  Array< Pointer< CoarsenSchedule<DIM> > > d_coarsen_sched_level_set;
+
 private:
  
   /*
@@ -33,7 +33,11 @@
  *
  * <h3> NOTES </h3>
  *
- *  - AMR is NOT yet supported.  It is still currently under development.
+ *  - AMR is supported by the standard LevelSetFunctionIntegrator and
+ *    LevelSetMethodGriddingAlgorithm classes.  Cells near the zero 
+ *    level set are tagged for refinement, and finer levels may be 
+ *    advanced using smaller time steps than coarser levels (see the 
+ *    use_subcycling input parameter).
  *
  * 
  * <h3> USAGE </h3>
@@ -146,6 +150,12 @@
  *                                   (default = 5)
  *   - tvd_runge_kutta_order       = order of Runge-Kutta time integration
  *                                   (default = 3)
+ *   - use_velocity_time_interpolation
+ *                                 = TRUE if velocity fields should be cached
+ *                                   and linearly interpolated in time for
+ *                                   Runge-Kutta stages instead of being 
+ *                                   recomputed for every stage
+ *                                   (default = FALSE)
  *   - reinitialization_interval   = interval between reinitialization
  *                                   (default = 10)
  *                                   (reinitialization disabled if <= 0)
@@ -246,16 +256,25 @@
  *   - verbose_mode                = TRUE if status should be output during 
  *                                   integration (default = TRUE)
  *
- *   <h5> AMR Parameters (CURRENTLY UNUSED): </h5>
+ *   <h5> AMR Parameters: </h5>
  *
  *   - use_AMR                     = TRUE if AMR should be used 
  *                                   (default = FALSE)
  *   - regrid_interval             = regridding interval (default = 5)
+ *   - use_interface_proximity_regrid
+ *                                 = TRUE if regridding should only be
+ *                                   requested when the zero level set may
+ *                                   leave the buffer of cells around the
+ *                                   cells tagged for refinement
+ *                                   (default = FALSE)
  *   - tag_buffer_width            = number of buffer cells to use around
  *                                   cells tagged for refinement
  *                                   (default = 2)
  *   - refinement_cutoff_value     = cutoff value for distance function
  *                                   (default = 1.0)
+ *   - use_subcycling              = TRUE if finer levels should be 
+ *                                   advanced using smaller time steps 
+ *                                   than coarser levels (default = FALSE)
  *
  *
  * <h4> LevelSetMethodGriddingAlgorithm Input Database Parameters </h4>
@@ -932,8 +951,8 @@ public:
    *                 this time step; false otherwise.
    *
    * NOTES:
-   *  - AMR is NOT yet implemented, so advanceLevelSetFunctions() 
-   *    currently always returns false.
+   *  - When use_subcycling is TRUE, dt is the time increment for the
+   *    coarsest level of the PatchHierarchy.
    *
    */
   virtual bool advanceLevelSetFunctions(const LSMLIB_REAL dt); 
@@ -12,15 +12,24 @@
 #define included_LevelSetMethodToolbox_cc
 
 // System Headers
+#include <map>
+#include <utility>
 #include <vector>
 #include <float.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "LSMLIB_config.h" 
 #include "LevelSetMethodToolbox.h" 
 #include "LSMLIB_DefaultParameters.h"
+#include "lsm_data_arrays.h"
 
 // SAMRAI Headers
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h" 
 #include "CartesianPatchGeometry.h"
 #include "CellData.h" 
@@ -46,6 +55,9 @@ extern "C" {
   #include "lsm_tvd_runge_kutta1d.h"
   #include "lsm_tvd_runge_kutta2d.h"
   #include "lsm_tvd_runge_kutta3d.h"
+  #include "lsm_semi_lagrangian1d.h"
+  #include "lsm_semi_lagrangian2d.h"
+  #include "lsm_semi_lagrangian3d.h"
   #include "lsm_utilities1d.h"
   #include "lsm_utilities2d.h"
   #include "lsm_utilities3d.h"
@@ -85,6 +97,9 @@ LevelSetMethodToolbox<DIM>::s_D2_three_ghostcells_handle = -1;
 template <int DIM> int 
 LevelSetMethodToolbox<DIM>::s_D3_three_ghostcells_handle = -1;
 
+template <int DIM> map< pair<int,int>, int > 
+LevelSetMethodToolbox<DIM>::s_grown_scratch_handles;
+
 
 // parameters for computing unit normal vector
 template <int DIM> int 
@@ -95,6 +110,40 @@ template <int DIM> int
 LevelSetMethodToolbox<DIM>::s_compute_normal_grad_phi_minus_handle = -1;
 
 
+// scratch data allocation policy
+template <int DIM> bool 
+LevelSetMethodToolbox<DIM>::s_use_persistent_scratch_data = false;
+
+
+// batch of global reductions
+template <int DIM> vector<LSMLIB_REAL> 
+LevelSetMethodToolbox<DIM>::s_reduction_values;
+template <int DIM> vector<int> 
+LevelSetMethodToolbox<DIM>::s_reduction_types;
+template <int DIM> int 
+LevelSetMethodToolbox<DIM>::s_num_reduced_values = 0;
+template <int DIM> int 
+LevelSetMethodToolbox<DIM>::s_num_started_reduction_values = 0;
+template <int DIM> vector<LSMLIB_REAL> 
+LevelSetMethodToolbox<DIM>::s_reduction_max_buffer;
+template <int DIM> vector<LSMLIB_REAL> 
+LevelSetMethodToolbox<DIM>::s_reduction_sum_buffer;
+template <int DIM> tbox::MPI::request 
+LevelSetMethodToolbox<DIM>::s_reduction_requests[2];
+template <int DIM> int 
+LevelSetMethodToolbox<DIM>::s_num_reduction_requests = 0;
+
+// non-blocking reductions require MPI_Iallreduce() (MPI-3)
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+#define LSM_USE_NONBLOCKING_REDUCTIONS
+#ifdef LSMLIB_DOUBLE_PRECISION
+#define LSM_MPI_REAL MPI_DOUBLE
+#else
+#define LSM_MPI_REAL MPI_FLOAT
+#endif
+#endif
+
+
 /****************************************************************
  *
  * Implementation of LevelSetMethodToolbox Methods
@@ -110,17 +159,30 @@ void LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
   const int grad_phi_handle,
   const int phi_handle,
   const int upwind_function_handle,
-  const int phi_component)
+  const int phi_component,
+  const int coarsest_level,
+  const int finest_level)
 {
 
   // make sure that the scratch PatchData handles have been created
   initializeComputeSpatialDerivativesParameters();
 
-  const int finest_level = hierarchy->getFinestLevelNumber();
-  for ( int ln=0 ; ln<=finest_level ; ln++ ) {
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the ENO/WENO scheme is checked before entering it
+  checkSpatialDerivativeParameters(
+    "computeUpwindSpatialDerivatives", spatial_derivative_type, spatial_derivative_order);
+
+  const int finest_ln = (finest_level < 0) ?
+    hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    // NOTE: PatchData allocation is not thread-safe, so the scratch
+    //       data is allocated before entering the threaded loop
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -132,6 +194,57 @@ void LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
                   << endl );
       }
 
+#ifdef _OPENMP
+      allocateSpatialDerivativeScratchData(
+        patch, spatial_derivative_type, spatial_derivative_order);
+#endif
+      patches.push_back(patch);
+
+    } // end loop over Patches
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+
+      // compute spatial derivatives for phi on the current patch
+      computeUpwindSpatialDerivatives(
+        patches[k],
+        spatial_derivative_type,
+        spatial_derivative_order,
+        grad_phi_handle,
+        phi_handle,
+        upwind_function_handle,
+        phi_component);
+
+    } // end threaded loop over Patches
+
+#ifdef _OPENMP
+    for (int k = 0; k < num_patches; k++) {
+      releaseSpatialDerivativeScratchData(
+        patches[k], spatial_derivative_type, spatial_derivative_order);
+    }
+#endif
+
+  } // end loop over PatchLevels
+}
+
+
+/* computeUpwindSpatialDerivatives() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
+  Pointer< Patch<DIM> > patch,
+  const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+  const int spatial_derivative_order,
+  const int grad_phi_handle,
+  const int phi_handle,
+  const int upwind_function_handle,
+  const int phi_component)
+{
+      // make sure that the scratch PatchData handles have been created
+      initializeComputeSpatialDerivativesParameters();
+
       // compute spatial derivatives for phi
       Pointer< CellData<DIM,LSMLIB_REAL> > grad_phi_data =
         patch->getPatchData( grad_phi_handle );
@@ -182,7 +295,7 @@ void LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
             case 1: {
 
               // prepare scratch PatchData
-              patch->allocatePatchData( s_D1_one_ghostcell_handle );
+              allocateScratchPatchData(patch, s_D1_one_ghostcell_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_one_ghostcell_handle );
@@ -294,15 +407,15 @@ void LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
               } // end switch over dimensions
 
               // deallocate scratch PatchData
-              patch->deallocatePatchData( s_D1_one_ghostcell_handle );
+              releaseScratchPatchData(patch, s_D1_one_ghostcell_handle);
 
               break;
             }
             case 2: {
 
               // prepare scratch PatchData
-              patch->allocatePatchData( s_D1_two_ghostcells_handle );
-              patch->allocatePatchData( s_D2_two_ghostcells_handle );
+              allocateScratchPatchData(patch, s_D1_two_ghostcells_handle);
+              allocateScratchPatchData(patch, s_D2_two_ghostcells_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_two_ghostcells_handle );
@@ -435,17 +548,17 @@ void LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
               } // end switch over dimensions
 
               // deallocate scratch PatchData
-              patch->deallocatePatchData( s_D1_two_ghostcells_handle );
-              patch->deallocatePatchData( s_D2_two_ghostcells_handle );
+              releaseScratchPatchData(patch, s_D1_two_ghostcells_handle);
+              releaseScratchPatchData(patch, s_D2_two_ghostcells_handle);
 
               break;
             }
             case 3: {
 
               // prepare scratch PatchData
-              patch->allocatePatchData( s_D1_three_ghostcells_handle );
-              patch->allocatePatchData( s_D2_three_ghostcells_handle );
-              patch->allocatePatchData( s_D3_three_ghostcells_handle );
+              allocateScratchPatchData(patch, s_D1_three_ghostcells_handle);
+              allocateScratchPatchData(patch, s_D2_three_ghostcells_handle);
+              allocateScratchPatchData(patch, s_D3_three_ghostcells_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_three_ghostcells_handle );
@@ -598,9 +711,9 @@ void LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
               }
 
               // deallocate scratch PatchData
-              patch->deallocatePatchData( s_D1_three_ghostcells_handle );
-              patch->deallocatePatchData( s_D2_three_ghostcells_handle );
-              patch->deallocatePatchData( s_D3_three_ghostcells_handle );
+              releaseScratchPatchData(patch, s_D1_three_ghostcells_handle);
+              releaseScratchPatchData(patch, s_D2_three_ghostcells_handle);
+              releaseScratchPatchData(patch, s_D3_three_ghostcells_handle);
 
               break;
             }
@@ -621,7 +734,7 @@ void LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
             case 5: {
 
               // prepare scratch PatchData
-              patch->allocatePatchData( s_D1_three_ghostcells_handle );
+              allocateScratchPatchData(patch, s_D1_three_ghostcells_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_three_ghostcells_handle );
@@ -732,7 +845,7 @@ void LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
               }
 
               // deallocate scratch PatchData
-              patch->deallocatePatchData( s_D1_three_ghostcells_handle );
+              releaseScratchPatchData(patch, s_D1_three_ghostcells_handle);
 
               break;
             }
@@ -758,9 +871,6 @@ void LevelSetMethodToolbox<DIM>::computeUpwindSpatialDerivatives(
         }
 
       } // end switch on derivative type
-
-    } // end loop over Patches
-  } // end loop over PatchLevels
 }
 
 
@@ -773,17 +883,30 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
   const int grad_phi_plus_handle,
   const int grad_phi_minus_handle,
   const int phi_handle,
-  const int phi_component)
+  const int phi_component,
+  const int coarsest_level,
+  const int finest_level)
 {
 
   // make sure that the scratch PatchData handles have been created
   initializeComputeSpatialDerivativesParameters();
 
-  const int finest_level = hierarchy->getFinestLevelNumber();
-  for ( int ln=0 ; ln<=finest_level ; ln++ ) {
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the ENO/WENO scheme is checked before entering it
+  checkSpatialDerivativeParameters(
+    "computePlusAndMinusSpatialDerivatives", spatial_derivative_type, spatial_derivative_order);
+
+  const int finest_ln = (finest_level < 0) ?
+    hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    // NOTE: PatchData allocation is not thread-safe, so the scratch
+    //       data is allocated before entering the threaded loop
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -795,7 +918,58 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
                   << endl );
       }
 
-      // compute spatial derivatives for phi
+#ifdef _OPENMP
+      allocateSpatialDerivativeScratchData(
+        patch, spatial_derivative_type, spatial_derivative_order);
+#endif
+      patches.push_back(patch);
+
+    } // end loop over Patches
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+
+      // compute spatial derivatives for phi on the current patch
+      computePlusAndMinusSpatialDerivatives(
+        patches[k],
+        spatial_derivative_type,
+        spatial_derivative_order,
+        grad_phi_plus_handle,
+        grad_phi_minus_handle,
+        phi_handle,
+        phi_component);
+
+    } // end threaded loop over Patches
+
+#ifdef _OPENMP
+    for (int k = 0; k < num_patches; k++) {
+      releaseSpatialDerivativeScratchData(
+        patches[k], spatial_derivative_type, spatial_derivative_order);
+    }
+#endif
+
+  } // end loop over PatchLevels
+}
+
+
+/* computePlusAndMinusSpatialDerivatives() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
+  Pointer< Patch<DIM> > patch,
+  const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+  const int spatial_derivative_order,
+  const int grad_phi_plus_handle,
+  const int grad_phi_minus_handle,
+  const int phi_handle,
+  const int phi_component,
+  const int fillbox_growth)
+{
+      // make sure that the scratch PatchData handles have been created
+      initializeComputeSpatialDerivativesParameters();
+
       Pointer< CartesianPatchGeometry<DIM> > patch_geom =
         patch->getPatchGeometry();
 #ifdef LSMLIB_DOUBLE_PRECISION
@@ -805,15 +979,18 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
       float dx[DIM];
       for (int i = 0; i < DIM; i++) dx[i] = (float) dx_double[i];
 #endif
-  
+
       Pointer< CellData<DIM,LSMLIB_REAL> > grad_phi_plus_data =
         patch->getPatchData( grad_phi_plus_handle );
       Pointer< CellData<DIM,LSMLIB_REAL> > grad_phi_minus_data =
         patch->getPatchData( grad_phi_minus_handle );
       Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
         patch->getPatchData( phi_handle );
-  
+
+      // NOTE: the fill box is grown into the ghost region of grad(phi) when
+      //       fillbox_growth > 0
       Box<DIM> fillbox = grad_phi_plus_data->getBox();
+      fillbox.grow(IntVector<DIM>(fillbox_growth));
       const IntVector<DIM> grad_phi_fillbox_lower = fillbox.lower();
       const IntVector<DIM> grad_phi_fillbox_upper = fillbox.upper();
 
@@ -847,10 +1024,12 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
             case 1: {
 
               // prepare scratch PatchData
-              patch->allocatePatchData( s_D1_one_ghostcell_handle );
+              const int D1_handle = 
+                getScratchHandle(s_D1_one_ghostcell_handle, fillbox_growth);
+              allocateScratchPatchData(patch, D1_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
-                patch->getPatchData( s_D1_one_ghostcell_handle );
+                patch->getPatchData( D1_handle );
 
               Box<DIM> D1_ghostbox = D1_data->getGhostBox();
               const IntVector<DIM> D1_ghostbox_lower = D1_ghostbox.lower();
@@ -956,7 +1135,7 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
               } 
 
               // deallocate scratch PatchData
-              patch->deallocatePatchData( s_D1_one_ghostcell_handle );
+              releaseScratchPatchData(patch, D1_handle);
 
               break;
             }
@@ -964,13 +1143,17 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
             case 2: {
 
               // prepare scratch PatchData
-              patch->allocatePatchData( s_D1_two_ghostcells_handle );
-              patch->allocatePatchData( s_D2_two_ghostcells_handle );
+              const int D1_handle = 
+                getScratchHandle(s_D1_two_ghostcells_handle, fillbox_growth);
+              const int D2_handle = 
+                getScratchHandle(s_D2_two_ghostcells_handle, fillbox_growth);
+              allocateScratchPatchData(patch, D1_handle);
+              allocateScratchPatchData(patch, D2_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
-                patch->getPatchData( s_D1_two_ghostcells_handle );
+                patch->getPatchData( D1_handle );
               Pointer< CellData<DIM,LSMLIB_REAL> > D2_data =
-                patch->getPatchData( s_D2_two_ghostcells_handle );
+                patch->getPatchData( D2_handle );
 
               Box<DIM> D1_ghostbox = D1_data->getGhostBox();
               const IntVector<DIM> D1_ghostbox_lower = D1_ghostbox.lower();
@@ -1095,8 +1278,8 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
               } 
 
               // deallocate scratch PatchData
-              patch->deallocatePatchData( s_D1_two_ghostcells_handle );
-              patch->deallocatePatchData( s_D2_two_ghostcells_handle );
+              releaseScratchPatchData(patch, D1_handle);
+              releaseScratchPatchData(patch, D2_handle);
 
               break;
             }
@@ -1104,16 +1287,22 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
             case 3: {
 
               // prepare scratch PatchData
-              patch->allocatePatchData( s_D1_three_ghostcells_handle );
-              patch->allocatePatchData( s_D2_three_ghostcells_handle );
-              patch->allocatePatchData( s_D3_three_ghostcells_handle );
+              const int D1_handle = 
+                getScratchHandle(s_D1_three_ghostcells_handle, fillbox_growth);
+              const int D2_handle = 
+                getScratchHandle(s_D2_three_ghostcells_handle, fillbox_growth);
+              const int D3_handle = 
+                getScratchHandle(s_D3_three_ghostcells_handle, fillbox_growth);
+              allocateScratchPatchData(patch, D1_handle);
+              allocateScratchPatchData(patch, D2_handle);
+              allocateScratchPatchData(patch, D3_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
-                patch->getPatchData( s_D1_three_ghostcells_handle );
+                patch->getPatchData( D1_handle );
               Pointer< CellData<DIM,LSMLIB_REAL> > D2_data =
-                patch->getPatchData( s_D2_three_ghostcells_handle );
+                patch->getPatchData( D2_handle );
               Pointer< CellData<DIM,LSMLIB_REAL> > D3_data =
-                patch->getPatchData( s_D3_three_ghostcells_handle );
+                patch->getPatchData( D3_handle );
 
               Box<DIM> D1_ghostbox = D1_data->getGhostBox();
               const IntVector<DIM> D1_ghostbox_lower = D1_ghostbox.lower();
@@ -1257,9 +1446,9 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
               } 
 
               // deallocate scratch PatchData
-              patch->deallocatePatchData( s_D1_three_ghostcells_handle );
-              patch->deallocatePatchData( s_D2_three_ghostcells_handle );
-              patch->deallocatePatchData( s_D3_three_ghostcells_handle );
+              releaseScratchPatchData(patch, D1_handle);
+              releaseScratchPatchData(patch, D2_handle);
+              releaseScratchPatchData(patch, D3_handle);
 
               break;
             }
@@ -1280,10 +1469,12 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
             case 5: {
 
               // prepare scratch PatchData
-              patch->allocatePatchData( s_D1_three_ghostcells_handle );
+              const int D1_handle = 
+                getScratchHandle(s_D1_three_ghostcells_handle, fillbox_growth);
+              allocateScratchPatchData(patch, D1_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
-                patch->getPatchData( s_D1_three_ghostcells_handle );
+                patch->getPatchData( D1_handle );
 
               Box<DIM> D1_ghostbox = D1_data->getGhostBox();
               const IntVector<DIM> D1_ghostbox_lower = D1_ghostbox.lower();
@@ -1389,7 +1580,7 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
               } 
 
               // deallocate scratch PatchData
-              patch->deallocatePatchData( s_D1_three_ghostcells_handle );
+              releaseScratchPatchData(patch, D1_handle);
 
               break;
             }
@@ -1415,9 +1606,6 @@ void LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
         }
 
       } // end switch on derivative type
-
-    } // end loop over Patches
-  } // end loop over PatchLevels
 }
 
 
@@ -1657,15 +1845,31 @@ void LevelSetMethodToolbox<DIM>::TVDRK1Step(
   const LSMLIB_REAL dt,
   const int u_next_component,
   const int u_cur_component,
-  const int rhs_component)
+  const int rhs_component,
+  const int coarsest_level,
+  const int finest_level)
 {
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "TVDRK1Step(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
+
   // loop over PatchHierarchy and take Runge-Kutta step
   // by calling Fortran routines
-  const int num_levels = patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  const int finest_ln = (finest_level < 0) ?
+    patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -1676,6 +1880,15 @@ void LevelSetMethodToolbox<DIM>::TVDRK1Step(
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       // get pointers to data and index space ranges
       Pointer< CellData<DIM,LSMLIB_REAL> > u_next_data =
@@ -1760,7 +1973,7 @@ void LevelSetMethodToolbox<DIM>::TVDRK1Step(
           &fillbox_upper[1],
           &dt);
 
-      } else if ( DIM == 1 ) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
         LSM1D_RK1_STEP(
           u_next,
           &u_next_ghostbox_lower[0],
@@ -1775,15 +1988,9 @@ void LevelSetMethodToolbox<DIM>::TVDRK1Step(
           &fillbox_upper[0],
           &dt);
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  "LevelSetMethodToolbox::" 
-                  << "TVDRK1Step(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
       }
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
   } // end loop over levels in hierarchy
 }
 
@@ -1798,15 +2005,32 @@ void LevelSetMethodToolbox<DIM>::TVDRK2Stage1(
   const LSMLIB_REAL dt,
   const int u_stage1_component,
   const int u_cur_component,
-  const int rhs_component)
+  const int rhs_component,
+  const int fillbox_growth,
+  const int coarsest_level,
+  const int finest_level)
 {
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "TVDRK2Stage1(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
+
   // loop over PatchHierarchy and take Runge-Kutta step
   // by calling Fortran routines
-  const int num_levels = patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  const int finest_ln = (finest_level < 0) ?
+    patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -1817,6 +2041,15 @@ void LevelSetMethodToolbox<DIM>::TVDRK2Stage1(
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       // get pointers to data and index space ranges
       Pointer< CellData<DIM,LSMLIB_REAL> > u_stage1_data =
@@ -1844,6 +2077,7 @@ void LevelSetMethodToolbox<DIM>::TVDRK2Stage1(
 
       // fill box
       Box<DIM> fillbox = u_stage1_data->getBox();
+      fillbox.grow(IntVector<DIM>(fillbox_growth));
       const IntVector<DIM> fillbox_lower = fillbox.lower();
       const IntVector<DIM> fillbox_upper = fillbox.upper();
 
@@ -1905,7 +2139,7 @@ void LevelSetMethodToolbox<DIM>::TVDRK2Stage1(
           &fillbox_upper[1],
           &dt);
 
-      } else if ( DIM == 1 ) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
         LSM1D_TVD_RK2_STAGE1(
           u_stage1,
           &u_stage1_ghostbox_lower[0],
@@ -1920,15 +2154,9 @@ void LevelSetMethodToolbox<DIM>::TVDRK2Stage1(
           &fillbox_upper[0],
           &dt);
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  "LevelSetMethodToolbox::" 
-                  << "TVDRK2Stage1(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
       }
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
   } // end loop over levels in hierarchy
 }
 
@@ -1945,15 +2173,31 @@ void LevelSetMethodToolbox<DIM>::TVDRK2Stage2(
   const int u_next_component,
   const int u_stage1_component,
   const int u_cur_component,
-  const int rhs_component)
+  const int rhs_component,
+  const int coarsest_level,
+  const int finest_level)
 {
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "TVDRK2Stage2(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
+
   // loop over PatchHierarchy and take Runge-Kutta step
   // by calling Fortran routines
-  const int num_levels = patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  const int finest_ln = (finest_level < 0) ?
+    patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -1964,6 +2208,15 @@ void LevelSetMethodToolbox<DIM>::TVDRK2Stage2(
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       // get pointers to data and index space ranges
       Pointer< CellData<DIM,LSMLIB_REAL> > u_next_data =
@@ -2073,7 +2326,7 @@ void LevelSetMethodToolbox<DIM>::TVDRK2Stage2(
           &fillbox_upper[1],
           &dt);
 
-      } else if ( DIM == 1 ) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
         LSM1D_TVD_RK2_STAGE2(
           u_next,
           &u_next_ghostbox_lower[0],
@@ -2091,15 +2344,9 @@ void LevelSetMethodToolbox<DIM>::TVDRK2Stage2(
           &fillbox_upper[0],
           &dt);
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  "LevelSetMethodToolbox::" 
-                  << "TVDRK2Stage2(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
       }
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
   } // end loop over levels in hierarchy
 
 }
@@ -2115,15 +2362,32 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage1(
   const LSMLIB_REAL dt,
   const int u_stage1_component,
   const int u_cur_component,
-  const int rhs_component)
+  const int rhs_component,
+  const int fillbox_growth,
+  const int coarsest_level,
+  const int finest_level)
 {
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "TVDRK3Stage1(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
+
   // loop over PatchHierarchy and take Runge-Kutta step
   // by calling Fortran routines
-  const int num_levels = patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  const int finest_ln = (finest_level < 0) ?
+    patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -2134,6 +2398,15 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage1(
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       // get pointers to data and index space ranges
       Pointer< CellData<DIM,LSMLIB_REAL> > u_stage1_data =
@@ -2161,6 +2434,7 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage1(
 
       // fill box
       Box<DIM> fillbox = u_stage1_data->getBox();
+      fillbox.grow(IntVector<DIM>(fillbox_growth));
       const IntVector<DIM> fillbox_lower = fillbox.lower();
       const IntVector<DIM> fillbox_upper = fillbox.upper();
 
@@ -2222,7 +2496,7 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage1(
           &fillbox_upper[1],
           &dt);
 
-      } else if ( DIM == 1 ) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
         LSM1D_TVD_RK3_STAGE1(
           u_stage1,
           &u_stage1_ghostbox_lower[0],
@@ -2237,15 +2511,9 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage1(
           &fillbox_upper[0],
           &dt);
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  "LevelSetMethodToolbox::" 
-                  << "TVDRK3Stage1(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
       }
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
   } // end loop over levels in hierarchy
 }
 
@@ -2262,15 +2530,32 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage2(
   const int u_stage2_component,
   const int u_stage1_component,
   const int u_cur_component,
-  const int rhs_component)
+  const int rhs_component,
+  const int fillbox_growth,
+  const int coarsest_level,
+  const int finest_level)
 {
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "TVDRK3Stage2(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
+
   // loop over PatchHierarchy and take Runge-Kutta step
   // by calling Fortran routines
-  const int num_levels = patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  const int finest_ln = (finest_level < 0) ?
+    patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -2281,6 +2566,15 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage2(
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       // get pointers to data and index space ranges
       Pointer< CellData<DIM,LSMLIB_REAL> > u_stage2_data =
@@ -2316,6 +2610,7 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage2(
 
       // fill box
       Box<DIM> fillbox = u_stage2_data->getBox();
+      fillbox.grow(IntVector<DIM>(fillbox_growth));
       const IntVector<DIM> fillbox_lower = fillbox.lower();
       const IntVector<DIM> fillbox_upper = fillbox.upper();
 
@@ -2390,7 +2685,7 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage2(
           &fillbox_upper[1],
           &dt);
 
-      } else if ( DIM == 1 ) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
         LSM1D_TVD_RK3_STAGE2(
           u_stage2,
           &u_stage2_ghostbox_lower[0],
@@ -2408,15 +2703,9 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage2(
           &fillbox_upper[0],
           &dt);
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  "LevelSetMethodToolbox::" 
-                  << "TVDRK3Stage2(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
       }
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
   } // end loop over levels in hierarchy
 
 }
@@ -2434,15 +2723,31 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage3(
   const int u_next_component,
   const int u_stage2_component,
   const int u_cur_component,
-  const int rhs_component)
+  const int rhs_component,
+  const int coarsest_level,
+  const int finest_level)
 {
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "TVDRK3Stage3(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
+
   // loop over PatchHierarchy and take Runge-Kutta step
   // by calling Fortran routines
-  const int num_levels = patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  const int finest_ln = (finest_level < 0) ?
+    patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -2453,6 +2758,15 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage3(
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       // get pointers to data and index space ranges
       Pointer< CellData<DIM,LSMLIB_REAL> > u_next_data =
@@ -2562,7 +2876,7 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage3(
           &fillbox_upper[1],
           &dt);
 
-      } else if ( DIM == 1 ) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
         LSM1D_TVD_RK3_STAGE3(
           u_next,
           &u_next_ghostbox_lower[0],
@@ -2580,267 +2894,505 @@ void LevelSetMethodToolbox<DIM>::TVDRK3Stage3(
           &fillbox_upper[0],
           &dt);
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  "LevelSetMethodToolbox::" 
-                  << "TVDRK3Stage3(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
       }
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
   } // end loop over levels in hierarchy
 
 }
 
 
-/* computeDistanceFunctionUsingFMM() */
+/* SSPRKStage() */
 template <int DIM> 
-void LevelSetMethodToolbox<DIM>::computeDistanceFunctionUsingFMM(
-  Pointer< PatchHierarchy<DIM> > hierarchy,
-  const int spatial_derivative_order,
-  const int distance_function_handle,
-  const int phi_handle,
-  const int distance_function_component,
-  const int phi_component)
+void LevelSetMethodToolbox<DIM>::SSPRKStage(
+  Pointer< PatchHierarchy<DIM> > patch_hierarchy,
+  const int u_next_handle,
+  const int u_stage_handle,
+  const int u_cur_handle,
+  const int rhs_handle,
+  const LSMLIB_REAL alpha,
+  const LSMLIB_REAL dt,
+  const int u_next_component,
+  const int u_stage_component,
+  const int u_cur_component,
+  const int rhs_component,
+  const int coarsest_level,
+  const int finest_level)
 {
-  const int finest_level = hierarchy->getFinestLevelNumber();
-
-  /*
-   * error checking
-   */
-
-  // TEMP - only single level calculations currently supported
-  if (finest_level > 0) {
-    TBOX_ERROR(  "LevelSetMethodToolbox::"
-              << "computeDistanceFunctionUsingFMM(): "
-              << "Only single level calculations currently supported."
-              << endl );
-  }
-
-  // TEMP - only first-order calculations currently supported
-  if (spatial_derivative_order > 0) {
-    TBOX_WARNING(  "LevelSetMethodToolbox::"
-                << "computeDistanceFunctionUsingFMM(): "
-                << "Only first-order calculations currently supported.  "
-                << "Dropping to first-order calculations." 
-                << endl );
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "SSPRKStage(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
   }
 
-  for ( int ln=0 ; ln<=finest_level ; ln++ ) {
-
-    Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(ln);
-
-    // error checking...only single level calculations currently supported
-    if (level->getNumberOfPatches() > 1) {
-      TBOX_ERROR(  "LevelSetMethodToolbox::"
-                << "computeDistanceFunctionUsingFMM(): "
-                << "Only single patch calculations currently supported."
-                << endl );
-    }
+  // loop over PatchHierarchy and take low-storage SSP Runge-Kutta stage
+  // by calling Fortran routines
+  const int finest_ln = (finest_level < 0) ?
+    patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
+    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+    
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
       Pointer< Patch<DIM> > patch = level->getPatch(pn);
       if ( patch.isNull() ) {
-        TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "computeDistanceFunctionUsingFMM(): "
+        TBOX_ERROR(  "LevelSetMethodToolbox::" 
+                  << "SSPRKStage(): "
                   << "Cannot find patch. Null patch pointer."
-                  << endl );
+                  << endl);
       }
+      patches.push_back(patch);
+    }
 
-      // get geometry information for patch
-      Pointer< CartesianPatchGeometry<DIM> > patch_geom =
-        patch->getPatchGeometry();
-#ifdef LSMLIB_DOUBLE_PRECISION
-      const double* dx = patch_geom->getDx();
-#else
-      const double* dx_double = patch_geom->getDx();
-      float dx[DIM];
-      for (int i = 0; i < DIM; i++) dx[i] = (float) dx_double[i];
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
 #endif
-  
-      // get PatchData for distance function and phi
-      Pointer< CellData<DIM,LSMLIB_REAL> > distance_function_data =
-        patch->getPatchData( distance_function_handle );
-      Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
-        patch->getPatchData( phi_handle );
-  
-      // get index space information for PatchData
-      Box<DIM> ghostbox = distance_function_data->getGhostBox();
-      IntVector<DIM> grid_dims_int_vector = 
-        ghostbox.upper() - ghostbox.lower();
-      int* grid_dims = grid_dims_int_vector;
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
-      LSMLIB_REAL* distance_function = 
-        distance_function_data->getPointer(distance_function_component);
-      LSMLIB_REAL* phi = phi_data->getPointer(phi_component);
+      // get pointers to data and index space ranges
+      Pointer< CellData<DIM,LSMLIB_REAL> > u_next_data =
+        patch->getPatchData( u_next_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > u_stage_data =
+        patch->getPatchData( u_stage_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > u_cur_data =
+        patch->getPatchData( u_cur_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > rhs_data =
+        patch->getPatchData( rhs_handle );
+  
+      Box<DIM> u_next_ghostbox = u_next_data->getGhostBox();
+      const IntVector<DIM> u_next_ghostbox_lower = 
+        u_next_ghostbox.lower();
+      const IntVector<DIM> u_next_ghostbox_upper = 
+        u_next_ghostbox.upper();
 
-      // call computeExtensionFields*() from toolbox to carry out
-      // computation
-      if ( DIM == 3 ) {
-        TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "computeDistanceFunctionUsingFMM(): "
-                  << "DIM = 3 is currently unsupported."
-                  << endl );
-        /*
-        computeExtensionFields3d(
-          distance_function,
-          (LSMLIB_REAL**) 0,
-          phi,
-          (LSMLIB_REAL**) 0,
-          0,
-          grid_dims,
-          (LSMLIB_REAL*) dx);
-        */
-      } else if ( DIM == 2 ) {
-        computeExtensionFields2d(
-          distance_function,
-          (LSMLIB_REAL**) 0,
-          phi,
-          (LSMLIB_REAL*) 0, // NULL mask field
-          (LSMLIB_REAL**) 0,
-          0,
-          spatial_derivative_order,  
-          grid_dims,
-          (LSMLIB_REAL*) dx);
-      } else if ( DIM == 1 ) {
-        TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "computeDistanceFunctionUsingFMM(): "
-                  << "DIM = 1 is currently unsupported."
-                  << endl );
-      } else {
-        TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "computeDistanceFunctionUsingFMM(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 2 is currently supported."
-                  << endl );
+      Box<DIM> u_stage_ghostbox = u_stage_data->getGhostBox();
+      const IntVector<DIM> u_stage_ghostbox_lower = 
+        u_stage_ghostbox.lower();
+      const IntVector<DIM> u_stage_ghostbox_upper = 
+        u_stage_ghostbox.upper();
 
-      } // end switch on DIM
+      Box<DIM> u_cur_ghostbox = u_cur_data->getGhostBox();
+      const IntVector<DIM> u_cur_ghostbox_lower = 
+        u_cur_ghostbox.lower();
+      const IntVector<DIM> u_cur_ghostbox_upper = 
+        u_cur_ghostbox.upper();
 
-    } // end loop over Patches
-  } // end loop over PatchLevels
-}
+      Box<DIM> rhs_ghostbox = rhs_data->getGhostBox();
+      const IntVector<DIM> rhs_ghostbox_lower = rhs_ghostbox.lower();
+      const IntVector<DIM> rhs_ghostbox_upper = rhs_ghostbox.upper();
 
+      // fill box
+      Box<DIM> fillbox = u_stage_data->getBox();
+      const IntVector<DIM> fillbox_lower = fillbox.lower();
+      const IntVector<DIM> fillbox_upper = fillbox.upper();
 
-/* computeExtensionFieldsUsingFMM() */
-template <int DIM>
-void LevelSetMethodToolbox<DIM>::computeExtensionFieldsUsingFMM(
-  Pointer< PatchHierarchy<DIM> > hierarchy,
-  const int spatial_derivative_order,
-  const vector<int>& extension_field_handles,
-  const int distance_function_handle,
-  const vector<int>& source_field_handles,
-  const int phi_handle,
-  const int extension_field_component,
-  const int distance_function_component,
-  const int source_field_component,
-  const int phi_component)
-{
-  const int finest_level = hierarchy->getFinestLevelNumber();
+      LSMLIB_REAL* u_next = u_next_data->getPointer(u_next_component);
+      LSMLIB_REAL* u_stage = u_stage_data->getPointer(u_stage_component);
+      LSMLIB_REAL* u_cur = u_cur_data->getPointer(u_cur_component);
+      LSMLIB_REAL* rhs = rhs_data->getPointer(rhs_component);
 
-  /*
-   * error checking
-   */
+      if ( DIM == 3 ) {
+        LSM3D_SSP_RK_STAGE(
+          u_next,
+          &u_next_ghostbox_lower[0],
+          &u_next_ghostbox_upper[0],
+          &u_next_ghostbox_lower[1],
+          &u_next_ghostbox_upper[1],
+          &u_next_ghostbox_lower[2],
+          &u_next_ghostbox_upper[2],
+          u_stage,
+          &u_stage_ghostbox_lower[0],
+          &u_stage_ghostbox_upper[0],
+          &u_stage_ghostbox_lower[1],
+          &u_stage_ghostbox_upper[1],
+          &u_stage_ghostbox_lower[2],
+          &u_stage_ghostbox_upper[2],
+          u_cur,
+          &u_cur_ghostbox_lower[0],
+          &u_cur_ghostbox_upper[0],
+          &u_cur_ghostbox_lower[1],
+          &u_cur_ghostbox_upper[1],
+          &u_cur_ghostbox_lower[2],
+          &u_cur_ghostbox_upper[2],
+          rhs,
+          &rhs_ghostbox_lower[0],
+          &rhs_ghostbox_upper[0],
+          &rhs_ghostbox_lower[1],
+          &rhs_ghostbox_upper[1],
+          &rhs_ghostbox_lower[2],
+          &rhs_ghostbox_upper[2],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &fillbox_lower[1],
+          &fillbox_upper[1],
+          &fillbox_lower[2],
+          &fillbox_upper[2],
+          &alpha,
+          &dt);
 
-  // TEMP - only single level calculations currently supported
-  if (finest_level > 0) {
-    TBOX_ERROR(  "LevelSetMethodToolbox::"
-              << "computeExtensionFieldsUsingFMM(): "
-              << "Only single level calculations currently supported."
-              << endl );
-  }
+      } else if ( DIM == 2 ) {
+        LSM2D_SSP_RK_STAGE(
+          u_next,
+          &u_next_ghostbox_lower[0],
+          &u_next_ghostbox_upper[0],
+          &u_next_ghostbox_lower[1],
+          &u_next_ghostbox_upper[1],
+          u_stage,
+          &u_stage_ghostbox_lower[0],
+          &u_stage_ghostbox_upper[0],
+          &u_stage_ghostbox_lower[1],
+          &u_stage_ghostbox_upper[1],
+          u_cur,
+          &u_cur_ghostbox_lower[0],
+          &u_cur_ghostbox_upper[0],
+          &u_cur_ghostbox_lower[1],
+          &u_cur_ghostbox_upper[1],
+          rhs,
+          &rhs_ghostbox_lower[0],
+          &rhs_ghostbox_upper[0],
+          &rhs_ghostbox_lower[1],
+          &rhs_ghostbox_upper[1],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &fillbox_lower[1],
+          &fillbox_upper[1],
+          &alpha,
+          &dt);
 
-  // TEMP - only first-order calculations currently supported
-  if (spatial_derivative_order > 0) {
-    TBOX_WARNING(  "LevelSetMethodToolbox::"
-                << "computeExtensionFieldsUsingFMM(): "
-                << "Only first-order calculations currently supported.  "
-                << "Dropping to first-order calculations." 
-                << endl );
-  }
+      } else {  // DIM == 1 (other values are rejected before the loop)
+        LSM1D_SSP_RK_STAGE(
+          u_next,
+          &u_next_ghostbox_lower[0],
+          &u_next_ghostbox_upper[0],
+          u_stage,
+          &u_stage_ghostbox_lower[0],
+          &u_stage_ghostbox_upper[0],
+          u_cur,
+          &u_cur_ghostbox_lower[0],
+          &u_cur_ghostbox_upper[0],
+          rhs,
+          &rhs_ghostbox_lower[0],
+          &rhs_ghostbox_upper[0],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &alpha,
+          &dt);
 
-  // allocate memory for extension fields and source fields
-  int num_extension_fields = extension_field_handles.size();
-  LSMLIB_REAL** extension_fields = new LSMLIB_REAL*[num_extension_fields];
-  LSMLIB_REAL** source_fields = new LSMLIB_REAL*[num_extension_fields];
+      }
 
-  for ( int ln=0 ; ln<=finest_level ; ln++ ) {
+    } // end threaded loop over patches in level
+  } // end loop over levels in hierarchy
 
-    Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(ln);
+}
 
-    // error checking...only single level calculations currently supported
-    if (level->getNumberOfPatches() > 1) {
-      TBOX_ERROR(  "LevelSetMethodToolbox::"
-                << "computeExtensionFieldsUsingFMM(): "
-                << "Only single patch calculations currently supported."
-                << endl );
-    }
 
+/* semiLagrangianAdvectionStep() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::semiLagrangianAdvectionStep(
+  Pointer< PatchHierarchy<DIM> > patch_hierarchy,
+  const int u_next_handle,
+  const int u_cur_handle,
+  const int u_in_handle,
+  const int velocity_handle,
+  const LSMLIB_REAL alpha,
+  const LSMLIB_REAL dt,
+  const int u_next_component,
+  const int u_cur_component,
+  const int u_in_component,
+  const int coarsest_level,
+  const int finest_level)
+{
+  Pointer< CartesianGridGeometry<DIM> > grid_geometry = 
+    patch_hierarchy->getGridGeometry();
+#ifdef LSMLIB_DOUBLE_PRECISION
+  const double* dx_level0 = grid_geometry->getDx();
+#else
+  const double* dx_level0_double = grid_geometry->getDx();
+  float dx_level0[DIM]; 
+  for (int i = 0; i < DIM; i++) dx_level0[i] = (float) dx_level0_double[i];
+#endif
+
+  // loop over PatchHierarchy and take semi-Lagrangian step
+  // by calling Fortran routines
+  const int finest_ln = (finest_level < 0) ?
+    patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
+
+    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+    const IntVector<DIM> ratio_to_coarsest = level->getRatio();
+  
+    LSMLIB_REAL dx[LSM_DIM_MAX];
+    for (int dir = 0; dir < DIM; dir++) {
+      dx[dir] = dx_level0[dir]/ratio_to_coarsest[dir];
+    }
+    
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
       Pointer< Patch<DIM> > patch = level->getPatch(pn);
       if ( patch.isNull() ) {
-        TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "computeExtensionFieldsUsingFMM(): "
+        TBOX_ERROR(  "LevelSetMethodToolbox::" 
+                  << "semiLagrangianAdvectionStep(): "
                   << "Cannot find patch. Null patch pointer."
-                  << endl );
+                  << endl);
       }
 
-      // get geometry information for patch
-      Pointer< CartesianPatchGeometry<DIM> > patch_geom =
-        patch->getPatchGeometry();
-#ifdef LSMLIB_DOUBLE_PRECISION
-      const double* dx = patch_geom->getDx();
-#else
-      const double* dx_double = patch_geom->getDx();
-      float dx[DIM];
-      for (int i = 0; i < DIM; i++) dx[i] = (float) dx_double[i];
-#endif
-  
-      // get PatchData for distance function and phi
-      Pointer< CellData<DIM,LSMLIB_REAL> > distance_function_data =
-        patch->getPatchData( distance_function_handle );
-      Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
-        patch->getPatchData( phi_handle );
-      LSMLIB_REAL* distance_function = 
-        distance_function_data->getPointer(distance_function_component);
-      LSMLIB_REAL* phi = phi_data->getPointer(phi_component);
+      // get pointers to data and index space ranges
+      Pointer< CellData<DIM,LSMLIB_REAL> > u_next_data =
+        patch->getPatchData( u_next_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > u_cur_data =
+        patch->getPatchData( u_cur_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > u_in_data =
+        patch->getPatchData( u_in_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > vel_data =
+        patch->getPatchData( velocity_handle );
   
-      // get PatchData for source fields and extension fields
-      for (int k=0; k < num_extension_fields; k++) {
-        Pointer< CellData<DIM,LSMLIB_REAL> > extension_field_data = 
-          patch->getPatchData( extension_field_handles[k] );
-        Pointer< CellData<DIM,LSMLIB_REAL> > source_field_data = 
-          patch->getPatchData( source_field_handles[k] );
+      Box<DIM> u_next_ghostbox = u_next_data->getGhostBox();
+      const IntVector<DIM> u_next_ghostbox_lower = 
+        u_next_ghostbox.lower();
+      const IntVector<DIM> u_next_ghostbox_upper = 
+        u_next_ghostbox.upper();
 
-        extension_fields[k] = 
-          extension_field_data->getPointer(extension_field_component);
-        source_fields[k] = 
-          source_field_data->getPointer(source_field_component);
+      Box<DIM> u_cur_ghostbox = u_cur_data->getGhostBox();
+      const IntVector<DIM> u_cur_ghostbox_lower = 
+        u_cur_ghostbox.lower();
+      const IntVector<DIM> u_cur_ghostbox_upper = 
+        u_cur_ghostbox.upper();
+
+      Box<DIM> u_in_ghostbox = u_in_data->getGhostBox();
+      const IntVector<DIM> u_in_ghostbox_lower = u_in_ghostbox.lower();
+      const IntVector<DIM> u_in_ghostbox_upper = u_in_ghostbox.upper();
+
+      Box<DIM> vel_ghostbox = vel_data->getGhostBox();
+      const IntVector<DIM> vel_ghostbox_lower = vel_ghostbox.lower();
+      const IntVector<DIM> vel_ghostbox_upper = vel_ghostbox.upper();
+
+      // fill box
+      Box<DIM> fillbox = u_next_data->getBox();
+      const IntVector<DIM> fillbox_lower = fillbox.lower();
+      const IntVector<DIM> fillbox_upper = fillbox.upper();
+
+      LSMLIB_REAL* u_next = u_next_data->getPointer(u_next_component);
+      LSMLIB_REAL* u_cur = u_cur_data->getPointer(u_cur_component);
+      LSMLIB_REAL* u_in = u_in_data->getPointer(u_in_component);
+      LSMLIB_REAL* vel[LSM_DIM_MAX];
+      for (int dim = 0; dim < DIM; dim++) {
+        vel[dim] = vel_data->getPointer(dim);
+      }
+
+      if ( DIM == 3 ) {
+        LSM3D_SEMI_LAGRANGIAN_ADVECTION_STEP(
+          u_next,
+          &u_next_ghostbox_lower[0],
+          &u_next_ghostbox_upper[0],
+          &u_next_ghostbox_lower[1],
+          &u_next_ghostbox_upper[1],
+          &u_next_ghostbox_lower[2],
+          &u_next_ghostbox_upper[2],
+          u_cur,
+          &u_cur_ghostbox_lower[0],
+          &u_cur_ghostbox_upper[0],
+          &u_cur_ghostbox_lower[1],
+          &u_cur_ghostbox_upper[1],
+          &u_cur_ghostbox_lower[2],
+          &u_cur_ghostbox_upper[2],
+          u_in,
+          &u_in_ghostbox_lower[0],
+          &u_in_ghostbox_upper[0],
+          &u_in_ghostbox_lower[1],
+          &u_in_ghostbox_upper[1],
+          &u_in_ghostbox_lower[2],
+          &u_in_ghostbox_upper[2],
+          vel[0], vel[1], vel[2],
+          &vel_ghostbox_lower[0],
+          &vel_ghostbox_upper[0],
+          &vel_ghostbox_lower[1],
+          &vel_ghostbox_upper[1],
+          &vel_ghostbox_lower[2],
+          &vel_ghostbox_upper[2],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &fillbox_lower[1],
+          &fillbox_upper[1],
+          &fillbox_lower[2],
+          &fillbox_upper[2],
+          &dx[0],
+          &dx[1],
+          &dx[2],
+          &alpha,
+          &dt);
+
+      } else if ( DIM == 2 ) {
+        LSM2D_SEMI_LAGRANGIAN_ADVECTION_STEP(
+          u_next,
+          &u_next_ghostbox_lower[0],
+          &u_next_ghostbox_upper[0],
+          &u_next_ghostbox_lower[1],
+          &u_next_ghostbox_upper[1],
+          u_cur,
+          &u_cur_ghostbox_lower[0],
+          &u_cur_ghostbox_upper[0],
+          &u_cur_ghostbox_lower[1],
+          &u_cur_ghostbox_upper[1],
+          u_in,
+          &u_in_ghostbox_lower[0],
+          &u_in_ghostbox_upper[0],
+          &u_in_ghostbox_lower[1],
+          &u_in_ghostbox_upper[1],
+          vel[0], vel[1],
+          &vel_ghostbox_lower[0],
+          &vel_ghostbox_upper[0],
+          &vel_ghostbox_lower[1],
+          &vel_ghostbox_upper[1],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &fillbox_lower[1],
+          &fillbox_upper[1],
+          &dx[0],
+          &dx[1],
+          &alpha,
+          &dt);
+
+      } else if ( DIM == 1 ) {
+        LSM1D_SEMI_LAGRANGIAN_ADVECTION_STEP(
+          u_next,
+          &u_next_ghostbox_lower[0],
+          &u_next_ghostbox_upper[0],
+          u_cur,
+          &u_cur_ghostbox_lower[0],
+          &u_cur_ghostbox_upper[0],
+          u_in,
+          &u_in_ghostbox_lower[0],
+          &u_in_ghostbox_upper[0],
+          vel[0],
+          &vel_ghostbox_lower[0],
+          &vel_ghostbox_upper[0],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &dx[0],
+          &alpha,
+          &dt);
+
+      } else {  // Unsupported dimension
+        TBOX_ERROR(  "LevelSetMethodToolbox::" 
+                  << "semiLagrangianAdvectionStep(): "
+                  << "Invalid value of DIM.  "
+                  << "Only DIM = 1, 2, and 3 are supported."
+                  << endl);
+      }
+
+    } // end loop over patches in level
+  } // end loop over levels in hierarchy
+
+}
+
+
+/* computeDistanceFunctionUsingFMM() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::computeDistanceFunctionUsingFMM(
+  Pointer< PatchHierarchy<DIM> > hierarchy,
+  const int spatial_derivative_order,
+  const int distance_function_handle,
+  const int phi_handle,
+  const int distance_function_component,
+  const int phi_component)
+{
+  const int finest_level = hierarchy->getFinestLevelNumber();
+
+  /*
+   * error checking
+   */
+
+  // TEMP - only single level calculations currently supported
+  if (finest_level > 0) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::"
+              << "computeDistanceFunctionUsingFMM(): "
+              << "Only single level calculations currently supported."
+              << endl );
+  }
+
+  // TEMP - only first-order calculations currently supported
+  if (spatial_derivative_order > 0) {
+    TBOX_WARNING(  "LevelSetMethodToolbox::"
+                << "computeDistanceFunctionUsingFMM(): "
+                << "Only first-order calculations currently supported.  "
+                << "Dropping to first-order calculations." 
+                << endl );
+  }
+
+  for ( int ln=0 ; ln<=finest_level ; ln++ ) {
+
+    Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(ln);
+
+    // error checking...only single level calculations currently supported
+    if (level->getNumberOfPatches() > 1) {
+      TBOX_ERROR(  "LevelSetMethodToolbox::"
+                << "computeDistanceFunctionUsingFMM(): "
+                << "Only single patch calculations currently supported."
+                << endl );
+    }
+
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      const int pn = *pi;
+      Pointer< Patch<DIM> > patch = level->getPatch(pn);
+      if ( patch.isNull() ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "computeDistanceFunctionUsingFMM(): "
+                  << "Cannot find patch. Null patch pointer."
+                  << endl );
       }
 
+      // get geometry information for patch
+      Pointer< CartesianPatchGeometry<DIM> > patch_geom =
+        patch->getPatchGeometry();
+#ifdef LSMLIB_DOUBLE_PRECISION
+      const double* dx = patch_geom->getDx();
+#else
+      const double* dx_double = patch_geom->getDx();
+      float dx[DIM];
+      for (int i = 0; i < DIM; i++) dx[i] = (float) dx_double[i];
+#endif
+  
+      // get PatchData for distance function and phi
+      Pointer< CellData<DIM,LSMLIB_REAL> > distance_function_data =
+        patch->getPatchData( distance_function_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
+        patch->getPatchData( phi_handle );
+  
       // get index space information for PatchData
       Box<DIM> ghostbox = distance_function_data->getGhostBox();
       IntVector<DIM> grid_dims_int_vector = 
         ghostbox.upper() - ghostbox.lower();
       int* grid_dims = grid_dims_int_vector;
 
+      LSMLIB_REAL* distance_function = 
+        distance_function_data->getPointer(distance_function_component);
+      LSMLIB_REAL* phi = phi_data->getPointer(phi_component);
+
       // call computeExtensionFields*() from toolbox to carry out
       // computation
       if ( DIM == 3 ) {
         TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "computeExtensionFieldsUsingFMM(): "
+                  << "computeDistanceFunctionUsingFMM(): "
                   << "DIM = 3 is currently unsupported."
                   << endl );
         /*
         computeExtensionFields3d(
           distance_function,
-          ext_field
+          (LSMLIB_REAL**) 0,
           phi,
-          (LSMLIB_REAL*) 0,
           (LSMLIB_REAL**) 0,
           0,
           grid_dims,
@@ -2849,22 +3401,22 @@ void LevelSetMethodToolbox<DIM>::computeExtensionFieldsUsingFMM(
       } else if ( DIM == 2 ) {
         computeExtensionFields2d(
           distance_function,
-          extension_fields,
+          (LSMLIB_REAL**) 0,
           phi,
-          (LSMLIB_REAL*) 0,  // NULL mask field
-          source_fields,
-          num_extension_fields,
-          spatial_derivative_order,
+          (LSMLIB_REAL*) 0, // NULL mask field
+          (LSMLIB_REAL**) 0,
+          0,
+          spatial_derivative_order,  
           grid_dims,
           (LSMLIB_REAL*) dx);
       } else if ( DIM == 1 ) {
         TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "computeExtensionFieldsUsingFMM(): "
+                  << "computeDistanceFunctionUsingFMM(): "
                   << "DIM = 1 is currently unsupported."
                   << endl );
       } else {
         TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "computeExtensionFieldsUsingFMM(): "
+                  << "computeDistanceFunctionUsingFMM(): "
                   << "Invalid value of DIM.  "
                   << "Only DIM = 2 is currently supported."
                   << endl );
@@ -2873,42 +3425,194 @@ void LevelSetMethodToolbox<DIM>::computeExtensionFieldsUsingFMM(
 
     } // end loop over Patches
   } // end loop over PatchLevels
-
-  // free memory for extension fields and source fields
-  delete [] extension_fields; 
-  delete [] source_fields; 
 }
 
 
-/* computeUnitNormalVectorFromPhi() */
+/* computeExtensionFieldsUsingFMM() */
 template <int DIM>
-void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
-  Pointer< PatchHierarchy<DIM> > patch_hierarchy,
-  SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+void LevelSetMethodToolbox<DIM>::computeExtensionFieldsUsingFMM(
+  Pointer< PatchHierarchy<DIM> > hierarchy,
   const int spatial_derivative_order,
-  const int normal_vector_handle,
+  const vector<int>& extension_field_handles,
+  const int distance_function_handle,
+  const vector<int>& source_field_handles,
   const int phi_handle,
-  const UNIT_NORMAL_TYPE unit_normal_type,
+  const int extension_field_component,
+  const int distance_function_component,
+  const int source_field_component,
   const int phi_component)
 {
+  const int finest_level = hierarchy->getFinestLevelNumber();
 
-  // make sure that the scratch PatchData handles have been created
-  if ( (s_compute_normal_grad_phi_handle < 0) ||
-       (s_compute_normal_grad_phi_plus_handle < 0) ||
-       (s_compute_normal_grad_phi_minus_handle < 0) ) {
-    initializeComputeUnitNormalParameters();
+  /*
+   * error checking
+   */
+
+  // TEMP - only single level calculations currently supported
+  if (finest_level > 0) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::"
+              << "computeExtensionFieldsUsingFMM(): "
+              << "Only single level calculations currently supported."
+              << endl );
   }
-  initializeComputeSpatialDerivativesParameters();
 
-  const int finest_level = patch_hierarchy->getFinestLevelNumber();
+  // TEMP - only first-order calculations currently supported
+  if (spatial_derivative_order > 0) {
+    TBOX_WARNING(  "LevelSetMethodToolbox::"
+                << "computeExtensionFieldsUsingFMM(): "
+                << "Only first-order calculations currently supported.  "
+                << "Dropping to first-order calculations." 
+                << endl );
+  }
+
+  // allocate memory for extension fields and source fields
+  int num_extension_fields = extension_field_handles.size();
+  LSMLIB_REAL** extension_fields = new LSMLIB_REAL*[num_extension_fields];
+  LSMLIB_REAL** source_fields = new LSMLIB_REAL*[num_extension_fields];
+
   for ( int ln=0 ; ln<=finest_level ; ln++ ) {
 
-    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
-    
-    typename PatchLevel<DIM>::Iterator pi;
-    for (pi.initialize(level); pi; pi++) { // loop over patches
-      const int pn = *pi;
-      Pointer< Patch<DIM> > patch = level->getPatch(pn);
+    Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(ln);
+
+    // error checking...only single level calculations currently supported
+    if (level->getNumberOfPatches() > 1) {
+      TBOX_ERROR(  "LevelSetMethodToolbox::"
+                << "computeExtensionFieldsUsingFMM(): "
+                << "Only single patch calculations currently supported."
+                << endl );
+    }
+
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      const int pn = *pi;
+      Pointer< Patch<DIM> > patch = level->getPatch(pn);
+      if ( patch.isNull() ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "computeExtensionFieldsUsingFMM(): "
+                  << "Cannot find patch. Null patch pointer."
+                  << endl );
+      }
+
+      // get geometry information for patch
+      Pointer< CartesianPatchGeometry<DIM> > patch_geom =
+        patch->getPatchGeometry();
+#ifdef LSMLIB_DOUBLE_PRECISION
+      const double* dx = patch_geom->getDx();
+#else
+      const double* dx_double = patch_geom->getDx();
+      float dx[DIM];
+      for (int i = 0; i < DIM; i++) dx[i] = (float) dx_double[i];
+#endif
+  
+      // get PatchData for distance function and phi
+      Pointer< CellData<DIM,LSMLIB_REAL> > distance_function_data =
+        patch->getPatchData( distance_function_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
+        patch->getPatchData( phi_handle );
+      LSMLIB_REAL* distance_function = 
+        distance_function_data->getPointer(distance_function_component);
+      LSMLIB_REAL* phi = phi_data->getPointer(phi_component);
+  
+      // get PatchData for source fields and extension fields
+      for (int k=0; k < num_extension_fields; k++) {
+        Pointer< CellData<DIM,LSMLIB_REAL> > extension_field_data = 
+          patch->getPatchData( extension_field_handles[k] );
+        Pointer< CellData<DIM,LSMLIB_REAL> > source_field_data = 
+          patch->getPatchData( source_field_handles[k] );
+
+        extension_fields[k] = 
+          extension_field_data->getPointer(extension_field_component);
+        source_fields[k] = 
+          source_field_data->getPointer(source_field_component);
+      }
+
+      // get index space information for PatchData
+      Box<DIM> ghostbox = distance_function_data->getGhostBox();
+      IntVector<DIM> grid_dims_int_vector = 
+        ghostbox.upper() - ghostbox.lower();
+      int* grid_dims = grid_dims_int_vector;
+
+      // call computeExtensionFields*() from toolbox to carry out
+      // computation
+      if ( DIM == 3 ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "computeExtensionFieldsUsingFMM(): "
+                  << "DIM = 3 is currently unsupported."
+                  << endl );
+        /*
+        computeExtensionFields3d(
+          distance_function,
+          ext_field
+          phi,
+          (LSMLIB_REAL*) 0,
+          (LSMLIB_REAL**) 0,
+          0,
+          grid_dims,
+          (LSMLIB_REAL*) dx);
+        */
+      } else if ( DIM == 2 ) {
+        computeExtensionFields2d(
+          distance_function,
+          extension_fields,
+          phi,
+          (LSMLIB_REAL*) 0,  // NULL mask field
+          source_fields,
+          num_extension_fields,
+          spatial_derivative_order,
+          grid_dims,
+          (LSMLIB_REAL*) dx);
+      } else if ( DIM == 1 ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "computeExtensionFieldsUsingFMM(): "
+                  << "DIM = 1 is currently unsupported."
+                  << endl );
+      } else {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "computeExtensionFieldsUsingFMM(): "
+                  << "Invalid value of DIM.  "
+                  << "Only DIM = 2 is currently supported."
+                  << endl );
+
+      } // end switch on DIM
+
+    } // end loop over Patches
+  } // end loop over PatchLevels
+
+  // free memory for extension fields and source fields
+  delete [] extension_fields; 
+  delete [] source_fields; 
+}
+
+
+/* computeUnitNormalVectorFromPhi() */
+template <int DIM>
+void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
+  Pointer< PatchHierarchy<DIM> > patch_hierarchy,
+  SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+  const int spatial_derivative_order,
+  const int normal_vector_handle,
+  const int phi_handle,
+  const UNIT_NORMAL_TYPE unit_normal_type,
+  const int phi_component)
+{
+
+  // make sure that the scratch PatchData handles have been created
+  if ( (s_compute_normal_grad_phi_handle < 0) ||
+       (s_compute_normal_grad_phi_plus_handle < 0) ||
+       (s_compute_normal_grad_phi_minus_handle < 0) ) {
+    initializeComputeUnitNormalParameters();
+  }
+  initializeComputeSpatialDerivativesParameters();
+
+  const int finest_level = patch_hierarchy->getFinestLevelNumber();
+  for ( int ln=0 ; ln<=finest_level ; ln++ ) {
+
+    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+    
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      const int pn = *pi;
+      Pointer< Patch<DIM> > patch = level->getPatch(pn);
       if ( patch.isNull() ) {
         TBOX_ERROR(  "LevelSetMethodToolbox::"
                   << "computeUnitNormalVectorFromPhi(): "
@@ -2917,9 +3621,9 @@ void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
       }
 
       // allocate scratch space for spatial derivatives
-      patch->allocatePatchData(s_compute_normal_grad_phi_handle);
-      patch->allocatePatchData(s_compute_normal_grad_phi_plus_handle);
-      patch->allocatePatchData(s_compute_normal_grad_phi_minus_handle);
+      allocateScratchPatchData(patch, s_compute_normal_grad_phi_handle);
+      allocateScratchPatchData(patch, s_compute_normal_grad_phi_plus_handle);
+      allocateScratchPatchData(patch, s_compute_normal_grad_phi_minus_handle);
 
       // get PatchData
       Pointer< CellData<DIM,LSMLIB_REAL> > normal_vector_data=
@@ -2994,7 +3698,7 @@ void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
             case 1: {
 
               // prepare scratch PatchData for computing grad(phi)
-              patch->allocatePatchData( s_D1_one_ghostcell_handle );
+              allocateScratchPatchData(patch, s_D1_one_ghostcell_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_one_ghostcell_handle );
@@ -3102,7 +3806,7 @@ void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
               } 
 
               // deallocate PatchData for computing grad(phi)
-              patch->deallocatePatchData( s_D1_one_ghostcell_handle );
+              releaseScratchPatchData(patch, s_D1_one_ghostcell_handle);
 
               break;
             }
@@ -3110,8 +3814,8 @@ void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
             case 2: {
 
               // prepare scratch PatchData for computing grad(phi)
-              patch->allocatePatchData( s_D1_two_ghostcells_handle );
-              patch->allocatePatchData( s_D2_two_ghostcells_handle );
+              allocateScratchPatchData(patch, s_D1_two_ghostcells_handle);
+              allocateScratchPatchData(patch, s_D2_two_ghostcells_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_two_ghostcells_handle );
@@ -3241,17 +3945,17 @@ void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
               } 
 
               // deallocate PatchData for computing grad(phi)
-              patch->deallocatePatchData( s_D1_two_ghostcells_handle );
-              patch->deallocatePatchData( s_D2_two_ghostcells_handle );
+              releaseScratchPatchData(patch, s_D1_two_ghostcells_handle);
+              releaseScratchPatchData(patch, s_D2_two_ghostcells_handle);
 
               break;
             }
             case 3: {
 
               // prepare scratch PatchData for computing grad(phi)
-              patch->allocatePatchData( s_D1_three_ghostcells_handle );
-              patch->allocatePatchData( s_D2_three_ghostcells_handle );
-              patch->allocatePatchData( s_D3_three_ghostcells_handle );
+              allocateScratchPatchData(patch, s_D1_three_ghostcells_handle);
+              allocateScratchPatchData(patch, s_D2_three_ghostcells_handle);
+              allocateScratchPatchData(patch, s_D3_three_ghostcells_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_three_ghostcells_handle );
@@ -3402,9 +4106,9 @@ void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
               } 
 
               // deallocate PatchData for computing grad(phi)
-              patch->deallocatePatchData( s_D1_three_ghostcells_handle );
-              patch->deallocatePatchData( s_D2_three_ghostcells_handle );
-              patch->deallocatePatchData( s_D3_three_ghostcells_handle );
+              releaseScratchPatchData(patch, s_D1_three_ghostcells_handle);
+              releaseScratchPatchData(patch, s_D2_three_ghostcells_handle);
+              releaseScratchPatchData(patch, s_D3_three_ghostcells_handle);
 
               break;
             }
@@ -3425,7 +4129,7 @@ void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
             case 5: {
 
               // prepare scratch PatchData for computing grad(phi)
-              patch->allocatePatchData( s_D1_three_ghostcells_handle );
+              allocateScratchPatchData(patch, s_D1_three_ghostcells_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_three_ghostcells_handle );
@@ -3534,7 +4238,7 @@ void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
               } 
 
               // deallocate PatchData for computing grad(phi)
-              patch->deallocatePatchData( s_D1_three_ghostcells_handle );
+              releaseScratchPatchData(patch, s_D1_three_ghostcells_handle);
 
               break;
             }
@@ -3818,9 +4522,9 @@ void LevelSetMethodToolbox<DIM>::computeUnitNormalVectorFromPhi(
       } // end switch on DIM
 
       // deallocate scratch space for spatial derivatives
-      patch->deallocatePatchData(s_compute_normal_grad_phi_handle);
-      patch->deallocatePatchData(s_compute_normal_grad_phi_plus_handle);
-      patch->deallocatePatchData(s_compute_normal_grad_phi_minus_handle);
+      releaseScratchPatchData(patch, s_compute_normal_grad_phi_handle);
+      releaseScratchPatchData(patch, s_compute_normal_grad_phi_plus_handle);
+      releaseScratchPatchData(patch, s_compute_normal_grad_phi_minus_handle);
 
     } // end loop over Patches
   } // end loop over PatchLevels
@@ -3864,9 +4568,9 @@ void LevelSetMethodToolbox<DIM>::computeSignedUnitNormalVectorFromPhi(
       }
 
       // allocate scratch space for spatial derivatives
-      patch->allocatePatchData(s_compute_normal_grad_phi_handle);
-      patch->allocatePatchData(s_compute_normal_grad_phi_plus_handle);
-      patch->allocatePatchData(s_compute_normal_grad_phi_minus_handle);
+      allocateScratchPatchData(patch, s_compute_normal_grad_phi_handle);
+      allocateScratchPatchData(patch, s_compute_normal_grad_phi_plus_handle);
+      allocateScratchPatchData(patch, s_compute_normal_grad_phi_minus_handle);
 
       // get PatchData
       Pointer< CellData<DIM,LSMLIB_REAL> > normal_vector_data=
@@ -3941,7 +4645,7 @@ void LevelSetMethodToolbox<DIM>::computeSignedUnitNormalVectorFromPhi(
             case 1: {
 
               // prepare scratch PatchData for computing grad(phi)
-              patch->allocatePatchData( s_D1_one_ghostcell_handle );
+              allocateScratchPatchData(patch, s_D1_one_ghostcell_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_one_ghostcell_handle );
@@ -4049,7 +4753,7 @@ void LevelSetMethodToolbox<DIM>::computeSignedUnitNormalVectorFromPhi(
               } 
 
               // deallocate PatchData for computing grad(phi)
-              patch->deallocatePatchData( s_D1_one_ghostcell_handle );
+              releaseScratchPatchData(patch, s_D1_one_ghostcell_handle);
 
               break;
             }
@@ -4057,8 +4761,8 @@ void LevelSetMethodToolbox<DIM>::computeSignedUnitNormalVectorFromPhi(
             case 2: {
 
               // prepare scratch PatchData for computing grad(phi)
-              patch->allocatePatchData( s_D1_two_ghostcells_handle );
-              patch->allocatePatchData( s_D2_two_ghostcells_handle );
+              allocateScratchPatchData(patch, s_D1_two_ghostcells_handle);
+              allocateScratchPatchData(patch, s_D2_two_ghostcells_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_two_ghostcells_handle );
@@ -4188,17 +4892,17 @@ void LevelSetMethodToolbox<DIM>::computeSignedUnitNormalVectorFromPhi(
               } 
 
               // deallocate PatchData for computing grad(phi)
-              patch->deallocatePatchData( s_D1_two_ghostcells_handle );
-              patch->deallocatePatchData( s_D2_two_ghostcells_handle );
+              releaseScratchPatchData(patch, s_D1_two_ghostcells_handle);
+              releaseScratchPatchData(patch, s_D2_two_ghostcells_handle);
 
               break;
             }
             case 3: {
 
               // prepare scratch PatchData for computing grad(phi)
-              patch->allocatePatchData( s_D1_three_ghostcells_handle );
-              patch->allocatePatchData( s_D2_three_ghostcells_handle );
-              patch->allocatePatchData( s_D3_three_ghostcells_handle );
+              allocateScratchPatchData(patch, s_D1_three_ghostcells_handle);
+              allocateScratchPatchData(patch, s_D2_three_ghostcells_handle);
+              allocateScratchPatchData(patch, s_D3_three_ghostcells_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_three_ghostcells_handle );
@@ -4349,9 +5053,9 @@ void LevelSetMethodToolbox<DIM>::computeSignedUnitNormalVectorFromPhi(
               } 
 
               // deallocate PatchData for computing grad(phi)
-              patch->deallocatePatchData( s_D1_three_ghostcells_handle );
-              patch->deallocatePatchData( s_D2_three_ghostcells_handle );
-              patch->deallocatePatchData( s_D3_three_ghostcells_handle );
+              releaseScratchPatchData(patch, s_D1_three_ghostcells_handle);
+              releaseScratchPatchData(patch, s_D2_three_ghostcells_handle);
+              releaseScratchPatchData(patch, s_D3_three_ghostcells_handle);
 
               break;
             }
@@ -4372,7 +5076,7 @@ void LevelSetMethodToolbox<DIM>::computeSignedUnitNormalVectorFromPhi(
             case 5: {
 
               // prepare scratch PatchData for computing grad(phi)
-              patch->allocatePatchData( s_D1_three_ghostcells_handle );
+              allocateScratchPatchData(patch, s_D1_three_ghostcells_handle);
 
               Pointer< CellData<DIM,LSMLIB_REAL> > D1_data =
                 patch->getPatchData( s_D1_three_ghostcells_handle );
@@ -4481,7 +5185,7 @@ void LevelSetMethodToolbox<DIM>::computeSignedUnitNormalVectorFromPhi(
               } 
 
               // deallocate PatchData for computing grad(phi)
-              patch->deallocatePatchData( s_D1_three_ghostcells_handle );
+              releaseScratchPatchData(patch, s_D1_three_ghostcells_handle);
 
               break;
             }
@@ -4783,9 +5487,9 @@ void LevelSetMethodToolbox<DIM>::computeSignedUnitNormalVectorFromPhi(
       } // end switch on DIM
 
       // deallocate scratch space for spatial derivatives
-      patch->deallocatePatchData(s_compute_normal_grad_phi_handle);
-      patch->deallocatePatchData(s_compute_normal_grad_phi_plus_handle);
-      patch->deallocatePatchData(s_compute_normal_grad_phi_minus_handle);
+      releaseScratchPatchData(patch, s_compute_normal_grad_phi_handle);
+      releaseScratchPatchData(patch, s_compute_normal_grad_phi_plus_handle);
+      releaseScratchPatchData(patch, s_compute_normal_grad_phi_minus_handle);
 
     } // end loop over Patches
   } // end loop over PatchLevels
@@ -5082,7 +5786,8 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeVolumeOfRegionDefinedByZeroLevelS
   const int control_volume_handle,
   const int region_indicator,
   const int phi_component,
-  const int heaviside_width)
+  const int heaviside_width,
+  const bool use_global_reduction)
 {
   LSMLIB_REAL volume = 0.0;
 
@@ -5361,7 +6066,11 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeVolumeOfRegionDefinedByZeroLevelS
 
   } // end if statement on (region_indicator > 0)
 
-  return tbox::MPI::sumReduction(volume);
+  if (use_global_reduction) {
+    volume = tbox::MPI::sumReduction(volume);
+  }
+
+  return volume;
 }
 
 
@@ -5373,7 +6082,8 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeVolumeOfZeroLevelSet(
   const int grad_phi_handle,
   const int control_volume_handle,
   const int phi_component,
-  const int delta_width)
+  const int delta_width,
+  const bool use_global_reduction)
 {
   LSMLIB_REAL volume = 0.0;
 
@@ -5541,7 +6251,11 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeVolumeOfZeroLevelSet(
     } // end loop over patches in level
   } // end loop over levels in hierarchy
 
-  return tbox::MPI::sumReduction(volume);
+  if (use_global_reduction) {
+    volume = tbox::MPI::sumReduction(volume);
+  }
+
+  return volume;
 }
 
 
@@ -5555,7 +6269,8 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeVolumeIntegral(
   const int region_indicator,
   const int F_component,
   const int phi_component,
-  const int heaviside_width)
+  const int heaviside_width,
+  const bool use_global_reduction)
 {
   LSMLIB_REAL integral_F = 0.0;
 
@@ -5878,7 +6593,11 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeVolumeIntegral(
 
   } // end if statement on (region_indicator > 0)
 
-  return tbox::MPI::sumReduction(integral_F);
+  if (use_global_reduction) {
+    integral_F = tbox::MPI::sumReduction(integral_F);
+  }
+
+  return integral_F;
 }
 
 
@@ -5892,7 +6611,8 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeSurfaceIntegral(
   const int control_volume_handle,
   const int F_component,
   const int phi_component,
-  const int delta_width)
+  const int delta_width,
+  const bool use_global_reduction)
 {
   LSMLIB_REAL integral_F = 0.0;
 
@@ -6082,7 +6802,11 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeSurfaceIntegral(
     } // end loop over patches in level
   } // end loop over levels in hierarchy
 
-  return tbox::MPI::sumReduction(integral_F);
+  if (use_global_reduction) {
+    integral_F = tbox::MPI::sumReduction(integral_F);
+  }
+
+  return integral_F;
 }
 
 
@@ -6092,7 +6816,10 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableAdvectionDt(
   Pointer< PatchHierarchy<DIM> > patch_hierarchy,
   const int velocity_handle,
   const int control_volume_handle,
-  const LSMLIB_REAL cfl_number)
+  const LSMLIB_REAL cfl_number,
+  const bool use_global_reduction,
+  const int coarsest_level,
+  const int finest_level)
 {
   Pointer< CartesianGridGeometry<DIM> > grid_geometry = 
     patch_hierarchy->getGridGeometry();
@@ -6105,10 +6832,21 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableAdvectionDt(
 #endif
   LSMLIB_REAL max_advection_dt = LSMLIB_REAL_MAX;
 
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "computeStableAdvectionDt(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl );
+  }
+
   // loop over PatchHierarchy and compute the maximum stable 
   // advection dt by calling Fortran routines
-  const int num_levels = patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  const int finest_ln = (finest_level < 0) ?
+    patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
     const IntVector<DIM> ratio_to_coarsest = level->getRatio();
@@ -6118,6 +6856,9 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableAdvectionDt(
       dx[dir] = dx_level0[dir]/ratio_to_coarsest[dir];
     }
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -6128,6 +6869,15 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableAdvectionDt(
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(min:max_advection_dt)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       LSMLIB_REAL max_advection_dt_on_patch = -1;  // bogus value overwritten
                                               // by Fortran subroutine
@@ -6205,7 +6955,7 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableAdvectionDt(
           &dx[0],
           &dx[1],
           &cfl_number);
-      } else if ( DIM == 1 ) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
         LSM1D_COMPUTE_STABLE_ADVECTION_DT_CONTROL_VOLUME(
           &max_advection_dt_on_patch,
           vel_data->getPointer(0),
@@ -6219,22 +6969,20 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableAdvectionDt(
           &vel_box_upper[0],
           &dx[0],
           &cfl_number);
-      } else { // invalid DIM value
-        TBOX_ERROR(  "LevelSetMethodToolbox::" 
-                  << "computeStableAdvectionDt(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl );
       } // end switch over dimension (DIM) of level set method calculation
 
       // update max_advection_dt
       if (max_advection_dt_on_patch < max_advection_dt)
         max_advection_dt = max_advection_dt_on_patch;
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
   } // end loop over levels in hierarchy
 
-  return tbox::MPI::minReduction(max_advection_dt);
+  if (use_global_reduction) {
+    max_advection_dt = tbox::MPI::minReduction(max_advection_dt);
+  }
+
+  return max_advection_dt;
 }
 
 
@@ -6246,7 +6994,10 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableNormalVelocityDt(
   const int grad_phi_plus_handle,
   const int grad_phi_minus_handle,
   const int control_volume_handle,
-  const LSMLIB_REAL cfl_number)
+  const LSMLIB_REAL cfl_number,
+  const bool use_global_reduction,
+  const int coarsest_level,
+  const int finest_level)
 {
   Pointer< CartesianGridGeometry<DIM> > grid_geometry = 
     patch_hierarchy->getGridGeometry();
@@ -6259,10 +7010,21 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableNormalVelocityDt(
 #endif
   LSMLIB_REAL max_normal_vel_dt = LSMLIB_REAL_MAX;
 
+  // NOTE: errors cannot be raised from inside of the threaded patch 
+  //       loop, so the dimension is checked before entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "computeStableNormalVelocityDt(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl );
+  }
+
   // loop over PatchHierarchy and compute the maximum stable 
   // advection dt by calling Fortran routines
-  const int num_levels = patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  const int finest_ln = (finest_level < 0) ?
+    patch_hierarchy->getFinestLevelNumber() : finest_level;
+  for ( int ln=coarsest_level ; ln<=finest_ln ; ln++ ) {
 
     Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
     const IntVector<DIM> ratio_to_coarsest = level->getRatio();
@@ -6272,6 +7034,9 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableNormalVelocityDt(
       dx[dir] = dx_level0[dir]/ratio_to_coarsest[dir];
     }
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    vector< Pointer< Patch<DIM> > > patches;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -6282,6 +7047,15 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableNormalVelocityDt(
                   << "Cannot find patch. Null patch pointer."
                   << endl);
       }
+      patches.push_back(patch);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(min:max_normal_vel_dt)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      Pointer< Patch<DIM> > patch = patches[k];
 
       LSMLIB_REAL max_normal_vel_dt_on_patch = -1;  // bogus value overwritten
                                                // by Fortran subroutine
@@ -6401,7 +7175,7 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableNormalVelocityDt(
           &dx[0],
           &dx[1],
           &cfl_number);
-      } else if ( DIM == 1 ) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
         LSM1D_COMPUTE_STABLE_NORMAL_VEL_DT_CONTROL_VOLUME(
           &max_normal_vel_dt_on_patch,
           vel_data->getPointer(),
@@ -6421,384 +7195,1558 @@ LSMLIB_REAL LevelSetMethodToolbox<DIM>::computeStableNormalVelocityDt(
           &vel_box_upper[0],
           &dx[0],
           &cfl_number);
-      } else { // invalid DIM value
-        TBOX_ERROR(  "LevelSetMethodToolbox::" 
-                  << "computeStableNormalVelocityDt(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl );
       } // end switch over dimension (DIM) of level set method calculation
 
-      // update max_normal_vel_dt
-      if (max_normal_vel_dt_on_patch < max_normal_vel_dt)
-        max_normal_vel_dt = max_normal_vel_dt_on_patch;
+      // update max_normal_vel_dt
+      if (max_normal_vel_dt_on_patch < max_normal_vel_dt)
+        max_normal_vel_dt = max_normal_vel_dt_on_patch;
+
+    } // end threaded loop over patches in level
+  } // end loop over levels in hierarchy
+
+  if (use_global_reduction) {
+    max_normal_vel_dt = tbox::MPI::minReduction(max_normal_vel_dt);
+  }
+
+  return max_normal_vel_dt;
+}
+
+
+/* maxNormOfDifference() */
+template <int DIM> 
+LSMLIB_REAL LevelSetMethodToolbox<DIM>::maxNormOfDifference(
+  Pointer< PatchHierarchy<DIM> > patch_hierarchy,
+  const int field1_handle,
+  const int field2_handle,
+  const int control_volume_handle,
+  const int field1_component,
+  const int field2_component,
+  const bool use_global_reduction)
+{
+  LSMLIB_REAL max_norm_diff = 0;
+
+  // loop over PatchHierarchy and compute the max norm of (field1-field2)
+  // by calling Fortran routines
+  const int num_levels = patch_hierarchy->getNumberLevels();
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+
+    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+    
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      const int pn = *pi;
+      Pointer< Patch<DIM> > patch = level->getPatch(pn);
+      if ( patch.isNull() ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::" 
+                  << "maxNormOfDifference(): "
+                  << "Cannot find patch. Null patch pointer."
+                  << endl);
+      }
+
+      // compute max norm of (field1-field2) on the current patch
+      LSMLIB_REAL max_norm_diff_on_patch = maxNormOfDifference(
+        patch,
+        field1_handle,
+        field2_handle,
+        control_volume_handle,
+        field1_component,
+        field2_component);
+
+      if (max_norm_diff < max_norm_diff_on_patch)
+        max_norm_diff = max_norm_diff_on_patch; 
+
+    } // end loop over patches in level
+  } // end loop over levels in hierarchy
+
+  if (use_global_reduction) {
+    max_norm_diff = tbox::MPI::maxReduction(max_norm_diff);
+  }
+
+  return max_norm_diff;
+}
+
+
+/* maxNormOfDifference() */
+template <int DIM> 
+LSMLIB_REAL LevelSetMethodToolbox<DIM>::maxNormOfDifference(
+  Pointer< Patch<DIM> > patch,
+  const int field1_handle,
+  const int field2_handle,
+  const int control_volume_handle,
+  const int field1_component,
+  const int field2_component)
+{
+      // get pointers to data and index space ranges
+      Pointer< CellData<DIM,LSMLIB_REAL> > field1_data =
+        patch->getPatchData( field1_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > field2_data =
+        patch->getPatchData( field2_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > control_volume_data =
+        patch->getPatchData( control_volume_handle );
+
+      Box<DIM> field1_ghostbox = field1_data->getGhostBox();
+      const IntVector<DIM> field1_ghostbox_lower = field1_ghostbox.lower();
+      const IntVector<DIM> field1_ghostbox_upper = field1_ghostbox.upper();
+
+      Box<DIM> field2_ghostbox = field2_data->getGhostBox();
+      const IntVector<DIM> field2_ghostbox_lower = field2_ghostbox.lower();
+      const IntVector<DIM> field2_ghostbox_upper = field2_ghostbox.upper();
+
+      Box<DIM> control_volume_ghostbox = 
+        control_volume_data->getGhostBox();
+      const IntVector<DIM> control_volume_ghostbox_lower = 
+        control_volume_ghostbox.lower();
+      const IntVector<DIM> control_volume_ghostbox_upper = 
+        control_volume_ghostbox.upper();
+
+      // interior box
+      Box<DIM> interior_box = field1_data->getBox();
+      const IntVector<DIM> interior_box_lower = interior_box.lower();
+      const IntVector<DIM> interior_box_upper = interior_box.upper();
+
+      LSMLIB_REAL* field1 = field1_data->getPointer(field1_component);
+      LSMLIB_REAL* field2 = field2_data->getPointer(field2_component);
+      LSMLIB_REAL* control_volume = control_volume_data->getPointer();
+      int control_volume_sgn = 1;
+
+      LSMLIB_REAL max_norm_diff_on_patch = 0.0;
+
+      if ( DIM == 3 ) {
+        LSM3D_MAX_NORM_DIFF_CONTROL_VOLUME(
+          &max_norm_diff_on_patch,
+          field1,
+          &field1_ghostbox_lower[0],
+          &field1_ghostbox_upper[0],
+          &field1_ghostbox_lower[1],
+          &field1_ghostbox_upper[1],
+          &field1_ghostbox_lower[2],
+          &field1_ghostbox_upper[2],
+          field2,
+          &field2_ghostbox_lower[0],
+          &field2_ghostbox_upper[0],
+          &field2_ghostbox_lower[1],
+          &field2_ghostbox_upper[1],
+          &field2_ghostbox_lower[2],
+          &field2_ghostbox_upper[2],
+          control_volume,
+          &control_volume_ghostbox_lower[0],
+          &control_volume_ghostbox_upper[0],
+          &control_volume_ghostbox_lower[1],
+          &control_volume_ghostbox_upper[1],
+          &control_volume_ghostbox_lower[2],
+          &control_volume_ghostbox_upper[2],
+          &control_volume_sgn,
+          &interior_box_lower[0],
+          &interior_box_upper[0],
+          &interior_box_lower[1],
+          &interior_box_upper[1],
+          &interior_box_lower[2],
+          &interior_box_upper[2]);
+
+      } else if ( DIM == 2 ) {
+        LSM2D_MAX_NORM_DIFF_CONTROL_VOLUME(
+          &max_norm_diff_on_patch,
+          field1,
+          &field1_ghostbox_lower[0],
+          &field1_ghostbox_upper[0],
+          &field1_ghostbox_lower[1],
+          &field1_ghostbox_upper[1],
+          field2,
+          &field2_ghostbox_lower[0],
+          &field2_ghostbox_upper[0],
+          &field2_ghostbox_lower[1],
+          &field2_ghostbox_upper[1],
+          control_volume,
+          &control_volume_ghostbox_lower[0],
+          &control_volume_ghostbox_upper[0],
+          &control_volume_ghostbox_lower[1],
+          &control_volume_ghostbox_upper[1],
+          &control_volume_sgn,
+          &interior_box_lower[0],
+          &interior_box_upper[0],
+          &interior_box_lower[1],
+          &interior_box_upper[1]);
+
+      } else if ( DIM == 1 ) {
+        LSM1D_MAX_NORM_DIFF_CONTROL_VOLUME(
+          &max_norm_diff_on_patch,
+          field1,
+          &field1_ghostbox_lower[0],
+          &field1_ghostbox_upper[0],
+          field2,
+          &field2_ghostbox_lower[0],
+          &field2_ghostbox_upper[0],
+          control_volume,
+          &control_volume_ghostbox_lower[0],
+          &control_volume_ghostbox_upper[0],
+          &control_volume_sgn,
+          &interior_box_lower[0],
+          &interior_box_upper[0]);
+
+      } else {  // Unsupported dimension
+        TBOX_ERROR(  "LevelSetMethodToolbox::" 
+                  << "maxNormOfDifference(): "
+                  << "Invalid value of DIM.  "
+                  << "Only DIM = 1, 2, and 3 are supported."
+                  << endl);
+      }
+
+      return max_norm_diff_on_patch;
+}
+
+
+/* computeGradPhiDeviationSums() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::computeGradPhiDeviationSums(
+  LSMLIB_REAL& deviation_sum,
+  LSMLIB_REAL& num_cells_in_band,
+  Pointer< Patch<DIM> > patch,
+  const int phi_handle,
+  const int control_volume_handle,
+  const LSMLIB_REAL band_width,
+  const int phi_component)
+{
+  // get dx
+  Pointer< CartesianPatchGeometry<DIM> > patch_geom =
+    patch->getPatchGeometry();
+#ifdef LSMLIB_DOUBLE_PRECISION
+  const double* dx = patch_geom->getDx();
+#else
+  const double* dx_double = patch_geom->getDx();
+  float dx[DIM]; 
+  for (int i = 0; i < DIM; i++) dx[i] = (float) dx_double[i];
+#endif
+
+  // get pointers to data and index space ranges
+  Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
+    patch->getPatchData( phi_handle );
+  Pointer< CellData<DIM,LSMLIB_REAL> > control_volume_data =
+    patch->getPatchData( control_volume_handle );
+
+  Box<DIM> phi_ghostbox = phi_data->getGhostBox();
+  const IntVector<DIM> phi_ghostbox_lower = phi_ghostbox.lower();
+  const IntVector<DIM> phi_ghostbox_upper = phi_ghostbox.upper();
+
+  Box<DIM> control_volume_ghostbox = 
+    control_volume_data->getGhostBox();
+  const IntVector<DIM> control_volume_ghostbox_lower = 
+    control_volume_ghostbox.lower();
+  const IntVector<DIM> control_volume_ghostbox_upper = 
+    control_volume_ghostbox.upper();
+
+  // interior box shrunk by one cell so that the central differences
+  // never reference (possibly stale) ghost cells
+  Box<DIM> interior_box = phi_data->getBox();
+  interior_box.grow(IntVector<DIM>(-1));
+  const IntVector<DIM> interior_box_lower = interior_box.lower();
+  const IntVector<DIM> interior_box_upper = interior_box.upper();
+
+  LSMLIB_REAL* phi = phi_data->getPointer(phi_component);
+  LSMLIB_REAL* control_volume = control_volume_data->getPointer();
+  int control_volume_sgn = 1;
+
+  deviation_sum = 0.0;
+  num_cells_in_band = 0.0;
+  if ( interior_box.empty() ) return;
+
+  if ( DIM == 3 ) {
+    LSM3D_GRAD_PHI_DEVIATION_CONTROL_VOLUME(
+      &deviation_sum,
+      &num_cells_in_band,
+      phi,
+      &phi_ghostbox_lower[0],
+      &phi_ghostbox_upper[0],
+      &phi_ghostbox_lower[1],
+      &phi_ghostbox_upper[1],
+      &phi_ghostbox_lower[2],
+      &phi_ghostbox_upper[2],
+      control_volume,
+      &control_volume_ghostbox_lower[0],
+      &control_volume_ghostbox_upper[0],
+      &control_volume_ghostbox_lower[1],
+      &control_volume_ghostbox_upper[1],
+      &control_volume_ghostbox_lower[2],
+      &control_volume_ghostbox_upper[2],
+      &control_volume_sgn,
+      &band_width,
+      &interior_box_lower[0],
+      &interior_box_upper[0],
+      &interior_box_lower[1],
+      &interior_box_upper[1],
+      &interior_box_lower[2],
+      &interior_box_upper[2],
+      &dx[0],
+      &dx[1],
+      &dx[2]);
+
+  } else if ( DIM == 2 ) {
+    LSM2D_GRAD_PHI_DEVIATION_CONTROL_VOLUME(
+      &deviation_sum,
+      &num_cells_in_band,
+      phi,
+      &phi_ghostbox_lower[0],
+      &phi_ghostbox_upper[0],
+      &phi_ghostbox_lower[1],
+      &phi_ghostbox_upper[1],
+      control_volume,
+      &control_volume_ghostbox_lower[0],
+      &control_volume_ghostbox_upper[0],
+      &control_volume_ghostbox_lower[1],
+      &control_volume_ghostbox_upper[1],
+      &control_volume_sgn,
+      &band_width,
+      &interior_box_lower[0],
+      &interior_box_upper[0],
+      &interior_box_lower[1],
+      &interior_box_upper[1],
+      &dx[0],
+      &dx[1]);
+
+  } else if ( DIM == 1 ) {
+    LSM1D_GRAD_PHI_DEVIATION_CONTROL_VOLUME(
+      &deviation_sum,
+      &num_cells_in_band,
+      phi,
+      &phi_ghostbox_lower[0],
+      &phi_ghostbox_upper[0],
+      control_volume,
+      &control_volume_ghostbox_lower[0],
+      &control_volume_ghostbox_upper[0],
+      &control_volume_sgn,
+      &band_width,
+      &interior_box_lower[0],
+      &interior_box_upper[0],
+      &dx[0]);
+
+  } else {  // Unsupported dimension
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "computeGradPhiDeviationSums(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
+}
+
+
+/* computeControlVolumes() */
+template <int DIM>
+void LevelSetMethodToolbox<DIM>::computeControlVolumes(
+  Pointer< PatchHierarchy<DIM> > patch_hierarchy,
+  int control_volume_handle)
+{
+  int finest_ln = patch_hierarchy->getFinestLevelNumber();
+  int ln;
+  for ( ln=finest_ln; ln >= 0; --ln ) {
+
+    /*
+     * On every level, first assign cell volume to vector weight.
+     */
+
+    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) {
+      const int pn = *pi;
+      Pointer< Patch<DIM> > patch = level->getPatch(pn);
+      Pointer< CartesianPatchGeometry<DIM> > patch_geometry =
+        patch->getPatchGeometry();
+#ifdef LSMLIB_DOUBLE_PRECISION
+      const double* dx = patch_geometry->getDx();
+#else
+      const double* dx_double = patch_geometry->getDx();
+      float dx[DIM];
+      for (int i = 0; i < DIM; i++) dx[i] = (float) dx_double[i];
+#endif
+      LSMLIB_REAL cell_vol = dx[0];
+      for (int i = 1; i<DIM; i++) {
+        cell_vol *= dx[i];
+      } 
+
+      Pointer< CellData<DIM,LSMLIB_REAL> > cv_data =
+        patch->getPatchData(control_volume_handle);
+      if ( !cv_data ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "computeControlVolumes(): "
+                  << "control_volume_handle must refer to a "
+                  << "pdat_CellVariable"
+                  << endl );
+      }
+      cv_data->fillAll(cell_vol);
+    }
+
+    /*
+     * On all but the finest level, assign 0 to vector
+     * weight to cells covered by finer cells.
+     */
+
+    if (ln < finest_ln) {
+
+      /*
+       * First get the boxes that describe index space of the next finer
+       * level and coarsen them to describe corresponding index space
+       * at this level.
+       */
+
+      Pointer< PatchLevel<DIM> > next_finer_level
+            = patch_hierarchy->getPatchLevel(ln+1);
+      BoxArray<DIM> coarsened_boxes = next_finer_level->getBoxes();
+      IntVector<DIM> coarsen_ratio = next_finer_level->getRatio();
+      coarsen_ratio /= level->getRatio();
+      coarsened_boxes.coarsen(coarsen_ratio);
+
+      /*
+       * Then set vector weight to 0 wherever there is
+       * a nonempty intersection with the next finer level.
+       * Note that all assignments are local.
+       */
+
+      typename PatchLevel<DIM>::Iterator pi;
+      for (pi.initialize(level); pi; pi++) {
+        const int pn = *pi;
+        Pointer< Patch<DIM> > patch = level->getPatch(pn);
+        for ( int i = 0; i < coarsened_boxes.getNumberOfBoxes(); i++ ) {
+
+          Box<DIM> coarse_box = coarsened_boxes(i);
+          Box<DIM> intersection = coarse_box*(patch->getBox());
+          if ( !intersection.empty() ) {
+            Pointer< CellData<DIM, LSMLIB_REAL> > cv_data =
+            patch->getPatchData(control_volume_handle);
+            cv_data->fillAll(0.0, intersection);
+
+          }  // assignment only in non-empty intersection
+        }  // loop over coarsened boxes from finer level
+      }  // loop over patches in level
+    }  // all levels except finest
+  }  // loop over levels
+}
+
+
+/* copySAMRAIData() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::copySAMRAIData(
+  Pointer< PatchHierarchy<DIM> > patch_hierarchy,
+  const int dst_handle,
+  const int src_handle,
+  const int dst_component,
+  const int src_component)
+{
+  // loop over PatchHierarchy and copy data in Patch interiors
+  const int num_levels = patch_hierarchy->getNumberLevels();
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+
+    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+    
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      const int pn = *pi;
+      Pointer< Patch<DIM> > patch = level->getPatch(pn);
+      if ( patch.isNull() ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "copySAMRAIData(): "
+                  << "Cannot find patch. Null patch pointer."
+                  << endl);
+      }
+
+      // get pointers to data and index space ranges
+      Pointer< CellData<DIM,LSMLIB_REAL> > dst_data =
+        patch->getPatchData( dst_handle );
+      Pointer< CellData<DIM,LSMLIB_REAL> > src_data =
+        patch->getPatchData( src_handle );
+
+      Box<DIM> dst_ghostbox = dst_data->getGhostBox();
+      const IntVector<DIM> dst_ghostbox_lower = dst_ghostbox.lower();
+      const IntVector<DIM> dst_ghostbox_upper = dst_ghostbox.upper();
+
+      Box<DIM> src_ghostbox = src_data->getGhostBox();
+      const IntVector<DIM> src_ghostbox_lower = src_ghostbox.lower();
+      const IntVector<DIM> src_ghostbox_upper = src_ghostbox.upper();
+
+      Box<DIM> fillbox = dst_data->getBox();
+      const IntVector<DIM> fillbox_lower = fillbox.lower();
+      const IntVector<DIM> fillbox_upper = fillbox.upper();
+
+      LSMLIB_REAL* dst = dst_data->getPointer(dst_component);
+      LSMLIB_REAL* src = src_data->getPointer(src_component);
+
+      if (DIM == 3) {
+
+        LSM3D_SAMRAI_UTILITIES_COPY_DATA(
+          dst,
+          &dst_ghostbox_lower[0],
+          &dst_ghostbox_upper[0],
+          &dst_ghostbox_lower[1],
+          &dst_ghostbox_upper[1],
+          &dst_ghostbox_lower[2],
+          &dst_ghostbox_upper[2],
+          src,
+          &src_ghostbox_lower[0],
+          &src_ghostbox_upper[0],
+          &src_ghostbox_lower[1],
+          &src_ghostbox_upper[1],
+          &src_ghostbox_lower[2],
+          &src_ghostbox_upper[2],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &fillbox_lower[1],
+          &fillbox_upper[1],
+          &fillbox_lower[2],
+          &fillbox_upper[2]);
+
+      } else if (DIM == 2) {
+
+        LSM2D_SAMRAI_UTILITIES_COPY_DATA(
+          dst,
+          &dst_ghostbox_lower[0],
+          &dst_ghostbox_upper[0],
+          &dst_ghostbox_lower[1],
+          &dst_ghostbox_upper[1],
+          src,
+          &src_ghostbox_lower[0],
+          &src_ghostbox_upper[0],
+          &src_ghostbox_lower[1],
+          &src_ghostbox_upper[1],
+          &fillbox_lower[0],
+          &fillbox_upper[0],
+          &fillbox_lower[1],
+          &fillbox_upper[1]);
+
+      } else if (DIM == 1) {
+
+        LSM1D_SAMRAI_UTILITIES_COPY_DATA(
+          dst,
+          &dst_ghostbox_lower[0],
+          &dst_ghostbox_upper[0],
+          src,
+          &src_ghostbox_lower[0],
+          &src_ghostbox_upper[0],
+          &fillbox_lower[0],
+          &fillbox_upper[0]);
+
+      } else {  // Unsupported dimension
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "copySAMRAIData(): "
+                  << "Invalid value of DIM.  "
+                  << "Only DIM = 1, 2, and 3 are supported."
+                  << endl);
+      }
+
+    }  // end loop over Patches
+  }  // end loop over PatchLevels
+}
+
+
+/* identifiers at the start of narrow band snapshot and index files */
+#define LSM_SNAPSHOT_MAGIC       "LSMLIB\0P"
+#define LSM_SNAPSHOT_INDEX_MAGIC "LSMLIB\0I"
+#define LSM_SNAPSHOT_MAGIC_SIZE  8
+
+/*
+ * narrowBandSnapshotFileName() returns the name of the narrow band
+ * snapshot file written by the processor with the specified rank.
+ */
+static string narrowBandSnapshotFileName(
+  const string& file_name,
+  const int rank)
+{
+  char suffix[16];
+  sprintf(suffix, ".%05d", rank);
+  return file_name + suffix;
+}
+
+/*
+ * narrowBandSnapshotIndexFileName() returns the name of the index file
+ * that records the ghost box and processor of every stored patch.
+ */
+static string narrowBandSnapshotIndexFileName(const string& file_name)
+{
+  return file_name + ".index";
+}
+
+/*
+ * openNarrowBandSnapshotFile() opens a snapshot file for reading.
+ * Compressed files are named with the suffix added by the compressor.
+ */
+static LSM_FILE* openNarrowBandSnapshotFile(const string& proc_file_name)
+{
+  LSM_FILE *fp = openLSMFileForReading(
+    const_cast<char*>(proc_file_name.c_str()));
+  if (!fp) {
+    fp = openLSMFileForReading(
+      const_cast<char*>((proc_file_name + ".gz").c_str()));
+  }
+  if (!fp) {
+    fp = openLSMFileForReading(
+      const_cast<char*>((proc_file_name + ".bz2").c_str()));
+  }
+  return fp;
+}
+
+/*
+ * copySnapshotGhostData() copies the data on the fill box from src to
+ * the cells of dst that have not been set (i.e. cells with the value 
+ * uncovered_value).  Boxes are specified by their lower and upper 
+ * corners in 3D (unused dimensions have lower = upper = 0).
+ */
+static void copySnapshotGhostData(
+  LSMLIB_REAL* dst,
+  const int* dst_lo,
+  const int* dst_hi,
+  const LSMLIB_REAL* src,
+  const int* src_lo,
+  const int* src_hi,
+  const int* fill_lo,
+  const int* fill_hi,
+  const LSMLIB_REAL uncovered_value)
+{
+  const int dst_nx = dst_hi[0] - dst_lo[0] + 1;
+  const int dst_ny = dst_hi[1] - dst_lo[1] + 1;
+  const int src_nx = src_hi[0] - src_lo[0] + 1;
+  const int src_ny = src_hi[1] - src_lo[1] + 1;
+
+  for (int k = fill_lo[2]; k <= fill_hi[2]; k++) {
+    for (int j = fill_lo[1]; j <= fill_hi[1]; j++) {
+      for (int i = fill_lo[0]; i <= fill_hi[0]; i++) {
+        const int dst_idx = (i-dst_lo[0]) 
+          + dst_nx*((j-dst_lo[1]) + dst_ny*(k-dst_lo[2]));
+        const int src_idx = (i-src_lo[0]) 
+          + src_nx*((j-src_lo[1]) + src_ny*(k-src_lo[2]));
+        if (dst[dst_idx] == uncovered_value) dst[dst_idx] = src[src_idx];
+      }
+    }
+  }
+}
+
+/*
+ * fillUncoveredCells() sets the cells of data that have not been set
+ * (i.e. cells with the value uncovered_value) to +/- threshold.  The
+ * sign is propagated from neighboring cells that have been set, so
+ * the sign of phi is preserved in regions (e.g. on levels that did 
+ * not exist when the snapshot was written) that are not covered by 
+ * the snapshot.  If no cells have been set, all cells are set to 
+ * +threshold.
+ */
+static void fillUncoveredCells(
+  LSMLIB_REAL* data,
+  const int* lo,
+  const int* hi,
+  const LSMLIB_REAL uncovered_value,
+  const LSMLIB_REAL threshold)
+{
+  int n[3];
+  for (int dim = 0; dim < 3; dim++) n[dim] = hi[dim] - lo[dim] + 1;
+  const int stride[3] = {1, n[0], n[0]*n[1]};
+  const int num_cells = n[0]*n[1]*n[2];
+
+  // the sign is propagated one layer of cells per sweep, so each cell 
+  // takes the sign of the nearest cell that has been set
+  vector<LSMLIB_REAL> prev_data;
+  bool changed = true;
+  bool uncovered = true;
+  while (changed && uncovered) {
+    changed = false;
+    uncovered = false;
+    prev_data.assign(data, data + num_cells);
+    for (int idx = 0; idx < num_cells; idx++) {
+      if (data[idx] != uncovered_value) continue;
+
+      // propagate the sign of the first neighbor that has been set
+      int ijk[3] = {idx % n[0], (idx/n[0]) % n[1], idx/(n[0]*n[1])};
+      for (int dim = 0; (dim < 3) && (data[idx] == uncovered_value); 
+           dim++) {
+        for (int offset = -1; offset <= 1; offset += 2) {
+          const int nbr = ijk[dim] + offset;
+          if ( (nbr < 0) || (nbr >= n[dim]) ) continue;
+          const LSMLIB_REAL nbr_value = prev_data[idx + offset*stride[dim]];
+          if (nbr_value != uncovered_value) {
+            data[idx] = (nbr_value < 0) ? -threshold : threshold;
+            changed = true;
+            break;
+          }
+        }
+      }
+      if (data[idx] == uncovered_value) uncovered = true;
+    }
+  }
+
+  if (uncovered) {
+    for (int idx = 0; idx < num_cells; idx++) {
+      if (data[idx] == uncovered_value) data[idx] = threshold;
+    }
+  }
+}
+
+
+/* writeNarrowBandSnapshot() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::writeNarrowBandSnapshot(
+  Pointer< PatchHierarchy<DIM> > patch_hierarchy,
+  const int phi_handle,
+  const LSMLIB_REAL threshold,
+  const string& file_name,
+  const int component,
+  const int zip_status)
+{
+  const int num_levels = patch_hierarchy->getNumberLevels();
+
+  /*
+   * write index file (processor 0 only).  The index records the 
+   * ghost box and processor of every patch so that readers only need
+   * to open the files containing data for their local patches.
+   */
+  if (tbox::MPI::getRank() == 0) {
+    const string index_file_name = 
+      narrowBandSnapshotIndexFileName(file_name);
+    LSM_FILE *fp = openLSMFileForWriting(
+      const_cast<char*>(index_file_name.c_str()), NO_ZIP);
+    if (!fp) {
+      TBOX_ERROR(  "LevelSetMethodToolbox::"
+                << "writeNarrowBandSnapshot(): "
+                << "Unable to open file " << index_file_name << "."
+                << endl);
+    }
+
+    VariableDatabase<DIM>* var_db = VariableDatabase<DIM>::getDatabase();
+    const IntVector<DIM> ghost_width = 
+      var_db->getPatchDescriptor()->getPatchDataFactory(phi_handle)
+        ->getGhostCellWidth();
+    int num_entries = 0;
+    for ( int ln=0 ; ln < num_levels; ln++ ) {
+      num_entries += patch_hierarchy->getPatchLevel(ln)->getNumberOfPatches();
+    }
+
+    int header[4];
+    header[0] = sizeof(LSMLIB_REAL);
+    header[1] = DIM;
+    header[2] = tbox::MPI::getNodes();
+    header[3] = num_entries;
+    int status = 
+      (writeLSMFile(LSM_SNAPSHOT_INDEX_MAGIC, 1, LSM_SNAPSHOT_MAGIC_SIZE, fp)
+       != LSM_SNAPSHOT_MAGIC_SIZE) ||
+      (writeLSMFile(header, sizeof(int), 4, fp) != 4) ||
+      (writeLSMFile(&threshold, sizeof(LSMLIB_REAL), 1, fp) != 1);
+
+    for ( int ln=0 ; (ln < num_levels) && !status; ln++ ) {
+      Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+      const BoxArray<DIM>& boxes = level->getBoxes();
+      const int num_patches = level->getNumberOfPatches();
+      for (int pn = 0; (pn < num_patches) && !status; pn++) {
+        Box<DIM> ghostbox = boxes[pn];
+        ghostbox.grow(ghost_width);
+        int entry[2+2*DIM];
+        entry[0] = ln;
+        entry[1] = level->getProcessorMapping().getProcessorAssignment(pn);
+        for (int dim = 0; dim < DIM; dim++) {
+          entry[2+dim]     = ghostbox.lower()(dim);
+          entry[2+DIM+dim] = ghostbox.upper()(dim);
+        }
+        status = (writeLSMFile(entry, sizeof(int), 2+2*DIM, fp) 
+                  != (size_t) (2+2*DIM));
+      }
+    }
+
+    if (status) {
+      TBOX_ERROR(  "LevelSetMethodToolbox::"
+                << "writeNarrowBandSnapshot(): "
+                << "Error writing file " << index_file_name << "."
+                << endl);
+    }
+    closeLSMFile(fp);
+  }
+
+  const string proc_file_name = 
+    narrowBandSnapshotFileName(file_name, tbox::MPI::getRank());
+  LSM_FILE *fp = openLSMFileForWriting(
+    const_cast<char*>(proc_file_name.c_str()), zip_status);
+  if (!fp) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::"
+              << "writeNarrowBandSnapshot(): "
+              << "Unable to open file " << proc_file_name << "."
+              << endl);
+  }
+
+  // count local patches
+  int num_patches = 0;
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) num_patches++;
+  }
+
+  // write header
+  int header[4];
+  header[0] = sizeof(LSMLIB_REAL);
+  header[1] = DIM;
+  header[2] = tbox::MPI::getNodes();
+  header[3] = num_patches;
+  writeLSMFile(LSM_SNAPSHOT_MAGIC, 1, LSM_SNAPSHOT_MAGIC_SIZE, fp);
+  writeLSMFile(header, sizeof(int), 4, fp);
+  writeLSMFile(&threshold, sizeof(LSMLIB_REAL), 1, fp);
+
+  // write level number, boxes, and narrow band data for each patch
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+
+    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+    
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      const int pn = *pi;
+      Pointer< Patch<DIM> > patch = level->getPatch(pn);
+      if ( patch.isNull() ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "writeNarrowBandSnapshot(): "
+                  << "Cannot find patch. Null patch pointer."
+                  << endl);
+      }
+
+      Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
+        patch->getPatchData( phi_handle );
 
-    } // end loop over patches in level
-  } // end loop over levels in hierarchy
+      Box<DIM> box = phi_data->getBox();
+      Box<DIM> ghostbox = phi_data->getGhostBox();
+      int record[1+4*DIM];
+      record[0] = ln;
+      for (int dim = 0; dim < DIM; dim++) {
+        record[1+dim]       = box.lower()(dim);
+        record[1+DIM+dim]   = box.upper()(dim);
+        record[1+2*DIM+dim] = ghostbox.lower()(dim);
+        record[1+3*DIM+dim] = ghostbox.upper()(dim);
+      }
+      writeLSMFile(record, sizeof(int), 1+4*DIM, fp);
+
+      if ( writeNarrowBandData(fp, phi_data->getPointer(component),
+                               ghostbox.size(), threshold) ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "writeNarrowBandSnapshot(): "
+                  << "Error writing file " << proc_file_name << "."
+                  << endl);
+      }
+
+    }  // end loop over Patches
+  }  // end loop over PatchLevels
 
-  return tbox::MPI::minReduction(max_normal_vel_dt);
+  closeLSMFile(fp);
 }
 
 
-/* maxNormOfDifference() */
+/* readNarrowBandSnapshot() */
 template <int DIM> 
-LSMLIB_REAL LevelSetMethodToolbox<DIM>::maxNormOfDifference(
+void LevelSetMethodToolbox<DIM>::readNarrowBandSnapshot(
   Pointer< PatchHierarchy<DIM> > patch_hierarchy,
-  const int field1_handle,
-  const int field2_handle,
-  const int control_volume_handle,
-  const int field1_component,
-  const int field2_component)
+  const int phi_handle,
+  const string& file_name,
+  const int component)
 {
-  LSMLIB_REAL max_norm_diff = 0;
-
-  // loop over PatchHierarchy and compute the max norm of (field1-field2)
-  // by calling Fortran routines
   const int num_levels = patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  vector<LSMLIB_REAL> record_data;
 
+  // cells that have not been set by the snapshot are marked with a value 
+  // larger than any value stored in the snapshot (|phi| <= threshold)
+  const LSMLIB_REAL uncovered_value = LSMLIB_REAL_MAX;
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
     Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
-    
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
-      Pointer< Patch<DIM> > patch = level->getPatch(pn);
-      if ( patch.isNull() ) {
-        TBOX_ERROR(  "LevelSetMethodToolbox::" 
-                  << "maxNormOfDifference(): "
-                  << "Cannot find patch. Null patch pointer."
+      Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
+        level->getPatch(pn)->getPatchData( phi_handle );
+      phi_data->fill(uncovered_value, component);
+    }
+  }
+
+  /*
+   * use the index file to find the files that contain data for the 
+   * local patches.  If there is no index file (e.g. for snapshots 
+   * written by older versions of LSMLIB), all files are read.
+   */
+  vector<int> file_nums;
+  bool read_all_files = true;
+  LSMLIB_REAL threshold = 0.0;
+  const string index_file_name = narrowBandSnapshotIndexFileName(file_name);
+  LSM_FILE *index_fp = 
+    openLSMFileForReading(const_cast<char*>(index_file_name.c_str()));
+  if (index_fp) {
+    char magic[LSM_SNAPSHOT_MAGIC_SIZE];
+    int header[4];
+    if ( (readLSMFile(magic, 1, LSM_SNAPSHOT_MAGIC_SIZE, index_fp)
+            != LSM_SNAPSHOT_MAGIC_SIZE) ||
+         (readLSMFile(header, sizeof(int), 4, index_fp) != 4) ||
+         (readLSMFile(&threshold, sizeof(LSMLIB_REAL), 1, index_fp) != 1) ||
+         (memcmp(magic, LSM_SNAPSHOT_INDEX_MAGIC, 
+                 LSM_SNAPSHOT_MAGIC_SIZE) != 0) ||
+         (header[0] != sizeof(LSMLIB_REAL)) || (header[1] != DIM) ) {
+      TBOX_ERROR(  "LevelSetMethodToolbox::"
+                << "readNarrowBandSnapshot(): "
+                << index_file_name << " is not a compatible "
+                << "narrow band snapshot index."
+                << endl);
+    }
+
+    vector<bool> file_needed(header[2], false);
+    const int num_entries = header[3];
+    for (int en = 0; en < num_entries; en++) {
+      int entry[2+2*DIM];
+      if ( (readLSMFile(entry, sizeof(int), 2+2*DIM, index_fp) 
+            != (size_t) (2+2*DIM)) ||
+           (entry[1] < 0) || (entry[1] >= header[2]) ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "readNarrowBandSnapshot(): "
+                  << "Error reading file " << index_file_name << "."
                   << endl);
       }
+      const int ln = entry[0];
+      if ( (ln >= num_levels) || file_needed[entry[1]] ) continue;
 
-      // get pointers to data and index space ranges
-      Pointer< CellData<DIM,LSMLIB_REAL> > field1_data =
-        patch->getPatchData( field1_handle );
-      Pointer< CellData<DIM,LSMLIB_REAL> > field2_data =
-        patch->getPatchData( field2_handle );
-      Pointer< CellData<DIM,LSMLIB_REAL> > control_volume_data =
-        patch->getPatchData( control_volume_handle );
-  
-      Box<DIM> field1_ghostbox = field1_data->getGhostBox();
-      const IntVector<DIM> field1_ghostbox_lower = field1_ghostbox.lower();
-      const IntVector<DIM> field1_ghostbox_upper = field1_ghostbox.upper();
+      Box<DIM> entry_ghostbox;
+      for (int dim = 0; dim < DIM; dim++) {
+        entry_ghostbox.lower()(dim) = entry[2+dim];
+        entry_ghostbox.upper()(dim) = entry[2+DIM+dim];
+      }
+      Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+      typename PatchLevel<DIM>::Iterator pi;
+      for (pi.initialize(level); pi; pi++) { // loop over patches
+        const int pn = *pi;
+        Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
+          level->getPatch(pn)->getPatchData( phi_handle );
+        if ( !(entry_ghostbox * phi_data->getGhostBox()).empty() ) {
+          file_needed[entry[1]] = true;
+          break;
+        }
+      }
+    }
+    closeLSMFile(index_fp);
 
-      Box<DIM> field2_ghostbox = field2_data->getGhostBox();
-      const IntVector<DIM> field2_ghostbox_lower = field2_ghostbox.lower();
-      const IntVector<DIM> field2_ghostbox_upper = field2_ghostbox.upper();
+    for (int file_num = 0; file_num < header[2]; file_num++) {
+      if (file_needed[file_num]) file_nums.push_back(file_num);
+    }
+    read_all_files = false;
+  } else {
+    // the number of files is read from the file written by processor 0
+    file_nums.push_back(0);
+  }
 
-      Box<DIM> control_volume_ghostbox = 
-        control_volume_data->getGhostBox();
-      const IntVector<DIM> control_volume_ghostbox_lower = 
-        control_volume_ghostbox.lower();
-      const IntVector<DIM> control_volume_ghostbox_upper = 
-        control_volume_ghostbox.upper();
+  for (unsigned int fn = 0; fn < file_nums.size(); fn++) {
 
-      // interior box
-      Box<DIM> interior_box = field1_data->getBox();
-      const IntVector<DIM> interior_box_lower = interior_box.lower();
-      const IntVector<DIM> interior_box_upper = interior_box.upper();
+    const int file_num = file_nums[fn];
+    const string proc_file_name = 
+      narrowBandSnapshotFileName(file_name, file_num);
+    LSM_FILE *fp = openNarrowBandSnapshotFile(proc_file_name);
+    if (!fp) {
+      TBOX_ERROR(  "LevelSetMethodToolbox::"
+                << "readNarrowBandSnapshot(): "
+                << "Unable to open file " << proc_file_name << "."
+                << endl);
+    }
 
-      LSMLIB_REAL* field1 = field1_data->getPointer(field1_component);
-      LSMLIB_REAL* field2 = field2_data->getPointer(field2_component);
-      LSMLIB_REAL* control_volume = control_volume_data->getPointer();
-      int control_volume_sgn = 1;
+    // read and check header
+    char magic[LSM_SNAPSHOT_MAGIC_SIZE];
+    int header[4];
+    if ( (readLSMFile(magic, 1, LSM_SNAPSHOT_MAGIC_SIZE, fp)
+            != LSM_SNAPSHOT_MAGIC_SIZE) ||
+         (readLSMFile(header, sizeof(int), 4, fp) != 4) ||
+         (readLSMFile(&threshold, sizeof(LSMLIB_REAL), 1, fp) != 1) ||
+         (memcmp(magic, LSM_SNAPSHOT_MAGIC, LSM_SNAPSHOT_MAGIC_SIZE) != 0) ||
+         (header[0] != sizeof(LSMLIB_REAL)) || (header[1] != DIM) ) {
+      TBOX_ERROR(  "LevelSetMethodToolbox::"
+                << "readNarrowBandSnapshot(): "
+                << proc_file_name << " is not a compatible "
+                << "narrow band snapshot."
+                << endl);
+    }
+    if (read_all_files && (file_num == 0)) {
+      for (int other_file_num = 1; other_file_num < header[2]; 
+           other_file_num++) {
+        file_nums.push_back(other_file_num);
+      }
+    }
 
-      LSMLIB_REAL max_norm_diff_on_patch = 0.0;
+    const int num_records = header[3];
+    for (int rn = 0; rn < num_records; rn++) {
 
-      if ( DIM == 3 ) {
-        LSM3D_MAX_NORM_DIFF_CONTROL_VOLUME(
-          &max_norm_diff_on_patch,
-          field1,
-          &field1_ghostbox_lower[0],
-          &field1_ghostbox_upper[0],
-          &field1_ghostbox_lower[1],
-          &field1_ghostbox_upper[1],
-          &field1_ghostbox_lower[2],
-          &field1_ghostbox_upper[2],
-          field2,
-          &field2_ghostbox_lower[0],
-          &field2_ghostbox_upper[0],
-          &field2_ghostbox_lower[1],
-          &field2_ghostbox_upper[1],
-          &field2_ghostbox_lower[2],
-          &field2_ghostbox_upper[2],
-          control_volume,
-          &control_volume_ghostbox_lower[0],
-          &control_volume_ghostbox_upper[0],
-          &control_volume_ghostbox_lower[1],
-          &control_volume_ghostbox_upper[1],
-          &control_volume_ghostbox_lower[2],
-          &control_volume_ghostbox_upper[2],
-          &control_volume_sgn,
-          &interior_box_lower[0],
-          &interior_box_upper[0],
-          &interior_box_lower[1],
-          &interior_box_upper[1],
-          &interior_box_lower[2],
-          &interior_box_upper[2]);
+      // read record
+      int record[1+4*DIM];
+      if (readLSMFile(record, sizeof(int), 1+4*DIM, fp) 
+          != (size_t) (1+4*DIM)) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "readNarrowBandSnapshot(): "
+                  << "Error reading file " << proc_file_name << "."
+                  << endl);
+      }
+      const int ln = record[0];
+      Box<DIM> record_box, record_ghostbox;
+      for (int dim = 0; dim < DIM; dim++) {
+        record_box.lower()(dim)      = record[1+dim];
+        record_box.upper()(dim)      = record[1+DIM+dim];
+        record_ghostbox.lower()(dim) = record[1+2*DIM+dim];
+        record_ghostbox.upper()(dim) = record[1+3*DIM+dim];
+      }
+      const IntVector<DIM> src_ghostbox_lower = record_ghostbox.lower();
+      const IntVector<DIM> src_ghostbox_upper = record_ghostbox.upper();
 
-      } else if ( DIM == 2 ) {
-        LSM2D_MAX_NORM_DIFF_CONTROL_VOLUME(
-          &max_norm_diff_on_patch,
-          field1,
-          &field1_ghostbox_lower[0],
-          &field1_ghostbox_upper[0],
-          &field1_ghostbox_lower[1],
-          &field1_ghostbox_upper[1],
-          field2,
-          &field2_ghostbox_lower[0],
-          &field2_ghostbox_upper[0],
-          &field2_ghostbox_lower[1],
-          &field2_ghostbox_upper[1],
-          control_volume,
-          &control_volume_ghostbox_lower[0],
-          &control_volume_ghostbox_upper[0],
-          &control_volume_ghostbox_lower[1],
-          &control_volume_ghostbox_upper[1],
-          &control_volume_sgn,
-          &interior_box_lower[0],
-          &interior_box_upper[0],
-          &interior_box_lower[1],
-          &interior_box_upper[1]);
+      record_data.resize(record_ghostbox.size());
+      if ( readNarrowBandData(fp, &(record_data[0]), 
+                              record_ghostbox.size(), threshold) ) {
+        TBOX_ERROR(  "LevelSetMethodToolbox::"
+                  << "readNarrowBandSnapshot(): "
+                  << "Error reading file " << proc_file_name << "."
+                  << endl);
+      }
+      if (ln >= num_levels) continue;
 
-      } else if ( DIM == 1 ) {
-        LSM1D_MAX_NORM_DIFF_CONTROL_VOLUME(
-          &max_norm_diff_on_patch,
-          field1,
-          &field1_ghostbox_lower[0],
-          &field1_ghostbox_upper[0],
-          field2,
-          &field2_ghostbox_lower[0],
-          &field2_ghostbox_upper[0],
-          control_volume,
-          &control_volume_ghostbox_lower[0],
-          &control_volume_ghostbox_upper[0],
-          &control_volume_sgn,
-          &interior_box_lower[0],
-          &interior_box_upper[0]);
+      /*
+       * copy interior of stored patch into intersecting local patches.
+       * The stored ghost cells are only copied into cells that are not 
+       * covered by the interior of any stored patch (e.g. ghost cells 
+       * outside of the physical domain), so they keep the sign of phi.
+       */
+      Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+      typename PatchLevel<DIM>::Iterator pi;
+      for (pi.initialize(level); pi; pi++) { // loop over patches
+        const int pn = *pi;
+        Pointer< Patch<DIM> > patch = level->getPatch(pn);
+        Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
+          patch->getPatchData( phi_handle );
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  "LevelSetMethodToolbox::" 
-                  << "maxNormOfDifference(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
+        Box<DIM> dst_ghostbox = phi_data->getGhostBox();
+        Box<DIM> fillbox = record_box * dst_ghostbox;
+        Box<DIM> ghost_fillbox = record_ghostbox * dst_ghostbox;
+        if (ghost_fillbox.empty()) continue;
+
+        const IntVector<DIM> dst_ghostbox_lower = dst_ghostbox.lower();
+        const IntVector<DIM> dst_ghostbox_upper = dst_ghostbox.upper();
+        const IntVector<DIM> fillbox_lower = fillbox.lower();
+        const IntVector<DIM> fillbox_upper = fillbox.upper();
+
+        LSMLIB_REAL* dst = phi_data->getPointer(component);
+        LSMLIB_REAL* src = &(record_data[0]);
+
+        if (fillbox.empty()) {
+
+          // stored patch only intersects the ghost cells of local patch
+
+        } else if (DIM == 3) {
+
+          LSM3D_SAMRAI_UTILITIES_COPY_DATA(
+            dst,
+            &dst_ghostbox_lower[0],
+            &dst_ghostbox_upper[0],
+            &dst_ghostbox_lower[1],
+            &dst_ghostbox_upper[1],
+            &dst_ghostbox_lower[2],
+            &dst_ghostbox_upper[2],
+            src,
+            &src_ghostbox_lower[0],
+            &src_ghostbox_upper[0],
+            &src_ghostbox_lower[1],
+            &src_ghostbox_upper[1],
+            &src_ghostbox_lower[2],
+            &src_ghostbox_upper[2],
+            &fillbox_lower[0],
+            &fillbox_upper[0],
+            &fillbox_lower[1],
+            &fillbox_upper[1],
+            &fillbox_lower[2],
+            &fillbox_upper[2]);
+
+        } else if (DIM == 2) {
+
+          LSM2D_SAMRAI_UTILITIES_COPY_DATA(
+            dst,
+            &dst_ghostbox_lower[0],
+            &dst_ghostbox_upper[0],
+            &dst_ghostbox_lower[1],
+            &dst_ghostbox_upper[1],
+            src,
+            &src_ghostbox_lower[0],
+            &src_ghostbox_upper[0],
+            &src_ghostbox_lower[1],
+            &src_ghostbox_upper[1],
+            &fillbox_lower[0],
+            &fillbox_upper[0],
+            &fillbox_lower[1],
+            &fillbox_upper[1]);
+
+        } else if (DIM == 1) {
+
+          LSM1D_SAMRAI_UTILITIES_COPY_DATA(
+            dst,
+            &dst_ghostbox_lower[0],
+            &dst_ghostbox_upper[0],
+            src,
+            &src_ghostbox_lower[0],
+            &src_ghostbox_upper[0],
+            &fillbox_lower[0],
+            &fillbox_upper[0]);
+
+        } else {  // Unsupported dimension
+          TBOX_ERROR(  "LevelSetMethodToolbox::"
+                    << "readNarrowBandSnapshot(): "
+                    << "Invalid value of DIM.  "
+                    << "Only DIM = 1, 2, and 3 are supported."
+                    << endl);
+        }
+
+        int dst_lo[3] = {0, 0, 0}, dst_hi[3] = {0, 0, 0};
+        int src_lo[3] = {0, 0, 0}, src_hi[3] = {0, 0, 0};
+        int fill_lo[3] = {0, 0, 0}, fill_hi[3] = {0, 0, 0};
+        for (int dim = 0; dim < DIM; dim++) {
+          dst_lo[dim]  = dst_ghostbox_lower(dim);
+          dst_hi[dim]  = dst_ghostbox_upper(dim);
+          src_lo[dim]  = src_ghostbox_lower(dim);
+          src_hi[dim]  = src_ghostbox_upper(dim);
+          fill_lo[dim] = ghost_fillbox.lower()(dim);
+          fill_hi[dim] = ghost_fillbox.upper()(dim);
+        }
+        copySnapshotGhostData(dst, dst_lo, dst_hi, src, src_lo, src_hi,
+                              fill_lo, fill_hi, uncovered_value);
+
+      }  // end loop over Patches
+    }  // end loop over records
+
+    closeLSMFile(fp);
+  }  // end loop over files
+
+  // set cells not covered by the snapshot to +/- threshold
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      const int pn = *pi;
+      Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
+        level->getPatch(pn)->getPatchData( phi_handle );
+      const Box<DIM> ghostbox = phi_data->getGhostBox();
+      int lo[3] = {0, 0, 0}, hi[3] = {0, 0, 0};
+      for (int dim = 0; dim < DIM; dim++) {
+        lo[dim] = ghostbox.lower()(dim);
+        hi[dim] = ghostbox.upper()(dim);
       }
+      fillUncoveredCells(phi_data->getPointer(component), lo, hi,
+                         uncovered_value, threshold);
+    }
+  }
+}
 
-      if (max_norm_diff < max_norm_diff_on_patch)
-        max_norm_diff = max_norm_diff_on_patch; 
 
-    } // end loop over patches in level
-  } // end loop over levels in hierarchy
+/* setUsePersistentScratchData() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::setUsePersistentScratchData(
+  const bool use_persistent_scratch_data)
+{
+  s_use_persistent_scratch_data = use_persistent_scratch_data;
+}
+
+
+/* usePersistentScratchData() */
+template <int DIM> 
+bool LevelSetMethodToolbox<DIM>::usePersistentScratchData()
+{
+  return s_use_persistent_scratch_data;
+}
+
+
+/* allocateSpatialDerivativeScratchData() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::allocateSpatialDerivativeScratchData(
+  Pointer< Patch<DIM> > patch,
+  const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+  const int spatial_derivative_order)
+{
+  // make sure that the scratch PatchData handles have been created
+  initializeComputeSpatialDerivativesParameters();
+
+  int scratch_handles[3];
+  const int num_scratch_handles = getSpatialDerivativeScratchHandles(
+    scratch_handles, spatial_derivative_type, spatial_derivative_order);
+  for (int k = 0; k < num_scratch_handles; k++) {
+    allocateScratchPatchData(patch, scratch_handles[k]);
+  }
+}
 
-  return tbox::MPI::maxReduction(max_norm_diff);
+
+/* releaseSpatialDerivativeScratchData() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::releaseSpatialDerivativeScratchData(
+  Pointer< Patch<DIM> > patch,
+  const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+  const int spatial_derivative_order)
+{
+  int scratch_handles[3];
+  const int num_scratch_handles = getSpatialDerivativeScratchHandles(
+    scratch_handles, spatial_derivative_type, spatial_derivative_order);
+  for (int k = 0; k < num_scratch_handles; k++) {
+    releaseScratchPatchData(patch, scratch_handles[k]);
+  }
+}
+
+
+/* deallocateScratchData() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::deallocateScratchData(
+  Pointer< PatchHierarchy<DIM> > hierarchy)
+{
+  const int scratch_handles[] = {
+    s_D1_one_ghostcell_handle,
+    s_D1_two_ghostcells_handle,
+    s_D2_two_ghostcells_handle,
+    s_D1_three_ghostcells_handle,
+    s_D2_three_ghostcells_handle,
+    s_D3_three_ghostcells_handle,
+    s_compute_normal_grad_phi_handle,
+    s_compute_normal_grad_phi_plus_handle,
+    s_compute_normal_grad_phi_minus_handle };
+  const int num_scratch_handles = 
+    sizeof(scratch_handles)/sizeof(scratch_handles[0]);
+
+  const int num_levels = hierarchy->getNumberLevels();
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+    Pointer< PatchLevel<DIM> > level = hierarchy->getPatchLevel(ln);
+    for (int k = 0; k < num_scratch_handles; k++) {
+      if (scratch_handles[k] >= 0) {
+        level->deallocatePatchData(scratch_handles[k]);
+      }
+    }
+    typename map< pair<int,int>, int >::const_iterator it;
+    for (it = s_grown_scratch_handles.begin(); 
+         it != s_grown_scratch_handles.end(); it++) {
+      level->deallocatePatchData(it->second);
+    }
+  }
 }
 
 
-/* computeControlVolumes() */
-template <int DIM>
-void LevelSetMethodToolbox<DIM>::computeControlVolumes(
-  Pointer< PatchHierarchy<DIM> > patch_hierarchy,
-  int control_volume_handle)
+/* addToReductionBatch() */
+template <int DIM> 
+int LevelSetMethodToolbox<DIM>::addToReductionBatch(
+  const LSMLIB_REAL local_value,
+  const REDUCTION_TYPE reduction_type)
 {
-  int finest_ln = patch_hierarchy->getFinestLevelNumber();
-  int ln;
-  for ( ln=finest_ln; ln >= 0; --ln ) {
-
-    /*
-     * On every level, first assign cell volume to vector weight.
-     */
+  s_reduction_values.push_back(local_value);
+  s_reduction_types.push_back(reduction_type);
+  return s_reduction_values.size()-1;
+}
 
-    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
 
-    typename PatchLevel<DIM>::Iterator pi;
-    for (pi.initialize(level); pi; pi++) {
-      const int pn = *pi;
-      Pointer< Patch<DIM> > patch = level->getPatch(pn);
-      Pointer< CartesianPatchGeometry<DIM> > patch_geometry =
-        patch->getPatchGeometry();
-#ifdef LSMLIB_DOUBLE_PRECISION
-      const double* dx = patch_geometry->getDx();
+/* startReductionBatch() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::startReductionBatch()
+{
+  // only one set of reductions may be in progress at a time
+  if (s_num_started_reduction_values > s_num_reduced_values) return;
+
+  const int num_values = s_reduction_values.size();
+  if (s_num_reduced_values == num_values) return;
+
+  // pack the pending values into one buffer for max reductions 
+  // (min reductions are negated) and one buffer for sum reductions
+  s_reduction_max_buffer.clear();
+  s_reduction_sum_buffer.clear();
+  for (int k = s_num_reduced_values; k < num_values; k++) {
+    switch (s_reduction_types[k]) {
+      case REDUCTION_MIN: {
+        s_reduction_max_buffer.push_back(-s_reduction_values[k]);
+        break;
+      }
+      case REDUCTION_MAX: {
+        s_reduction_max_buffer.push_back(s_reduction_values[k]);
+        break;
+      }
+      case REDUCTION_SUM: {
+        s_reduction_sum_buffer.push_back(s_reduction_values[k]);
+        break;
+      }
+      default: {
+        TBOX_ERROR(  "LevelSetMethodToolbox::" 
+                  << "startReductionBatch(): "
+                  << "Invalid reduction type."
+                  << endl);
+      }
+    }
+  }
+  s_num_started_reduction_values = num_values;
+
+  // start reductions
+  s_num_reduction_requests = 0;
+#ifdef LSM_USE_NONBLOCKING_REDUCTIONS
+  if (s_reduction_max_buffer.size() > 0) {
+    MPI_Iallreduce(MPI_IN_PLACE, &s_reduction_max_buffer[0], 
+                   s_reduction_max_buffer.size(), LSM_MPI_REAL, MPI_MAX,
+                   tbox::MPI::getCommunicator(),
+                   &s_reduction_requests[s_num_reduction_requests++]);
+  }
+  if (s_reduction_sum_buffer.size() > 0) {
+    MPI_Iallreduce(MPI_IN_PLACE, &s_reduction_sum_buffer[0], 
+                   s_reduction_sum_buffer.size(), LSM_MPI_REAL, MPI_SUM,
+                   tbox::MPI::getCommunicator(),
+                   &s_reduction_requests[s_num_reduction_requests++]);
+  }
 #else
-      const double* dx_double = patch_geometry->getDx();
-      float dx[DIM];
-      for (int i = 0; i < DIM; i++) dx[i] = (float) dx_double[i];
+  if (s_reduction_max_buffer.size() > 0) {
+    tbox::MPI::maxReduction(&s_reduction_max_buffer[0], 
+                            s_reduction_max_buffer.size());
+  }
+  if (s_reduction_sum_buffer.size() > 0) {
+    tbox::MPI::sumReduction(&s_reduction_sum_buffer[0], 
+                            s_reduction_sum_buffer.size());
+  }
 #endif
-      LSMLIB_REAL cell_vol = dx[0];
-      for (int i = 1; i<DIM; i++) {
-        cell_vol *= dx[i];
-      } 
+}
 
-      Pointer< CellData<DIM,LSMLIB_REAL> > cv_data =
-        patch->getPatchData(control_volume_handle);
-      if ( !cv_data ) {
-        TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "computeControlVolumes(): "
-                  << "control_volume_handle must refer to a "
-                  << "pdat_CellVariable"
-                  << endl );
+
+/* completeReductionBatch() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::completeReductionBatch()
+{
+  // start reductions for the pending values if they have not 
+  // already been started
+  startReductionBatch();
+  if (s_num_started_reduction_values == s_num_reduced_values) return;
+
+  // wait for reductions to complete
+#ifdef LSM_USE_NONBLOCKING_REDUCTIONS
+  if (s_num_reduction_requests > 0) {
+    MPI_Waitall(s_num_reduction_requests, s_reduction_requests, 
+                MPI_STATUSES_IGNORE);
+  }
+#endif
+  s_num_reduction_requests = 0;
+
+  // unpack the reduced values
+  int max_idx = 0;
+  int sum_idx = 0;
+  for (int k = s_num_reduced_values; k < s_num_started_reduction_values; 
+       k++) {
+    switch (s_reduction_types[k]) {
+      case REDUCTION_MIN: {
+        s_reduction_values[k] = -s_reduction_max_buffer[max_idx++];
+        break;
+      }
+      case REDUCTION_MAX: {
+        s_reduction_values[k] = s_reduction_max_buffer[max_idx++];
+        break;
+      }
+      case REDUCTION_SUM: {
+        s_reduction_values[k] = s_reduction_sum_buffer[sum_idx++];
+        break;
       }
-      cv_data->fillAll(cell_vol);
     }
+  }
+  s_num_reduced_values = s_num_started_reduction_values;
 
-    /*
-     * On all but the finest level, assign 0 to vector
-     * weight to cells covered by finer cells.
-     */
+  // reduce values added after the reductions were started
+  if (s_num_reduced_values < (int) s_reduction_values.size()) {
+    completeReductionBatch();
+  }
+}
 
-    if (ln < finest_ln) {
 
-      /*
-       * First get the boxes that describe index space of the next finer
-       * level and coarsen them to describe corresponding index space
-       * at this level.
-       */
+/* getReducedValue() */
+template <int DIM> 
+LSMLIB_REAL LevelSetMethodToolbox<DIM>::getReducedValue(const int index)
+{
+  if ( (index < 0) || (index >= s_num_reduced_values) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::" 
+              << "getReducedValue(): "
+              << "Invalid index or reduction not yet completed."
+              << endl);
+  }
+  return s_reduction_values[index];
+}
 
-      Pointer< PatchLevel<DIM> > next_finer_level
-            = patch_hierarchy->getPatchLevel(ln+1);
-      BoxArray<DIM> coarsened_boxes = next_finer_level->getBoxes();
-      IntVector<DIM> coarsen_ratio = next_finer_level->getRatio();
-      coarsen_ratio /= level->getRatio();
-      coarsened_boxes.coarsen(coarsen_ratio);
 
-      /*
-       * Then set vector weight to 0 wherever there is
-       * a nonempty intersection with the next finer level.
-       * Note that all assignments are local.
-       */
+/* clearReductionBatch() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::clearReductionBatch()
+{
+  // reductions in progress write into the packed buffers, so they 
+  // must complete before the batch is modified
+  if (s_num_started_reduction_values > s_num_reduced_values) {
+    completeReductionBatch();
+  }
+  s_reduction_values.clear();
+  s_reduction_types.clear();
+  s_num_reduced_values = 0;
+  s_num_started_reduction_values = 0;
+}
 
-      typename PatchLevel<DIM>::Iterator pi;
-      for (pi.initialize(level); pi; pi++) {
-        const int pn = *pi;
-        Pointer< Patch<DIM> > patch = level->getPatch(pn);
-        for ( int i = 0; i < coarsened_boxes.getNumberOfBoxes(); i++ ) {
 
-          Box<DIM> coarse_box = coarsened_boxes(i);
-          Box<DIM> intersection = coarse_box*(patch->getBox());
-          if ( !intersection.empty() ) {
-            Pointer< CellData<DIM, LSMLIB_REAL> > cv_data =
-            patch->getPatchData(control_volume_handle);
-            cv_data->fillAll(0.0, intersection);
+/* getReductionBatchSize() */
+template <int DIM> 
+int LevelSetMethodToolbox<DIM>::getReductionBatchSize()
+{
+  return s_reduction_values.size();
+}
 
-          }  // assignment only in non-empty intersection
-        }  // loop over coarsened boxes from finer level
-      }  // loop over patches in level
-    }  // all levels except finest
-  }  // loop over levels
+
+/* truncateReductionBatch() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::truncateReductionBatch(const int num_values)
+{
+  if ( (num_values < 0) || 
+       (num_values >= (int) s_reduction_values.size()) ) return;
+  if (s_num_started_reduction_values > s_num_reduced_values) {
+    completeReductionBatch();
+  }
+  s_reduction_values.resize(num_values);
+  s_reduction_types.resize(num_values);
+  if (s_num_reduced_values > num_values) s_num_reduced_values = num_values;
+  s_num_started_reduction_values = s_num_reduced_values;
 }
 
 
-/* copySAMRAIData() */
+/* allocateScratchPatchData() */
 template <int DIM> 
-void LevelSetMethodToolbox<DIM>::copySAMRAIData(
-  Pointer< PatchHierarchy<DIM> > patch_hierarchy,
-  const int dst_handle,
-  const int src_handle,
-  const int dst_component,
-  const int src_component)
+void LevelSetMethodToolbox<DIM>::allocateScratchPatchData(
+  Pointer< Patch<DIM> > patch,
+  const int scratch_handle)
 {
-  // loop over PatchHierarchy and copy data in Patch interiors
-  const int num_levels = patch_hierarchy->getNumberLevels();
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
+  // scratch data kept from a previous call is reused as is
+  if (!patch->checkAllocated(scratch_handle)) {
+    patch->allocatePatchData(scratch_handle);
+  }
+}
 
-    Pointer< PatchLevel<DIM> > level = patch_hierarchy->getPatchLevel(ln);
-    
-    typename PatchLevel<DIM>::Iterator pi;
-    for (pi.initialize(level); pi; pi++) { // loop over patches
-      const int pn = *pi;
-      Pointer< Patch<DIM> > patch = level->getPatch(pn);
-      if ( patch.isNull() ) {
-        TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "copySAMRAIData(): "
-                  << "Cannot find patch. Null patch pointer."
-                  << endl);
-      }
 
-      // get pointers to data and index space ranges
-      Pointer< CellData<DIM,LSMLIB_REAL> > dst_data =
-        patch->getPatchData( dst_handle );
-      Pointer< CellData<DIM,LSMLIB_REAL> > src_data =
-        patch->getPatchData( src_handle );
+/* releaseScratchPatchData() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::releaseScratchPatchData(
+  Pointer< Patch<DIM> > patch,
+  const int scratch_handle)
+{
+#ifdef _OPENMP
+  // scratch data used inside of a threaded patch loop is released
+  // by the thread that allocated it after the loop completes
+  if (omp_in_parallel()) {
+    return;
+  }
+#endif
 
-      Box<DIM> dst_ghostbox = dst_data->getGhostBox();
-      const IntVector<DIM> dst_ghostbox_lower = dst_ghostbox.lower();
-      const IntVector<DIM> dst_ghostbox_upper = dst_ghostbox.upper();
+  if (!s_use_persistent_scratch_data) {
+    patch->deallocatePatchData(scratch_handle);
+  }
+}
 
-      Box<DIM> src_ghostbox = src_data->getGhostBox();
-      const IntVector<DIM> src_ghostbox_lower = src_ghostbox.lower();
-      const IntVector<DIM> src_ghostbox_upper = src_ghostbox.upper();
 
-      Box<DIM> fillbox = dst_data->getBox();
-      const IntVector<DIM> fillbox_lower = fillbox.lower();
-      const IntVector<DIM> fillbox_upper = fillbox.upper();
+/* getSpatialDerivativeScratchHandles() */
+template <int DIM> 
+int LevelSetMethodToolbox<DIM>::getSpatialDerivativeScratchHandles(
+  int scratch_handles[3],
+  const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+  const int spatial_derivative_order)
+{
+  // NOTE: unsupported derivative types and orders are reported by the
+  //       spatial derivative computations themselves
+  if (spatial_derivative_type == WENO) {
+    scratch_handles[0] = s_D1_three_ghostcells_handle;
+    return 1;
+  } else if (spatial_derivative_type != ENO) {
+    return 0;
+  }
 
-      LSMLIB_REAL* dst = dst_data->getPointer(dst_component);
-      LSMLIB_REAL* src = src_data->getPointer(src_component);
+  switch (spatial_derivative_order) {
+    case 1: {
+      scratch_handles[0] = s_D1_one_ghostcell_handle;
+      return 1;
+    }
+    case 2: {
+      scratch_handles[0] = s_D1_two_ghostcells_handle;
+      scratch_handles[1] = s_D2_two_ghostcells_handle;
+      return 2;
+    }
+    case 3: {
+      scratch_handles[0] = s_D1_three_ghostcells_handle;
+      scratch_handles[1] = s_D2_three_ghostcells_handle;
+      scratch_handles[2] = s_D3_three_ghostcells_handle;
+      return 3;
+    }
+    default: {
+      return 0;
+    }
+  }
+}
 
-      if (DIM == 3) {
 
-        LSM3D_SAMRAI_UTILITIES_COPY_DATA(
-          dst,
-          &dst_ghostbox_lower[0],
-          &dst_ghostbox_upper[0],
-          &dst_ghostbox_lower[1],
-          &dst_ghostbox_upper[1],
-          &dst_ghostbox_lower[2],
-          &dst_ghostbox_upper[2],
-          src,
-          &src_ghostbox_lower[0],
-          &src_ghostbox_upper[0],
-          &src_ghostbox_lower[1],
-          &src_ghostbox_upper[1],
-          &src_ghostbox_lower[2],
-          &src_ghostbox_upper[2],
-          &fillbox_lower[0],
-          &fillbox_upper[0],
-          &fillbox_lower[1],
-          &fillbox_upper[1],
-          &fillbox_lower[2],
-          &fillbox_upper[2]);
+/* checkSpatialDerivativeParameters() */
+template <int DIM> 
+void LevelSetMethodToolbox<DIM>::checkSpatialDerivativeParameters(
+  const string& method_name,
+  const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+  const int spatial_derivative_order)
+{
+  if (spatial_derivative_type == ENO) {
+    if ( (spatial_derivative_order < 1) || (spatial_derivative_order > 3) ) {
+      TBOX_ERROR(  "LevelSetMethodToolbox::"
+                << method_name << "(): "
+                << "Unsupported order for ENO derivative.  "
+                << "Only ENO1, ENO2, and ENO3 supported."
+                << endl );
+    }
+  } else if (spatial_derivative_type == WENO) {
+    if (spatial_derivative_order != 5) {
+      TBOX_ERROR(  "LevelSetMethodToolbox::"
+                << method_name << "(): "
+                << "Unsupported order for WENO derivative.  "
+                << "Only WENO5 supported."
+                << endl );
+    }
+  } else {
+    TBOX_ERROR(  "LevelSetMethodToolbox::"
+              << method_name << "(): "
+              << "Unsupported spatial derivative type.  "
+              << "Only ENO and WENO derivatives are supported."
+              << endl );
+  }
 
-      } else if (DIM == 2) {
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  "LevelSetMethodToolbox::"
+              << method_name << "(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl );
+  }
+}
 
-        LSM2D_SAMRAI_UTILITIES_COPY_DATA(
-          dst,
-          &dst_ghostbox_lower[0],
-          &dst_ghostbox_upper[0],
-          &dst_ghostbox_lower[1],
-          &dst_ghostbox_upper[1],
-          src,
-          &src_ghostbox_lower[0],
-          &src_ghostbox_upper[0],
-          &src_ghostbox_lower[1],
-          &src_ghostbox_upper[1],
-          &fillbox_lower[0],
-          &fillbox_upper[0],
-          &fillbox_lower[1],
-          &fillbox_upper[1]);
 
-      } else if (DIM == 1) {
+/* getScratchHandle() */
+template <int DIM> 
+int LevelSetMethodToolbox<DIM>::getScratchHandle(
+  const int scratch_handle,
+  const int fillbox_growth)
+{
+  if (fillbox_growth <= 0) {
+    return scratch_handle;
+  }
 
-        LSM1D_SAMRAI_UTILITIES_COPY_DATA(
-          dst,
-          &dst_ghostbox_lower[0],
-          &dst_ghostbox_upper[0],
-          src,
-          &src_ghostbox_lower[0],
-          &src_ghostbox_upper[0],
-          &fillbox_lower[0],
-          &fillbox_upper[0]);
+  // scratch data for a grown fill box is registered the first time
+  // that it is requested
+  // NOTE: registration is not thread-safe, so grown fill boxes must
+  //       not be used inside of threaded patch loops
+  const pair<int,int> key(scratch_handle, fillbox_growth);
+  typename map< pair<int,int>, int >::const_iterator it = 
+    s_grown_scratch_handles.find(key);
+  if (it != s_grown_scratch_handles.end()) {
+    return it->second;
+  }
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  "LevelSetMethodToolbox::"
-                  << "copySAMRAIData(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
-      }
+  // get pointer to VariableDatabase
+  VariableDatabase<DIM> *var_db = VariableDatabase<DIM>::getDatabase();
 
-    }  // end loop over Patches
-  }  // end loop over PatchLevels
+  // the scratch data must cover the grown fill box plus the stencil
+  // width, so its ghost region is widened by fillbox_growth cells
+  Pointer< Variable<DIM> > variable;
+  var_db->mapIndexToVariable(scratch_handle, variable);
+  const IntVector<DIM> ghostcell_width = 
+    var_db->getPatchDescriptor()->getPatchDataFactory(scratch_handle)
+          ->getGhostCellWidth() + IntVector<DIM>(fillbox_growth);
+
+  char context_name[64];
+  sprintf(context_name, "LSM_TOOLBOX_SCRATCH::GROWN_FILLBOX_%d_%d",
+          scratch_handle, fillbox_growth);
+  Pointer<VariableContext> context = var_db->getContext(context_name);
+
+  const int grown_scratch_handle = var_db->registerVariableAndContext(
+    variable, context, ghostcell_width);
+  s_grown_scratch_handles[key] = grown_scratch_handle;
+
+  return grown_scratch_handle;
 }
 
 
@@ -40,7 +40,10 @@
  * 
  *  - computation of the max norm of the difference of two fields;
  * 
- *  - computation of control volumes for structured adaptive meshes; and
+ *  - computation of control volumes for structured adaptive meshes;
+ *
+ *  - narrow band snapshots of the level set function for compact
+ *    time series output; and
  *
  *  - general data management/transfer procedures.
  *
@@ -54,9 +57,24 @@
  *
  *       LevelSetMethodToolbox::function(...)
  *
+ *  - When LSMLIB is configured with --enable-openmp, the patch loops
+ *    in the PatchHierarchy versions of the spatial derivative 
+ *    computations (upwind and plus/minus), the TVD Runge-Kutta and
+ *    SSP Runge-Kutta stages, computeStableAdvectionDt(), and 
+ *    computeStableNormalVelocityDt() are distributed among threads on
+ *    each MPI process.  Only the numerical kernels run concurrently; 
+ *    all SAMRAI data management (e.g. allocation of scratch PatchData)
+ *    is done serially because SAMRAI is not thread-safe, and invalid
+ *    parameters are rejected before entering the threaded loops.  The
+ *    remaining patch loops in this class (and in 
+ *    FieldExtensionAlgorithm) are not threaded.
+ *
  */
 
 
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "SAMRAI_config.h"
@@ -66,6 +84,7 @@
 #include "RefineAlgorithm.h"
 #include "RefineSchedule.h"
 #include "tbox/Array.h"
+#include "tbox/MPI.h"
 #include "tbox/Pointer.h"
 
 #include "LSMLIB_config.h"
@@ -133,6 +152,15 @@ public:
    */
   typedef enum { PHI_UPWIND = 0, AVERAGE = 1 } UNIT_NORMAL_TYPE;
 
+  /*! \enum REDUCTION_TYPE
+   *
+   * Enumerated type for the global reductions supported by the
+   * reduction batch (see addToReductionBatch()).
+   *
+   */
+  typedef enum { REDUCTION_MIN = 0, REDUCTION_MAX = 1, REDUCTION_SUM = 2 } 
+    REDUCTION_TYPE;
+
   //! @}
 
 
@@ -158,6 +186,11 @@ public:
    *  - upwind_function_handle(in):     PatchData handle for upwinding function
    *  - phi_component (in):             component of phi for which to compute
    *                                    spatial derivatives (default = 0)
+   *  - coarsest_level (in):            coarsest level of hierarchy to
+   *                                    update (default = 0)
+   *  - finest_level (in):              finest level of hierarchy to update
+   *                                    (default = -1, i.e. finest level
+   *                                    of hierarchy)
    *
    * Return value:                      none
    *
@@ -183,6 +216,28 @@ public:
     const int grad_phi_handle,
     const int phi_handle,
     const int upwind_function_handle,
+    const int phi_component = 0,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
+
+  /*!
+   * This version of computeUpwindSpatialDerivatives() computes upwind
+   * spatial derivatives on a single patch.
+   *
+   * Arguments:     
+   *  - patch (in):                     Pointer to Patch containing data
+   *  - all other arguments:            same as for hierarchy version
+   *
+   * Return value:                      none
+   *
+   */
+  static void computeUpwindSpatialDerivatives(
+    Pointer< Patch<DIM> > patch,
+    const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+    const int spatial_derivative_order,
+    const int grad_phi_handle,
+    const int phi_handle,
+    const int upwind_function_handle,
     const int phi_component = 0);
 
   /*!
@@ -202,6 +257,11 @@ public:
    *  - phi_handle (in):                PatchData handle for phi
    *  - phi_component (in):             component of phi for which to compute
    *                                    spatial derivatives (default = 0)
+   *  - coarsest_level (in):            coarsest level of hierarchy to
+   *                                    update (default = 0)
+   *  - finest_level (in):              finest level of hierarchy to update
+   *                                    (default = -1, i.e. finest level
+   *                                    of hierarchy)
    *
    * Return value:                      none
    *
@@ -227,7 +287,42 @@ public:
     const int grad_phi_plus_handle,
     const int grad_phi_minus_handle,
     const int phi_handle,
-    const int phi_component = 0);
+    const int phi_component = 0,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
+
+  /*!
+   * This version of computePlusAndMinusSpatialDerivatives() computes 
+   * the forward (plus) and backward (minus) approximations to the 
+   * spatial derivatives on a single patch.  It allows calculations 
+   * to skip patches where no work is required.
+   *
+   * Arguments:     
+   *  - patch (in):                     Pointer to Patch containing data
+   *  - fillbox_growth (in):            number of cells that the region
+   *                                    where derivatives are computed
+   *                                    extends beyond the patch interior
+   *                                    (default = 0)
+   *  - all other arguments:            same as for hierarchy version
+   *
+   * Return value:                      none
+   *
+   * NOTES:
+   *  - When fillbox_growth is positive, the PatchData for grad(phi)
+   *    must have at least fillbox_growth ghost cells and the PatchData 
+   *    for phi must have fillbox_growth more ghost cells than the
+   *    selected ENO/WENO scheme requires.
+   *
+   */
+  static void computePlusAndMinusSpatialDerivatives(
+    Pointer< Patch<DIM> > patch,
+    const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+    const int spatial_derivative_order,
+    const int grad_phi_plus_handle,
+    const int grad_phi_minus_handle,
+    const int phi_handle,
+    const int phi_component = 0,
+    const int fillbox_growth = 0);
 
   /*!
    * computeCentralSpatialDerivatives() computes central approximations 
@@ -311,6 +406,11 @@ public:
    *                            (default = 0)
    *  - rhs_component (in):     component of rhs to use in step
    *                            (default = 0)
+   *  - coarsest_level (in):    coarsest level of hierarchy to
+   *                            update (default = 0)
+   *  - finest_level (in):      finest level of hierarchy to update
+   *                            (default = -1, i.e. finest level
+   *                            of hierarchy)
    *
    * Return value:              none
    *
@@ -323,7 +423,9 @@ public:
     const LSMLIB_REAL dt,
     const int u_next_component = 0,
     const int u_cur_component = 0,
-    const int rhs_component = 0);
+    const int rhs_component = 0,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
 
   /*!
    * TVDRK2Stage1() advances the solution through the first stage
@@ -342,6 +444,14 @@ public:
    *                              (default = 0)
    *  - rhs_component (in):       component of rhs to use in step
    *                              (default = 0)
+   *  - fillbox_growth (in):      number of cells that the update 
+   *                              extends into the ghost region 
+   *                              (default = 0)
+   *  - coarsest_level (in):      coarsest level of hierarchy to
+   *                              update (default = 0)
+   *  - finest_level (in):        finest level of hierarchy to update
+   *                              (default = -1, i.e. finest level
+   *                              of hierarchy)
    *
    * Return value:                none
    *
@@ -354,7 +464,10 @@ public:
     const LSMLIB_REAL dt,
     const int u_stage1_component = 0,
     const int u_cur_component = 0,
-    const int rhs_component = 0);
+    const int rhs_component = 0,
+    const int fillbox_growth = 0,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
 
   /*!
    * TVDRK2Stage2() completes advancing the solution through a 
@@ -376,6 +489,11 @@ public:
    *                              (default = 0)
    *  - rhs_component (in):       component of rhs to use in step
    *                              (default = 0)
+   *  - coarsest_level (in):      coarsest level of hierarchy to
+   *                              update (default = 0)
+   *  - finest_level (in):        finest level of hierarchy to update
+   *                              (default = -1, i.e. finest level
+   *                              of hierarchy)
    *
    * Return value:                none
    *
@@ -390,7 +508,9 @@ public:
     const int u_next_component = 0,
     const int u_stage1_component = 0,
     const int u_cur_component = 0,
-    const int rhs_component = 0);
+    const int rhs_component = 0,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
 
   /*!
    * TVDRK3Stage1() advances the solution through the first stage
@@ -409,6 +529,14 @@ public:
    *                              (default = 0)
    *  - rhs_component (in):       component of rhs to use in step
    *                              (default = 0)
+   *  - fillbox_growth (in):      number of cells that the update 
+   *                              extends into the ghost region 
+   *                              (default = 0)
+   *  - coarsest_level (in):      coarsest level of hierarchy to
+   *                              update (default = 0)
+   *  - finest_level (in):        finest level of hierarchy to update
+   *                              (default = -1, i.e. finest level
+   *                              of hierarchy)
    *
    * Return value:                none
    *
@@ -421,7 +549,10 @@ public:
     const LSMLIB_REAL dt,
     const int u_stage1_component = 0,
     const int u_cur_component = 0,
-    const int rhs_component = 0);
+    const int rhs_component = 0,
+    const int fillbox_growth = 0,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
 
   /*!
    * TVDRK3Stage2() advances the solution through the second stage
@@ -443,6 +574,14 @@ public:
    *                              (default = 0)
    *  - rhs_component (in):       component of rhs to use in step
    *                              (default = 0)
+   *  - fillbox_growth (in):      number of cells that the update 
+   *                              extends into the ghost region 
+   *                              (default = 0)
+   *  - coarsest_level (in):      coarsest level of hierarchy to
+   *                              update (default = 0)
+   *  - finest_level (in):        finest level of hierarchy to update
+   *                              (default = -1, i.e. finest level
+   *                              of hierarchy)
    *
    * Return value:                none
    *
@@ -457,7 +596,10 @@ public:
     const int u_stage2_component = 0,
     const int u_stage1_component = 0,
     const int u_cur_component = 0,
-    const int rhs_component = 0);
+    const int rhs_component = 0,
+    const int fillbox_growth = 0,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
 
   /*!
    * TVDRK3Stage3() completes advancing the solution through a 
@@ -479,6 +621,11 @@ public:
    *                              (default = 0)
    *  - rhs_component (in):       component of rhs to use in step
    *                              (default = 0)
+   *  - coarsest_level (in):      coarsest level of hierarchy to
+   *                              update (default = 0)
+   *  - finest_level (in):        finest level of hierarchy to update
+   *                              (default = -1, i.e. finest level
+   *                              of hierarchy)
    *
    * Return value:                none
    *
@@ -493,7 +640,128 @@ public:
     const int u_next_component = 0,
     const int u_stage2_component = 0,
     const int u_cur_component = 0,
-    const int rhs_component = 0);
+    const int rhs_component = 0,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
+
+  /*!
+   * SSPRKStage() advances the solution through a single stage of a
+   * low-storage strong stability preserving (SSP) Runge-Kutta method.
+   * Each stage has the form
+   *
+   *   u_next = alpha*u_cur + (1-alpha)*( u_stage + dt*rhs ),
+   *
+   * so only u_cur and a single stage need to be stored.  u_next may 
+   * be the same PatchData as u_stage or u_cur.
+   *
+   * Arguments:     
+   *  - hierarchy (in):           Pointer to PatchHierarchy containing
+   *                              data
+   *  - u_next_handle (out):      PatchData handle for u at the end of 
+   *                              the stage
+   *  - u_stage_handle (in):      PatchData handle for u at the 
+   *                              beginning of the stage
+   *  - u_cur_handle (in):        PatchData handle for u(t)
+   *  - rhs_handle (in):          PatchData handle for rhs computed
+   *                              from u_stage
+   *  - alpha (in):               weight of u_cur for the stage
+   *  - dt (in):                  time increment for the stage
+   *  - u_next_component (in):    component of u_next to use in step
+   *                              (default = 0)
+   *  - u_stage_component (in):   component of u_stage to use in step
+   *                              (default = 0)
+   *  - u_cur_component (in):     component of u_cur to use in step
+   *                              (default = 0)
+   *  - rhs_component (in):       component of rhs to use in step
+   *                              (default = 0)
+   *  - coarsest_level (in):      coarsest level of hierarchy to
+   *                              update (default = 0)
+   *  - finest_level (in):        finest level of hierarchy to update
+   *                              (default = -1, i.e. finest level
+   *                              of hierarchy)
+   *
+   * Return value:                none
+   *
+   */
+  static void SSPRKStage(
+    Pointer< PatchHierarchy<DIM> > hierarchy,
+    const int u_next_handle,
+    const int u_stage_handle,
+    const int u_cur_handle,
+    const int rhs_handle,
+    const LSMLIB_REAL alpha,
+    const LSMLIB_REAL dt,
+    const int u_next_component = 0,
+    const int u_stage_component = 0,
+    const int u_cur_component = 0,
+    const int rhs_component = 0,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
+
+  /*!
+   * semiLagrangianAdvectionStep() takes a single semi-Lagrangian step 
+   * for the advection equation u_t + vel . grad(u) = 0.  The 
+   * characteristic through each cell center is traced back to its 
+   * departure point and u_in is interpolated there (using 
+   * multilinear interpolation).  The result is blended with u_cur:
+   *
+   *   u_next = alpha*u_cur + (1-alpha)*u_in(departure point)
+   *
+   * Semi-Lagrangian steps are not restricted by the CFL condition.  
+   * A BFECC (back and forth error compensation and correction) step 
+   * is built from three calls:
+   *
+   *  -# u_fwd  = SL(u_cur; dt)                     (alpha = 0)
+   *  -# u_corr = 3/2 u_cur - 1/2 SL(u_fwd; -dt)    (alpha = 3/2)
+   *  -# u_next = SL(u_corr; dt)                    (alpha = 0)
+   *
+   * Arguments:     
+   *  - hierarchy (in):           Pointer to PatchHierarchy containing
+   *                              data
+   *  - u_next_handle (out):      PatchData handle for u at the end of 
+   *                              the step
+   *  - u_cur_handle (in):        PatchData handle for u(t) (only used 
+   *                              when alpha is nonzero)
+   *  - u_in_handle (in):         PatchData handle for u to interpolate
+   *                              at the departure points
+   *  - velocity_handle (in):     PatchData handle for velocity field
+   *  - alpha (in):               weight of u_cur
+   *  - dt (in):                  time increment (negative for backward
+   *                              steps)
+   *  - u_next_component (in):    component of u_next to use in step
+   *                              (default = 0)
+   *  - u_cur_component (in):     component of u_cur to use in step
+   *                              (default = 0)
+   *  - u_in_component (in):      component of u_in to use in step
+   *                              (default = 0)
+   *  - coarsest_level (in):      coarsest level of hierarchy to
+   *                              update (default = 0)
+   *  - finest_level (in):        finest level of hierarchy to update
+   *                              (default = -1, i.e. finest level
+   *                              of hierarchy)
+   *
+   * Return value:                none
+   *
+   * NOTES:
+   *  - the ghostcells of u_in must be filled and the ghostcell width 
+   *    of u_in should be at least int(CFL)+1.  Departure points that 
+   *    fall outside of the ghostbox are moved to its boundary.
+   *  - u_next may be the same PatchData as u_cur but NOT u_in.
+   *
+   */
+  static void semiLagrangianAdvectionStep(
+    Pointer< PatchHierarchy<DIM> > hierarchy,
+    const int u_next_handle,
+    const int u_cur_handle,
+    const int u_in_handle,
+    const int velocity_handle,
+    const LSMLIB_REAL alpha,
+    const LSMLIB_REAL dt,
+    const int u_next_component = 0,
+    const int u_cur_component = 0,
+    const int u_in_component = 0,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
 
   //! @}
 
@@ -813,6 +1081,9 @@ public:
    *                                 function (default = 0)
    *  - heaviside_width (in):        width of Heaviside function as a multiple 
    *                                 of the grid spacing (default = 3)
+   *  - use_global_reduction (in):   flag indicating whether the result 
+   *                                 should be reduced across processors
+   *                                 (default = true)
    *
    * Return value:                   volume of the specified domain that
    *                                 is enclosed by the zero level set
@@ -824,7 +1095,8 @@ public:
     const int control_volume_handle,
     const int region_indicator,
     const int phi_component = 0,
-    const int heaviside_width = 3);
+    const int heaviside_width = 3,
+    const bool use_global_reduction = true);
 
   /*!
    * computeVolumeOfZeroLevelSet() computes the volume of the codimension-one
@@ -841,6 +1113,9 @@ public:
    *                                 function (default = 0)
    *  - delta_width (in):            width of delta-function as a multiple of
    *                                 the grid spacing (default = 3)
+   *  - use_global_reduction (in):   flag indicating whether the result 
+   *                                 should be reduced across processors
+   *                                 (default = true)
    *
    * Return value:                   volume of zero level set
    *
@@ -856,7 +1131,8 @@ public:
     const int grad_phi_handle,
     const int control_volume_handle,
     const int phi_component = 0,
-    const int delta_width = 3);
+    const int delta_width = 3,
+    const bool use_global_reduction = true);
 
   /*!
    * computeVolumeIntegral() computes the volume integral of the specified
@@ -882,6 +1158,9 @@ public:
    *                                 function (default = 0)
    *  - heaviside_width (in):        width of Heaviside function as a multiple 
    *                                 of the grid spacing (default = 3)
+   *  - use_global_reduction (in):   flag indicating whether the result 
+   *                                 should be reduced across processors
+   *                                 (default = true)
    *
    * Return value:                   integral of F over the specified domain
    *
@@ -894,7 +1173,8 @@ public:
     const int region_integrator,
     const int F_component = 0,
     const int phi_component = 0,
-    const int heaviside_width = 3);
+    const int heaviside_width = 3,
+    const bool use_global_reduction = true);
 
   /*!
    * computeSurfaceIntegral() computes the surface integral over the 
@@ -914,6 +1194,9 @@ public:
    *                                 function (default = 0)
    *  - delta_width (in):            width of delta-function as a multiple of
    *                                 the grid spacing (default = 3)
+   *  - use_global_reduction (in):   flag indicating whether the result 
+   *                                 should be reduced across processors
+   *                                 (default = true)
    *
    * Return value:                   integral of F over the zero level set
    *
@@ -931,7 +1214,8 @@ public:
     const int control_volume_handle,
     const int F_component = 0,
     const int phi_component = 0,
-    const int delta_width = 3);
+    const int delta_width = 3,
+    const bool use_global_reduction = true);
 
   //! @}
 
@@ -956,6 +1240,14 @@ public:
    *                                 data
    *  - control_volume_handle (in):  PatchData handle for control volume
    *  - cfl_number (in):             CFL number
+   *  - use_global_reduction (in):   flag indicating whether the result 
+   *                                 should be reduced across processors
+   *                                 (default = true)
+   *  - coarsest_level (in):         coarsest level of hierarchy to
+   *                                 include (default = 0)
+   *  - finest_level (in):           finest level of hierarchy to include
+   *                                 (default = -1, i.e. finest level
+   *                                 of hierarchy)
    *
    * Return value:                   none
    *
@@ -964,7 +1256,10 @@ public:
     Pointer< PatchHierarchy<DIM> > patch_hierarchy,
     const int velocity_handle,
     const int control_volume_handle,
-    const LSMLIB_REAL cfl_number);
+    const LSMLIB_REAL cfl_number,
+    const bool use_global_reduction = true,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
 
   /*!
    * computeStableNormalVelocityDt() computes the maximum stable
@@ -982,6 +1277,14 @@ public:
    *                                  computed using forward differencing
    *  - control_volume_handle (in):   PatchData handle for control volume
    *  - cfl_number (in):              CFL number
+   *  - use_global_reduction (in):    flag indicating whether the result 
+   *                                  should be reduced across processors
+   *                                  (default = true)
+   *  - coarsest_level (in):          coarsest level of hierarchy to
+   *                                  include (default = 0)
+   *  - finest_level (in):            finest level of hierarchy to include
+   *                                  (default = -1, i.e. finest level
+   *                                  of hierarchy)
    *
    * Return value:                    none
    *
@@ -995,7 +1298,10 @@ public:
     const int grad_phi_plus_handle,
     const int grad_phi_minus_handle,
     const int control_volume_handle,
-    const LSMLIB_REAL cfl_number);
+    const LSMLIB_REAL cfl_number,
+    const bool use_global_reduction = true,
+    const int coarsest_level = 0,
+    const int finest_level = -1);
 
   /*!
    * maxNormOfDifference() computes the max norm of the difference 
@@ -1011,6 +1317,9 @@ public:
    *                                 (default = 0)
    *  - field2_component (in):       component of field2 to use 
    *                                 (default = 0)
+   *  - use_global_reduction (in):   flag indicating whether the result 
+   *                                 should be reduced across processors
+   *                                 (default = true)
    *
    * Return value:                   max norm of (field1 - field2)
    *
@@ -1021,8 +1330,73 @@ public:
     const int field2_handle,
     const int control_volume_handle,
     const int field1_component = 0,
+    const int field2_component = 0,
+    const bool use_global_reduction = true);
+
+  /*!
+   * This version of maxNormOfDifference() computes the max norm of the
+   * difference of two scalar fields on a single patch.  
+   *
+   * Arguments:     
+   *  - patch (in):                  Pointer to Patch containing data
+   *  - all other arguments:         same as for hierarchy version
+   *
+   * Return value:                   max norm of (field1 - field2) on
+   *                                 the patch
+   *
+   * NOTES:
+   *  - No reduction across processors is performed.
+   *
+   */
+  static LSMLIB_REAL maxNormOfDifference(
+    Pointer< Patch<DIM> > patch,
+    const int field1_handle,
+    const int field2_handle,
+    const int control_volume_handle,
+    const int field1_component = 0,
     const int field2_component = 0);
 
+  /*!
+   * computeGradPhiDeviationSums() computes the sum of | |grad(phi)| - 1 |
+   * and the number of grid cells over the cells within a band of the
+   * zero level set (i.e. |phi| < band_width) on a single patch.  The 
+   * band-averaged deviation is a cheap measure of how far phi has 
+   * drifted from a signed distance function and may be used to decide
+   * when reinitialization is required.
+   *
+   * Arguments:     
+   *  - deviation_sum (out):         sum of | |grad(phi)| - 1 | 
+   *  - num_cells_in_band (out):     number of cells in the band
+   *  - patch (in):                  Pointer to Patch containing data
+   *  - phi_handle (in):             PatchData handle for phi
+   *  - control_volume_handle (in):  PatchData handle for control volume
+   *  - band_width (in):             half-width of band about the zero 
+   *                                 level set
+   *  - phi_component (in):          component of phi to use 
+   *                                 (default = 0)
+   *
+   * Return value:                   none
+   *
+   * NOTES:
+   *  - grad(phi) is computed using second-order central differences.
+   *    Cells adjacent to patch boundaries are excluded so that the
+   *    ghost cells of phi need not be filled.
+   *
+   *  - Cells with a non-positive control volume (i.e. cells covered
+   *    by a finer level) are not included.
+   *
+   *  - No reduction across processors is performed.
+   *
+   */
+  static void computeGradPhiDeviationSums(
+    LSMLIB_REAL& deviation_sum,
+    LSMLIB_REAL& num_cells_in_band,
+    Pointer< Patch<DIM> > patch,
+    const int phi_handle,
+    const int control_volume_handle,
+    const LSMLIB_REAL band_width,
+    const int phi_component = 0);
+
   /*!
    * computeControlVolumes() computes the control volumes for the
    * cells in the specified PatchHierarchy.
@@ -1069,6 +1443,351 @@ public:
 
   //! @}
 
+  //! @{
+  /*!
+   ******************************************************************
+   *
+   * @name Narrow band snapshots
+   *
+   ******************************************************************/
+
+  /*!
+   * writeNarrowBandSnapshot() writes a narrow band snapshot of the
+   * level set function to a file.  Only the values at grid cells
+   * where |phi| < threshold are stored (see writeNarrowBandData() in
+   * the serial package), which greatly reduces the size of time
+   * series output.
+   *
+   * Each processor writes the data for its local patches to the
+   * file "<file_name>.<processor number>".  For each patch, the
+   * level number, the interior box, and the ghost box are stored
+   * along with the narrow band data for the ghost box.  Processor 0
+   * also writes the index file "<file_name>.index", which records the
+   * ghost box and processor of every patch in the hierarchy.
+   *
+   * Arguments:
+   *  - patch_hierarchy (in):  PatchHierarchy containing the level
+   *                           set function
+   *  - phi_handle (in):       PatchData handle for phi
+   *  - threshold (in):        narrow band threshold
+   *  - file_name (in):        base name of output files
+   *  - component (in):        component of phi to write
+   *                           (default = 0)
+   *  - zip_status (in):       compression of the files
+   *                           (NO_ZIP, GZIP, BZIP2)
+   *                           (default = NO_ZIP)
+   *
+   * Return value:             none
+   *
+   */
+  static void writeNarrowBandSnapshot(
+    Pointer< PatchHierarchy<DIM> > patch_hierarchy,
+    const int phi_handle,
+    const LSMLIB_REAL threshold,
+    const string& file_name,
+    const int component = 0,
+    const int zip_status = 0);
+
+  /*!
+   * readNarrowBandSnapshot() reads a narrow band snapshot written by
+   * writeNarrowBandSnapshot() into the level set function.  Values
+   * outside of the narrow band are clamped to +/- threshold (with the
+   * sign of phi when the snapshot was written).
+   *
+   * Arguments:
+   *  - patch_hierarchy (in):  PatchHierarchy containing the level
+   *                           set function
+   *  - phi_handle (in):       PatchData handle for phi
+   *  - file_name (in):        base name of input files
+   *  - component (in):        component of phi to read into
+   *                           (default = 0)
+   *
+   * Return value:             none
+   *
+   * NOTES:
+   *  - The snapshot may be read by a different number of processors
+   *    than it was written by.  Each processor uses the index file to
+   *    open only the files that contain stored patches intersecting
+   *    the ghost boxes of its local patches.  If there is no index 
+   *    file, the files written by all processors are read.
+   *
+   *  - The data for a patch is copied from the interiors of the 
+   *    stored patches on the same level that intersect its ghost box.
+   *    Cells not covered by any stored interior (e.g. ghost cells 
+   *    outside of the physical domain) are copied from the stored
+   *    ghost cells.
+   *
+   *  - Cells not covered by the snapshot at all (e.g. on levels that 
+   *    did not exist when the snapshot was written) are set to 
+   *    +/- threshold with the sign of the nearest cell in the same 
+   *    patch that is covered (+threshold if no cell in the patch is
+   *    covered).  Boundary conditions should be imposed after the 
+   *    snapshot is read.
+   *
+   */
+  static void readNarrowBandSnapshot(
+    Pointer< PatchHierarchy<DIM> > patch_hierarchy,
+    const int phi_handle,
+    const string& file_name,
+    const int component = 0);
+
+  //! @}
+
+  //! @{
+  /*!
+   ******************************************************************
+   *
+   * @name Scratch data management
+   *
+   ******************************************************************/
+
+  /*!
+   * setUsePersistentScratchData() sets the allocation policy for the
+   * scratch PatchData used internally by the toolbox (e.g. the divided
+   * differences used to compute ENO/WENO derivatives).  When persistent
+   * scratch data is used, the scratch data is allocated the first time
+   * it is needed on a patch and kept alive between calls, so it is only
+   * reallocated for new patches (i.e. after regridding).  Otherwise,
+   * the scratch data is allocated and deallocated on every call.
+   *
+   * Arguments:
+   *  - use_persistent_scratch_data (in):  true if scratch data should 
+   *                                       be kept between calls
+   *
+   * Return value:                         none
+   *
+   * NOTES:
+   *  - The default is to deallocate scratch data after every call.
+   *
+   */
+  static void setUsePersistentScratchData(
+    const bool use_persistent_scratch_data);
+
+  /*!
+   * usePersistentScratchData() returns the current allocation policy
+   * for the scratch PatchData used internally by the toolbox.
+   *
+   * Arguments:     none
+   *
+   * Return value:  true if scratch data is kept between calls
+   *
+   */
+  static bool usePersistentScratchData();
+
+  /*!
+   * checkSpatialDerivativeParameters() raises an error if the specified
+   * ENO/WENO scheme (or DIM) is not supported.  Threaded patch loops 
+   * call it before entering the threaded region because errors cannot
+   * be raised from inside of it.
+   *
+   * Arguments:
+   *  - method_name (in):               name of calling method (used in
+   *                                    error messages)
+   *  - spatial_derivative_type (in):   type of spatial derivative 
+   *                                    calculation
+   *  - spatial_derivative_order (in):  order of spatial derivative
+   *
+   * Return value:                      none
+   *
+   */
+  static void checkSpatialDerivativeParameters(
+    const string& method_name,
+    const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+    const int spatial_derivative_order);
+
+  /*!
+   * allocateSpatialDerivativeScratchData() allocates the scratch 
+   * PatchData required to compute spatial derivatives using the 
+   * specified ENO/WENO scheme on a patch.
+   *
+   * Arguments:
+   *  - patch (in):                     Patch on which to allocate
+   *                                    scratch data
+   *  - spatial_derivative_type (in):   type of spatial derivative 
+   *                                    calculation
+   *  - spatial_derivative_order (in):  order of spatial derivative
+   *
+   * Return value:                      none
+   *
+   * NOTES:
+   *  - PatchData allocation is not thread-safe, so patch loops that
+   *    are distributed among threads must allocate the scratch data
+   *    for all patches before entering the threaded region.
+   *
+   */
+  static void allocateSpatialDerivativeScratchData(
+    Pointer< Patch<DIM> > patch,
+    const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+    const int spatial_derivative_order);
+
+  /*!
+   * releaseSpatialDerivativeScratchData() releases the scratch 
+   * PatchData allocated by allocateSpatialDerivativeScratchData()
+   * unless persistent scratch data is being used.
+   *
+   * Arguments:
+   *  - patch (in):                     Patch on which to release
+   *                                    scratch data
+   *  - spatial_derivative_type (in):   type of spatial derivative 
+   *                                    calculation
+   *  - spatial_derivative_order (in):  order of spatial derivative
+   *
+   * Return value:                      none
+   *
+   */
+  static void releaseSpatialDerivativeScratchData(
+    Pointer< Patch<DIM> > patch,
+    const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+    const int spatial_derivative_order);
+
+  /*!
+   * deallocateScratchData() frees all of the scratch PatchData used
+   * internally by the toolbox on the specified PatchHierarchy.
+   *
+   * Arguments:
+   *  - hierarchy (in):  PatchHierarchy on which to free scratch data
+   *
+   * Return value:       none
+   *
+   */
+  static void deallocateScratchData(
+    Pointer< PatchHierarchy<DIM> > hierarchy);
+
+  //! @}
+
+  //! @{
+  /*!
+   ******************************************************************
+   *
+   * @name Batched global reductions
+   *
+   ******************************************************************/
+
+  /*!
+   * addToReductionBatch() adds a processor-local value to the batch of
+   * pending global reductions.  The reduction is not carried out until
+   * completeReductionBatch() is called, so several quantities (e.g. the
+   * stable time step sizes computed with use_global_reduction set to 
+   * false) may be reduced with a single round of communication.
+   *
+   * Arguments:
+   *  - local_value (in):     value on the current processor
+   *  - reduction_type (in):  type of reduction (min, max, or sum)
+   *
+   * Return value:            index used to retrieve the reduced value
+   *                          via getReducedValue()
+   *
+   */
+  static int addToReductionBatch(
+    const LSMLIB_REAL local_value,
+    const REDUCTION_TYPE reduction_type);
+
+  /*!
+   * startReductionBatch() starts the global reductions for all of the 
+   * pending values in the batch without waiting for them to complete.
+   * Computation that does not depend on the reduced values may be 
+   * carried out between startReductionBatch() and 
+   * completeReductionBatch() to overlap it with the communication.
+   *
+   * Arguments:     none
+   *
+   * Return value:  none
+   *
+   * NOTES:
+   *  - The reductions are non-blocking only when the MPI library 
+   *    provides MPI_Iallreduce() (MPI-3 or later).  Otherwise, the 
+   *    reductions are carried out (blocking) by startReductionBatch().
+   *
+   *  - Values added to the batch after startReductionBatch() is called 
+   *    are reduced by the next call to completeReductionBatch().
+   *
+   *  - This method must be called on all processors with the same 
+   *    sequence of reduction types.
+   *
+   */
+  static void startReductionBatch();
+
+  /*!
+   * completeReductionBatch() carries out all of the pending reductions
+   * added since the last call to completeReductionBatch() or 
+   * clearReductionBatch().  Reductions started by startReductionBatch() 
+   * are waited for; all other pending values are reduced immediately.
+   *
+   * Arguments:     none
+   *
+   * Return value:  none
+   *
+   * NOTES:
+   *  - All min and max reductions are combined into a single max 
+   *    reduction (using min(x) = -max(-x)), and all sum reductions are 
+   *    combined into a single sum reduction.  So, at most two global 
+   *    reductions are performed regardless of the size of the batch.
+   *
+   *  - This method must be called on all processors with the same 
+   *    sequence of reduction types.
+   *
+   */
+  static void completeReductionBatch();
+
+  /*!
+   * getReducedValue() returns the result of a reduction in the batch.
+   *
+   * Arguments:
+   *  - index (in):  index returned by addToReductionBatch()
+   *
+   * Return value:   reduced value
+   *
+   * NOTES:
+   *  - It is an error to request a value before completeReductionBatch()
+   *    has been called for it.
+   *
+   */
+  static LSMLIB_REAL getReducedValue(const int index);
+
+  /*!
+   * clearReductionBatch() removes all values from the reduction batch.
+   *
+   * Arguments:     none
+   *
+   * Return value:  none
+   *
+   * NOTES:
+   *  - Library routines never call clearReductionBatch(), so values 
+   *    added by the application remain in the batch until the 
+   *    application clears them.
+   *
+   */
+  static void clearReductionBatch();
+
+  /*!
+   * getReductionBatchSize() returns the number of values in the 
+   * reduction batch.  Together with truncateReductionBatch(), it allows
+   * a routine to remove only the values that it added to the batch.
+   *
+   * Arguments:     none
+   *
+   * Return value:  number of values in the reduction batch
+   *
+   */
+  static int getReductionBatchSize();
+
+  /*!
+   * truncateReductionBatch() removes all values added to the reduction
+   * batch after it contained num_values values.  Values added before 
+   * that point (and their reduced values) are left untouched.
+   *
+   * Arguments:
+   *  - num_values (in):  number of values to keep in the batch (usually
+   *                      the value returned by getReductionBatchSize()
+   *                      before any values were added)
+   *
+   * Return value:        none
+   *
+   */
+  static void truncateReductionBatch(const int num_values);
+
+  //! @}
+
 protected:
 
   //! @{
@@ -1079,6 +1798,78 @@ protected:
    *
    ******************************************************************/
 
+  /*!
+   * allocateScratchPatchData() allocates scratch PatchData on a patch
+   * unless it is already allocated (e.g. because persistent scratch 
+   * data is being used).
+   *
+   * Arguments:
+   *  - patch (in):           Patch on which to allocate scratch data
+   *  - scratch_handle (in):  PatchData handle of scratch data
+   *
+   * Return value:            none
+   *
+   */
+  static void allocateScratchPatchData(
+    Pointer< Patch<DIM> > patch,
+    const int scratch_handle);
+
+  /*!
+   * releaseScratchPatchData() deallocates scratch PatchData on a patch
+   * unless persistent scratch data is being used.  When called from 
+   * inside of a threaded patch loop, the scratch data is left
+   * allocated so that it can be released after the loop completes.
+   *
+   * Arguments:
+   *  - patch (in):           Patch on which to release scratch data
+   *  - scratch_handle (in):  PatchData handle of scratch data
+   *
+   * Return value:            none
+   *
+   */
+  static void releaseScratchPatchData(
+    Pointer< Patch<DIM> > patch,
+    const int scratch_handle);
+
+  /*!
+   * getSpatialDerivativeScratchHandles() fills scratch_handles with the
+   * PatchData handles of the divided differences used by the specified
+   * ENO/WENO scheme.
+   *
+   * Arguments:
+   *  - scratch_handles (out):          PatchData handles of scratch data
+   *  - spatial_derivative_type (in):   type of spatial derivative 
+   *                                    calculation
+   *  - spatial_derivative_order (in):  order of spatial derivative
+   *
+   * Return value:                      number of scratch handles
+   *
+   */
+  static int getSpatialDerivativeScratchHandles(
+    int scratch_handles[3],
+    const SPATIAL_DERIVATIVE_TYPE spatial_derivative_type,
+    const int spatial_derivative_order);
+
+  /*!
+   * getScratchHandle() returns the PatchData handle of the scratch 
+   * data used to hold divided differences.  If fillbox_growth is 
+   * positive, the handle of a scratch variable whose ghost region is 
+   * widened by fillbox_growth cells is returned instead.  The widened
+   * scratch variable is registered the first time it is requested, so 
+   * it is allocated and released like any other scratch data.
+   *
+   * Arguments:
+   *  - scratch_handle (in):  PatchData handle of scratch data
+   *  - fillbox_growth (in):  number of cells that the fill box extends
+   *                          into the ghost region
+   *
+   * Return value:            PatchData handle of scratch data
+   *
+   */
+  static int getScratchHandle(
+    const int scratch_handle,
+    const int fillbox_growth);
+
   /*!
    * initializeComputeSpatialDerivativesParameters() sets up the 
    * parameters required for computing spatial derivatives.
@@ -1118,12 +1909,35 @@ protected:
   static int s_D2_three_ghostcells_handle;
   static int s_D3_three_ghostcells_handle;
 
+  // Scratch data for divided differences on grown fill boxes (indexed
+  // by scratch handle and fill box growth)
+  // NOTE:  these are set up as needed.
+  static map< pair<int,int>, int > s_grown_scratch_handles;
+
   // Parameters for computing unit normal vector 
   // NOTE:  these are set up as needed.
   static int s_compute_normal_grad_phi_handle;
   static int s_compute_normal_grad_phi_plus_handle;
   static int s_compute_normal_grad_phi_minus_handle;
 
+  // Allocation policy for scratch data
+  static bool s_use_persistent_scratch_data;
+
+  // Batch of global reductions (values, reduction types, and number 
+  // of values that have been reduced)
+  static vector<LSMLIB_REAL> s_reduction_values;
+  static vector<int> s_reduction_types;
+  static int s_num_reduced_values;
+
+  // Reductions in progress (number of values that have been started, 
+  // packed buffers for max and sum reductions, and requests for 
+  // non-blocking reductions)
+  static int s_num_started_reduction_values;
+  static vector<LSMLIB_REAL> s_reduction_max_buffer;
+  static vector<LSMLIB_REAL> s_reduction_sum_buffer;
+  static tbox::MPI::request s_reduction_requests[2];
+  static int s_num_reduction_requests;
+
 
 private:
 
@@ -216,6 +216,75 @@ public:
     const int psi_handle,
     const int component) = 0;
 
+  /*!
+   * computeVelocityFieldOnLevels() computes all necessary level set 
+   * method velocity fields on the specified range of levels.  It is
+   * used by the LevelSetFunctionIntegrator in place of 
+   * computeVelocityField() so that the velocity fields are only 
+   * computed on the levels that are advanced (e.g. a single level when
+   * finer levels are subcycled).
+   *
+   * Arguments:
+   *  - time (in):            time that velocity field is to be computed
+   *  - phi_handle (in):      PatchData handle for phi
+   *  - psi_handle (in):      PatchData handle for psi
+   *  - component (in):       component of level set functions for which
+   *                          to compute velocity field 
+   *  - coarsest_level (in):  coarsest level on which to compute the 
+   *                          velocity field
+   *  - finest_level (in):    finest level on which to compute the 
+   *                          velocity field
+   *
+   * Return value:            none
+   *
+   * NOTES:
+   *   - See computeVelocityField() for a description of phi_handle and
+   *     psi_handle.
+   *
+   *   - This method is virtual with a default implementation that 
+   *     calls computeVelocityField() (i.e. computes the velocity field
+   *     on the entire hierarchy) so that users do not need to provide 
+   *     an implementation when the cost of the velocity field 
+   *     calculation on the other levels is not important.
+   *
+   */
+  virtual void computeVelocityFieldOnLevels(
+    const LSMLIB_REAL time,
+    const int phi_handle,
+    const int psi_handle,
+    const int component,
+    const int coarsest_level,
+    const int finest_level)
+  { computeVelocityField(time, phi_handle, psi_handle, component); }
+
+  /*!
+   * velocityFieldDependsOnLevelSetFunctions() indicates whether the
+   * velocity field computed by computeVelocityField() depends on the
+   * level set functions.
+   *
+   * Arguments:     none
+   *
+   * Return value:  true if the velocity field depends on the level set
+   *                functions; false otherwise
+   *
+   * NOTES:
+   *   - When use_velocity_time_interpolation is TRUE for the 
+   *     LevelSetFunctionIntegrator, velocity fields computed during 
+   *     one time step are only reused in the next time step if this 
+   *     method returns false.  The velocity field at the end of a time
+   *     step is computed from the predicted (rather than the final) 
+   *     level set functions, so it should not be reused when the 
+   *     velocity depends on the level set functions.
+   *
+   *   - This method is virtual with a default implementation that 
+   *     returns true (rather than pure virtual) so that users do not 
+   *     need to provide an implementation when the velocity field 
+   *     depends on the level set functions.
+   *
+   */
+  virtual bool velocityFieldDependsOnLevelSetFunctions() const 
+  { return true; }
+
   //! @}
 
 
@@ -30,6 +30,7 @@ extern "C" {
 #include "PatchLevel.h" 
 #include "VariableContext.h" 
 #include "VariableDatabase.h" 
+#include "tbox/MPI.h"
 
 // Headers for Fortran kernels
 extern "C" {
@@ -155,6 +156,12 @@ ReinitializationAlgorithm<DIM>::ReinitializationAlgorithm(
     }
   }
 
+  // update all patches until the stop criteria are met
+  d_skip_converged_patches = LSM_DEFAULT_SKIP_CONVERGED_PATCHES;
+
+  // fill ghost cells at every TVD Runge-Kutta stage
+  d_use_wide_ghost_regions = LSM_DEFAULT_USE_WIDE_GHOST_REGIONS;
+
 
   // set verbose-mode
   d_verbose_mode = verbose_mode;
@@ -258,6 +265,9 @@ void ReinitializationAlgorithm<DIM>::reinitializeLevelSetFunctions(
     }
   }
 
+  // mark all patches as active
+  initializePatchActivity(d_num_phi_components);
+
 
   /*
    *  main reinitialization loop
@@ -271,6 +281,9 @@ void ReinitializationAlgorithm<DIM>::reinitializeLevelSetFunctions(
 
     // reset delta to zero
     delta = 0.0;
+    const int batch_start = 
+      LevelSetMethodToolbox<DIM>::getReductionBatchSize();
+    int first_delta_idx = -1;
 
     // loop over components in level set function
     for (int component = 0; component < d_num_phi_components; component++) {
@@ -302,16 +315,36 @@ void ReinitializationAlgorithm<DIM>::reinitializeLevelSetFunctions(
       } // end switch on TVD Runge-Kutta order
 
       // update count and delta
-      if (d_use_iteration_stop_tol) {
-        delta += LevelSetMethodToolbox<DIM>::maxNormOfDifference(
-          d_patch_hierarchy, phi_handle_after_step, phi_handle_before_step, 
-          d_control_volume_handle, component, 0);  // 0 is component of field
-                                                   // before the time step
-                                                   // which is just a single
-                                                   // component scratch space
+      // NOTE: without patch skipping, the max norms for all components 
+      //       are reduced across processors in a single batch after the 
+      //       loop over components
+      if (d_skip_patches) {
+        delta += updatePatchActivity(component);
+      } else if (d_use_iteration_stop_tol) {
+        const int delta_idx = LevelSetMethodToolbox<DIM>::addToReductionBatch(
+          LevelSetMethodToolbox<DIM>::maxNormOfDifference(
+            d_patch_hierarchy, phi_handle_after_step, phi_handle_before_step, 
+            d_control_volume_handle, component, 0,  // 0 is component of 
+                                                    // field before the time 
+                                                    // step which is just a 
+                                                    // single component 
+                                                    // scratch space
+            false),
+          LevelSetMethodToolbox<DIM>::REDUCTION_MAX);
+        if (component == 0) first_delta_idx = delta_idx;
       }
     } // end loop over components of level set function
 
+    if (!d_skip_patches && d_use_iteration_stop_tol) {
+      LevelSetMethodToolbox<DIM>::completeReductionBatch();
+      for (int component = 0; component < d_num_phi_components; 
+           component++) {
+        delta += LevelSetMethodToolbox<DIM>::getReducedValue(
+          first_delta_idx + component);
+      }
+      LevelSetMethodToolbox<DIM>::truncateReductionBatch(batch_start);
+    }
+
     // VERBOSE MODE
     if (d_verbose_mode) {
       pout << endl;
@@ -352,6 +385,17 @@ void ReinitializationAlgorithm<DIM>::reinitializeLevelSetFunctions(
     if (d_use_iteration_stop_tol)
       pout << "  Last max norm of change in level set function: " 
            << delta << endl;
+    if (d_skip_patches) {
+      LSMLIB_REAL percent_skipped = 0.0;
+      if (d_num_cell_updates > 0) {
+        percent_skipped = 100.0*d_num_cell_updates_skipped
+                        / d_num_cell_updates;
+      }
+      pout << "  Patch updates skipped on this processor: " 
+           << d_num_patch_updates_skipped << " of " 
+           << d_num_patch_updates << " (" 
+           << percent_skipped << "% of cell updates)" << endl;
+    }
   }
 
   // deallocate patch data that was allocated for reinitialization 
@@ -424,6 +468,9 @@ void ReinitializationAlgorithm<DIM>::
   } 
 
 
+  // mark all patches as active
+  initializePatchActivity(component+1);
+
   /*
    *  main reinitialization loop
    */
@@ -461,7 +508,9 @@ void ReinitializationAlgorithm<DIM>::
     } // end switch on TVD Runge-Kutta order
 
     // update count and delta
-    if (d_use_iteration_stop_tol) {
+    if (d_skip_patches) {
+      delta = updatePatchActivity(component);
+    } else if (d_use_iteration_stop_tol) {
       delta = LevelSetMethodToolbox<DIM>::maxNormOfDifference(
         d_patch_hierarchy, phi_handle_after_step, phi_handle_before_step, 
         d_control_volume_handle, component, 0);  // 0 is component of field
@@ -510,6 +559,17 @@ void ReinitializationAlgorithm<DIM>::
     if (d_use_iteration_stop_tol)
       pout << "  Last change in max norm of level set function: " 
            << delta << endl;
+    if (d_skip_patches) {
+      LSMLIB_REAL percent_skipped = 0.0;
+      if (d_num_cell_updates > 0) {
+        percent_skipped = 100.0*d_num_cell_updates_skipped
+                        / d_num_cell_updates;
+      }
+      pout << "  Patch updates skipped on this processor: " 
+           << d_num_patch_updates_skipped << " of " 
+           << d_num_patch_updates << " (" 
+           << percent_skipped << "% of cell updates)" << endl;
+    }
   }
 
   // deallocate patch data that was allocated for reinitialization calculation
@@ -600,7 +660,7 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK1(
     0);
 
   // advance reinitialization equation through TVD-RK1 step
-  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage]);
+  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage], phi_component);
   LevelSetMethodToolbox<DIM>::TVDRK1Step(
     d_patch_hierarchy,
     d_phi_handle,
@@ -618,6 +678,11 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK2(
   const IntVector<DIM>& lower_bc,
   const IntVector<DIM>& upper_bc)
 {
+  // number of cells that the earlier stages are computed into the 
+  // ghost region when ghost cells are only filled once per step
+  const int stage_growth = 
+    d_use_wide_ghost_regions ? d_stencil_ghostcell_width : 0;
+
   // { begin Stage 1
 
   // initialize counter for current stage of TVD RK step
@@ -649,13 +714,15 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK2(
     0);
 
   // advance reinitialization equation through the first stage of TVD-RK2
-  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage]);
+  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage], phi_component,
+                                stage_growth);
   LevelSetMethodToolbox<DIM>::TVDRK2Stage1(
     d_patch_hierarchy,
     d_phi_scr_handles[rk_stage+1],
     d_phi_scr_handles[rk_stage],
     d_rhs_handle, dt,
-    0, 0, 0);  // components of PatchData to use in TVD-RK2 step
+    0, 0, 0,  // components of PatchData to use in TVD-RK2 step
+    stage_growth);
 
   // } end Stage 1
 
@@ -666,10 +733,15 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK2(
   rk_stage = 1;
 
   // fill scratch space for secont stage of time advance
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    // NOTE: 0.0 is "current time" and true indicates that physical 
-    //       boundary conditions should be set.
-    d_phi_fill_bdry_sched[rk_stage][ln]->fillData(0.0,true);
+  // NOTE: with wide ghost regions, the ghost cells were computed by the 
+  //       previous stage, so only the physical boundary conditions
+  //       need to be imposed
+  if (!d_use_wide_ghost_regions) {
+    for ( int ln=0 ; ln < num_levels; ln++ ) {
+      // NOTE: 0.0 is "current time" and true indicates that physical 
+      //       boundary conditions should be set.
+      d_phi_fill_bdry_sched[rk_stage][ln]->fillData(0.0,true);
+    }
   }
   d_bc_module->imposeBoundaryConditions(
     d_phi_scr_handles[rk_stage], 
@@ -680,7 +752,7 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK2(
     0);
 
   // advance reinitialization equation through the second stage of TVD-RK2
-  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage]);
+  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage], phi_component);
   LevelSetMethodToolbox<DIM>::TVDRK2Stage2(
     d_patch_hierarchy,
     d_phi_handle,
@@ -701,6 +773,11 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK3(
   const IntVector<DIM>& lower_bc,
   const IntVector<DIM>& upper_bc)
 {
+  // number of cells that the earlier stages are computed into the 
+  // ghost region when ghost cells are only filled once per step
+  const int stage_growth = 
+    d_use_wide_ghost_regions ? d_stencil_ghostcell_width : 0;
+
   // { begin Stage 1
 
   // initialize counter for current stage of TVD RK step
@@ -732,13 +809,15 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK3(
     0);
 
   // advance reinitialization equation through the first stage of TVD-RK3
-  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage]);
+  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage], phi_component,
+                                2*stage_growth);
   LevelSetMethodToolbox<DIM>::TVDRK3Stage1(
     d_patch_hierarchy,
     d_phi_scr_handles[rk_stage+1],
     d_phi_scr_handles[rk_stage],
     d_rhs_handle, dt,
-    0, 0, 0);  // components of PatchData to use in TVD-RK3 step
+    0, 0, 0,  // components of PatchData to use in TVD-RK3 step
+    2*stage_growth);
 
   // } end Stage 1
 
@@ -749,10 +828,15 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK3(
   rk_stage = 1;
 
   // fill scratch space for secont stage of time advance
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    // NOTE: 0.0 is "current time" and true indicates that physical 
-    //       boundary conditions should be set.
-    d_phi_fill_bdry_sched[rk_stage][ln]->fillData(0.0,true);
+  // NOTE: with wide ghost regions, the ghost cells were computed by the 
+  //       previous stage, so only the physical boundary conditions
+  //       need to be imposed
+  if (!d_use_wide_ghost_regions) {
+    for ( int ln=0 ; ln < num_levels; ln++ ) {
+      // NOTE: 0.0 is "current time" and true indicates that physical 
+      //       boundary conditions should be set.
+      d_phi_fill_bdry_sched[rk_stage][ln]->fillData(0.0,true);
+    }
   }
   d_bc_module->imposeBoundaryConditions(
     d_phi_scr_handles[rk_stage], 
@@ -763,14 +847,16 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK3(
     0);
 
   // advance reinitialization equation through the second stage of TVD-RK3
-  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage]);
+  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage], phi_component,
+                                stage_growth);
   LevelSetMethodToolbox<DIM>::TVDRK3Stage2(
     d_patch_hierarchy,
     d_phi_scr_handles[rk_stage+1],
     d_phi_scr_handles[rk_stage],
     d_phi_scr_handles[rk_stage-1],
     d_rhs_handle, dt,
-    0, 0, 0, 0);  // components of PatchData to use in TVD-RK3 step
+    0, 0, 0, 0,  // components of PatchData to use in TVD-RK3 step
+    stage_growth);
 
   // } end Stage 2
 
@@ -781,10 +867,15 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK3(
   rk_stage = 2;
 
   // fill scratch space for secont stage of time advance
-  for ( int ln=0 ; ln < num_levels; ln++ ) {
-    // NOTE: 0.0 is "current time" and true indicates that physical 
-    //       boundary conditions should be set.
-    d_phi_fill_bdry_sched[rk_stage][ln]->fillData(0.0,true);
+  // NOTE: with wide ghost regions, the ghost cells were computed by the 
+  //       previous stage, so only the physical boundary conditions
+  //       need to be imposed
+  if (!d_use_wide_ghost_regions) {
+    for ( int ln=0 ; ln < num_levels; ln++ ) {
+      // NOTE: 0.0 is "current time" and true indicates that physical 
+      //       boundary conditions should be set.
+      d_phi_fill_bdry_sched[rk_stage][ln]->fillData(0.0,true);
+    }
   }
   d_bc_module->imposeBoundaryConditions(
     d_phi_scr_handles[rk_stage], 
@@ -795,7 +886,7 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK3(
     0);
 
   // advance reinitialization equation through the third stage of TVD-RK3
-  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage]);
+  computeReinitializationEqnRHS(d_phi_scr_handles[rk_stage], phi_component);
   LevelSetMethodToolbox<DIM>::TVDRK3Stage3(
     d_patch_hierarchy,
     d_phi_handle,
@@ -811,17 +902,35 @@ void ReinitializationAlgorithm<DIM>::advanceReinitializationEqnUsingTVDRK3(
 /* computeReinitializationEqnRHS() */
 template <int DIM> 
 void ReinitializationAlgorithm<DIM>::computeReinitializationEqnRHS( 
-  const int phi_handle)
+  const int phi_handle,
+  const int phi_component,
+  const int fillbox_growth)
 {
 
-  // compute spatial derivatives for the current stage
-  LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
-    d_patch_hierarchy,
-    d_spatial_derivative_type,
-    d_spatial_derivative_order,
-    d_grad_phi_plus_handle,
-    d_grad_phi_minus_handle,
-    phi_handle);
+  // NOTE: when the fill box is grown into the ghost region, temporary
+  //       scratch data is created on each patch, so the patch loop is 
+  //       only distributed among threads when fillbox_growth is zero
+  const bool use_threads = (fillbox_growth == 0);
+
+  // NOTE: errors cannot be raised from inside of the threaded loop, so
+  //       the dimension and the ENO/WENO scheme are checked before 
+  //       entering it
+  if ( (DIM < 1) || (DIM > 3) ) {
+    TBOX_ERROR(  d_object_name
+              << "::computeReinitializationEqnRHS(): "
+              << "Invalid value of DIM.  "
+              << "Only DIM = 1, 2, and 3 are supported."
+              << endl);
+  }
+  LevelSetMethodToolbox<DIM>::checkSpatialDerivativeParameters(
+    "computePlusAndMinusSpatialDerivatives",
+    d_spatial_derivative_type, d_spatial_derivative_order);
+
+  // local update counters (accumulated across threads)
+  int num_patch_updates = 0;
+  int num_patch_updates_skipped = 0;
+  double num_cell_updates = 0.0;
+  double num_cell_updates_skipped = 0.0;
 
   // loop over PatchHierarchy and compute RHS for level set equation
   // by calling Fortran routines
@@ -830,6 +939,12 @@ void ReinitializationAlgorithm<DIM>::computeReinitializationEqnRHS(
 
     Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
     
+    // collect the local patches so that they can be distributed among
+    // threads
+    // NOTE: PatchData allocation is not thread-safe, so the scratch
+    //       data is allocated before entering the threaded loop
+    vector< Pointer< Patch<DIM> > > patches;
+    vector<int> patch_numbers;
     typename PatchLevel<DIM>::Iterator pi;
     for (pi.initialize(level); pi; pi++) { // loop over patches
       const int pn = *pi;
@@ -841,9 +956,51 @@ void ReinitializationAlgorithm<DIM>::computeReinitializationEqnRHS(
                   << endl);
       }
 
+#ifdef _OPENMP
+      LevelSetMethodToolbox<DIM>::allocateSpatialDerivativeScratchData(
+        patch, d_spatial_derivative_type, d_spatial_derivative_order);
+#endif
+      patches.push_back(patch);
+      patch_numbers.push_back(pn);
+    }
+
+    const int num_patches = patches.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (use_threads) \
+  reduction(+:num_patch_updates,num_patch_updates_skipped, \
+              num_cell_updates,num_cell_updates_skipped)
+#endif
+    for (int k = 0; k < num_patches; k++) {
+      const int pn = patch_numbers[k];
+      Pointer< Patch<DIM> > patch = patches[k];
+
       // get pointers to data and index space ranges
       Pointer< CellData<DIM,LSMLIB_REAL> > rhs_data =
         patch->getPatchData( d_rhs_handle );
+
+      // skip converged patches
+      // NOTE: with a zero RHS, the TVD Runge-Kutta stages leave the level 
+      //       set function on the patch unchanged (up to roundoff)
+      const double num_cells = patch->getBox().size();
+      num_patch_updates++;
+      num_cell_updates += num_cells;
+      if (d_skip_patches && !d_patch_is_active[phi_component][ln][pn]) {
+        rhs_data->fillAll(0.0);
+        num_patch_updates_skipped++;
+        num_cell_updates_skipped += num_cells;
+        continue;
+      }
+
+      // compute spatial derivatives for the current stage
+      LevelSetMethodToolbox<DIM>::computePlusAndMinusSpatialDerivatives(
+        patch,
+        d_spatial_derivative_type,
+        d_spatial_derivative_order,
+        d_grad_phi_plus_handle,
+        d_grad_phi_minus_handle,
+        phi_handle,
+        0, fillbox_growth);
+
       Pointer< CellData<DIM,LSMLIB_REAL> > phi_data =
         patch->getPatchData( phi_handle );
       Pointer< CellData<DIM,LSMLIB_REAL> > grad_phi_plus_data =
@@ -873,6 +1030,7 @@ void ReinitializationAlgorithm<DIM>::computeReinitializationEqnRHS(
 
       // fill box
       Box<DIM> fillbox = rhs_data->getBox();
+      fillbox.grow(IntVector<DIM>(fillbox_growth));
       const IntVector<DIM> fillbox_lower = fillbox.lower();
       const IntVector<DIM> fillbox_upper = fillbox.upper();
 
@@ -981,7 +1139,7 @@ void ReinitializationAlgorithm<DIM>::computeReinitializationEqnRHS(
           &dx[0], &dx[1],
           &use_phi0);
 
-      } else if (DIM == 1) {
+      } else {  // DIM == 1 (other values are rejected before the loop)
 
         LSM1D_COMPUTE_REINITIALIZATION_EQN_RHS(
           rhs,
@@ -1004,17 +1162,221 @@ void ReinitializationAlgorithm<DIM>::computeReinitializationEqnRHS(
           &dx[0],
           &use_phi0);
 
-      } else {  // Unsupported dimension
-        TBOX_ERROR(  d_object_name
-                  << "::computeReinitializationEqnRHS(): "
-                  << "Invalid value of DIM.  "
-                  << "Only DIM = 1, 2, and 3 are supported."
-                  << endl);
       }
 
-    } // end loop over patches in level
+    } // end threaded loop over patches in level
+
+#ifdef _OPENMP
+    for (int k = 0; k < num_patches; k++) {
+      LevelSetMethodToolbox<DIM>::releaseSpatialDerivativeScratchData(
+        patches[k], d_spatial_derivative_type, d_spatial_derivative_order);
+    }
+#endif
+
   } // end loop over levels in hierarchy
 
+  d_num_patch_updates += num_patch_updates;
+  d_num_patch_updates_skipped += num_patch_updates_skipped;
+  d_num_cell_updates += num_cell_updates;
+  d_num_cell_updates_skipped += num_cell_updates_skipped;
+
+}
+
+
+/* initializePatchActivity() */
+template <int DIM> 
+void ReinitializationAlgorithm<DIM>::initializePatchActivity(
+  const int num_components)
+{
+  // patches can only be skipped when there is a convergence criterion
+  d_skip_patches = d_skip_converged_patches && d_use_iteration_stop_tol;
+
+  // reset statistics
+  d_num_patch_updates = 0;
+  d_num_patch_updates_skipped = 0;
+  d_num_cell_updates = 0.0;
+  d_num_cell_updates_skipped = 0.0;
+
+  if (!d_skip_patches) return;
+
+  // mark all patches on all levels as active
+  const int num_levels = d_patch_hierarchy->getNumberLevels();
+  d_patch_is_active.resizeArray(num_components);
+  for (int comp = 0; comp < num_components; comp++) {
+    d_patch_is_active[comp].resizeArray(num_levels);
+    for ( int ln=0 ; ln < num_levels; ln++ ) {
+      Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
+      const int num_patches = level->getNumberOfPatches();
+      d_patch_is_active[comp][ln].resizeArray(num_patches);
+      for (int pn = 0; pn < num_patches; pn++) {
+        d_patch_is_active[comp][ln][pn] = true;
+      }
+    }
+  }
+}
+
+
+/* updatePatchActivity() */
+template <int DIM> 
+LSMLIB_REAL ReinitializationAlgorithm<DIM>::updatePatchActivity(
+  const int component)
+{
+  const int num_levels = d_patch_hierarchy->getNumberLevels();
+
+  /*
+   * compute the change in phi on the active patches owned by this
+   * processor and share the results with all processors
+   * NOTE: the values for all levels are reduced in a single batch
+   *       and only these values are removed from the batch afterwards
+   */
+  const int batch_start = LevelSetMethodToolbox<DIM>::getReductionBatchSize();
+  Array< Array<double> > patch_delta(num_levels);
+  int first_patch_idx = -1;
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+    Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
+    const int num_patches = level->getNumberOfPatches();
+    patch_delta[ln].resizeArray(num_patches);
+    for (int pn = 0; pn < num_patches; pn++) {
+      patch_delta[ln][pn] = 0.0;
+    }
+
+    typename PatchLevel<DIM>::Iterator pi;
+    for (pi.initialize(level); pi; pi++) { // loop over patches
+      const int pn = *pi;
+      if (d_patch_is_active[component][ln][pn]) {
+        patch_delta[ln][pn] = LevelSetMethodToolbox<DIM>::maxNormOfDifference(
+          level->getPatch(pn), d_phi_handle, d_phi_scr_handles[0],
+          d_control_volume_handle, component, 0);  // 0 is component of 
+                                                   // field before the 
+                                                   // time step
+      }
+    }
+
+    for (int pn = 0; pn < num_patches; pn++) {
+      const int patch_idx = LevelSetMethodToolbox<DIM>::addToReductionBatch(
+        patch_delta[ln][pn], LevelSetMethodToolbox<DIM>::REDUCTION_MAX);
+      if (first_patch_idx < 0) first_patch_idx = patch_idx;
+    }
+  }
+  LevelSetMethodToolbox<DIM>::completeReductionBatch();
+
+  LSMLIB_REAL delta = 0.0;
+  int idx = first_patch_idx;
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+    const int num_patches = patch_delta[ln].getSize();
+    for (int pn = 0; pn < num_patches; pn++) {
+      patch_delta[ln][pn] = LevelSetMethodToolbox<DIM>::getReducedValue(idx++);
+      if (delta < patch_delta[ln][pn]) delta = patch_delta[ln][pn];
+    }
+  }
+  LevelSetMethodToolbox<DIM>::truncateReductionBatch(batch_start);
+
+  /*
+   * update patch activity flags
+   */
+
+  // get the number of cells in the computational domain in the 
+  // periodic directions (used to shift boxes across periodic boundaries)
+  const IntVector<DIM> periodic_dirs = d_grid_geometry->getPeriodicShift();
+  BoxArray<DIM> domain(d_grid_geometry->getPhysicalDomain());
+  IntVector<DIM> periodic_shift(0);
+  IntVector<DIM> coarser_periodic_shift(0);
+
+  for ( int ln=0 ; ln < num_levels; ln++ ) {
+    Pointer< PatchLevel<DIM> > level = d_patch_hierarchy->getPatchLevel(ln);
+    const int num_patches = level->getNumberOfPatches();
+    const BoxArray<DIM>& boxes = level->getBoxes();
+
+    IntVector<DIM> ratio_to_coarser(1);
+    if (ln > 0) {
+      ratio_to_coarser = level->getRatioToCoarserLevel();
+      domain.refine(ratio_to_coarser);
+    }
+    const Box<DIM> domain_box = domain.getBoundingBox();
+    coarser_periodic_shift = periodic_shift;
+    for (int dim = 0; dim < DIM; dim++) {
+      if (periodic_dirs(dim) != 0) {
+        periodic_shift(dim) = domain_box.numberCells(dim);
+      }
+    }
+
+    for (int pn = 0; pn < num_patches; pn++) {
+
+      bool active = (patch_delta[ln][pn] > d_iteration_stop_tol);
+
+      if (!active) {
+        // check for changes on patches on the same level
+        Box<DIM> ghost_box(boxes(pn));
+        ghost_box.grow(d_phi_scratch_ghostcell_width);
+        active = ghostDataChanged(ghost_box, boxes, patch_delta[ln],
+                                  periodic_shift);
+
+        // check for changes on patches on the next coarser level
+        // NOTE: the ghost box is grown by one coarse cell to account
+        //       for the stencil of the linear refine operator
+        if (!active && (ln > 0)) {
+          Pointer< PatchLevel<DIM> > coarser_level = 
+            d_patch_hierarchy->getPatchLevel(ln-1);
+          Box<DIM> coarse_ghost_box(ghost_box);
+          coarse_ghost_box.coarsen(ratio_to_coarser);
+          coarse_ghost_box.grow(IntVector<DIM>(1));
+          active = ghostDataChanged(coarse_ghost_box, 
+                                    coarser_level->getBoxes(),
+                                    patch_delta[ln-1],
+                                    coarser_periodic_shift);
+        }
+      }
+
+      d_patch_is_active[component][ln][pn] = active;
+
+    } // end loop over patches
+  } // end loop over levels
+
+  return delta;
+}
+
+
+/* ghostDataChanged() */
+template <int DIM> 
+bool ReinitializationAlgorithm<DIM>::ghostDataChanged(
+  const Box<DIM>& ghost_box,
+  const BoxArray<DIM>& boxes,
+  const Array<double>& patch_delta,
+  const IntVector<DIM>& periodic_shift)
+{
+  // loop over the ghost box and its periodic images
+  int num_images = 1;
+  for (int dim = 0; dim < DIM; dim++) num_images *= 3;
+
+  for (int image = 0; image < num_images; image++) {
+
+    // compute shift for current image (-1, 0, or +1 domain lengths 
+    // in each direction)
+    IntVector<DIM> shift(0);
+    bool valid_image = true;
+    int image_idx = image;
+    for (int dim = 0; dim < DIM; dim++) {
+      const int offset = image_idx%3 - 1;
+      image_idx /= 3;
+      if ( (offset != 0) && (periodic_shift(dim) == 0) ) {
+        valid_image = false;
+      }
+      shift(dim) = offset*periodic_shift(dim);
+    }
+    if (!valid_image) continue;
+
+    Box<DIM> shifted_ghost_box(ghost_box);
+    shifted_ghost_box.shift(shift);
+
+    for (int qn = 0; qn < boxes.getNumberOfBoxes(); qn++) {
+      if (patch_delta[qn] > d_iteration_stop_tol) {
+        Box<DIM> intersection = shifted_ghost_box*boxes(qn);
+        if ( !intersection.empty() ) return true;
+      }
+    }
+  }
+
+  return false;
 }
 
 
@@ -1045,9 +1407,22 @@ void ReinitializationAlgorithm<DIM>::initializeVariables()
                 << endl );
   }
 
+  d_stencil_ghostcell_width = scratch_ghostcell_width_for_grad;
   d_phi_scratch_ghostcell_width = 
     IntVector<DIM>(scratch_ghostcell_width_for_grad);
-  IntVector<DIM> zero_ghostcell_width(0);
+  IntVector<DIM> rhs_ghostcell_width(0);
+
+  // with wide ghost regions, the ghost cells filled at the beginning of 
+  // a TVD Runge-Kutta step must support all of the stages.  Each stage 
+  // before the last one is computed on the part of the ghost region 
+  // required by the remaining stages, so the RHS and grad(phi) need 
+  // (tvd_runge_kutta_order-1) stencil widths of ghost cells.
+  if (d_use_wide_ghost_regions) {
+    d_phi_scratch_ghostcell_width = IntVector<DIM>(
+      d_tvd_runge_kutta_order*scratch_ghostcell_width_for_grad);
+    rhs_ghostcell_width = IntVector<DIM>(
+      (d_tvd_runge_kutta_order-1)*scratch_ghostcell_width_for_grad);
+  }
 
   /*
    * create variables and PatchData for scratch data
@@ -1114,7 +1489,7 @@ void ReinitializationAlgorithm<DIM>::initializeVariables()
    rhs_variable = new CellVariable<DIM,LSMLIB_REAL>(rhs_name.str(), 1);
   }
   d_rhs_handle = var_db->registerVariableAndContext(
-    rhs_variable, scratch_context, zero_ghostcell_width);
+    rhs_variable, scratch_context, rhs_ghostcell_width);
   d_scratch_data.setFlag(d_rhs_handle);
 
   // create variables for grad(phi)
@@ -1132,9 +1507,9 @@ void ReinitializationAlgorithm<DIM>::initializeVariables()
   Pointer<VariableContext> grad_phi_minus_context =  
     var_db->getContext("REINITIALIZATION_GRAD_PHI_MINUS");
   d_grad_phi_plus_handle = var_db->registerVariableAndContext(
-    grad_phi_variable, grad_phi_plus_context, zero_ghostcell_width);
+    grad_phi_variable, grad_phi_plus_context, rhs_ghostcell_width);
   d_grad_phi_minus_handle = var_db->registerVariableAndContext(
-    grad_phi_variable, grad_phi_minus_context, zero_ghostcell_width);
+    grad_phi_variable, grad_phi_minus_context, rhs_ghostcell_width);
   d_scratch_data.setFlag(d_grad_phi_plus_handle);
   d_scratch_data.setFlag(d_grad_phi_minus_handle);
 
@@ -1267,6 +1642,14 @@ void ReinitializationAlgorithm<DIM>::getFromInput(
     }
   }
 
+  // get flag for skipping converged patches
+  d_skip_converged_patches = db->getBoolWithDefault(
+    "skip_converged_patches", LSM_DEFAULT_SKIP_CONVERGED_PATCHES);
+
+  // get flag for filling ghost cells once per TVD Runge-Kutta step
+  d_use_wide_ghost_regions = db->getBoolWithDefault(
+    "use_wide_ghost_regions", LSM_DEFAULT_USE_WIDE_GHOST_REGIONS);
+
   // get verbose mode
   d_verbose_mode = db->getBoolWithDefault(
     "verbose_mode", LSM_DEFAULT_VERBOSE_MODE);
@@ -68,6 +68,13 @@
  *                                of the change in the level set function
  *                                drops below the specified tolerance.
  *                                (default = 0.0)
+ * - skip_converged_patches     = flag to activate/deactivate skipping of
+ *                                patches where the change in the level set
+ *                                function has dropped below 
+ *                                iteration_stop_tolerance (default = false)
+ * - use_wide_ghost_regions     = flag to activate/deactivate filling 
+ *                                ghost cells only once per TVD Runge-Kutta
+ *                                step (default = false)
  * - verbose_mode               = flag to activate/deactivate verbose-mode 
  *                                (default = false)
  *
@@ -95,11 +102,37 @@
  *   be a distance function) or using a lower order spatial-and 
  *   time-discretization.
  * 
+ * - When skip_converged_patches is set to true and 
+ *   iteration_stop_tolerance is specified, patches where the change in 
+ *   the level set function has dropped below the tolerance are no 
+ *   longer updated.  A converged patch is reactivated only if a patch that 
+ *   supplies its ghostcell data (on the same level or the next coarser 
+ *   level) changes by more than the tolerance.  Far from the zero level 
+ *   set, most patches converge after a few iterations, so this saves a 
+ *   large fraction of the spatial derivative calculations.
+ *
+ * - When use_wide_ghost_regions is set to true, the scratch copies of 
+ *   the level set function are allocated with a ghost region that is
+ *   tvd_runge_kutta_order times wider than the spatial derivative
+ *   stencil requires.  Ghost cells are then exchanged only once per
+ *   time step instead of once per Runge-Kutta stage; the earlier 
+ *   stages are also computed in the part of the ghost region needed 
+ *   by the later stages.  This trades redundant computation for fewer
+ *   (but larger) messages, which pays off when communication latency
+ *   dominates (e.g. many small patches or many processors).  Physical
+ *   boundary conditions are still imposed at every stage.  Because 
+ *   ghost cells at coarse-fine boundaries are evolved with the 
+ *   values interpolated at the start of the step, results may differ
+ *   slightly from the default mode on hierarchies with more than one
+ *   level.
+ *
  */
 
 
 #include <vector>
 #include "SAMRAI_config.h"
+#include "Box.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "ComponentSelector.h"
 #include "PatchHierarchy.h"
@@ -470,14 +503,24 @@ protected:
    *   phi_t = ...
    *
    * Arguments:
-   *  - phi_handle (in):  PatchData handle to use in computing RHS of 
-   *                      reinitialization equation
+   *  - phi_handle (in):     PatchData handle to use in computing RHS of 
+   *                         reinitialization equation
+   *  - phi_component (in):  component of the level set function being
+   *                         reinitialized (used to look up which patches 
+   *                         are active) (default = 0)
+   *  - fillbox_growth (in): number of cells that the RHS is computed 
+   *                         into the ghost region (default = 0)
    *
-   * Return value:        none
+   * Return value:           none
+   *
+   * NOTES:
+   *  - The RHS is set to zero on converged (inactive) patches.
    *
    */
   virtual void computeReinitializationEqnRHS(
-    const int phi_handle);
+    const int phi_handle,
+    const int phi_component = 0,
+    const int fillbox_growth = 0);
 
   //! @}
 
@@ -541,6 +584,68 @@ protected:
    */
   virtual void checkParameters();
 
+  /*!
+   * initializePatchActivity() marks all patches as active for the
+   * components of the level set function to be reinitialized and
+   * resets the statistics on skipped patch updates.
+   *
+   * Arguments:
+   *  - num_components (in):  number of components of the level set 
+   *                          function for which to track patch activity
+   *
+   * Return value:            none
+   *
+   */
+  virtual void initializePatchActivity(const int num_components);
+
+  /*!
+   * updatePatchActivity() computes the change in the level set function 
+   * on each active patch during the last time step and updates the
+   * activity flags for all patches.  A patch remains (or becomes) active 
+   * if the change on the patch itself or on a patch that supplies its 
+   * ghostcell data exceeds the iteration stop tolerance.
+   *
+   * Arguments:
+   *  - component (in):  component of level set function that was advanced
+   *
+   * Return value:       max norm of the change in the level set function
+   *                     over the entire hierarchy
+   *
+   * NOTES:
+   *  - The per-patch changes are combined across processors using a
+   *    single array reduction per level, which replaces the reduction
+   *    in LevelSetMethodToolbox::maxNormOfDifference().
+   *
+   */
+  virtual LSMLIB_REAL updatePatchActivity(const int component);
+
+  /*!
+   * ghostDataChanged() determines whether any of the specified patches 
+   * with a change in the level set function above the iteration stop 
+   * tolerance overlaps the specified ghost box (or one of its periodic 
+   * images).
+   *
+   * Arguments:
+   *  - ghost_box (in):       ghost box of the patch to check
+   *  - boxes (in):           boxes of the patches on the level 
+   *                          supplying the ghostcell data
+   *  - patch_delta (in):     change in the level set function on each 
+   *                          of the patches in boxes
+   *  - periodic_shift (in):  number of cells in the computational domain
+   *                          in periodic directions (zero in 
+   *                          non-periodic directions)
+   *
+   * Return value:            true if the ghostcell data may have changed
+   *                          by more than the iteration stop tolerance;
+   *                          false otherwise
+   *
+   */
+  virtual bool ghostDataChanged(
+    const Box<DIM>& ghost_box,
+    const BoxArray<DIM>& boxes,
+    const Array<double>& patch_delta,
+    const IntVector<DIM>& periodic_shift);
+
   //! @}
 
 
@@ -567,6 +672,8 @@ protected:
   LSMLIB_REAL d_stop_distance;
   int d_max_iterations;
   LSMLIB_REAL d_iteration_stop_tol;
+  bool d_skip_converged_patches;
+  bool d_use_wide_ghost_regions;
 
   // verbose mode
   bool d_verbose_mode;
@@ -592,6 +699,7 @@ protected:
   // scratch data 
   vector<int> d_phi_scr_handles;
   IntVector<DIM> d_phi_scratch_ghostcell_width;
+  int d_stencil_ghostcell_width;
   int d_rhs_handle;
   int d_grad_phi_plus_handle;
   int d_grad_phi_minus_handle;
@@ -611,6 +719,15 @@ protected:
   // level set data parameters
   int d_num_phi_components;
 
+  // patch activity flags (indexed by component, level, and patch number)
+  // and statistics on skipped patch updates for the current processor
+  bool d_skip_patches;
+  Array< Array< Array<bool> > > d_patch_is_active;
+  int d_num_patch_updates;
+  int d_num_patch_updates_skipped;
+  double d_num_cell_updates;
+  double d_num_cell_updates_skipped;
+
   // ComponentSelector to organize variables
   ComponentSelector d_scratch_data;
 
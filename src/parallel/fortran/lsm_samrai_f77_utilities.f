@@ -172,3 +172,201 @@ c     } end loop over grid
       end
 c } end subroutine
 c***********************************************************************
+
+c***********************************************************************
+c
+c  lsm1dSAMRAIUtilitiesTagCells() tags cells near the zero level set
+c  for refinement for 1D problems.  A cell is tagged if both |phi| and
+c  |psi| are less than the cutoff value.  Tags for cells that do not 
+c  satisfy the criterion are left unchanged.
+c
+c  Arguments:
+c    tags (in/out):       tags for refinement (1 = tagged)
+c    phi (in):            phi 
+c    psi (in):            psi (phi should be passed for codimension-one 
+c                         problems)
+c    cutoff (in):         cutoff value for |phi| and |psi|
+c    *_gb (in):           index range for ghostbox
+c    *_fb (in):           index range for fillbox
+c
+c***********************************************************************
+      subroutine lsm1dSAMRAIUtilitiesTagCells(
+     &  tags,
+     &  ilo_tag_gb, ihi_tag_gb, 
+     &  phi, psi,
+     &  ilo_phi_gb, ihi_phi_gb, 
+     &  ilo_fb, ihi_fb,
+     &  cutoff)
+c***********************************************************************
+c { begin subroutine
+      implicit none
+
+c     _gb refers to ghostbox 
+c     _fb refers to fillbox 
+      integer ilo_tag_gb, ihi_tag_gb
+      integer ilo_phi_gb, ihi_phi_gb
+      integer ilo_fb, ihi_fb
+      integer tags(ilo_tag_gb:ihi_tag_gb)
+      real phi(ilo_phi_gb:ihi_phi_gb)
+      real psi(ilo_phi_gb:ihi_phi_gb)
+      real cutoff
+      integer i
+
+c     loop over cells in fillbox {
+      do i=ilo_fb,ihi_fb
+
+        if ( (abs(phi(i)) .lt. cutoff) .and. 
+     &       (abs(psi(i)) .lt. cutoff) ) then
+          tags(i) = 1
+        endif
+
+      enddo
+c     } end loop over grid 
+
+      return
+      end
+c } end subroutine
+c***********************************************************************
+
+c***********************************************************************
+c
+c  lsm2dSAMRAIUtilitiesTagCells() tags cells near the zero level set
+c  for refinement for 2D problems.  A cell is tagged if both |phi| and
+c  |psi| are less than the cutoff value.  Tags for cells that do not 
+c  satisfy the criterion are left unchanged.
+c
+c  Arguments:
+c    tags (in/out):       tags for refinement (1 = tagged)
+c    phi (in):            phi 
+c    psi (in):            psi (phi should be passed for codimension-one 
+c                         problems)
+c    cutoff (in):         cutoff value for |phi| and |psi|
+c    *_gb (in):           index range for ghostbox
+c    *_fb (in):           index range for fillbox
+c
+c***********************************************************************
+      subroutine lsm2dSAMRAIUtilitiesTagCells(
+     &  tags,
+     &  ilo_tag_gb, ihi_tag_gb, 
+     &  jlo_tag_gb, jhi_tag_gb, 
+     &  phi, psi,
+     &  ilo_phi_gb, ihi_phi_gb, 
+     &  jlo_phi_gb, jhi_phi_gb, 
+     &  ilo_fb, ihi_fb,
+     &  jlo_fb, jhi_fb,
+     &  cutoff)
+c***********************************************************************
+c { begin subroutine
+      implicit none
+
+c     _gb refers to ghostbox 
+c     _fb refers to fillbox 
+      integer ilo_tag_gb, ihi_tag_gb
+      integer jlo_tag_gb, jhi_tag_gb
+      integer ilo_phi_gb, ihi_phi_gb
+      integer jlo_phi_gb, jhi_phi_gb
+      integer ilo_fb, ihi_fb
+      integer jlo_fb, jhi_fb
+      integer tags(ilo_tag_gb:ihi_tag_gb,
+     &             jlo_tag_gb:jhi_tag_gb)
+      real phi(ilo_phi_gb:ihi_phi_gb,
+     &         jlo_phi_gb:jhi_phi_gb)
+      real psi(ilo_phi_gb:ihi_phi_gb,
+     &         jlo_phi_gb:jhi_phi_gb)
+      real cutoff
+      integer i,j
+
+c     loop over cells in fillbox {
+      do j=jlo_fb,jhi_fb
+        do i=ilo_fb,ihi_fb
+
+          if ( (abs(phi(i,j)) .lt. cutoff) .and. 
+     &         (abs(psi(i,j)) .lt. cutoff) ) then
+            tags(i,j) = 1
+          endif
+
+        enddo
+      enddo
+c     } end loop over grid 
+
+      return
+      end
+c } end subroutine
+c***********************************************************************
+
+c***********************************************************************
+c
+c  lsm3dSAMRAIUtilitiesTagCells() tags cells near the zero level set
+c  for refinement for 3D problems.  A cell is tagged if both |phi| and
+c  |psi| are less than the cutoff value.  Tags for cells that do not 
+c  satisfy the criterion are left unchanged.
+c
+c  Arguments:
+c    tags (in/out):       tags for refinement (1 = tagged)
+c    phi (in):            phi 
+c    psi (in):            psi (phi should be passed for codimension-one 
+c                         problems)
+c    cutoff (in):         cutoff value for |phi| and |psi|
+c    *_gb (in):           index range for ghostbox
+c    *_fb (in):           index range for fillbox
+c
+c***********************************************************************
+      subroutine lsm3dSAMRAIUtilitiesTagCells(
+     &  tags,
+     &  ilo_tag_gb, ihi_tag_gb, 
+     &  jlo_tag_gb, jhi_tag_gb, 
+     &  klo_tag_gb, khi_tag_gb, 
+     &  phi, psi,
+     &  ilo_phi_gb, ihi_phi_gb, 
+     &  jlo_phi_gb, jhi_phi_gb, 
+     &  klo_phi_gb, khi_phi_gb, 
+     &  ilo_fb, ihi_fb,
+     &  jlo_fb, jhi_fb,
+     &  klo_fb, khi_fb,
+     &  cutoff)
+c***********************************************************************
+c { begin subroutine
+      implicit none
+
+c     _gb refers to ghostbox 
+c     _fb refers to fillbox 
+      integer ilo_tag_gb, ihi_tag_gb
+      integer jlo_tag_gb, jhi_tag_gb
+      integer klo_tag_gb, khi_tag_gb
+      integer ilo_phi_gb, ihi_phi_gb
+      integer jlo_phi_gb, jhi_phi_gb
+      integer klo_phi_gb, khi_phi_gb
+      integer ilo_fb, ihi_fb
+      integer jlo_fb, jhi_fb
+      integer klo_fb, khi_fb
+      integer tags(ilo_tag_gb:ihi_tag_gb,
+     &             jlo_tag_gb:jhi_tag_gb,
+     &             klo_tag_gb:khi_tag_gb)
+      real phi(ilo_phi_gb:ihi_phi_gb,
+     &         jlo_phi_gb:jhi_phi_gb,
+     &         klo_phi_gb:khi_phi_gb)
+      real psi(ilo_phi_gb:ihi_phi_gb,
+     &         jlo_phi_gb:jhi_phi_gb,
+     &         klo_phi_gb:khi_phi_gb)
+      real cutoff
+      integer i,j,k
+
+c     loop over cells in fillbox {
+      do k=klo_fb,khi_fb
+        do j=jlo_fb,jhi_fb
+          do i=ilo_fb,ihi_fb
+
+            if ( (abs(phi(i,j,k)) .lt. cutoff) .and. 
+     &           (abs(psi(i,j,k)) .lt. cutoff) ) then
+              tags(i,j,k) = 1
+            endif
+
+          enddo
+        enddo
+      enddo
+c     } end loop over grid 
+
+      return
+      end
+c } end subroutine
+c***********************************************************************
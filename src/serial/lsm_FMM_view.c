@@ -0,0 +1,228 @@
+/*
+ * File:        lsm_FMM_view.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Implementation of Fast Marching Method functions for
+ *              data arrays described by LSM_DataArrayViews
+ */
+
+#include <stdlib.h>
+#include "lsm_fast_marching_method.h"
+#include "FMM_Macros.h"
+
+
+/*==================== Helper Functions ================================*/
+
+/*
+ * sameGhostbox() returns 1 if the views have the same ghostbox and 0
+ * otherwise.  A NULL view is compatible with any view.
+ */
+static int sameGhostbox(LSM_DataArrayView *view, LSM_DataArrayView *ref)
+{
+  if (!view) return 1;
+  return ( (view->ilo_gb == ref->ilo_gb) && (view->ihi_gb == ref->ihi_gb) &&
+           (view->jlo_gb == ref->jlo_gb) && (view->jhi_gb == ref->jhi_gb) &&
+           (view->klo_gb == ref->klo_gb) && (view->khi_gb == ref->khi_gb) );
+}
+
+
+/*
+ * getContiguousData() returns the data array of the view if it is
+ * contiguous.  Otherwise, it returns a temporary contiguous array that
+ * is initialized with the values of the view if copy_in is nonzero.
+ */
+static LSMLIB_REAL *getContiguousData(
+  LSM_DataArrayView *view,
+  int num_gridpts,
+  int copy_in)
+{
+  LSMLIB_REAL *data;
+
+  if (!view) return NULL;
+  if (dataArrayViewIsContiguous(view)) return view->data;
+
+  data = (LSMLIB_REAL *) malloc(num_gridpts*sizeof(LSMLIB_REAL));
+  if (copy_in) copyDataArrayViewToArray(data, view);
+  return data;
+}
+
+
+/*
+ * releaseContiguousData() frees a temporary array returned by
+ * getContiguousData() after copying its values into the view if
+ * copy_out is nonzero.
+ */
+static void releaseContiguousData(
+  LSM_DataArrayView *view,
+  LSMLIB_REAL *data,
+  int copy_out)
+{
+  if ( (!view) || (data == view->data) ) return;
+
+  if (copy_out) copyArrayToDataArrayView(view, data);
+  free(data);
+}
+
+
+/*
+ * getViewGridDims() sets grid_dims to the extents of the ghostbox of
+ * the view and returns the number of grid points in the ghostbox.
+ */
+static int getViewGridDims(LSM_DataArrayView *view, int *grid_dims)
+{
+  grid_dims[0] = view->ihi_gb - view->ilo_gb + 1;
+  grid_dims[1] = view->jhi_gb - view->jlo_gb + 1;
+  grid_dims[2] = view->khi_gb - view->klo_gb + 1;
+
+  return grid_dims[0]*grid_dims[1]*
+         ( (view->num_dims == 3) ? grid_dims[2] : 1 );
+}
+
+
+/*==================== Fast Marching Method Functions ==================*/
+
+int computeExtensionFieldsView(
+  LSM_DataArrayView *distance_function,
+  LSM_DataArrayView *extension_fields,
+  LSM_DataArrayView *phi,
+  LSM_DataArrayView *mask,
+  LSM_DataArrayView *source_fields,
+  int num_extension_fields,
+  int spatial_discretization_order,
+  Grid *grid)
+{
+  LSMLIB_REAL *distance_function_data, *phi_data, *mask_data;
+  LSMLIB_REAL **extension_fields_data, **source_fields_data;
+  int grid_dims[3], num_gridpts;
+  int i, status;
+
+  if ( !sameGhostbox(distance_function, phi) || !sameGhostbox(mask, phi) )
+    return LSM_FMM_ERR_INCOMPATIBLE_DATA_ARRAY_VIEWS;
+  for (i = 0; i < num_extension_fields; i++) {
+    if ( !sameGhostbox(&(extension_fields[i]), phi) ||
+         !sameGhostbox(&(source_fields[i]), phi) )
+      return LSM_FMM_ERR_INCOMPATIBLE_DATA_ARRAY_VIEWS;
+  }
+
+  num_gridpts = getViewGridDims(phi, grid_dims);
+
+  distance_function_data =
+    getContiguousData(distance_function, num_gridpts, 0);
+  phi_data = getContiguousData(phi, num_gridpts, 1);
+  mask_data = getContiguousData(mask, num_gridpts, 1);
+  extension_fields_data =
+    (LSMLIB_REAL **) malloc(num_extension_fields*sizeof(LSMLIB_REAL *));
+  source_fields_data =
+    (LSMLIB_REAL **) malloc(num_extension_fields*sizeof(LSMLIB_REAL *));
+  for (i = 0; i < num_extension_fields; i++) {
+    extension_fields_data[i] =
+      getContiguousData(&(extension_fields[i]), num_gridpts, 0);
+    source_fields_data[i] =
+      getContiguousData(&(source_fields[i]), num_gridpts, 1);
+  }
+
+  if (grid->num_dims == 3) {
+    status = computeExtensionFields3d(
+      distance_function_data, extension_fields_data, phi_data, mask_data,
+      source_fields_data, num_extension_fields,
+      spatial_discretization_order, grid_dims, grid->dx);
+  } else {
+    status = computeExtensionFields2d(
+      distance_function_data, extension_fields_data, phi_data, mask_data,
+      source_fields_data, num_extension_fields,
+      spatial_discretization_order, grid_dims, grid->dx);
+  }
+
+  for (i = 0; i < num_extension_fields; i++) {
+    releaseContiguousData(&(extension_fields[i]), extension_fields_data[i],
+                          1);
+    releaseContiguousData(&(source_fields[i]), source_fields_data[i], 0);
+  }
+  free(extension_fields_data);
+  free(source_fields_data);
+  releaseContiguousData(mask, mask_data, 0);
+  releaseContiguousData(phi, phi_data, 0);
+  releaseContiguousData(distance_function, distance_function_data, 1);
+
+  return status;
+}
+
+
+int computeDistanceFunctionView(
+  LSM_DataArrayView *distance_function,
+  LSM_DataArrayView *phi,
+  LSM_DataArrayView *mask,
+  int spatial_discretization_order,
+  Grid *grid)
+{
+  LSMLIB_REAL *distance_function_data, *phi_data, *mask_data;
+  int grid_dims[3], num_gridpts;
+  int status;
+
+  if ( !sameGhostbox(distance_function, phi) || !sameGhostbox(mask, phi) )
+    return LSM_FMM_ERR_INCOMPATIBLE_DATA_ARRAY_VIEWS;
+
+  num_gridpts = getViewGridDims(phi, grid_dims);
+
+  distance_function_data =
+    getContiguousData(distance_function, num_gridpts, 0);
+  phi_data = getContiguousData(phi, num_gridpts, 1);
+  mask_data = getContiguousData(mask, num_gridpts, 1);
+
+  if (grid->num_dims == 3) {
+    status = computeDistanceFunction3d(
+      distance_function_data, phi_data, mask_data,
+      spatial_discretization_order, grid_dims, grid->dx);
+  } else {
+    status = computeDistanceFunction2d(
+      distance_function_data, phi_data, mask_data,
+      spatial_discretization_order, grid_dims, grid->dx);
+  }
+
+  releaseContiguousData(mask, mask_data, 0);
+  releaseContiguousData(phi, phi_data, 0);
+  releaseContiguousData(distance_function, distance_function_data, 1);
+
+  return status;
+}
+
+
+int solveEikonalEquationView(
+  LSM_DataArrayView *phi,
+  LSM_DataArrayView *speed,
+  LSM_DataArrayView *mask,
+  int spatial_discretization_order,
+  Grid *grid)
+{
+  LSMLIB_REAL *phi_data, *speed_data, *mask_data;
+  int grid_dims[3], num_gridpts;
+  int status;
+
+  if ( !sameGhostbox(speed, phi) || !sameGhostbox(mask, phi) )
+    return LSM_FMM_ERR_INCOMPATIBLE_DATA_ARRAY_VIEWS;
+
+  num_gridpts = getViewGridDims(phi, grid_dims);
+
+  phi_data = getContiguousData(phi, num_gridpts, 1);
+  speed_data = getContiguousData(speed, num_gridpts, 1);
+  mask_data = getContiguousData(mask, num_gridpts, 1);
+
+  if (grid->num_dims == 3) {
+    status = solveEikonalEquation3d(
+      phi_data, speed_data, mask_data,
+      spatial_discretization_order, grid_dims, grid->dx);
+  } else {
+    status = solveEikonalEquation2d(
+      phi_data, speed_data, mask_data,
+      spatial_discretization_order, grid_dims, grid->dx);
+  }
+
+  releaseContiguousData(mask, mask_data, 0);
+  releaseContiguousData(speed, speed_data, 0);
+  releaseContiguousData(phi, phi_data, 1);
+
+  return status;
+}
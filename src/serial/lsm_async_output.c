@@ -0,0 +1,339 @@
+/*
+ * File:        lsm_async_output.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Implementation file for asynchronous output of data arrays
+ *              for serial LSMLIB calculations
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lsm_async_output.h"
+#include "lsm_data_arrays.h"
+
+#ifdef LSMLIB_HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+/* types of write requests */
+#define LSM_ASYNC_DATA_ARRAY   0
+#define LSM_ASYNC_NARROW_BAND  1
+
+
+/*
+ * 'LSM_AsyncWrite' stores a copy of the data for one write request.
+ * Write requests are recycled through the buffer pool once the data
+ * has been written.
+ */
+typedef struct _LSM_AsyncWrite {
+
+  int          type;
+  LSMLIB_REAL *data;
+  int          capacity;     /* number of values data can hold */
+  Grid         grid;
+  LSMLIB_REAL  threshold;
+  char        *file_name;
+  int          zip_status;
+
+  struct _LSM_AsyncWrite *next;
+
+} LSM_AsyncWrite;
+
+
+struct _LSM_AsyncWriter {
+
+  /* limits on pending writes */
+  int        max_pending_writes;
+  long long  max_pending_bytes;
+
+  /* pending writes (queued or being written) */
+  int        num_pending_writes;
+  long long  num_pending_bytes;
+
+  /* queue of write requests and pool of free write requests */
+  LSM_AsyncWrite *queue_head, *queue_tail;
+  LSM_AsyncWrite *pool;
+
+  /* zero if data arrays are written synchronously */
+  int        threaded;
+
+#ifdef LSMLIB_HAVE_PTHREAD
+  pthread_t       thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t  work_available;   /* signaled when requests are queued */
+  pthread_cond_t  work_completed;   /* signaled when requests complete   */
+  int             shutdown;
+#endif
+
+};
+
+
+/*==================== Helper Functions ================================*/
+
+#ifdef LSMLIB_HAVE_PTHREAD
+/*
+ * performWrite() writes the data for a write request to disk.
+ */
+static void performWrite(LSM_AsyncWrite *request)
+{
+  if (request->type == LSM_ASYNC_NARROW_BAND) {
+    writeDataArrayNarrowBand(request->data, &(request->grid),
+                             request->threshold, request->file_name,
+                             request->zip_status);
+  } else {
+    writeDataArray(request->data, &(request->grid),
+                   request->file_name, request->zip_status);
+  }
+}
+
+
+/*
+ * takeFromPool() returns a write request from the buffer pool (or a
+ * new one if the pool is empty) whose buffer holds at least
+ * num_gridpts values.
+ */
+static LSM_AsyncWrite *takeFromPool(
+  LSM_AsyncWriter *writer,
+  int num_gridpts)
+{
+  LSM_AsyncWrite *request = writer->pool;
+
+  if (request) {
+    writer->pool = request->next;
+  } else {
+    request = (LSM_AsyncWrite *)calloc(1,sizeof(LSM_AsyncWrite));
+  }
+  request->next = NULL;
+
+  if (request->capacity < num_gridpts) {
+    free(request->data);
+    request->data = (LSMLIB_REAL *)malloc(num_gridpts*sizeof(LSMLIB_REAL));
+    request->capacity = num_gridpts;
+  }
+
+  return request;
+}
+
+
+/*
+ * returnToPool() puts a completed write request back into the buffer
+ * pool.
+ */
+static void returnToPool(LSM_AsyncWriter *writer, LSM_AsyncWrite *request)
+{
+  free(request->file_name);
+  request->file_name = NULL;
+  request->next = writer->pool;
+  writer->pool = request;
+}
+
+
+/*
+ * asyncWriterThread() is the main loop of the background output thread.
+ */
+static void *asyncWriterThread(void *arg)
+{
+  LSM_AsyncWriter *writer = (LSM_AsyncWriter *) arg;
+  LSM_AsyncWrite *request;
+  long long num_bytes;
+
+  pthread_mutex_lock(&(writer->mutex));
+  while (1) {
+
+    while ( (writer->queue_head == NULL) && !writer->shutdown ) {
+      pthread_cond_wait(&(writer->work_available), &(writer->mutex));
+    }
+    if (writer->queue_head == NULL) break;  /* shutdown */
+
+    request = writer->queue_head;
+    writer->queue_head = request->next;
+    if (writer->queue_head == NULL) writer->queue_tail = NULL;
+
+    /* write data without holding the lock */
+    pthread_mutex_unlock(&(writer->mutex));
+    performWrite(request);
+    pthread_mutex_lock(&(writer->mutex));
+
+    num_bytes = ((long long) request->grid.num_gridpts)*sizeof(LSMLIB_REAL);
+    writer->num_pending_writes--;
+    writer->num_pending_bytes -= num_bytes;
+    returnToPool(writer, request);
+    pthread_cond_broadcast(&(writer->work_completed));
+  }
+  pthread_mutex_unlock(&(writer->mutex));
+
+  return NULL;
+}
+#endif
+
+
+/*
+ * submitWrite() copies the data array into a pooled buffer and queues
+ * the write request, blocking while the limits on pending writes are
+ * reached.
+ */
+static void submitWrite(
+  LSM_AsyncWriter *writer,
+  int type,
+  LSMLIB_REAL *data,
+  Grid *grid,
+  LSMLIB_REAL threshold,
+  char *file_name,
+  int zip_status)
+{
+#ifdef LSMLIB_HAVE_PTHREAD
+  LSM_AsyncWrite *request;
+  long long num_bytes = ((long long) grid->num_gridpts)*sizeof(LSMLIB_REAL);
+#endif
+
+  if (!writer->threaded) {
+    if (type == LSM_ASYNC_NARROW_BAND) {
+      writeDataArrayNarrowBand(data, grid, threshold, file_name, zip_status);
+    } else {
+      writeDataArray(data, grid, file_name, zip_status);
+    }
+    return;
+  }
+
+#ifdef LSMLIB_HAVE_PTHREAD
+  pthread_mutex_lock(&(writer->mutex));
+  while ( (writer->num_pending_writes >= writer->max_pending_writes) ||
+          ( (writer->max_pending_bytes > 0) &&
+            (writer->num_pending_writes > 0) &&
+            (writer->num_pending_bytes + num_bytes
+             > writer->max_pending_bytes) ) ) {
+    pthread_cond_wait(&(writer->work_completed), &(writer->mutex));
+  }
+  request = takeFromPool(writer, grid->num_gridpts);
+  writer->num_pending_writes++;
+  writer->num_pending_bytes += num_bytes;
+  pthread_mutex_unlock(&(writer->mutex));
+
+  /* snapshot data array (the caller may modify data after returning) */
+  request->type = type;
+  request->grid = *grid;
+  if (grid->num_gridpts_alloc != grid->num_gridpts) {
+    removeDataArrayPadding(request->data, data, grid);
+    setGridAllocationPadding(&(request->grid), 0);
+  } else {
+    memcpy(request->data, data, num_bytes);
+  }
+  request->threshold = threshold;
+  request->file_name = (char *)malloc(strlen(file_name)+1);
+  strcpy(request->file_name, file_name);
+  request->zip_status = zip_status;
+
+  pthread_mutex_lock(&(writer->mutex));
+  if (writer->queue_tail) {
+    writer->queue_tail->next = request;
+  } else {
+    writer->queue_head = request;
+  }
+  writer->queue_tail = request;
+  pthread_cond_signal(&(writer->work_available));
+  pthread_mutex_unlock(&(writer->mutex));
+#endif
+}
+
+
+/*==================== Asynchronous Output Functions ===================*/
+
+LSM_AsyncWriter *createAsyncWriter(
+  int max_pending_writes,
+  long long max_pending_bytes)
+{
+  LSM_AsyncWriter *writer =
+    (LSM_AsyncWriter *)calloc(1,sizeof(LSM_AsyncWriter));
+
+  writer->max_pending_writes = (max_pending_writes > 0) ?
+    max_pending_writes : LSM_ASYNC_DEFAULT_MAX_PENDING_WRITES;
+  writer->max_pending_bytes = (max_pending_bytes > 0) ?
+    max_pending_bytes : 0;
+
+#ifdef LSMLIB_HAVE_PTHREAD
+  pthread_mutex_init(&(writer->mutex), NULL);
+  pthread_cond_init(&(writer->work_available), NULL);
+  pthread_cond_init(&(writer->work_completed), NULL);
+  if (pthread_create(&(writer->thread), NULL, asyncWriterThread, writer)) {
+    printf("\nCould not create output thread; writing synchronously");
+  } else {
+    writer->threaded = 1;
+  }
+#endif
+
+  return writer;
+}
+
+
+void writeDataArrayAsync(
+  LSM_AsyncWriter *writer,
+  LSMLIB_REAL *data,
+  Grid *grid,
+  char *file_name,
+  int zip_status)
+{
+  submitWrite(writer, LSM_ASYNC_DATA_ARRAY, data, grid, 0.0,
+              file_name, zip_status);
+}
+
+
+void writeDataArrayNarrowBandAsync(
+  LSM_AsyncWriter *writer,
+  LSMLIB_REAL *data,
+  Grid *grid,
+  LSMLIB_REAL threshold,
+  char *file_name,
+  int zip_status)
+{
+  submitWrite(writer, LSM_ASYNC_NARROW_BAND, data, grid, threshold,
+              file_name, zip_status);
+}
+
+
+void flushAsyncWriter(LSM_AsyncWriter *writer)
+{
+#ifdef LSMLIB_HAVE_PTHREAD
+  if (!writer->threaded) return;
+  pthread_mutex_lock(&(writer->mutex));
+  while (writer->num_pending_writes > 0) {
+    pthread_cond_wait(&(writer->work_completed), &(writer->mutex));
+  }
+  pthread_mutex_unlock(&(writer->mutex));
+#endif
+}
+
+
+void destroyAsyncWriter(LSM_AsyncWriter *writer)
+{
+  LSM_AsyncWrite *request;
+
+  if (!writer) return;
+
+#ifdef LSMLIB_HAVE_PTHREAD
+  /* the output thread finishes the queued writes before exiting */
+  if (writer->threaded) {
+    pthread_mutex_lock(&(writer->mutex));
+    writer->shutdown = 1;
+    pthread_cond_signal(&(writer->work_available));
+    pthread_mutex_unlock(&(writer->mutex));
+    pthread_join(writer->thread, NULL);
+  }
+
+  pthread_cond_destroy(&(writer->work_completed));
+  pthread_cond_destroy(&(writer->work_available));
+  pthread_mutex_destroy(&(writer->mutex));
+#endif
+
+  while (writer->pool) {
+    request = writer->pool;
+    writer->pool = request->next;
+    free(request->data);
+    free(request);
+  }
+  free(writer);
+}
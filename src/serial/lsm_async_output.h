@@ -0,0 +1,166 @@
+/*
+ * File:        lsm_async_output.h
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Header file for asynchronous output of data arrays for
+ *              serial LSMLIB calculations
+ */
+
+#ifndef included_lsm_async_output_h
+#define included_lsm_async_output_h
+
+#include "LSMLIB_config.h"
+#include "lsm_grid.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*! \file lsm_async_output.h
+ *
+ * \brief
+ * @ref lsm_async_output.h provides support for writing data arrays
+ * to disk in a background thread so that output (including
+ * compression) overlaps with computation.
+ *
+ * Each write request copies the data array into a buffer taken from
+ * a pool owned by the LSM_AsyncWriter and returns immediately; the
+ * data array may be modified as soon as the write function returns.
+ * The number of pending writes and the memory used by their buffers
+ * are bounded.  When either limit is reached, write requests block
+ * until earlier writes have completed.
+ *
+ * When LSMLIB is configured without POSIX threads, data arrays are
+ * written synchronously (i.e. before the write function returns).
+ *
+ */
+
+
+/*!
+ * Default maximum number of pending writes (i.e. writes that have
+ * been requested but have not completed).
+ */
+#define LSM_ASYNC_DEFAULT_MAX_PENDING_WRITES  2
+
+
+/*!
+ * The 'LSM_AsyncWriter' structure manages the background output
+ * thread, the queue of pending writes, and the buffer pool.
+ */
+typedef struct _LSM_AsyncWriter LSM_AsyncWriter;
+
+
+/*! @{
+ ****************************************************************
+ *
+ * @name Asynchronous output functions
+ *
+ ****************************************************************/
+
+/*!
+ * createAsyncWriter() creates an LSM_AsyncWriter and starts its
+ * background output thread.
+ *
+ * Arguments:
+ *  - max_pending_writes (in):  maximum number of pending writes
+ *                              (LSM_ASYNC_DEFAULT_MAX_PENDING_WRITES
+ *                              is used if max_pending_writes < 1)
+ *  - max_pending_bytes (in):   maximum memory (in bytes) used for
+ *                              buffers of pending writes (no limit if 0)
+ *
+ * Return value:                pointer to LSM_AsyncWriter
+ *
+ * NOTES:
+ *  - If the output thread cannot be started, data arrays are written
+ *    synchronously.
+ *
+ *  - A single write that is larger than max_pending_bytes is allowed
+ *    once all other pending writes have completed.
+ *
+ */
+LSM_AsyncWriter *createAsyncWriter(
+  int max_pending_writes,
+  long long max_pending_bytes);
+
+/*!
+ * writeDataArrayAsync() requests that the data array be written to
+ * a binary file using writeDataArray().
+ *
+ * Arguments:
+ *  - writer (in):     pointer to LSM_AsyncWriter
+ *  - data (in):       data array to be output to file
+ *  - grid (in):       pointer to Grid
+ *  - file_name (in):  name of output file
+ *  - zip_status(in):  integer indicating compression of the file
+ *                     (NO_ZIP,GZIP,BZIP2)
+ *
+ * Return value:       none
+ *
+ */
+void writeDataArrayAsync(
+  LSM_AsyncWriter *writer,
+  LSMLIB_REAL *data,
+  Grid *grid,
+  char *file_name,
+  int zip_status);
+
+/*!
+ * writeDataArrayNarrowBandAsync() requests that a narrow band snapshot
+ * of the data array be written to a binary file using
+ * writeDataArrayNarrowBand().
+ *
+ * Arguments:
+ *  - writer (in):     pointer to LSM_AsyncWriter
+ *  - data (in):       level set function to be output to file
+ *  - grid (in):       pointer to Grid
+ *  - threshold (in):  narrow band threshold
+ *  - file_name (in):  name of output file
+ *  - zip_status(in):  integer indicating compression of the file
+ *                     (NO_ZIP,GZIP,BZIP2)
+ *
+ * Return value:       none
+ *
+ */
+void writeDataArrayNarrowBandAsync(
+  LSM_AsyncWriter *writer,
+  LSMLIB_REAL *data,
+  Grid *grid,
+  LSMLIB_REAL threshold,
+  char *file_name,
+  int zip_status);
+
+/*!
+ * flushAsyncWriter() waits until all pending writes have completed.
+ *
+ * Arguments:
+ *  - writer (in):  pointer to LSM_AsyncWriter
+ *
+ * Return value:    none
+ *
+ */
+void flushAsyncWriter(LSM_AsyncWriter *writer);
+
+/*!
+ * destroyAsyncWriter() waits until all pending writes have completed,
+ * stops the background output thread, and frees the LSM_AsyncWriter
+ * and its buffer pool.
+ *
+ * Arguments:
+ *  - writer (in):  pointer to LSM_AsyncWriter
+ *
+ * Return value:    none
+ *
+ */
+void destroyAsyncWriter(LSM_AsyncWriter *writer);
+
+/*! @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -21,6 +21,18 @@ void linearExtrapolationBC(
   Grid *grid,
   int bdry_location_idx)
 {
+  LSM_DataArrayView phi_view;
+  initializeDataArrayViewFromGrid(&phi_view, phi, grid);
+  linearExtrapolationBCView(&phi_view, grid, bdry_location_idx);
+}
+
+
+void linearExtrapolationBCView(
+  LSM_DataArrayView *phi_view,
+  Grid *grid,
+  int bdry_location_idx)
+{
+  LSMLIB_REAL *phi = phi_view->data;
   int num_dims = grid->num_dims;
   if (num_dims == 2) {
 
@@ -31,8 +43,8 @@ void linearExtrapolationBC(
       case 3: {
         LSM2D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &bdry_location_idx);
@@ -42,8 +54,8 @@ void linearExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM2D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -51,8 +63,8 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM2D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -64,8 +76,8 @@ void linearExtrapolationBC(
         int tmp_bdry_location_idx = 2;
         LSM2D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -73,8 +85,8 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM2D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -86,8 +98,8 @@ void linearExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM2D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -95,8 +107,8 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM2D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -104,8 +116,8 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 2;
         LSM2D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -113,8 +125,8 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM2D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -137,9 +149,9 @@ void linearExtrapolationBC(
       case 5: {
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -150,9 +162,9 @@ void linearExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -161,9 +173,9 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -176,9 +188,9 @@ void linearExtrapolationBC(
         int tmp_bdry_location_idx = 2;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -187,9 +199,9 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -202,9 +214,9 @@ void linearExtrapolationBC(
         int tmp_bdry_location_idx = 4;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -213,9 +225,9 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 5;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -228,9 +240,9 @@ void linearExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -239,9 +251,9 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -250,9 +262,9 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 2;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -261,9 +273,9 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -272,9 +284,9 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 4;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -283,9 +295,9 @@ void linearExtrapolationBC(
         tmp_bdry_location_idx = 5;
         LSM3D_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -308,6 +320,18 @@ void signedLinearExtrapolationBC(
   Grid *grid,
   int bdry_location_idx)
 {
+  LSM_DataArrayView phi_view;
+  initializeDataArrayViewFromGrid(&phi_view, phi, grid);
+  signedLinearExtrapolationBCView(&phi_view, grid, bdry_location_idx);
+}
+
+
+void signedLinearExtrapolationBCView(
+  LSM_DataArrayView *phi_view,
+  Grid *grid,
+  int bdry_location_idx)
+{
+  LSMLIB_REAL *phi = phi_view->data;
   int num_dims = grid->num_dims;
   if (num_dims == 2) {
 
@@ -318,8 +342,8 @@ void signedLinearExtrapolationBC(
       case 3: {
         LSM2D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &bdry_location_idx);
@@ -329,8 +353,8 @@ void signedLinearExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM2D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -338,8 +362,8 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM2D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -351,8 +375,8 @@ void signedLinearExtrapolationBC(
         int tmp_bdry_location_idx = 2;
         LSM2D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -360,8 +384,8 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM2D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -373,8 +397,8 @@ void signedLinearExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM2D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -382,8 +406,8 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM2D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -391,8 +415,8 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 2;
         LSM2D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -400,8 +424,8 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM2D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -424,9 +448,9 @@ void signedLinearExtrapolationBC(
       case 5: {
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -437,9 +461,9 @@ void signedLinearExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -448,9 +472,9 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -463,9 +487,9 @@ void signedLinearExtrapolationBC(
         int tmp_bdry_location_idx = 2;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -474,9 +498,9 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -489,9 +513,9 @@ void signedLinearExtrapolationBC(
         int tmp_bdry_location_idx = 4;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -500,9 +524,9 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 5;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -515,9 +539,9 @@ void signedLinearExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -526,9 +550,9 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -537,9 +561,9 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 2;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -548,9 +572,9 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -559,9 +583,9 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 4;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -570,9 +594,9 @@ void signedLinearExtrapolationBC(
         tmp_bdry_location_idx = 5;
         LSM3D_SIGNED_LINEAR_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -595,6 +619,18 @@ void copyExtrapolationBC(
   Grid *grid,
   int bdry_location_idx)
 {
+  LSM_DataArrayView phi_view;
+  initializeDataArrayViewFromGrid(&phi_view, phi, grid);
+  copyExtrapolationBCView(&phi_view, grid, bdry_location_idx);
+}
+
+
+void copyExtrapolationBCView(
+  LSM_DataArrayView *phi_view,
+  Grid *grid,
+  int bdry_location_idx)
+{
+  LSMLIB_REAL *phi = phi_view->data;
   int num_dims = grid->num_dims;
   if (num_dims == 2) {
 
@@ -605,8 +641,8 @@ void copyExtrapolationBC(
       case 3: {
         LSM2D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &bdry_location_idx);
@@ -616,8 +652,8 @@ void copyExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM2D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -625,8 +661,8 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM2D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -638,8 +674,8 @@ void copyExtrapolationBC(
         int tmp_bdry_location_idx = 2;
         LSM2D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -647,8 +683,8 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM2D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -660,8 +696,8 @@ void copyExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM2D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -669,8 +705,8 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM2D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -678,8 +714,8 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 2;
         LSM2D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -687,8 +723,8 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM2D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &tmp_bdry_location_idx);
@@ -711,9 +747,9 @@ void copyExtrapolationBC(
       case 5: {
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -724,9 +760,9 @@ void copyExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -735,9 +771,9 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -750,9 +786,9 @@ void copyExtrapolationBC(
         int tmp_bdry_location_idx = 2;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -761,9 +797,9 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -776,9 +812,9 @@ void copyExtrapolationBC(
         int tmp_bdry_location_idx = 4;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -787,9 +823,9 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 5;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -802,9 +838,9 @@ void copyExtrapolationBC(
         int tmp_bdry_location_idx = 0;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -813,9 +849,9 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 1;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -824,9 +860,9 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 2;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -835,9 +871,9 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 3;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -846,9 +882,9 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 4;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -857,9 +893,9 @@ void copyExtrapolationBC(
         tmp_bdry_location_idx = 5;
         LSM3D_COPY_EXTRAPOLATION(
           phi,
-          &(grid->ilo_gb), &(grid->ihi_gb), 
-          &(grid->jlo_gb), &(grid->jhi_gb), 
-          &(grid->klo_gb), &(grid->khi_gb), 
+          &(phi_view->ilo_gb), &(phi_view->ihi_alloc), 
+          &(phi_view->jlo_gb), &(phi_view->jhi_alloc), 
+          &(phi_view->klo_gb), &(phi_view->khi_alloc), 
           &(grid->ilo_fb), &(grid->ihi_fb), 
           &(grid->jlo_fb), &(grid->jhi_fb), 
           &(grid->klo_fb), &(grid->khi_fb), 
@@ -884,3 +920,12 @@ void homogeneousNeumannBC(
 {
   copyExtrapolationBC(phi, grid, bdry_location_idx);
 }
+
+
+void homogeneousNeumannBCView(
+  LSM_DataArrayView *phi_view,
+  Grid *grid,
+  int bdry_location_idx)
+{
+  copyExtrapolationBCView(phi_view, grid, bdry_location_idx);
+}
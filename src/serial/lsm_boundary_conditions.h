@@ -19,6 +19,7 @@ extern "C" {
 #endif
 
 #include "lsm_grid.h"
+#include "lsm_data_array_view.h"
 
 
 /*! \file lsm_boundary_conditions.h
@@ -32,6 +33,12 @@ extern "C" {
  * of the computational domain in such a way that they produce
  * the desired boundary condition.  
  *
+ * The functions with names ending in "View" impose boundary
+ * conditions on data arrays described by an LSM_DataArrayView (e.g.
+ * arrays owned by the application with a different number of 
+ * ghostcells).  Ghostcells are filled for the entire ghostbox of 
+ * the view.
+ *
  */
 
 /* @enum BOUNDARY_LOCATION_IDX
@@ -176,6 +183,42 @@ void homogeneousNeumannBC(
   int bdry_location_idx);
 
 
+/*!
+ * linearExtrapolationBCView(), signedLinearExtrapolationBCView(),
+ * copyExtrapolationBCView(), and homogeneousNeumannBCView() impose the 
+ * same boundary conditions as the corresponding functions above on 
+ * the data array described by phi_view.
+ *
+ * Arguments:
+ *  - phi_view (in/out):       view of grid function for which to set
+ *                             ghostcells
+ *  - grid (in):               pointer to Grid data structure
+ *  - bdry_location_idx (in):  boundary location index
+ *      
+ * Return value:               none
+ *      
+ */
+void linearExtrapolationBCView(
+  LSM_DataArrayView *phi_view,
+  Grid *grid,
+  int bdry_location_idx);
+
+void signedLinearExtrapolationBCView(
+  LSM_DataArrayView *phi_view,
+  Grid *grid,
+  int bdry_location_idx);
+
+void copyExtrapolationBCView(
+  LSM_DataArrayView *phi_view,
+  Grid *grid,
+  int bdry_location_idx);
+
+void homogeneousNeumannBCView(
+  LSM_DataArrayView *phi_view,
+  Grid *grid,
+  int bdry_location_idx);
+
+
 #ifdef __cplusplus
 }
 #endif
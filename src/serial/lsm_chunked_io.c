@@ -0,0 +1,759 @@
+/*
+ * File:        lsm_chunked_io.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Implementation file for chunked (tiled) random-access data
+ *              files for serial LSMLIB calculations
+ */
+
+/* allow files larger than 2GB on 32-bit platforms */
+#define _FILE_OFFSET_BITS 64
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "lsm_chunked_io.h"
+#include "lsm_data_arrays.h"
+
+#ifdef LSMLIB_HAVE_ZLIB
+#include <zlib.h>
+
+/* favor speed over compression ratio when writing chunks */
+#define LSM_CHUNK_ZLIB_LEVEL  1
+#endif
+
+/*
+ * File layout:
+ *
+ *   header (LSM_CHUNKED_HEADER_SIZE bytes)
+ *     magic (8 bytes), version, sizeof(LSMLIB_REAL), size of Grid record,
+ *     zip_status, chunk_dims[3], index offset (long long)
+ *   Grid record (see getGridFields())
+ *   chunk data
+ *   chunk index (offset and stored size of each chunk)
+ *
+ * NOTES:
+ *  - Version 1 files stored a raw copy of the Grid structure (before the
+ *    allocation fields were added to Grid).  They can still be read on
+ *    the platform that wrote them.
+ */
+#define LSM_CHUNKED_MAGIC        "LSMLIB\0C"
+#define LSM_CHUNKED_MAGIC_SIZE   8
+#define LSM_CHUNKED_VERSION      2
+#define LSM_CHUNKED_HEADER_SIZE  64
+#define LSM_CHUNKED_INDEX_POS    (LSM_CHUNKED_MAGIC_SIZE + 7*sizeof(int))
+
+/* number of integer, real, and mark fields in the Grid record */
+#define LSM_CHUNKED_GRID_NUM_INTS   39
+#define LSM_CHUNKED_GRID_NUM_REALS  17
+#define LSM_CHUNKED_GRID_NUM_MARKS  5
+#define LSM_CHUNKED_GRID_SIZE \
+  (LSM_CHUNKED_GRID_NUM_INTS*sizeof(int) \
+   + LSM_CHUNKED_GRID_NUM_REALS*sizeof(LSMLIB_REAL) \
+   + LSM_CHUNKED_GRID_NUM_MARKS*sizeof(unsigned char))
+
+/* size of the raw Grid stored in version 1 files */
+#define LSM_CHUNKED_GRID_SIZE_V1    offsetof(Grid, grid_dims_alloc)
+
+
+/*======================== Helper Functions ============================*/
+
+/*
+ * getGridFields() sets pointers to the fields of the Grid that are
+ * stored in the Grid record of a chunked file.  The allocation fields
+ * are not stored because chunks are stored without padding.
+ */
+static void getGridFields(
+  Grid *grid,
+  int **int_fields,
+  LSMLIB_REAL **real_fields,
+  unsigned char **mark_fields)
+{
+  int n = 0;
+  int dir;
+
+  int_fields[n++] = &(grid->num_dims);
+  for (dir = 0; dir < 3; dir++) int_fields[n++] = &(grid->grid_dims[dir]);
+  for (dir = 0; dir < 3; dir++)
+    int_fields[n++] = &(grid->grid_dims_ghostbox[dir]);
+  int_fields[n++] = &(grid->num_gridpts);
+  int_fields[n++] = &(grid->ilo_gb);    int_fields[n++] = &(grid->ihi_gb);
+  int_fields[n++] = &(grid->jlo_gb);    int_fields[n++] = &(grid->jhi_gb);
+  int_fields[n++] = &(grid->klo_gb);    int_fields[n++] = &(grid->khi_gb);
+  int_fields[n++] = &(grid->ilo_fb);    int_fields[n++] = &(grid->ihi_fb);
+  int_fields[n++] = &(grid->jlo_fb);    int_fields[n++] = &(grid->jhi_fb);
+  int_fields[n++] = &(grid->klo_fb);    int_fields[n++] = &(grid->khi_fb);
+  int_fields[n++] = &(grid->ilo_D1_fb); int_fields[n++] = &(grid->ihi_D1_fb);
+  int_fields[n++] = &(grid->jlo_D1_fb); int_fields[n++] = &(grid->jhi_D1_fb);
+  int_fields[n++] = &(grid->klo_D1_fb); int_fields[n++] = &(grid->khi_D1_fb);
+  int_fields[n++] = &(grid->ilo_D2_fb); int_fields[n++] = &(grid->ihi_D2_fb);
+  int_fields[n++] = &(grid->jlo_D2_fb); int_fields[n++] = &(grid->jhi_D2_fb);
+  int_fields[n++] = &(grid->klo_D2_fb); int_fields[n++] = &(grid->khi_D2_fb);
+  int_fields[n++] = &(grid->ilo_D3_fb); int_fields[n++] = &(grid->ihi_D3_fb);
+  int_fields[n++] = &(grid->jlo_D3_fb); int_fields[n++] = &(grid->jhi_D3_fb);
+  int_fields[n++] = &(grid->klo_D3_fb); int_fields[n++] = &(grid->khi_D3_fb);
+  int_fields[n++] = &(grid->num_nb_levels);
+
+  n = 0;
+  for (dir = 0; dir < 3; dir++) real_fields[n++] = &(grid->x_lo[dir]);
+  for (dir = 0; dir < 3; dir++) real_fields[n++] = &(grid->x_hi[dir]);
+  for (dir = 0; dir < 3; dir++)
+    real_fields[n++] = &(grid->x_lo_ghostbox[dir]);
+  for (dir = 0; dir < 3; dir++)
+    real_fields[n++] = &(grid->x_hi_ghostbox[dir]);
+  for (dir = 0; dir < 3; dir++) real_fields[n++] = &(grid->dx[dir]);
+  real_fields[n++] = &(grid->beta);
+  real_fields[n++] = &(grid->gamma);
+
+  mark_fields[0] = &(grid->mark_gb);
+  mark_fields[1] = &(grid->mark_D1);
+  mark_fields[2] = &(grid->mark_D2);
+  mark_fields[3] = &(grid->mark_D3);
+  mark_fields[4] = &(grid->mark_fb);
+}
+
+
+/*
+ * writeGridRecord() writes the Grid record to fp.  Returns 0 on
+ * success and 1 otherwise.
+ */
+static int writeGridRecord(Grid *grid, FILE *fp)
+{
+  int *int_fields[LSM_CHUNKED_GRID_NUM_INTS];
+  LSMLIB_REAL *real_fields[LSM_CHUNKED_GRID_NUM_REALS];
+  unsigned char *mark_fields[LSM_CHUNKED_GRID_NUM_MARKS];
+  int i;
+
+  getGridFields(grid, int_fields, real_fields, mark_fields);
+  for (i = 0; i < LSM_CHUNKED_GRID_NUM_INTS; i++)
+    if (fwrite(int_fields[i], sizeof(int), 1, fp) != 1) return 1;
+  for (i = 0; i < LSM_CHUNKED_GRID_NUM_REALS; i++)
+    if (fwrite(real_fields[i], sizeof(LSMLIB_REAL), 1, fp) != 1) return 1;
+  for (i = 0; i < LSM_CHUNKED_GRID_NUM_MARKS; i++)
+    if (fwrite(mark_fields[i], sizeof(unsigned char), 1, fp) != 1) return 1;
+
+  return 0;
+}
+
+
+/*
+ * readGridRecord() reads the Grid record from fp.  Returns 0 on
+ * success and 1 otherwise.
+ */
+static int readGridRecord(Grid *grid, FILE *fp)
+{
+  int *int_fields[LSM_CHUNKED_GRID_NUM_INTS];
+  LSMLIB_REAL *real_fields[LSM_CHUNKED_GRID_NUM_REALS];
+  unsigned char *mark_fields[LSM_CHUNKED_GRID_NUM_MARKS];
+  int i;
+
+  memset(grid, 0, sizeof(Grid));
+  getGridFields(grid, int_fields, real_fields, mark_fields);
+  for (i = 0; i < LSM_CHUNKED_GRID_NUM_INTS; i++)
+    if (fread(int_fields[i], sizeof(int), 1, fp) != 1) return 1;
+  for (i = 0; i < LSM_CHUNKED_GRID_NUM_REALS; i++)
+    if (fread(real_fields[i], sizeof(LSMLIB_REAL), 1, fp) != 1) return 1;
+  for (i = 0; i < LSM_CHUNKED_GRID_NUM_MARKS; i++)
+    if (fread(mark_fields[i], sizeof(unsigned char), 1, fp) != 1) return 1;
+
+  return 0;
+}
+
+
+/*
+ * allocateChunkedFile() allocates an LSM_ChunkedFile for the grid and
+ * chunk layout.  The chunk index is zeroed.
+ */
+static LSM_ChunkedFile *allocateChunkedFile(
+  Grid *grid,
+  int *chunk_dims,
+  int zip_status)
+{
+  LSM_ChunkedFile *chunked_file;
+  int dir;
+  long long num_chunk_gridpts = 1;
+
+  chunked_file = (LSM_ChunkedFile *)calloc(1,sizeof(LSM_ChunkedFile));
+  chunked_file->grid = *grid;
+  chunked_file->zip_status = zip_status;
+
+  /* chunks are stored without the padding of data arrays */
+  setGridAllocationPadding(&(chunked_file->grid), 0);
+
+  chunked_file->num_chunks_total = 1;
+  for (dir = 0; dir < 3; dir++) {
+    int n = grid->grid_dims_ghostbox[dir];
+    if (n < 1) n = 1;
+
+    chunked_file->chunk_dims[dir] = chunk_dims[dir];
+    if (chunked_file->chunk_dims[dir] > n)
+      chunked_file->chunk_dims[dir] = n;
+
+    chunked_file->num_chunks[dir] =
+      (n + chunked_file->chunk_dims[dir] - 1)/chunked_file->chunk_dims[dir];
+    chunked_file->num_chunks_total *= chunked_file->num_chunks[dir];
+    num_chunk_gridpts *= chunked_file->chunk_dims[dir];
+  }
+
+  chunked_file->chunk_offset = (long long *)calloc(
+    chunked_file->num_chunks_total,sizeof(long long));
+  chunked_file->chunk_size = (long long *)calloc(
+    chunked_file->num_chunks_total,sizeof(long long));
+  chunked_file->chunk_capacity = (long long *)calloc(
+    chunked_file->num_chunks_total,sizeof(long long));
+
+  chunked_file->chunk_buffer = (LSMLIB_REAL *)malloc(
+    num_chunk_gridpts*sizeof(LSMLIB_REAL));
+
+#ifdef LSMLIB_HAVE_ZLIB
+  if (zip_status == GZIP) {
+    chunked_file->zip_buffer_size =
+      compressBound(num_chunk_gridpts*sizeof(LSMLIB_REAL));
+    chunked_file->zip_buffer = (unsigned char *)malloc(
+      chunked_file->zip_buffer_size);
+  }
+#endif
+
+  return chunked_file;
+}
+
+
+/*
+ * getChunkBox() computes the index range of the chunk with index
+ * (ci,cj,ck) and returns the number of grid points in the chunk.
+ */
+static int getChunkBox(
+  LSM_ChunkedFile *chunked_file,
+  int *chunk_idx,
+  int *lo,
+  int *hi)
+{
+  int dir;
+  int num_gridpts = 1;
+
+  for (dir = 0; dir < 3; dir++) {
+    int n = chunked_file->grid.grid_dims_ghostbox[dir];
+    if (n < 1) n = 1;
+
+    lo[dir] = chunk_idx[dir]*chunked_file->chunk_dims[dir];
+    hi[dir] = lo[dir] + chunked_file->chunk_dims[dir] - 1;
+    if (hi[dir] > n-1) hi[dir] = n-1;
+    num_gridpts *= hi[dir] - lo[dir] + 1;
+  }
+
+  return num_gridpts;
+}
+
+
+/*
+ * checkBox() returns 0 if the box lies inside the ghostbox of the
+ * grid and 1 otherwise.
+ */
+static int checkBox(LSM_ChunkedFile *chunked_file, int *lo, int *hi)
+{
+  int dir;
+
+  for (dir = 0; dir < 3; dir++) {
+    int n = chunked_file->grid.grid_dims_ghostbox[dir];
+    if (n < 1) n = 1;
+    if ( (lo[dir] < 0) || (hi[dir] > n-1) || (lo[dir] > hi[dir]) ) {
+      fprintf(stderr,
+              "ERROR: box [%d,%d]x[%d,%d]x[%d,%d] outside of grid\n",
+              lo[0],hi[0],lo[1],hi[1],lo[2],hi[2]);
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+
+/*
+ * copyBoxData() copies the data on the intersection of boxes a and b
+ * from src (defined on box src_lo/src_hi) to dst (defined on box
+ * dst_lo/dst_hi).
+ */
+static void copyBoxData(
+  LSMLIB_REAL *dst, int *dst_lo, int *dst_hi,
+  LSMLIB_REAL *src, int *src_lo, int *src_hi)
+{
+  int lo[3], hi[3];
+  int dst_nx = dst_hi[0] - dst_lo[0] + 1;
+  int dst_ny = dst_hi[1] - dst_lo[1] + 1;
+  int src_nx = src_hi[0] - src_lo[0] + 1;
+  int src_ny = src_hi[1] - src_lo[1] + 1;
+  int dir, j, k;
+
+  for (dir = 0; dir < 3; dir++) {
+    lo[dir] = (dst_lo[dir] > src_lo[dir]) ? dst_lo[dir] : src_lo[dir];
+    hi[dir] = (dst_hi[dir] < src_hi[dir]) ? dst_hi[dir] : src_hi[dir];
+    if (lo[dir] > hi[dir]) return;
+  }
+
+  for (k = lo[2]; k <= hi[2]; k++) {
+    for (j = lo[1]; j <= hi[1]; j++) {
+      long long dst_idx = (lo[0]-dst_lo[0])
+        + dst_nx*((long long)(j-dst_lo[1]) + dst_ny*(k-dst_lo[2]));
+      long long src_idx = (lo[0]-src_lo[0])
+        + src_nx*((long long)(j-src_lo[1]) + src_ny*(k-src_lo[2]));
+      memcpy(dst+dst_idx, src+src_idx,
+             (hi[0]-lo[0]+1)*sizeof(LSMLIB_REAL));
+    }
+  }
+}
+
+
+/*
+ * readChunk() loads the chunk with linear index chunk_num into
+ * chunk_buffer.  Chunks that have not been written are set to zero.
+ */
+static int readChunk(
+  LSM_ChunkedFile *chunked_file,
+  int chunk_num,
+  int num_gridpts)
+{
+  size_t num_bytes = num_gridpts*sizeof(LSMLIB_REAL);
+
+  if (chunked_file->chunk_offset[chunk_num] == 0) {
+    memset(chunked_file->chunk_buffer, 0, num_bytes);
+    return 0;
+  }
+
+  if (fseeko(chunked_file->fp,
+             (off_t) chunked_file->chunk_offset[chunk_num], SEEK_SET)) {
+    fprintf(stderr,"ERROR: unable to seek to chunk %d\n", chunk_num);
+    return 1;
+  }
+
+  if (chunked_file->zip_status == NO_ZIP) {
+    if (fread(chunked_file->chunk_buffer, 1, num_bytes, chunked_file->fp)
+        != num_bytes) {
+      fprintf(stderr,"ERROR: unable to read chunk %d\n", chunk_num);
+      return 1;
+    }
+  }
+#ifdef LSMLIB_HAVE_ZLIB
+  else {
+    size_t stored_size = (size_t) chunked_file->chunk_size[chunk_num];
+    uLongf dest_size = num_bytes;
+
+    if ( (stored_size > chunked_file->zip_buffer_size) ||
+         (fread(chunked_file->zip_buffer, 1, stored_size, chunked_file->fp)
+          != stored_size) ||
+         (uncompress((Bytef *) chunked_file->chunk_buffer, &dest_size,
+                     chunked_file->zip_buffer, stored_size) != Z_OK) ||
+         (dest_size != num_bytes) ) {
+      fprintf(stderr,"ERROR: unable to read chunk %d\n", chunk_num);
+      return 1;
+    }
+  }
+#endif
+
+  return 0;
+}
+
+
+/*
+ * writeChunk() stores the contents of chunk_buffer as the chunk with
+ * linear index chunk_num.  Chunks are overwritten in place when they
+ * fit in the space previously used for the chunk or when the chunk is
+ * the last one in the file.  Otherwise, the chunk is appended to the
+ * file.
+ */
+static int writeChunk(
+  LSM_ChunkedFile *chunked_file,
+  int chunk_num,
+  int num_gridpts)
+{
+  size_t num_bytes = num_gridpts*sizeof(LSMLIB_REAL);
+  void *stored_data = chunked_file->chunk_buffer;
+  size_t stored_size = num_bytes;
+  long long offset = chunked_file->chunk_offset[chunk_num];
+
+#ifdef LSMLIB_HAVE_ZLIB
+  if (chunked_file->zip_status == GZIP) {
+    uLongf dest_size = chunked_file->zip_buffer_size;
+    if (compress2(chunked_file->zip_buffer, &dest_size,
+                  (Bytef *) chunked_file->chunk_buffer, num_bytes,
+                  LSM_CHUNK_ZLIB_LEVEL) != Z_OK) {
+      fprintf(stderr,"ERROR: unable to compress chunk %d\n", chunk_num);
+      return 1;
+    }
+    stored_data = chunked_file->zip_buffer;
+    stored_size = dest_size;
+  }
+#endif
+
+  if (offset != 0) {
+    /* compressed chunks may grow when they are rewritten */
+    if (offset + chunked_file->chunk_capacity[chunk_num]
+        == chunked_file->end_offset) {
+      chunked_file->chunk_capacity[chunk_num] = stored_size;
+      chunked_file->end_offset = offset + stored_size;
+    } else if ((long long) stored_size
+               > chunked_file->chunk_capacity[chunk_num]) {
+      offset = 0;
+    }
+  }
+
+  if (offset == 0) {
+    offset = chunked_file->end_offset;
+    chunked_file->end_offset += stored_size;
+    chunked_file->chunk_capacity[chunk_num] = stored_size;
+  }
+
+  if ( fseeko(chunked_file->fp, (off_t) offset, SEEK_SET) ||
+       (fwrite(stored_data, 1, stored_size, chunked_file->fp)
+        != stored_size) ) {
+    fprintf(stderr,"ERROR: unable to write chunk %d\n", chunk_num);
+    return 1;
+  }
+
+  chunked_file->chunk_offset[chunk_num] = offset;
+  chunked_file->chunk_size[chunk_num] = stored_size;
+
+  return 0;
+}
+
+
+/*
+ * processBox() reads (write_flag = 0) or writes (write_flag = 1) the
+ * data for a sub-box one chunk at a time.
+ */
+static int processBox(
+  LSM_ChunkedFile *chunked_file,
+  LSMLIB_REAL *data,
+  int *box_lo,
+  int *box_hi,
+  int write_flag)
+{
+  int chunk_lo[3], chunk_hi[3];
+  int chunk_idx[3];
+  int lo[3], hi[3];
+  int dir;
+
+  if (checkBox(chunked_file, box_lo, box_hi)) return 1;
+
+  for (dir = 0; dir < 3; dir++) {
+    chunk_lo[dir] = box_lo[dir]/chunked_file->chunk_dims[dir];
+    chunk_hi[dir] = box_hi[dir]/chunked_file->chunk_dims[dir];
+  }
+
+  for (chunk_idx[2] = chunk_lo[2]; chunk_idx[2] <= chunk_hi[2];
+       chunk_idx[2]++) {
+    for (chunk_idx[1] = chunk_lo[1]; chunk_idx[1] <= chunk_hi[1];
+         chunk_idx[1]++) {
+      for (chunk_idx[0] = chunk_lo[0]; chunk_idx[0] <= chunk_hi[0];
+           chunk_idx[0]++) {
+
+        int chunk_num = chunk_idx[0] + chunked_file->num_chunks[0]
+          * (chunk_idx[1] + chunked_file->num_chunks[1]*chunk_idx[2]);
+        int num_gridpts = getChunkBox(chunked_file, chunk_idx, lo, hi);
+
+        if (write_flag) {
+
+          /* chunks only partially covered by the box must be loaded */
+          int covered = 1;
+          for (dir = 0; dir < 3; dir++) {
+            if ( (box_lo[dir] > lo[dir]) || (box_hi[dir] < hi[dir]) )
+              covered = 0;
+          }
+          if ( !covered &&
+               readChunk(chunked_file, chunk_num, num_gridpts) ) return 1;
+
+          copyBoxData(chunked_file->chunk_buffer, lo, hi,
+                      data, box_lo, box_hi);
+          if (writeChunk(chunked_file, chunk_num, num_gridpts)) return 1;
+
+        } else {
+
+          if (readChunk(chunked_file, chunk_num, num_gridpts)) return 1;
+          copyBoxData(data, box_lo, box_hi,
+                      chunked_file->chunk_buffer, lo, hi);
+
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+
+/*==================== Chunked File Functions ==========================*/
+
+LSM_ChunkedFile *createChunkedFile(
+  char *file_name,
+  Grid *grid,
+  int *chunk_dims,
+  int zip_status)
+{
+  LSM_ChunkedFile *chunked_file;
+  int default_chunk_dims[3] = {LSM_DEFAULT_CHUNK_SIZE,
+                               LSM_DEFAULT_CHUNK_SIZE,
+                               LSM_DEFAULT_CHUNK_SIZE};
+  char header[LSM_CHUNKED_HEADER_SIZE];
+  int header_ints[7];
+  long long index_offset = 0;
+  FILE *fp;
+  int dir;
+
+  if (!chunk_dims) chunk_dims = default_chunk_dims;
+  for (dir = 0; dir < 3; dir++) {
+    if (chunk_dims[dir] < 1) {
+      fprintf(stderr,"ERROR: invalid chunk size %d\n", chunk_dims[dir]);
+      return NULL;
+    }
+  }
+
+#ifdef LSMLIB_HAVE_ZLIB
+  if (zip_status != NO_ZIP) zip_status = GZIP;
+#else
+  zip_status = NO_ZIP;
+#endif
+
+  fp = fopen(file_name,"w+b");
+  if (!fp) {
+    fprintf(stderr,"ERROR: unable to open file %s\n", file_name);
+    return NULL;
+  }
+
+  chunked_file = allocateChunkedFile(grid, chunk_dims, zip_status);
+  chunked_file->fp = fp;
+  chunked_file->writable = 1;
+
+  /* write header and grid */
+  memset(header, 0, LSM_CHUNKED_HEADER_SIZE);
+  memcpy(header, LSM_CHUNKED_MAGIC, LSM_CHUNKED_MAGIC_SIZE);
+  header_ints[0] = LSM_CHUNKED_VERSION;
+  header_ints[1] = sizeof(LSMLIB_REAL);
+  header_ints[2] = LSM_CHUNKED_GRID_SIZE;
+  header_ints[3] = zip_status;
+  for (dir = 0; dir < 3; dir++)
+    header_ints[4+dir] = chunked_file->chunk_dims[dir];
+  memcpy(header+LSM_CHUNKED_MAGIC_SIZE, header_ints, sizeof(header_ints));
+  memcpy(header+LSM_CHUNKED_INDEX_POS, &index_offset, sizeof(long long));
+
+  if ( (fwrite(header, 1, LSM_CHUNKED_HEADER_SIZE, fp)
+        != LSM_CHUNKED_HEADER_SIZE) ||
+       writeGridRecord(&(chunked_file->grid), fp) ) {
+    fprintf(stderr,"ERROR: unable to write header to %s\n", file_name);
+    chunked_file->writable = 0;
+    closeChunkedFile(chunked_file);
+    return NULL;
+  }
+  chunked_file->end_offset = LSM_CHUNKED_HEADER_SIZE + LSM_CHUNKED_GRID_SIZE;
+
+  return chunked_file;
+}
+
+
+LSM_ChunkedFile *openChunkedFile(char *file_name)
+{
+  LSM_ChunkedFile *chunked_file;
+  char header[LSM_CHUNKED_HEADER_SIZE];
+  int header_ints[7];
+  long long index_offset;
+  Grid grid;
+  FILE *fp;
+
+  fp = fopen(file_name,"rb");
+  if (!fp) {
+    fprintf(stderr,"ERROR: unable to open file %s\n", file_name);
+    return NULL;
+  }
+
+  if ( (fread(header, 1, LSM_CHUNKED_HEADER_SIZE, fp)
+        != LSM_CHUNKED_HEADER_SIZE) ||
+       memcmp(header, LSM_CHUNKED_MAGIC, LSM_CHUNKED_MAGIC_SIZE) ) {
+    fprintf(stderr,"ERROR: %s is not a chunked data file\n", file_name);
+    fclose(fp);
+    return NULL;
+  }
+  memcpy(header_ints, header+LSM_CHUNKED_MAGIC_SIZE, sizeof(header_ints));
+  memcpy(&index_offset, header+LSM_CHUNKED_INDEX_POS, sizeof(long long));
+
+  if ( (header_ints[1] != sizeof(LSMLIB_REAL)) ||
+       !( ( (header_ints[0] == LSM_CHUNKED_VERSION) &&
+            (header_ints[2] == LSM_CHUNKED_GRID_SIZE) ) ||
+          ( (header_ints[0] == 1) &&
+            (header_ints[2] == LSM_CHUNKED_GRID_SIZE_V1) ) ) ) {
+    fprintf(stderr,
+            "ERROR: %s was written with an incompatible version of LSMLIB\n",
+            file_name);
+    fclose(fp);
+    return NULL;
+  }
+#ifndef LSMLIB_HAVE_ZLIB
+  if (header_ints[3] != NO_ZIP) {
+    fprintf(stderr,
+            "ERROR: reading compressed chunks from %s requires zlib\n",
+            file_name);
+    fclose(fp);
+    return NULL;
+  }
+#endif
+  if (index_offset == 0) {
+    fprintf(stderr,"ERROR: %s was not closed properly\n", file_name);
+    fclose(fp);
+    return NULL;
+  }
+
+  memset(&grid, 0, sizeof(Grid));
+  if ( (header_ints[0] == 1) ?
+       (fread(&grid, LSM_CHUNKED_GRID_SIZE_V1, 1, fp) != 1) :
+       readGridRecord(&grid, fp) ) {
+    fprintf(stderr,"ERROR: unable to read grid from %s\n", file_name);
+    fclose(fp);
+    return NULL;
+  }
+
+  chunked_file = allocateChunkedFile(&grid, header_ints+4, header_ints[3]);
+  chunked_file->fp = fp;
+  chunked_file->end_offset = index_offset;
+
+  /* read chunk index */
+  if ( fseeko(fp, (off_t) index_offset, SEEK_SET) ||
+       (fread(chunked_file->chunk_offset, sizeof(long long),
+              chunked_file->num_chunks_total, fp)
+        != (size_t) chunked_file->num_chunks_total) ||
+       (fread(chunked_file->chunk_size, sizeof(long long),
+              chunked_file->num_chunks_total, fp)
+        != (size_t) chunked_file->num_chunks_total) ) {
+    fprintf(stderr,"ERROR: unable to read chunk index from %s\n",
+            file_name);
+    chunked_file->writable = 0;
+    closeChunkedFile(chunked_file);
+    return NULL;
+  }
+  memcpy(chunked_file->chunk_capacity, chunked_file->chunk_size,
+         chunked_file->num_chunks_total*sizeof(long long));
+
+  return chunked_file;
+}
+
+
+int closeChunkedFile(LSM_ChunkedFile *chunked_file)
+{
+  int status = 0;
+
+  if (!chunked_file) return 0;
+
+  if (chunked_file->writable) {
+    long long index_offset = chunked_file->end_offset;
+    size_t num_chunks = (size_t) chunked_file->num_chunks_total;
+
+    /* write chunk index and record its location in the header */
+    if ( fseeko(chunked_file->fp, (off_t) index_offset, SEEK_SET) ||
+         (fwrite(chunked_file->chunk_offset, sizeof(long long),
+                 num_chunks, chunked_file->fp) != num_chunks) ||
+         (fwrite(chunked_file->chunk_size, sizeof(long long),
+                 num_chunks, chunked_file->fp) != num_chunks) ||
+         fseeko(chunked_file->fp, (off_t) LSM_CHUNKED_INDEX_POS, SEEK_SET) ||
+         (fwrite(&index_offset, sizeof(long long), 1, chunked_file->fp)
+          != 1) ) {
+      fprintf(stderr,"ERROR: unable to write chunk index\n");
+      status = 1;
+    }
+  }
+
+  if (chunked_file->fp && fclose(chunked_file->fp)) status = 1;
+  free(chunked_file->chunk_offset);
+  free(chunked_file->chunk_size);
+  free(chunked_file->chunk_capacity);
+  free(chunked_file->chunk_buffer);
+  if (chunked_file->zip_buffer) free(chunked_file->zip_buffer);
+  free(chunked_file);
+
+  return status;
+}
+
+
+int writeChunkedFileBox(
+  LSM_ChunkedFile *chunked_file,
+  LSMLIB_REAL *data,
+  int *box_lo,
+  int *box_hi)
+{
+  if (!chunked_file->writable) {
+    fprintf(stderr,"ERROR: chunked data file is not writable\n");
+    return 1;
+  }
+  return processBox(chunked_file, data, box_lo, box_hi, 1);
+}
+
+
+int readChunkedFileBox(
+  LSM_ChunkedFile *chunked_file,
+  LSMLIB_REAL *data,
+  int *box_lo,
+  int *box_hi)
+{
+  return processBox(chunked_file, data, box_lo, box_hi, 0);
+}
+
+
+int readChunkedFileZSlice(
+  LSM_ChunkedFile *chunked_file,
+  LSMLIB_REAL *data,
+  int k)
+{
+  int box_lo[3], box_hi[3];
+
+  box_lo[0] = 0;
+  box_hi[0] = chunked_file->grid.grid_dims_ghostbox[0] - 1;
+  box_lo[1] = 0;
+  box_hi[1] = chunked_file->grid.grid_dims_ghostbox[1] - 1;
+  box_lo[2] = k;
+  box_hi[2] = k;
+
+  return processBox(chunked_file, data, box_lo, box_hi, 0);
+}
+
+
+void writeDataArrayChunked(
+  LSMLIB_REAL *data,
+  Grid *grid,
+  char *file_name,
+  int *chunk_dims,
+  int zip_status)
+{
+  LSM_ChunkedFile *chunked_file;
+  LSMLIB_REAL *unpadded_data = data;
+  int box_lo[3] = {0, 0, 0};
+  int box_hi[3];
+  int dir;
+
+  chunked_file = createChunkedFile(file_name, grid, chunk_dims, zip_status);
+  if (!chunked_file) return;
+
+  if (grid->num_gridpts_alloc != grid->num_gridpts) {
+    unpadded_data = (LSMLIB_REAL *)malloc(grid->num_gridpts*sizeof(LSMLIB_REAL));
+    removeDataArrayPadding(unpadded_data, data, grid);
+  }
+
+  for (dir = 0; dir < 3; dir++) {
+    box_hi[dir] = chunked_file->grid.grid_dims_ghostbox[dir] - 1;
+    if (box_hi[dir] < 0) box_hi[dir] = 0;
+  }
+  if ( writeChunkedFileBox(chunked_file, unpadded_data, box_lo, box_hi) ||
+       closeChunkedFile(chunked_file) ) {
+    fprintf(stderr,"ERROR: unable to write data array to %s\n", file_name);
+  }
+
+  if (unpadded_data != data) free(unpadded_data);
+}
+
+
+Grid *readGridFromChunkedFile(LSM_ChunkedFile *chunked_file)
+{
+  Grid *grid = (Grid *)malloc(sizeof(Grid));
+  *grid = chunked_file->grid;
+  return grid;
+}
@@ -0,0 +1,268 @@
+/*
+ * File:        lsm_chunked_io.h
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Header file for chunked (tiled) random-access data files
+ *              for serial LSMLIB calculations
+ */
+
+#ifndef included_lsm_chunked_io_h
+#define included_lsm_chunked_io_h
+
+#include <stdio.h>
+#include "LSMLIB_config.h"
+#include "lsm_grid.h"
+#include "lsm_file.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*! \file lsm_chunked_io.h
+ *
+ * \brief
+ * @ref lsm_chunked_io.h provides support for reading and writing
+ * data arrays using a chunked (i.e. tiled) file format that allows
+ * sub-boxes and z-slices of large 3D fields to be accessed without
+ * reading the entire data array.
+ *
+ * The data array is split into rectangular chunks (the last chunk in
+ * each coordinate direction may be smaller than the others) that are
+ * stored independently and optionally compressed with zlib.  A chunk
+ * index (the location and size of each chunk in the file) is stored
+ * at the end of the file, and a copy of the Grid is stored in the
+ * header so that the grid can be recovered from the data file alone.
+ *
+ * Indices of sub-boxes are 0-based indices into the ghostbox of the
+ * grid (i.e. 0 <= i < grid_dims_ghostbox[0], etc.), and data for a
+ * sub-box is stored with the x-index varying fastest (the same
+ * ordering as for full data arrays).
+ *
+ */
+
+
+/*!
+ * Default number of grid points in each coordinate direction for
+ * a chunk.
+ */
+#define LSM_DEFAULT_CHUNK_SIZE  32
+
+
+/*!
+ * The 'LSM_ChunkedFile' structure is a handle for an open chunked
+ * data file.
+ */
+typedef struct _LSM_ChunkedFile {
+
+  FILE  *fp;
+
+  /* nonzero if the file was created by createChunkedFile() */
+  int    writable;
+
+  /* grid stored in the file */
+  Grid   grid;
+
+  /* chunk layout */
+  int    chunk_dims[3];
+  int    num_chunks[3];
+  int    num_chunks_total;
+
+  /* compression of chunks (NO_ZIP or GZIP) */
+  int    zip_status;
+
+  /* chunk index: location and stored size (in bytes) of each chunk; */
+  /* chunks that have not been written have offset 0                 */
+  long long *chunk_offset;
+  long long *chunk_size;
+
+  /* space available in the file for each chunk (in bytes) */
+  long long *chunk_capacity;
+
+  /* location of end of chunk data (where new chunks are appended) */
+  long long  end_offset;
+
+  /* buffers for one (uncompressed and compressed) chunk */
+  LSMLIB_REAL   *chunk_buffer;
+  unsigned char *zip_buffer;
+  long long      zip_buffer_size;
+
+} LSM_ChunkedFile;
+
+
+/*! @{
+ ****************************************************************
+ *
+ * @name Chunked file management functions
+ *
+ ****************************************************************/
+
+/*!
+ * createChunkedFile() creates a new chunked data file for the
+ * specified grid.
+ *
+ * Arguments:
+ *  - file_name (in):   name of output file
+ *  - grid (in):        Grid for the data array
+ *  - chunk_dims (in):  number of grid points in each coordinate
+ *                      direction for a chunk (LSM_DEFAULT_CHUNK_SIZE
+ *                      is used if chunk_dims is NULL)
+ *  - zip_status (in):  compression of chunks (NO_ZIP or GZIP)
+ *
+ * Return value:        pointer to LSM_ChunkedFile; NULL if the file
+ *                      could not be created
+ *
+ * NOTES:
+ *  - GZIP compression requires LSMLIB to be configured with zlib.
+ *    Otherwise, chunks are stored uncompressed.
+ *
+ *  - Chunks that are never written are read back as zeros.
+ *
+ *  - If a file with the specified file_name already exists, it is
+ *    overwritten.
+ *
+ */
+LSM_ChunkedFile *createChunkedFile(
+  char *file_name,
+  Grid *grid,
+  int *chunk_dims,
+  int zip_status);
+
+/*!
+ * openChunkedFile() opens an existing chunked data file for reading.
+ *
+ * Arguments:
+ *  - file_name (in):  name of input file
+ *
+ * Return value:       pointer to LSM_ChunkedFile; NULL if the file
+ *                     could not be opened
+ *
+ */
+LSM_ChunkedFile *openChunkedFile(char *file_name);
+
+/*!
+ * closeChunkedFile() writes the chunk index (for files created by
+ * createChunkedFile()), closes the file, and frees the LSM_ChunkedFile
+ * structure.
+ *
+ * Arguments:
+ *  - chunked_file (in):  pointer to LSM_ChunkedFile
+ *
+ * Return value:          0 on success; 1 if the chunk index could not
+ *                        be written
+ *
+ */
+int closeChunkedFile(LSM_ChunkedFile *chunked_file);
+
+/*!
+ * writeChunkedFileBox() writes the data for a sub-box of the grid.
+ *
+ * Arguments:
+ *  - chunked_file (in):  pointer to LSM_ChunkedFile
+ *  - data (in):          data for the sub-box
+ *  - box_lo (in):        lower corner of the sub-box
+ *  - box_hi (in):        upper corner of the sub-box
+ *
+ * Return value:          0 on success; 1 otherwise
+ *
+ * NOTES:
+ *  - Chunks that are only partially covered by the sub-box are read,
+ *    updated, and rewritten.  Rewritten chunks reuse their space in
+ *    the file unless they no longer fit (compressed chunks may grow),
+ *    in which case they are appended and their old space is not
+ *    reused.
+ *
+ */
+int writeChunkedFileBox(
+  LSM_ChunkedFile *chunked_file,
+  LSMLIB_REAL *data,
+  int *box_lo,
+  int *box_hi);
+
+/*!
+ * readChunkedFileBox() reads the data for a sub-box of the grid.
+ *
+ * Arguments:
+ *  - chunked_file (in):  pointer to LSM_ChunkedFile
+ *  - data (out):         data for the sub-box
+ *  - box_lo (in):        lower corner of the sub-box
+ *  - box_hi (in):        upper corner of the sub-box
+ *
+ * Return value:          0 on success; 1 otherwise
+ *
+ * NOTES:
+ *  - Only the chunks that intersect the sub-box are read from the file.
+ *
+ *  - The memory for data is assumed to be allocated by the user.
+ *
+ */
+int readChunkedFileBox(
+  LSM_ChunkedFile *chunked_file,
+  LSMLIB_REAL *data,
+  int *box_lo,
+  int *box_hi);
+
+/*!
+ * readChunkedFileZSlice() reads the data for the z-slice with index k.
+ *
+ * Arguments:
+ *  - chunked_file (in):  pointer to LSM_ChunkedFile
+ *  - data (out):         data for the slice (grid_dims_ghostbox[0] x
+ *                        grid_dims_ghostbox[1] values)
+ *  - k (in):             index of the slice
+ *
+ * Return value:          0 on success; 1 otherwise
+ *
+ */
+int readChunkedFileZSlice(
+  LSM_ChunkedFile *chunked_file,
+  LSMLIB_REAL *data,
+  int k);
+
+/*!
+ * writeDataArrayChunked() writes an entire data array to a chunked
+ * data file.
+ *
+ * Arguments:
+ *  - data (in):        data array to be output to file
+ *  - grid (in):        Grid for the data array
+ *  - file_name (in):   name of output file
+ *  - chunk_dims (in):  number of grid points in each coordinate
+ *                      direction for a chunk (may be NULL)
+ *  - zip_status (in):  compression of chunks (NO_ZIP or GZIP)
+ *
+ * Return value:        none
+ *
+ */
+void writeDataArrayChunked(
+  LSMLIB_REAL *data,
+  Grid *grid,
+  char *file_name,
+  int *chunk_dims,
+  int zip_status);
+
+/*!
+ * readGridFromChunkedFile() returns a copy of the Grid stored in a
+ * chunked data file.
+ *
+ * Arguments:
+ *  - chunked_file (in):  pointer to LSM_ChunkedFile
+ *
+ * Return value:          pointer to newly allocated Grid
+ *
+ * NOTES:
+ *  - The Grid should be freed using destroyGrid().
+ *
+ */
+Grid *readGridFromChunkedFile(LSM_ChunkedFile *chunked_file);
+
+/*! @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+/*
+ * File:        lsm_data_array_view.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Implementation file for views of externally owned data
+ *              arrays for serial LSMLIB calculations
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "lsm_data_array_view.h"
+
+
+/*==================== Data Array View Functions =======================*/
+
+int initializeDataArrayView(
+  LSM_DataArrayView *view,
+  LSMLIB_REAL *data,
+  Grid *grid,
+  int *ghost_width,
+  int *strides)
+{
+  int gw[3], nx, ny;
+
+  gw[0] = ghost_width ? ghost_width[0] : grid->ilo_fb - grid->ilo_gb;
+  gw[1] = ghost_width ? ghost_width[1] : grid->jlo_fb - grid->jlo_gb;
+  gw[2] = ghost_width ? ghost_width[2] : grid->klo_fb - grid->klo_gb;
+
+  view->data = data;
+  view->num_dims = grid->num_dims;
+
+  view->ilo_gb = grid->ilo_fb - gw[0];  view->ihi_gb = grid->ihi_fb + gw[0];
+  view->jlo_gb = grid->jlo_fb - gw[1];  view->jhi_gb = grid->jhi_fb + gw[1];
+  if (grid->num_dims == 3) {
+    view->klo_gb = grid->klo_fb - gw[2];  view->khi_gb = grid->khi_fb + gw[2];
+  } else {
+    view->klo_gb = 0;  view->khi_gb = 0;
+  }
+
+  view->ihi_alloc = view->ihi_gb;
+  view->jhi_alloc = view->jhi_gb;
+  view->khi_alloc = view->khi_gb;
+
+  if (strides) {
+    nx = view->ihi_gb - view->ilo_gb + 1;
+    ny = view->jhi_gb - view->jlo_gb + 1;
+
+    if ( (strides[0] != 1) || (strides[1] < nx) ) {
+      fprintf(stderr,
+              "ERROR: initializeDataArrayView: invalid strides (%d,%d)\n",
+              strides[0], strides[1]);
+      return 1;
+    }
+    view->ihi_alloc = view->ilo_gb + strides[1] - 1;
+
+    if (grid->num_dims == 3) {
+      if ( (strides[2] % strides[1] != 0) ||
+           (strides[2]/strides[1] < ny) ) {
+        fprintf(stderr,
+                "ERROR: initializeDataArrayView: invalid z-stride %d\n",
+                strides[2]);
+        return 1;
+      }
+      view->jhi_alloc = view->jlo_gb + strides[2]/strides[1] - 1;
+    }
+  }
+
+  return 0;
+}
+
+
+void initializeDataArrayViewFromGrid(
+  LSM_DataArrayView *view,
+  LSMLIB_REAL *data,
+  Grid *grid)
+{
+  view->data = data;
+  view->num_dims = grid->num_dims;
+
+  view->ilo_gb = grid->ilo_gb;  view->ihi_gb = grid->ihi_gb;
+  view->jlo_gb = grid->jlo_gb;  view->jhi_gb = grid->jhi_gb;
+  view->klo_gb = grid->klo_gb;  view->khi_gb = grid->khi_gb;
+
+  view->ihi_alloc = grid->ihi_alloc;
+  view->jhi_alloc = grid->jhi_alloc;
+  view->khi_alloc = grid->khi_alloc;
+}
+
+
+int dataArrayViewIsContiguous(LSM_DataArrayView *view)
+{
+  if (view->ihi_alloc != view->ihi_gb) return 0;
+  if ( (view->num_dims == 3) && (view->jhi_alloc != view->jhi_gb) ) return 0;
+  return 1;
+}
+
+
+void copyDataArrayViewToArray(
+  LSMLIB_REAL *data,
+  LSM_DataArrayView *view)
+{
+  int nx = view->ihi_gb - view->ilo_gb + 1;
+  int ny = view->jhi_gb - view->jlo_gb + 1;
+  int nz = view->khi_gb - view->klo_gb + 1;
+  int nx_alloc = view->ihi_alloc - view->ilo_gb + 1;
+  int nxy_alloc = nx_alloc*(view->jhi_alloc - view->jlo_gb + 1);
+  int j, k;
+
+  for (k = 0; k < nz; k++)
+    for (j = 0; j < ny; j++)
+      memcpy(data + j*nx + k*nx*ny,
+             view->data + j*nx_alloc + k*nxy_alloc,
+             nx*sizeof(LSMLIB_REAL));
+}
+
+
+void copyArrayToDataArrayView(
+  LSM_DataArrayView *view,
+  LSMLIB_REAL *data)
+{
+  int nx = view->ihi_gb - view->ilo_gb + 1;
+  int ny = view->jhi_gb - view->jlo_gb + 1;
+  int nz = view->khi_gb - view->klo_gb + 1;
+  int nx_alloc = view->ihi_alloc - view->ilo_gb + 1;
+  int nxy_alloc = nx_alloc*(view->jhi_alloc - view->jlo_gb + 1);
+  int j, k;
+
+  for (k = 0; k < nz; k++)
+    for (j = 0; j < ny; j++)
+      memcpy(view->data + j*nx_alloc + k*nxy_alloc,
+             data + j*nx + k*nx*ny,
+             nx*sizeof(LSMLIB_REAL));
+}
@@ -0,0 +1,199 @@
+/*
+ * File:        lsm_data_array_view.h
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Header file for views of externally owned data arrays for
+ *              serial LSMLIB calculations
+ */
+
+#ifndef included_lsm_data_array_view_h
+#define included_lsm_data_array_view_h
+
+#include "LSMLIB_config.h"
+#include "lsm_grid.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*! \file lsm_data_array_view.h
+ *
+ * \brief
+ * @ref lsm_data_array_view.h provides support for using data arrays
+ * that are owned by the application (e.g. with a different number of
+ * ghostcells or different strides than the data arrays managed by
+ * LSMLIB) without copying them.
+ *
+ * An LSM_DataArrayView describes the memory layout of a data array
+ * relative to the index space of a Grid.  Views are accepted by the
+ * boundary condition functions (e.g. linearExtrapolationBCView()) and
+ * the Fast Marching Method functions (e.g.
+ * computeDistanceFunctionView()).  The ghostbox index space of a view
+ * may also be passed directly to the toolbox kernels, e.g.
+ *
+ *   LSM3D_HJ_ENO2(..., view.data,
+ *                 &(view.ilo_gb), &(view.ihi_alloc),
+ *                 &(view.jlo_gb), &(view.jhi_alloc),
+ *                 &(view.klo_gb), &(view.khi_alloc), ...,
+ *                 &(grid->ilo_fb), &(grid->ihi_fb), ...);
+ *
+ * because the fillbox of the Grid lies at the same indices in the
+ * index space of the view.
+ *
+ */
+
+
+/*!
+ * The 'LSM_DataArrayView' structure describes the memory layout of a
+ * data array in the index space of a Grid.
+ *
+ * NOTES:
+ * - The data array holds values for the index space
+ *   [ilo_gb,ihi_gb] x [jlo_gb,jhi_gb] x [klo_gb,khi_gb].  Its memory
+ *   is laid out as a Fortran array with index space
+ *   [ilo_gb,ihi_alloc] x [jlo_gb,jhi_alloc] x [klo_gb,khi_alloc] (i.e.
+ *   the distance between consecutive rows is ihi_alloc-ilo_gb+1).
+ *
+ * - The view does not own the data array.
+ *
+ */
+typedef struct _LSM_DataArrayView {
+
+  /* address of the value at (ilo_gb, jlo_gb, klo_gb) */
+  LSMLIB_REAL *data;
+
+  /* dimension (2 or 3) */
+  int num_dims;
+
+  /* index space of data array (the fillbox of the Grid is at the */
+  /* same indices)                                                 */
+  int ilo_gb, ihi_gb, jlo_gb, jhi_gb, klo_gb, khi_gb;
+
+  /* upper limits of index space of the memory layout */
+  int ihi_alloc, jhi_alloc, khi_alloc;
+
+} LSM_DataArrayView;
+
+
+/*! @{
+ ****************************************************************
+ *
+ * @name Data array view functions
+ *
+ ****************************************************************/
+
+/*!
+ * initializeDataArrayView() sets up a view of an application-owned
+ * data array.
+ *
+ * Arguments:
+ *  - view (out):         pointer to LSM_DataArrayView
+ *  - data (in):          address of the first value of the data array
+ *                        (i.e. the value in the lower corner of its
+ *                        ghostbox)
+ *  - grid (in):          pointer to Grid
+ *  - ghost_width (in):   number of ghostcells of the data array on each
+ *                        side of the fillbox of grid in each coordinate
+ *                        direction (the number of ghostcells of grid is
+ *                        used if ghost_width is NULL)
+ *  - strides (in):       distance (in values) between consecutive values
+ *                        in each coordinate direction (a contiguous
+ *                        layout is assumed if strides is NULL)
+ *
+ * Return value:          0 if the layout can be represented by a view;
+ *                        1 otherwise
+ *
+ * NOTES:
+ * - strides[0] must be 1, strides[1] must be at least the number of
+ *   values in a row, and (in 3D) strides[2] must be a multiple of
+ *   strides[1] that is at least strides[1] times the number of rows.
+ *
+ * - The toolbox kernels for spatial derivatives and level set
+ *   evolution require ghost_width to be at least the number of
+ *   ghostcells used by the spatial discretization.
+ *
+ * - The size of the ghost_width and strides arrays should be equal to
+ *   the number of dimensions.
+ *
+ */
+int initializeDataArrayView(
+  LSM_DataArrayView *view,
+  LSMLIB_REAL *data,
+  Grid *grid,
+  int *ghost_width,
+  int *strides);
+
+/*!
+ * initializeDataArrayViewFromGrid() sets up a view of a data array that
+ * is laid out as specified by the Grid (including the padding set by
+ * setGridAllocationPadding()).
+ *
+ * Arguments:
+ *  - view (out):  pointer to LSM_DataArrayView
+ *  - data (in):   data array of size grid->num_gridpts_alloc
+ *  - grid (in):   pointer to Grid
+ *
+ * Return value:   none
+ *
+ */
+void initializeDataArrayViewFromGrid(
+  LSM_DataArrayView *view,
+  LSMLIB_REAL *data,
+  Grid *grid);
+
+/*!
+ * dataArrayViewIsContiguous() returns 1 if the values in the ghostbox
+ * of the view are stored contiguously (i.e. rows and planes are not
+ * padded) and 0 otherwise.
+ *
+ * Arguments:
+ *  - view (in):  pointer to LSM_DataArrayView
+ *
+ * Return value:  1 if data array is contiguous; 0 otherwise
+ *
+ */
+int dataArrayViewIsContiguous(LSM_DataArrayView *view);
+
+/*!
+ * copyDataArrayViewToArray() copies the values in the ghostbox of
+ * the view into a contiguous data array.
+ *
+ * Arguments:
+ *  - data (out):  contiguous data array with the extents of the
+ *                 ghostbox of the view
+ *  - view (in):   pointer to LSM_DataArrayView
+ *
+ * Return value:   none
+ *
+ */
+void copyDataArrayViewToArray(
+  LSMLIB_REAL *data,
+  LSM_DataArrayView *view);
+
+/*!
+ * copyArrayToDataArrayView() copies a contiguous data array into the
+ * ghostbox of the view.
+ *
+ * Arguments:
+ *  - view (in):  pointer to LSM_DataArrayView
+ *  - data (in):  contiguous data array with the extents of the
+ *                ghostbox of the view
+ *
+ * Return value:  none
+ *
+ */
+void copyArrayToDataArrayView(
+  LSM_DataArrayView *view,
+  LSMLIB_REAL *data);
+
+/*! @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
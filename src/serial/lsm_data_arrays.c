@@ -19,6 +19,11 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "lsm_data_arrays.h"
 
@@ -26,10 +31,47 @@
 #define ISZ  sizeof(int)
 #define UCSZ sizeof(unsigned char)
 
+/* identifier at the start of files written by writeDataArrayAligned() */
+#define LSM_ALIGNED_MAGIC       "LSMLIB\0A"
+#define LSM_ALIGNED_MAGIC_SIZE  8
+
+/* identifier at the start of files written by writeDataArrayNarrowBand() */
+#define LSM_NARROW_BAND_MAGIC   "LSMLIB\0N"
+
 #define LSMLIB_SERIAL_dummy_pointer        ((LSMLIB_REAL*)(-1))
 #define LSMLIB_SERIAL_dummy_pointer_int    ((int*)(-1))
 #define LSMLIB_SERIAL_dummy_pointer_uchar  ((unsigned char*)(-1))
 
+/* maximum number of data arrays in LSM_DataArrays */
+#define LSM_MAX_NUM_DATA_ARRAYS  64
+
+/* arrays in the arena are staggered so they do not start at addresses */
+/* separated by multiples of the page size (avoids cache aliasing)     */
+#define LSM_ARENA_PAGE_SIZE      4096
+
+#ifdef MAP_ANONYMOUS
+#define LSM_MAP_ANONYMOUS  MAP_ANONYMOUS
+#else
+#define LSM_MAP_ANONYMOUS  MAP_ANON
+#endif
+
+
+/*
+ * getUnpaddedDataArray() returns data if the data arrays for the grid
+ * are not padded.  Otherwise, it returns a newly allocated copy of 
+ * data without the padding, which must be freed by the caller.
+ */
+static LSMLIB_REAL *getUnpaddedDataArray(LSMLIB_REAL *data, Grid *grid)
+{
+  LSMLIB_REAL *unpadded_data;
+  
+  if (grid->num_gridpts_alloc == grid->num_gridpts) return data;
+  
+  unpadded_data = (LSMLIB_REAL *) malloc(grid->num_gridpts*DSZ);
+  removeDataArrayPadding(unpadded_data, data, grid);
+  return unpadded_data;
+}
+
 LSM_DataArrays *allocateLSMDataArrays(void)
 {
   LSM_DataArrays *lsm_data_arrays;
@@ -99,6 +141,9 @@ LSM_DataArrays *allocateLSMDataArrays(void)
   lsm_data_arrays->D2 = LSMLIB_SERIAL_dummy_pointer;
   lsm_data_arrays->D3 = LSMLIB_SERIAL_dummy_pointer;
   
+  lsm_data_arrays->arena = NULL;
+  lsm_data_arrays->arena_size = 0;
+  
   return  lsm_data_arrays;
 }
 
@@ -112,268 +157,406 @@ void destroyLSMDataArrays(LSM_DataArrays *lsm_data_arrays)
 }
 
 
-void  allocateMemoryForLSMDataArrays(
+void initializeLSMDataArraysFeatures(LSM_DataArraysFeatures *features)
+{
+  features->accuracy = VERY_HIGH;
+  features->upwind_derivatives = 1;
+  features->second_derivatives = 1;
+  features->velocity_type = LSM_NORMAL_VELOCITY | LSM_EXTERNAL_VELOCITY;
+  features->localization = 1;
+  features->reinitialization = 1;
+  features->rhs_storage = 1;
+  features->mask = 1;
+  features->solid = 1;
+  features->extra_storage = 1;
+}
+
+
+/* sets data array pointer to NULL if it has not been allocated */
+#define LSM_SKIP_DATA_ARRAY(ptr, dummy)                                  \
+  if( (ptr) == (dummy) ) (ptr) = NULL;
+
+void setLSMDataArraysFeatures(
   LSM_DataArrays *lsm_data_arrays,
-  Grid *grid)
+  LSM_DataArraysFeatures *features)
 {
- /* Only arrays that are equal to LSMLIB_SERIAL_dummy_pointer will get memory allocated.
-  *   If memory allocation is to be avoided, set the pointer to NULL,
-  *   Non-NULL pointers different from LSMLIB_SERIAL_dummy_pointer are assumed allocated
-  *   elsewhere and that will not be overridden.
-  */
-        
-  if( lsm_data_arrays->phi == LSMLIB_SERIAL_dummy_pointer )
-    lsm_data_arrays->phi = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
-    
-  if( lsm_data_arrays->phi_stage1  == LSMLIB_SERIAL_dummy_pointer )
-    lsm_data_arrays->phi_stage1 = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
-  
-  if( lsm_data_arrays->phi_stage2  == LSMLIB_SERIAL_dummy_pointer )  
-    lsm_data_arrays->phi_stage2 = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
+  LSM_DataArrays *d = lsm_data_arrays;
   
-  if( lsm_data_arrays->phi_next  == LSMLIB_SERIAL_dummy_pointer ) 
-    lsm_data_arrays->phi_next = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
+  /* divided differences: D2 is not used by ENO1, D3 only by ENO3 */
+  if( features->accuracy == LOW )
+  {
+    LSM_SKIP_DATA_ARRAY(d->D2, LSMLIB_SERIAL_dummy_pointer)
+  }
+  if( features->accuracy != HIGH )
+  {
+    LSM_SKIP_DATA_ARRAY(d->D3, LSMLIB_SERIAL_dummy_pointer)
+  }
   
-  if( lsm_data_arrays->phi0  == LSMLIB_SERIAL_dummy_pointer )
-    lsm_data_arrays->phi0 = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);  
+  /* second TVD Runge-Kutta stage is only used by third-order scheme */
+  if( features->accuracy <= MEDIUM )
+  {
+    LSM_SKIP_DATA_ARRAY(d->phi_stage2, LSMLIB_SERIAL_dummy_pointer)
+  }
   
-  if( lsm_data_arrays->phi_prev  == LSMLIB_SERIAL_dummy_pointer ) 
-    lsm_data_arrays->phi_prev = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
+  if( !features->upwind_derivatives )
+  {
+    LSM_SKIP_DATA_ARRAY(d->phi_x_plus, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->phi_x_minus, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->phi_y_plus, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->phi_y_minus, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->phi_z_plus, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->phi_z_minus, LSMLIB_SERIAL_dummy_pointer)
+  }
   
-  if( lsm_data_arrays->phi_extra  == LSMLIB_SERIAL_dummy_pointer ) 
-    lsm_data_arrays->phi_extra = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
-   
-  if( lsm_data_arrays->mask  == LSMLIB_SERIAL_dummy_pointer )
-    lsm_data_arrays->mask = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);  
-    
-  if( lsm_data_arrays->lse_rhs  == LSMLIB_SERIAL_dummy_pointer )
-    lsm_data_arrays->lse_rhs = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-        
-  if( lsm_data_arrays->phi_x_plus  == LSMLIB_SERIAL_dummy_pointer ) 
-    lsm_data_arrays->phi_x_plus  = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-   
-  if( lsm_data_arrays->phi_x_minus  == LSMLIB_SERIAL_dummy_pointer )     
-    lsm_data_arrays->phi_x_minus = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-    
-  if( lsm_data_arrays->phi_x  == LSMLIB_SERIAL_dummy_pointer )     
-    lsm_data_arrays->phi_x = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-     
-  if( lsm_data_arrays->phi_y_plus  == LSMLIB_SERIAL_dummy_pointer )      
-    lsm_data_arrays->phi_y_plus  = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
+  if( !features->second_derivatives )
+  {
+    LSM_SKIP_DATA_ARRAY(d->phi_xx, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->phi_xy, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->phi_yy, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->phi_xz, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->phi_yz, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->phi_zz, LSMLIB_SERIAL_dummy_pointer)
+  }
   
-  if( lsm_data_arrays->phi_y_minus  == LSMLIB_SERIAL_dummy_pointer )     
-    lsm_data_arrays->phi_y_minus = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
+  if( !(features->velocity_type & LSM_NORMAL_VELOCITY) )
+  {
+    LSM_SKIP_DATA_ARRAY(d->normal_velocity, LSMLIB_SERIAL_dummy_pointer)
+  }
+  if( !(features->velocity_type & LSM_EXTERNAL_VELOCITY) )
+  {
+    LSM_SKIP_DATA_ARRAY(d->external_velocity_x, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->external_velocity_y, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->external_velocity_z, LSMLIB_SERIAL_dummy_pointer)
+  }
   
-  if( lsm_data_arrays->phi_y  == LSMLIB_SERIAL_dummy_pointer )     
-    lsm_data_arrays->phi_y = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
+  if( !features->localization )
+  {
+    LSM_SKIP_DATA_ARRAY(d->narrow_band, LSMLIB_SERIAL_dummy_pointer_uchar)
+    LSM_SKIP_DATA_ARRAY(d->index_x, LSMLIB_SERIAL_dummy_pointer_int)
+    LSM_SKIP_DATA_ARRAY(d->index_y, LSMLIB_SERIAL_dummy_pointer_int)
+    LSM_SKIP_DATA_ARRAY(d->index_z, LSMLIB_SERIAL_dummy_pointer_int)
+    LSM_SKIP_DATA_ARRAY(d->index_outer_pts, LSMLIB_SERIAL_dummy_pointer_int)
+  }
   
-  if(grid->num_dims == 3)
+  if( !features->reinitialization )
   {
-      if( lsm_data_arrays->phi_z_plus  == LSMLIB_SERIAL_dummy_pointer )
-        lsm_data_arrays->phi_z_plus  = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-      
-      if( lsm_data_arrays->phi_z_minus  == LSMLIB_SERIAL_dummy_pointer )	    
-        lsm_data_arrays->phi_z_minus = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-     
-      if( lsm_data_arrays->phi_z  == LSMLIB_SERIAL_dummy_pointer )	    
-        lsm_data_arrays->phi_z = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
+    LSM_SKIP_DATA_ARRAY(d->phi0, LSMLIB_SERIAL_dummy_pointer)
   }
-  else
+  
+  /* reinitialization also uses lse_rhs */
+  if( !features->rhs_storage && !features->reinitialization )
   {
-     lsm_data_arrays->phi_z_plus = (LSMLIB_REAL *)NULL;
-     lsm_data_arrays->phi_z_minus = (LSMLIB_REAL *)NULL;
-     lsm_data_arrays->phi_z = (LSMLIB_REAL *)NULL;
+    LSM_SKIP_DATA_ARRAY(d->lse_rhs, LSMLIB_SERIAL_dummy_pointer)
   }
   
-  if( lsm_data_arrays->phi_xx  == LSMLIB_SERIAL_dummy_pointer )  
-    lsm_data_arrays->phi_xx = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
-    
-  if( lsm_data_arrays->phi_xy  == LSMLIB_SERIAL_dummy_pointer )  
-    lsm_data_arrays->phi_xy = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
-    
-  if( lsm_data_arrays->phi_yy  == LSMLIB_SERIAL_dummy_pointer )  
-    lsm_data_arrays->phi_yy = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
+  if( !features->mask )
+  {
+    LSM_SKIP_DATA_ARRAY(d->mask, LSMLIB_SERIAL_dummy_pointer)
+  }
   
-  if(grid->num_dims == 3)
+  if( !features->solid )
   {
-     if( lsm_data_arrays->phi_zz  == LSMLIB_SERIAL_dummy_pointer )
-       lsm_data_arrays->phi_zz = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
-     
-     if( lsm_data_arrays->phi_xz  == LSMLIB_SERIAL_dummy_pointer )
-       lsm_data_arrays->phi_xz = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
-     
-     if( lsm_data_arrays->phi_yz  == LSMLIB_SERIAL_dummy_pointer )
-       lsm_data_arrays->phi_yz = (LSMLIB_REAL*) calloc(grid->num_gridpts,DSZ);
+    LSM_SKIP_DATA_ARRAY(d->solid_narrow_band, 
+                        LSMLIB_SERIAL_dummy_pointer_uchar)
+    LSM_SKIP_DATA_ARRAY(d->solid_index_x, LSMLIB_SERIAL_dummy_pointer_int)
+    LSM_SKIP_DATA_ARRAY(d->solid_index_y, LSMLIB_SERIAL_dummy_pointer_int)
+    LSM_SKIP_DATA_ARRAY(d->solid_index_z, LSMLIB_SERIAL_dummy_pointer_int)
+    LSM_SKIP_DATA_ARRAY(d->solid_normal_x, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->solid_normal_y, LSMLIB_SERIAL_dummy_pointer)
+    LSM_SKIP_DATA_ARRAY(d->solid_normal_z, LSMLIB_SERIAL_dummy_pointer)
   }
-  else
+  
+  if( !features->extra_storage )
   {
-     lsm_data_arrays->phi_zz = (LSMLIB_REAL *)NULL;
-     lsm_data_arrays->phi_xz = (LSMLIB_REAL *)NULL;
-     lsm_data_arrays->phi_yz = (LSMLIB_REAL *)NULL;
+    LSM_SKIP_DATA_ARRAY(d->phi_extra, LSMLIB_SERIAL_dummy_pointer)
+  }
+}
+
+
+/* adds data array to list of arrays to allocate from the arena */
+#define LSM_ADD_DATA_ARRAY(ptr, dummy, size)                             \
+  if( (ptr) == (dummy) )                                                 \
+  {                                                                      \
+    slot[num_arrays] = (void **) &(ptr);                                 \
+    elem_size[num_arrays] = (size);                                      \
+    num_arrays++;                                                        \
   }
+
+void  allocateMemoryForLSMDataArrays(
+  LSM_DataArrays *lsm_data_arrays,
+  Grid *grid)
+{
+  LSM_DataArrays *d = lsm_data_arrays;
+  void  **slot[LSM_MAX_NUM_DATA_ARRAYS];
+  size_t  elem_size[LSM_MAX_NUM_DATA_ARRAYS];
+  size_t  offset[LSM_MAX_NUM_DATA_ARRAYS];
+  size_t  arena_size = 0, array_size;
+  int     num_arrays = 0, allocate_outer_pts, i;
+  char   *arena;
   
-  if( lsm_data_arrays->normal_velocity  == LSMLIB_SERIAL_dummy_pointer )  
-    lsm_data_arrays->normal_velocity = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
+ /* Only arrays that are equal to LSMLIB_SERIAL_dummy_pointer will get memory allocated.
+  *   If memory allocation is to be avoided, set the pointer to NULL,
+  *   Non-NULL pointers different from LSMLIB_SERIAL_dummy_pointer are assumed allocated
+  *   elsewhere and that will not be overridden.
+  */
   
-  if( lsm_data_arrays->external_velocity_x  == LSMLIB_SERIAL_dummy_pointer )  
-    lsm_data_arrays->external_velocity_x = 
-      (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-   
-  if( lsm_data_arrays->external_velocity_y  == LSMLIB_SERIAL_dummy_pointer )  
-    lsm_data_arrays->external_velocity_y = 
-      (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-    
-  if(grid->num_dims == 3)
+  /* z-direction arrays are not used in 2d */
+  if(grid->num_dims != 3)
   {
-    if( lsm_data_arrays->external_velocity_z  == LSMLIB_SERIAL_dummy_pointer )  
-      lsm_data_arrays->external_velocity_z = 
-        (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);	
+     d->phi_z_plus = (LSMLIB_REAL *)NULL;
+     d->phi_z_minus = (LSMLIB_REAL *)NULL;
+     d->phi_z = (LSMLIB_REAL *)NULL;
+     d->phi_zz = (LSMLIB_REAL *)NULL;
+     d->phi_xz = (LSMLIB_REAL *)NULL;
+     d->phi_yz = (LSMLIB_REAL *)NULL;
+     d->external_velocity_z = (LSMLIB_REAL *)NULL;
+     d->index_z = (int*) NULL;
+     d->solid_index_z = (int*) NULL;
+     d->solid_normal_z = (LSMLIB_REAL *)NULL;
   }
-  else lsm_data_arrays->external_velocity_z = (LSMLIB_REAL *)NULL;
   
-  if (lsm_data_arrays->D1 == LSMLIB_SERIAL_dummy_pointer )
-    lsm_data_arrays->D1 = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
+  allocate_outer_pts = 
+    (d->index_outer_pts == LSMLIB_SERIAL_dummy_pointer_int);
   
-  if (lsm_data_arrays->D2 == LSMLIB_SERIAL_dummy_pointer )  
-    lsm_data_arrays->D2 = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-   
-  if (lsm_data_arrays->D3 == LSMLIB_SERIAL_dummy_pointer )
-    lsm_data_arrays->D3 = (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-        
-  if( lsm_data_arrays->narrow_band == LSMLIB_SERIAL_dummy_pointer_uchar )  
-    lsm_data_arrays->narrow_band = (unsigned char*) malloc(grid->num_gridpts*UCSZ);
-    
-  if( lsm_data_arrays->index_x == LSMLIB_SERIAL_dummy_pointer_int )
-    lsm_data_arrays->index_x = (int*) malloc(grid->num_gridpts*ISZ); 
+  LSM_ADD_DATA_ARRAY(d->phi, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_stage1, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_stage2, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_next, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi0, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_prev, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_extra, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->mask, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->lse_rhs, LSMLIB_SERIAL_dummy_pointer, DSZ)
   
-  if( lsm_data_arrays->index_y == LSMLIB_SERIAL_dummy_pointer_int )
-    lsm_data_arrays->index_y = (int*) malloc(grid->num_gridpts*ISZ);
+  LSM_ADD_DATA_ARRAY(d->phi_x_plus, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_x_minus, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_x, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_y_plus, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_y_minus, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_y, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_z_plus, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_z_minus, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_z, LSMLIB_SERIAL_dummy_pointer, DSZ)
   
-  if(grid->num_dims == 3)
-  { 
-    if( lsm_data_arrays->index_z == LSMLIB_SERIAL_dummy_pointer_int )
-      lsm_data_arrays->index_z = (int*) malloc(grid->num_gridpts*ISZ);
-  }
-  else  lsm_data_arrays->index_z = (int*) NULL;
+  LSM_ADD_DATA_ARRAY(d->phi_xx, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_xy, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_yy, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_zz, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_xz, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->phi_yz, LSMLIB_SERIAL_dummy_pointer, DSZ)
   
-  if( lsm_data_arrays->index_outer_pts == LSMLIB_SERIAL_dummy_pointer_int )
-  {
-    lsm_data_arrays->index_outer_pts = (int*) malloc(grid->num_gridpts*ISZ);
-    lsm_data_arrays->num_alloc_index_outer_pts = grid->num_gridpts;
-  }  
-    
-    
-  if( lsm_data_arrays->solid_narrow_band == LSMLIB_SERIAL_dummy_pointer_uchar )  
-    lsm_data_arrays->solid_narrow_band = (unsigned char*) malloc(grid->num_gridpts*UCSZ);
-    
-  if( lsm_data_arrays->solid_index_x == LSMLIB_SERIAL_dummy_pointer_int )
-    lsm_data_arrays->solid_index_x = (int*) malloc(grid->num_gridpts*ISZ); 
+  LSM_ADD_DATA_ARRAY(d->normal_velocity, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->external_velocity_x, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->external_velocity_y, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->external_velocity_z, LSMLIB_SERIAL_dummy_pointer, DSZ)
   
-  if( lsm_data_arrays->solid_index_y == LSMLIB_SERIAL_dummy_pointer_int )
-    lsm_data_arrays->solid_index_y = (int*) malloc(grid->num_gridpts*ISZ);
+  LSM_ADD_DATA_ARRAY(d->D1, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->D2, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->D3, LSMLIB_SERIAL_dummy_pointer, DSZ)
   
-  if(grid->num_dims == 3)
-  { 
-    if( lsm_data_arrays->solid_index_z == LSMLIB_SERIAL_dummy_pointer_int )
-      lsm_data_arrays->solid_index_z = (int*) malloc(grid->num_gridpts*ISZ);
-  }
-  else  lsm_data_arrays->solid_index_z = (int*) NULL;
+  LSM_ADD_DATA_ARRAY(d->narrow_band, LSMLIB_SERIAL_dummy_pointer_uchar, UCSZ)
+  LSM_ADD_DATA_ARRAY(d->index_x, LSMLIB_SERIAL_dummy_pointer_int, ISZ)
+  LSM_ADD_DATA_ARRAY(d->index_y, LSMLIB_SERIAL_dummy_pointer_int, ISZ)
+  LSM_ADD_DATA_ARRAY(d->index_z, LSMLIB_SERIAL_dummy_pointer_int, ISZ)
+  LSM_ADD_DATA_ARRAY(d->index_outer_pts, LSMLIB_SERIAL_dummy_pointer_int, ISZ)
   
+  LSM_ADD_DATA_ARRAY(d->solid_narrow_band, LSMLIB_SERIAL_dummy_pointer_uchar,
+                     UCSZ)
+  LSM_ADD_DATA_ARRAY(d->solid_index_x, LSMLIB_SERIAL_dummy_pointer_int, ISZ)
+  LSM_ADD_DATA_ARRAY(d->solid_index_y, LSMLIB_SERIAL_dummy_pointer_int, ISZ)
+  LSM_ADD_DATA_ARRAY(d->solid_index_z, LSMLIB_SERIAL_dummy_pointer_int, ISZ)
+  LSM_ADD_DATA_ARRAY(d->solid_normal_x, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->solid_normal_y, LSMLIB_SERIAL_dummy_pointer, DSZ)
+  LSM_ADD_DATA_ARRAY(d->solid_normal_z, LSMLIB_SERIAL_dummy_pointer, DSZ)
   
+  if( allocate_outer_pts )
+    d->num_alloc_index_outer_pts = grid->num_gridpts_alloc;
   
-  if( lsm_data_arrays->solid_normal_x  == LSMLIB_SERIAL_dummy_pointer )  
-    lsm_data_arrays->solid_normal_x = 
-      (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
-   
-  if( lsm_data_arrays->solid_normal_y  == LSMLIB_SERIAL_dummy_pointer )  
-    lsm_data_arrays->solid_normal_y = 
-      (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);
+  if( (num_arrays == 0) || (d->arena != NULL) )
+  {
+    /* arrays requested after the arena was created are allocated */
+    /* individually                                                */
+    for(i = 0; i < num_arrays; i++)
+      *(slot[i]) = calloc(grid->num_gridpts_alloc,elem_size[i]);
+    return;
+  }
+  
+  /* lay out arrays in the arena */
+  for(i = 0; i < num_arrays; i++)
+  {
+    array_size = ((size_t) grid->num_gridpts_alloc)*elem_size[i];
+    array_size = ( (array_size + LSM_DATA_ARRAYS_ALIGNMENT - 1)
+                 / LSM_DATA_ARRAYS_ALIGNMENT ) * LSM_DATA_ARRAYS_ALIGNMENT;
+    if( array_size % LSM_ARENA_PAGE_SIZE == 0 )
+      array_size += LSM_DATA_ARRAYS_ALIGNMENT;
     
-  if(grid->num_dims == 3)
+    offset[i] = arena_size;
+    arena_size += array_size;
+  }
+  
+  /* anonymous mappings are page-aligned, zero-filled, and backed by */
+  /* physical memory only when touched                                */
+  arena = (char *) mmap(NULL, arena_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | LSM_MAP_ANONYMOUS, -1, 0);
+  if( arena == (char *) MAP_FAILED )
   {
-    if( lsm_data_arrays->solid_normal_z  == LSMLIB_SERIAL_dummy_pointer )  
-      lsm_data_arrays->solid_normal_z = 
-        (LSMLIB_REAL*) malloc(grid->num_gridpts*DSZ);	
+    for(i = 0; i < num_arrays; i++)
+      *(slot[i]) = calloc(grid->num_gridpts_alloc,elem_size[i]);
+    return;
   }
-  else lsm_data_arrays->solid_normal_z = (LSMLIB_REAL *)NULL;  
+  
+  d->arena = arena;
+  d->arena_size = arena_size;
+  for(i = 0; i < num_arrays; i++)
+    *(slot[i]) = arena + offset[i];
 }     
 
 
+/*
+ * freeDataArray() frees a data array unless it is part of the arena or
+ * has not been allocated.
+ */
+static void freeDataArray(LSM_DataArrays *lsm_data_arrays, void *ptr)
+{
+  char *arena = (char *) lsm_data_arrays->arena;
+  
+  if( (ptr == NULL) || (ptr == (void *) LSMLIB_SERIAL_dummy_pointer) )
+    return;
+  if( arena && ((char *) ptr >= arena) && 
+      ((char *) ptr < arena + lsm_data_arrays->arena_size) )
+    return;
+  free(ptr);
+}
+
+
 
 void  freeMemoryForLSMDataArrays(LSM_DataArrays *lsm_data_arrays)
 {   
-  free(lsm_data_arrays->phi);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi);
   
-  free(lsm_data_arrays->phi_stage1); 
-  free(lsm_data_arrays->phi_stage2);
-  free(lsm_data_arrays->phi_next);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_stage1); 
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_stage2);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_next);
   
-  free(lsm_data_arrays->phi0);      
-  free(lsm_data_arrays->phi_prev);
-  free(lsm_data_arrays->phi_extra);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi0);      
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_prev);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_extra);
   
-  free(lsm_data_arrays->mask); 
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->mask); 
   
-  free(lsm_data_arrays->lse_rhs);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->lse_rhs);
    
-  free(lsm_data_arrays->phi_x_plus);
-  free(lsm_data_arrays->phi_x_minus);    
-  free(lsm_data_arrays->phi_x);    
-  free(lsm_data_arrays->phi_y_plus);
-  free(lsm_data_arrays->phi_y_minus);
-  free(lsm_data_arrays->phi_y);    
-  free(lsm_data_arrays->phi_z_plus);
-  free(lsm_data_arrays->phi_z_minus);  
-  free(lsm_data_arrays->phi_z);    
-  
-  free(lsm_data_arrays->phi_xx);
-  free(lsm_data_arrays->phi_xy);
-  free(lsm_data_arrays->phi_yy);
-  free(lsm_data_arrays->phi_xz);
-  free(lsm_data_arrays->phi_yz);
-  free(lsm_data_arrays->phi_zz);
-  
-  free(lsm_data_arrays->normal_velocity);
-  free(lsm_data_arrays->external_velocity_x);
-  free(lsm_data_arrays->external_velocity_y);
-  free(lsm_data_arrays->external_velocity_z);
-
-  free(lsm_data_arrays->narrow_band);
-  free(lsm_data_arrays->index_x);
-  free(lsm_data_arrays->index_y);
-  free(lsm_data_arrays->index_z);
-
-  free(lsm_data_arrays->index_outer_pts);
-  
-  free(lsm_data_arrays->solid_narrow_band);
-  free(lsm_data_arrays->solid_index_x);
-  free(lsm_data_arrays->solid_index_y);
-  free(lsm_data_arrays->solid_index_z);
-  
-  free(lsm_data_arrays->solid_normal_x);
-  free(lsm_data_arrays->solid_normal_y);
-  free(lsm_data_arrays->solid_normal_z);
-  
-  free(lsm_data_arrays->D1);
-  free(lsm_data_arrays->D2);
-  free(lsm_data_arrays->D3);  
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_x_plus);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_x_minus);    
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_x);    
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_y_plus);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_y_minus);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_y);    
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_z_plus);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_z_minus);  
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_z);    
+  
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_xx);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_xy);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_yy);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_xz);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_yz);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->phi_zz);
+  
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->normal_velocity);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->external_velocity_x);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->external_velocity_y);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->external_velocity_z);
+
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->narrow_band);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->index_x);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->index_y);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->index_z);
+
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->index_outer_pts);
+  
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->solid_narrow_band);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->solid_index_x);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->solid_index_y);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->solid_index_z);
+  
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->solid_normal_x);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->solid_normal_y);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->solid_normal_z);
+  
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->D1);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->D2);
+  freeDataArray(lsm_data_arrays,lsm_data_arrays->D3);  
+  
+  if( lsm_data_arrays->arena )
+  {
+    munmap(lsm_data_arrays->arena,lsm_data_arrays->arena_size);
+    lsm_data_arrays->arena = NULL;
+    lsm_data_arrays->arena_size = 0;
+  }
 }
    
 
+void removeDataArrayPadding(
+     LSMLIB_REAL *unpadded_data,
+     LSMLIB_REAL *data,
+     Grid *grid)
+{
+   int  nx = grid->grid_dims_ghostbox[0];
+   int  ny = grid->grid_dims_ghostbox[1];
+   int  nz = (grid->num_dims == 3) ? grid->grid_dims_ghostbox[2] : 1;
+   int  nx_alloc = grid->grid_dims_alloc[0];
+   int  nxy_alloc = nx_alloc*grid->grid_dims_alloc[1];
+   int  j, k;
+  
+   for (k = 0; k < nz; k++)
+     for (j = 0; j < ny; j++)
+       memcpy(unpadded_data + j*nx + k*nx*ny, 
+              data + j*nx_alloc + k*nxy_alloc, nx*DSZ);
+}
+
+
+void addDataArrayPadding(
+     LSMLIB_REAL *data,
+     LSMLIB_REAL *unpadded_data,
+     Grid *grid)
+{
+   int  nx = grid->grid_dims_ghostbox[0];
+   int  ny = grid->grid_dims_ghostbox[1];
+   int  nz = (grid->num_dims == 3) ? grid->grid_dims_ghostbox[2] : 1;
+   int  nx_alloc = grid->grid_dims_alloc[0];
+   int  nxy_alloc = nx_alloc*grid->grid_dims_alloc[1];
+   int  j, k;
+  
+   /* copy backwards so that data and unpadded_data may be the same */
+   for (k = nz-1; k >= 0; k--)
+     for (j = ny-1; j >= 0; j--)
+       memmove(data + j*nx_alloc + k*nxy_alloc,
+               unpadded_data + j*nx + k*nx*ny, nx*DSZ);
+}
+
+
 void writeDataArray(LSMLIB_REAL *data, Grid *grid, char *file_name,int zip_status)
 {
-   FILE *fp;
+   LSM_FILE    *fp;
+   LSMLIB_REAL *unpadded_data;
    
-   fp = fopen(file_name,"w");   
+   fp = openLSMFileForWriting(file_name,zip_status);
+   if (!fp)
+   {
+      printf("\nCould not open file %s",file_name);
+      return;
+   }
 
    /* write grid dimensions */
-   fwrite(grid->grid_dims_ghostbox, sizeof(int), 3, fp); 
+   writeLSMFile(grid->grid_dims_ghostbox, sizeof(int), 3, fp); 
 
    /* write data array */
-   fwrite(data, DSZ, grid->num_gridpts, fp);
+   unpadded_data = getUnpaddedDataArray(data, grid);
+   writeLSMFile(unpadded_data, DSZ, grid->num_gridpts, fp);
+   if (unpadded_data != data) free(unpadded_data);
 
-   fclose(fp);
-   zipFile(file_name,zip_status);
+   closeLSMFile(fp);
 }
 
 
@@ -383,37 +566,104 @@ void writeDataArrayNoGrid(
      char *file_name,
      int zip_status)
 {
-   FILE *fp;
+   LSM_FILE *fp;
    
-   fp = fopen(file_name,"w");   
+   fp = openLSMFileForWriting(file_name,zip_status);
+   if (!fp)
+   {
+      printf("\nCould not open file %s",file_name);
+      return;
+   }
 
    /* write grid dimensions */
-   fwrite(n, sizeof(int), 3, fp); 
+   writeLSMFile(n, sizeof(int), 3, fp); 
 
    /* write data array */
-   fwrite(data, sizeof(LSMLIB_REAL), n[0]*n[1]*n[2], fp);
+   writeLSMFile(data, sizeof(LSMLIB_REAL), n[0]*n[1]*n[2], fp);
 
-   fclose(fp);
-   zipFile(file_name,zip_status);
+   closeLSMFile(fp);
+}
+
+
+/*
+ * readNarrowBandSnapshot() reads the remainder of a narrow band snapshot
+ * after the file identifier and sizeof(LSMLIB_REAL) (real_size) have
+ * been read.
+ */
+static LSMLIB_REAL *readNarrowBandSnapshot(
+     LSM_FILE *fp,
+     int real_size,
+     int *grid_dims_ghostbox,
+     LSMLIB_REAL *threshold)
+{
+   int     num_gridpts;
+   LSMLIB_REAL    *data;
+
+   if (real_size != DSZ)
+   {
+     printf("\nNarrow band snapshot has incompatible precision");
+     return NULL;
+   }
+
+   readLSMFile(grid_dims_ghostbox, sizeof(int), 3, fp);
+   readLSMFile(threshold, DSZ, 1, fp);
+
+   num_gridpts = grid_dims_ghostbox[0] * grid_dims_ghostbox[1]
+               * grid_dims_ghostbox[2];
+   data = (LSMLIB_REAL *) malloc(num_gridpts*DSZ);
+   if (readNarrowBandData(fp, data, num_gridpts, *threshold))
+   {
+     printf("\nCorrupt narrow band snapshot");
+     free(data);
+     return NULL;
+   }
+
+   return data;
 }
 
 
 LSMLIB_REAL *readDataArray(int *grid_dims_ghostbox,char *file_name)
 {
-   FILE    *fp;
-   int     zip_status;
+   LSM_FILE *fp;
    int     num_gridpts;
    LSMLIB_REAL    *data = NULL;
-   char    *file_base;
    
-   checkUnzipFile(file_name,&zip_status,&file_base);
-   
-   fp = fopen(file_base,"r");
+   fp = openLSMFileForReading(file_name);
 
    if( fp != NULL)
    {
      /* read grid dimensions */
-     fread(grid_dims_ghostbox, sizeof(int), 3, fp); 
+     readLSMFile(grid_dims_ghostbox, sizeof(int), 3, fp); 
+
+     /* reconstruct the data for narrow band snapshots */
+     if (memcmp(grid_dims_ghostbox,LSM_NARROW_BAND_MAGIC,
+                LSM_ALIGNED_MAGIC_SIZE) == 0)
+     {
+       LSMLIB_REAL threshold;
+       data = readNarrowBandSnapshot(fp,grid_dims_ghostbox[2],
+                                     grid_dims_ghostbox,&threshold);
+       closeLSMFile(fp);
+       return data;
+     }
+
+     /* skip the rest of the header for files in the aligned format */
+     if (memcmp(grid_dims_ghostbox,LSM_ALIGNED_MAGIC,
+                LSM_ALIGNED_MAGIC_SIZE) == 0)
+     {
+       char header[LSM_ALIGNED_HEADER_SIZE];
+       int  real_size;
+       memcpy(header,grid_dims_ghostbox,3*ISZ);
+       readLSMFile(header+3*ISZ, 1, LSM_ALIGNED_HEADER_SIZE-3*ISZ, fp);
+       memcpy(&real_size,header+LSM_ALIGNED_MAGIC_SIZE,ISZ);
+       if (real_size != DSZ)
+       {
+         printf("\nData array in file %s has incompatible precision",
+                file_name);
+         closeLSMFile(fp);
+         return NULL;
+       }
+       memcpy(grid_dims_ghostbox,header+LSM_ALIGNED_MAGIC_SIZE+ISZ,3*ISZ);
+     }
   
      /* allocate memory for data array */ 
      num_gridpts = grid_dims_ghostbox[0] * grid_dims_ghostbox[1]
@@ -421,70 +671,356 @@ LSMLIB_REAL *readDataArray(int *grid_dims_ghostbox,char *file_name)
      data = (LSMLIB_REAL *) malloc(num_gridpts*DSZ);
 
      /* read data array */ 
-     fread(data, DSZ, num_gridpts, fp);
+     readLSMFile(data, DSZ, num_gridpts, fp);
 
-     fclose(fp);
-     
-     zipFile(file_base,zip_status);
+     closeLSMFile(fp);
    }
    else
    {
       printf("\nCould not open file %s",file_name);
    }
-   free(file_base);
    return data;
 }
 
 
+void writeDataArrayAligned(LSMLIB_REAL *data, Grid *grid, char *file_name)
+{
+   FILE *fp;
+   char  header[LSM_ALIGNED_HEADER_SIZE];
+   int   real_size = DSZ;
+   LSMLIB_REAL *unpadded_data;
+   
+   fp = fopen(file_name,"w");   
+   if (!fp)
+   {
+      printf("\nCould not open file %s",file_name);
+      return;
+   }
+
+   /* header: identifier, sizeof(LSMLIB_REAL), grid dimensions, padding */
+   memset(header,0,LSM_ALIGNED_HEADER_SIZE);
+   memcpy(header,LSM_ALIGNED_MAGIC,LSM_ALIGNED_MAGIC_SIZE);
+   memcpy(header+LSM_ALIGNED_MAGIC_SIZE,&real_size,ISZ);
+   memcpy(header+LSM_ALIGNED_MAGIC_SIZE+ISZ,grid->grid_dims_ghostbox,3*ISZ);
+   fwrite(header, 1, LSM_ALIGNED_HEADER_SIZE, fp);
+
+   /* write data array */
+   unpadded_data = getUnpaddedDataArray(data, grid);
+   fwrite(unpadded_data, DSZ, grid->num_gridpts, fp);
+   if (unpadded_data != data) free(unpadded_data);
+
+   fclose(fp);
+}
+
+
+LSM_MappedDataArray *mapDataArray(char *file_name, int write_back)
+{
+   LSM_MappedDataArray *mapped_array;
+   struct stat file_stat;
+   char   *header;
+   int     fd, real_size;
+   size_t  data_size;
+
+   fd = open(file_name, write_back ? O_RDWR : O_RDONLY);
+   if (fd < 0)
+   {
+      printf("\nCould not open file %s",file_name);
+      return NULL;
+   }
+   if ( (fstat(fd,&file_stat) != 0) || 
+        (file_stat.st_size < LSM_ALIGNED_HEADER_SIZE) )
+   {
+      printf("\nFile %s is not an aligned data array file",file_name);
+      close(fd);
+      return NULL;
+   }
+
+   mapped_array = (LSM_MappedDataArray *)calloc(1,sizeof(LSM_MappedDataArray));
+   mapped_array->map_size = file_stat.st_size;
+   mapped_array->map_addr = mmap(NULL, mapped_array->map_size, 
+                                 PROT_READ | PROT_WRITE,
+                                 write_back ? MAP_SHARED : MAP_PRIVATE,
+                                 fd, 0);
+   close(fd);  /* the mapping remains valid after the file is closed */
+   if (mapped_array->map_addr == MAP_FAILED)
+   {
+      printf("\nCould not map file %s",file_name);
+      free(mapped_array);
+      return NULL;
+   }
+
+   /* check header */
+   header = (char *)mapped_array->map_addr;
+   memcpy(&real_size,header+LSM_ALIGNED_MAGIC_SIZE,ISZ);
+   memcpy(mapped_array->grid_dims_ghostbox,
+          header+LSM_ALIGNED_MAGIC_SIZE+ISZ,3*ISZ);
+   mapped_array->num_gridpts = mapped_array->grid_dims_ghostbox[0]
+                             * mapped_array->grid_dims_ghostbox[1]
+                             * mapped_array->grid_dims_ghostbox[2];
+   data_size = ((size_t) mapped_array->num_gridpts)*DSZ;
+   if ( (memcmp(header,LSM_ALIGNED_MAGIC,LSM_ALIGNED_MAGIC_SIZE) != 0) ||
+        (real_size != DSZ) ||
+        (mapped_array->map_size < LSM_ALIGNED_HEADER_SIZE + data_size) )
+   {
+      printf("\nFile %s is not an aligned data array file",file_name);
+      unmapDataArray(mapped_array);
+      return NULL;
+   }
+
+   mapped_array->data = (LSMLIB_REAL *)(header + LSM_ALIGNED_HEADER_SIZE);
+   return mapped_array;
+}
+
+
+void unmapDataArray(LSM_MappedDataArray *mapped_array)
+{
+   if (!mapped_array) return;
+   munmap(mapped_array->map_addr,mapped_array->map_size);
+   free(mapped_array);
+}
+
+
+void writeDataArrayNarrowBand(
+     LSMLIB_REAL *data,
+     Grid *grid,
+     LSMLIB_REAL threshold,
+     char *file_name,
+     int zip_status)
+{
+   LSM_FILE *fp;
+   int   real_size = DSZ;
+   LSMLIB_REAL *unpadded_data;
+
+   fp = openLSMFileForWriting(file_name,zip_status);
+   if (!fp)
+   {
+      printf("\nCould not open file %s",file_name);
+      return;
+   }
+
+   /* write header */
+   writeLSMFile(LSM_NARROW_BAND_MAGIC, 1, LSM_ALIGNED_MAGIC_SIZE, fp);
+   writeLSMFile(&real_size, sizeof(int), 1, fp);
+   writeLSMFile(grid->grid_dims_ghostbox, sizeof(int), 3, fp);
+   writeLSMFile(&threshold, DSZ, 1, fp);
+
+   /* write narrow band data */
+   unpadded_data = getUnpaddedDataArray(data, grid);
+   writeNarrowBandData(fp, unpadded_data, grid->num_gridpts, threshold);
+   if (unpadded_data != data) free(unpadded_data);
+
+   closeLSMFile(fp);
+}
+
+
+LSMLIB_REAL *readDataArrayNarrowBand(
+     int *grid_dims_ghostbox,
+     LSMLIB_REAL *threshold,
+     char *file_name)
+{
+   LSM_FILE *fp;
+   char  magic[LSM_ALIGNED_MAGIC_SIZE];
+   int   real_size;
+   LSMLIB_REAL    *data = NULL;
+
+   fp = openLSMFileForReading(file_name);
+   if (!fp)
+   {
+      printf("\nCould not open file %s",file_name);
+      return NULL;
+   }
+
+   readLSMFile(magic, 1, LSM_ALIGNED_MAGIC_SIZE, fp);
+   readLSMFile(&real_size, sizeof(int), 1, fp);
+   if (memcmp(magic,LSM_NARROW_BAND_MAGIC,LSM_ALIGNED_MAGIC_SIZE) == 0)
+   {
+     data = readNarrowBandSnapshot(fp,real_size,grid_dims_ghostbox,
+                                   threshold);
+   }
+   else
+   {
+     printf("\nFile %s is not a narrow band snapshot",file_name);
+   }
+
+   closeLSMFile(fp);
+   return data;
+}
+
+
+/*
+ * narrowBandRunType() classifies a value of the level set function as
+ * below (-1), inside (0), or above (1) the narrow band.
+ */
+static signed char narrowBandRunType(LSMLIB_REAL phi, LSMLIB_REAL threshold)
+{
+   if (phi <= -threshold) return -1;
+   if (phi >= threshold) return 1;
+   return 0;
+}
+
+
+int writeNarrowBandData(
+     LSM_FILE *fp,
+     LSMLIB_REAL *data,
+     int num_gridpts,
+     LSMLIB_REAL threshold)
+{
+   int   num_runs = 0;
+   int  *run_length;
+   signed char *run_type;
+   int   i, run, start;
+   int   status = 0;
+
+   /* count runs */
+   for (i = 0; i < num_gridpts; i++)
+   {
+     if ( (i == 0) || (narrowBandRunType(data[i],threshold) 
+                       != narrowBandRunType(data[i-1],threshold)) )
+       num_runs++;
+   }
+
+   /* record runs */
+   run_length = (int *) malloc((num_runs+1)*ISZ);
+   run_type = (signed char *) malloc((num_runs+1)*sizeof(signed char));
+   run = -1;
+   for (i = 0; i < num_gridpts; i++)
+   {
+     signed char type = narrowBandRunType(data[i],threshold);
+     if ( (run < 0) || (type != run_type[run]) )
+     {
+       run++;
+       run_type[run] = type;
+       run_length[run] = 0;
+     }
+     run_length[run]++;
+   }
+
+   if ( (writeLSMFile(&num_runs, ISZ, 1, fp) != 1) ||
+        (writeLSMFile(run_length, ISZ, num_runs, fp) != (size_t) num_runs) ||
+        (writeLSMFile(run_type, sizeof(signed char), num_runs, fp) 
+         != (size_t) num_runs) )
+     status = 1;
+
+   /* write values in the narrow band (contiguous within each run) */
+   start = 0;
+   for (run = 0; (run < num_runs) && (status == 0); run++)
+   {
+     if ( (run_type[run] == 0) &&
+          (writeLSMFile(data+start, DSZ, run_length[run], fp)
+           != (size_t) run_length[run]) )
+       status = 1;
+     start += run_length[run];
+   }
+
+   free(run_length);
+   free(run_type);
+
+   return status;
+}
+
+
+int readNarrowBandData(
+     LSM_FILE *fp,
+     LSMLIB_REAL *data,
+     int num_gridpts,
+     LSMLIB_REAL threshold)
+{
+   int   num_runs;
+   int  *run_length;
+   signed char *run_type;
+   int   i, run, start;
+   int   status = 0;
+
+   if ( (readLSMFile(&num_runs, ISZ, 1, fp) != 1) ||
+        (num_runs < 0) || (num_runs > num_gridpts) )
+     return 1;
+
+   run_length = (int *) malloc((num_runs+1)*ISZ);
+   run_type = (signed char *) malloc((num_runs+1)*sizeof(signed char));
+   if ( (readLSMFile(run_length, ISZ, num_runs, fp) != (size_t) num_runs) ||
+        (readLSMFile(run_type, sizeof(signed char), num_runs, fp) 
+         != (size_t) num_runs) )
+     status = 1;
+
+   /* reconstruct level set function, clamping values outside of */
+   /* the narrow band to +/- threshold                           */
+   start = 0;
+   for (run = 0; (run < num_runs) && (status == 0); run++)
+   {
+     if ( (run_length[run] < 0) || 
+          (start + run_length[run] > num_gridpts) )
+     {
+       status = 1;
+     }
+     else if (run_type[run] == 0)
+     {
+       if (readLSMFile(data+start, DSZ, run_length[run], fp)
+           != (size_t) run_length[run])
+         status = 1;
+     }
+     else
+     {
+       LSMLIB_REAL value = run_type[run]*threshold;
+       for (i = start; i < start+run_length[run]; i++) data[i] = value;
+     }
+     start += run_length[run];
+   }
+   if (start != num_gridpts) status = 1;
+
+   free(run_length);
+   free(run_type);
+
+   return status;
+}
+
+
 void writeDataArray1d(LSMLIB_REAL *data, int num_elements, char *file_name,
                       int zip_status)
 {
-   FILE *fp;
+   LSM_FILE *fp;
    
-   fp = fopen(file_name,"w");
+   fp = openLSMFileForWriting(file_name,zip_status);
+   if (!fp)
+   {
+      printf("\nCould not open file %s",file_name);
+      return;
+   }
 
    /* write number of elements */
-   fwrite(&num_elements, sizeof(int), 1, fp); 
+   writeLSMFile(&num_elements, sizeof(int), 1, fp); 
 
    /* write data array */
-   fwrite(data, DSZ, num_elements, fp);
+   writeLSMFile(data, DSZ, num_elements, fp);
 
-   fclose(fp);
-   zipFile(file_name,zip_status);
+   closeLSMFile(fp);
 }
 
 
 LSMLIB_REAL *readDataArray1d(int *num_elements, char *file_name)
 {
-   FILE    *fp;
-   LSMLIB_REAL  *data;
-   char    *file_base;
-   int     zip_status;
-   
-   checkUnzipFile(file_name,&zip_status,&file_base);
+   LSM_FILE *fp;
+   LSMLIB_REAL  *data = NULL;
    
-   fp = fopen(file_base,"r");
+   fp = openLSMFileForReading(file_name);
 
    if(fp)
    {
      /* read number of elements */
-     fread(num_elements, sizeof(int), 1, fp); 
+     readLSMFile(num_elements, sizeof(int), 1, fp); 
    
      /* allocate memory for data*/
      data = (LSMLIB_REAL *)malloc((*num_elements)*DSZ);
 
      /* read data array */
-     fread(data ,DSZ, *num_elements, fp);
+     readLSMFile(data ,DSZ, *num_elements, fp);
 
-     fclose(fp);
-     zipFile(file_base,zip_status);
+     closeLSMFile(fp);
    }
    else
    {
       printf("\nCould not open file %s",file_name);
    }
    
-   free(file_base);
    return data;
 }
 
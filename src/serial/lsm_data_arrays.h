@@ -93,9 +93,72 @@ typedef struct _LSM_DataArrays
   
   LSMLIB_REAL *solid_normal_x, *solid_normal_y, *solid_normal_z;
 
+  /* memory region from which data arrays are allocated */
+  void   *arena;
+  size_t  arena_size;
+
 }  LSM_DataArrays;
 
 
+/*!
+ * Alignment (in bytes) of the data arrays allocated by 
+ * allocateMemoryForLSMDataArrays().
+ */
+#define LSM_DATA_ARRAYS_ALIGNMENT  LSM_GRID_ALIGNMENT
+
+/*!
+ * Velocity types for the 'velocity_type' element of 
+ * LSM_DataArraysFeatures (may be combined using bitwise OR).
+ */
+#define LSM_NORMAL_VELOCITY    1
+#define LSM_EXTERNAL_VELOCITY  2
+
+/*!
+ * Structure 'LSM_DataArraysFeatures' describes the features of a level 
+ * set method calculation that determine which of the data arrays in 
+ * LSM_DataArrays are required.  Nonzero integer elements indicate that
+ * a feature is used.
+ */
+typedef struct _LSM_DataArraysFeatures
+{
+  /* accuracy of spatial derivatives and time integration */
+  /* (LSMLIB_SPATIAL_DERIVATIVE_ACCURACY_TYPE)             */
+  int  accuracy;
+
+  /* upwind (plus and minus) first-order derivatives */
+  int  upwind_derivatives;
+
+  /* second-order derivatives (e.g. for curvature terms) */
+  int  second_derivatives;
+
+  /* velocity type (LSM_NORMAL_VELOCITY, LSM_EXTERNAL_VELOCITY, or both) */
+  int  velocity_type;
+
+  /* localization (i.e. narrow band) calculations */
+  int  localization;
+
+  /* reinitialization (storage of the initial level set function) */
+  int  reinitialization;
+
+  /* storage of the right-hand side of the level set equation (not  */
+  /* required when the level set equation is advanced using the     */
+  /* fused TVD Runge-Kutta stage kernels, e.g.                      */
+  /* LSM3D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV(), unless             */
+  /* reinitialization is used)                                      */
+  int  rhs_storage;
+
+  /* restricted domains defined by a mask level set function */
+  int  mask;
+
+  /* solid narrow band and normals */
+  int  solid;
+
+  /* application specific storage (phi_extra) */
+  int  extra_storage;
+
+} LSM_DataArraysFeatures;
+
+
 /*!
  * allocateLSMDataArrays() allocates a LSM_DataArrays data structure 
  * and initializes all of its data pointers to a non-NULL dummy pointer.
@@ -110,6 +173,44 @@ LSM_DataArrays *allocateLSMDataArrays(void);
 
 
 
+/*!
+ * initializeLSMDataArraysFeatures() sets all features to be used (i.e.
+ * all data arrays are required) with VERY_HIGH accuracy and both 
+ * velocity types.
+ *  
+ * Arguments:
+ *  - features(out):  pointer to LSM_DataArraysFeatures
+ *
+ * Return value:      none
+ *
+ */
+void initializeLSMDataArraysFeatures(LSM_DataArraysFeatures *features);
+
+
+/*!
+ * setLSMDataArraysFeatures() marks the data arrays that are not required
+ * for the specified features so that allocateMemoryForLSMDataArrays() 
+ * does not allocate them (i.e. sets their pointers to NULL).
+ *  
+ * Arguments:
+ *  - lsm_data_arrays(in/out):  pointer to LSM_DataArrays structure
+ *  - features(in):             pointer to LSM_DataArraysFeatures
+ *
+ * Return value:                none
+ *
+ * NOTES: 
+ * - setLSMDataArraysFeatures() must be called before 
+ *   allocateMemoryForLSMDataArrays().
+ *
+ * - Data arrays that have already been allocated (or set by the user)
+ *   are not modified.
+ *
+ */
+void setLSMDataArraysFeatures(
+  LSM_DataArrays *lsm_data_arrays,
+  LSM_DataArraysFeatures *features);
+
+
 /*!
  * allocateMemoryForLSMDataArrays() allocates memory for the data 
  * arrays contained within the LSM_DataArrays structure.
@@ -130,6 +231,16 @@ LSM_DataArrays *allocateLSMDataArrays(void);
  *   If memory has already been allocated for a particular data array or
  *  the data pointer is set to NULL, it will not be reallocated.
  *
+ * - The data arrays are allocated from a single zero-initialized memory
+ *   region.  Each data array is aligned to LSM_DATA_ARRAYS_ALIGNMENT 
+ *   bytes, and the space between arrays is padded so that arrays do not
+ *   start at addresses separated by multiples of the page size.  Memory
+ *   is committed by the operating system only when a data array is first 
+ *   used, so data arrays that are never used do not consume memory.
+ *
+ * - Each data array holds grid->num_gridpts_alloc values (see
+ *   setGridAllocationPadding()).
+ *
  */
 void allocateMemoryForLSMDataArrays(
   LSM_DataArrays *lsm_data_arrays,
@@ -162,6 +273,49 @@ void freeMemoryForLSMDataArrays(LSM_DataArrays *lsm_arrays);
  */
 void destroyLSMDataArrays(LSM_DataArrays *lsm_data_arrays);
 
+
+/*!
+ * removeDataArrayPadding() copies a data array laid out with the 
+ * allocation extents of the grid (grid->grid_dims_alloc) into an array
+ * laid out with the ghostbox extents (grid->grid_dims_ghostbox).
+ *
+ * Arguments:
+ *  - unpadded_data (out):  data array of size grid->num_gridpts
+ *  - data (in):            data array of size grid->num_gridpts_alloc
+ *  - grid (in):            pointer to Grid
+ *
+ * Return value:            none
+ *
+ */
+void removeDataArrayPadding(
+  LSMLIB_REAL *unpadded_data,
+  LSMLIB_REAL *data,
+  Grid *grid);
+
+/*!
+ * addDataArrayPadding() copies a data array laid out with the ghostbox
+ * extents (grid->grid_dims_ghostbox) into an array laid out with the
+ * allocation extents of the grid (grid->grid_dims_alloc).
+ *
+ * Arguments:
+ *  - data (out):          data array of size grid->num_gridpts_alloc
+ *  - unpadded_data (in):  data array of size grid->num_gridpts
+ *  - grid (in):           pointer to Grid
+ *
+ * Return value:           none
+ *
+ * NOTES:
+ * - data and unpadded_data may be the same array (if it holds
+ *   grid->num_gridpts_alloc values).
+ *
+ * - Values in the padding are not set.
+ *
+ */
+void addDataArrayPadding(
+  LSMLIB_REAL *data,
+  LSMLIB_REAL *unpadded_data,
+  Grid *grid);
+
 /*!
  * writeDataArray() writes the specified data array out to a binary file.
  *
@@ -186,6 +340,9 @@ void destroyLSMDataArrays(LSM_DataArrays *lsm_data_arrays);
  * - If a file with the specified file_name already exists, it is
  *   overwritten.
  *
+ * - The padding of data arrays (see setGridAllocationPadding()) is 
+ *   not written to the file.
+ *
  */   
 void writeDataArray(LSMLIB_REAL *data, Grid *grid, char *file_name,
                     int zip_status);
@@ -240,10 +397,216 @@ void writeDataArrayNoGrid(LSMLIB_REAL *data, int *n, char *file_name,
  *
  * - Function recognizes if the file name contains .gz or .bz2 extention
  *   and uncompresses the file accordingly.
+ *
+ * - Files written by writeDataArrayAligned() and
+ *   writeDataArrayNarrowBand() are also recognized.
+ *
+ * - The data array that is returned is not padded.  Use 
+ *   addDataArrayPadding() to copy it into a padded data array.
  */   
 LSMLIB_REAL *readDataArray(int *grid_dims, char *file_name);
 
 
+/*!
+ * Size (in bytes) of the header of data array files written by
+ * writeDataArrayAligned().  The header size is a multiple of the
+ * cache line size so that the data in a memory-mapped file is 
+ * suitably aligned for use in place.
+ */
+#define LSM_ALIGNED_HEADER_SIZE  64
+
+/*!
+ * Structure 'LSM_MappedDataArray' describes a data array file that 
+ * has been memory-mapped by mapDataArray().
+ */
+typedef struct _LSM_MappedDataArray
+{
+  /* pointer to data array (inside of the mapped file) */
+  LSMLIB_REAL *data;
+
+  /* dimensions of data array */
+  int grid_dims_ghostbox[3];
+  int num_gridpts;
+
+  /* mapped region */
+  void   *map_addr;
+  size_t  map_size;
+
+} LSM_MappedDataArray;
+
+
+/*!
+ * writeDataArrayAligned() writes the specified data array out to a 
+ * binary file that can be memory-mapped by mapDataArray().
+ *
+ * The data is output in the following order:
+ * -# header of LSM_ALIGNED_HEADER_SIZE bytes containing a file 
+ *    identifier, sizeof(LSMLIB_REAL), and the grid dimensions
+ * -# values of data array at all grid points.
+ *
+ * Arguments:
+ *  - data (in):       data array to be output to file
+ *  - grid (in):       Grid structure containing grid dimensions
+ *  - file_name (in):  name of output file
+ *   
+ * Return value:       none
+ *   
+ * NOTES: 
+ * - Files written by writeDataArrayAligned() are never compressed 
+ *   (compressed files cannot be memory-mapped).  They can also be
+ *   read using readDataArray().
+ *
+ * - If a file with the specified file_name already exists, it is
+ *   overwritten.
+ *
+ */   
+void writeDataArrayAligned(LSMLIB_REAL *data, Grid *grid, char *file_name);
+
+
+/*!
+ * mapDataArray() memory-maps a data array file written by 
+ * writeDataArrayAligned() so that the data can be used in place
+ * without allocating memory for it or reading it into memory up front.
+ *   
+ * Arguments:
+ *  - file_name (in):   name of input file 
+ *  - write_back (in):  if nonzero, changes to the data are written
+ *                      back to the file; otherwise, the data is
+ *                      mapped copy-on-write (the file is not modified)
+ *   
+ * Return value:        pointer to LSM_MappedDataArray; NULL if the file
+ *                      could not be mapped
+ *   
+ * NOTES: 
+ * - The data array is valid until unmapDataArray() is called.
+ *
+ * - Files written by writeDataArray() and compressed files are not
+ *   supported; use readDataArray() for those files.
+ *
+ */   
+LSM_MappedDataArray *mapDataArray(char *file_name, int write_back);
+
+
+/*!
+ * unmapDataArray() unmaps a data array file mapped by mapDataArray()
+ * and frees the LSM_MappedDataArray structure.
+ *   
+ * Arguments:
+ *  - mapped_array (in):  pointer to LSM_MappedDataArray
+ *   
+ * Return value:          none
+ *   
+ */   
+void unmapDataArray(LSM_MappedDataArray *mapped_array);
+
+
+/*!
+ * writeDataArrayNarrowBand() writes a narrow band snapshot of the
+ * specified level set function out to a binary file.  Only the values
+ * at grid points where |phi| < threshold are stored.
+ *
+ * The data is output in the following order:
+ * -# file identifier, sizeof(LSMLIB_REAL), and grid dimensions
+ * -# threshold
+ * -# narrow band data (see writeNarrowBandData())
+ *
+ * Arguments:
+ *  - data (in):       level set function to be output to file
+ *  - grid (in):       pointer to Grid
+ *  - threshold (in):  narrow band threshold
+ *  - file_name (in):  name of output file
+ *  - zip_status(in):  integer indicating compression of the file
+ *                     (NO_ZIP,GZIP,BZIP2)
+ *
+ * Return value:       none
+ *
+ * NOTES:
+ * - Files written by writeDataArrayNarrowBand() can be read using
+ *   readDataArray() or readDataArrayNarrowBand().  Values outside of
+ *   the narrow band are reconstructed as +/- threshold.
+ *
+ * - If a file with the specified file_name already exists, it is
+ *   overwritten.
+ *
+ */
+void writeDataArrayNarrowBand(LSMLIB_REAL *data, Grid *grid,
+                              LSMLIB_REAL threshold, char *file_name,
+                              int zip_status);
+
+
+/*!
+ * readDataArrayNarrowBand() loads a narrow band snapshot written by
+ * writeDataArrayNarrowBand() and returns the reconstructed level set
+ * function.
+ *
+ * Arguments:
+ *  - grid_dims (out):  dimensions of grid (read from file)
+ *  - threshold (out):  narrow band threshold (read from file)
+ *  - file_name (in):   name of input file
+ *
+ * Return value:        pointer to data array loaded from file; NULL
+ *                      if the file is not a narrow band snapshot
+ *
+ * NOTES:
+ * - readDataArrayNarrowBand() dynamically allocates memory for the data
+ *   array that is returned.
+ *
+ * - The memory for grid_dims and threshold is assumed to be allocated
+ *   by the user.
+ *
+ */
+LSMLIB_REAL *readDataArrayNarrowBand(int *grid_dims, LSMLIB_REAL *threshold,
+                                     char *file_name);
+
+
+/*!
+ * writeNarrowBandData() writes the narrow band data of a level set
+ * function to an open file.  It is used by writeDataArrayNarrowBand()
+ * and by the parallel package to write the data for each patch.
+ *
+ * The grid points are run-length encoded in memory order.  Each run
+ * is a sequence of grid points with phi <= -threshold (type -1),
+ * |phi| < threshold (type 0), or phi >= threshold (type 1).  The data
+ * is output in the following order:
+ * -# number of runs
+ * -# length of each run
+ * -# type of each run (signed char)
+ * -# values of phi at grid points in runs of type 0.
+ *
+ * Arguments:
+ *  - fp (in):           pointer to LSM_FILE opened for writing
+ *  - data (in):         level set function
+ *  - num_gridpts (in):  number of grid points
+ *  - threshold (in):    narrow band threshold
+ *
+ * Return value:         0 on success; 1 otherwise
+ *
+ */
+int writeNarrowBandData(LSM_FILE *fp, LSMLIB_REAL *data, int num_gridpts,
+                        LSMLIB_REAL threshold);
+
+
+/*!
+ * readNarrowBandData() reads narrow band data written by
+ * writeNarrowBandData() and reconstructs the level set function.
+ * Values outside of the narrow band are set to +/- threshold.
+ *
+ * Arguments:
+ *  - fp (in):           pointer to LSM_FILE opened for reading
+ *  - data (out):        level set function
+ *  - num_gridpts (in):  number of grid points
+ *  - threshold (in):    narrow band threshold
+ *
+ * Return value:         0 on success; 1 otherwise
+ *
+ * NOTES:
+ * - The memory for data is assumed to be allocated by the user.
+ *
+ */
+int readNarrowBandData(LSM_FILE *fp, LSMLIB_REAL *data, int num_gridpts,
+                       LSMLIB_REAL threshold);
+
+
 /*!
  * writeDataArray1d() writes the specified data array out to a binary file.
  *
@@ -13,6 +13,8 @@
 
 #include "LSMLIB_config.h"
 #include "FMM_Core.h"
+#include "lsm_grid.h"
+#include "lsm_data_array_view.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,7 +42,9 @@ extern "C" {
  *
  * - Error Codes:  0 - successful computation,
  *                 1 - FMM_Data creation error,
- *                 2 - invalid spatial discretization order
+ *                 2 - invalid spatial discretization order,
+ *                 3 - data array views with different ghostboxes
+ *                     (functions taking LSM_DataArrayView only)
  *
  * - While @ref lsm_fast_marching_method.h only provides functions 
  *   for 2D and 3D FMM calculations, LSMLIB is capable of supporting higher 
@@ -456,6 +460,58 @@ int solveEikonalEquation3d(
   int *grid_dims,
   LSMLIB_REAL *dx);
 
+/*!
+ * computeExtensionFieldsView(), computeDistanceFunctionView(), and
+ * solveEikonalEquationView() perform the same calculations as
+ * computeExtensionFields{2d,3d}(), computeDistanceFunction{2d,3d}(),
+ * and solveEikonalEquation{2d,3d}() on data arrays described by 
+ * LSM_DataArrayViews.
+ *
+ * Arguments:
+ *  - same as for the 2d/3d functions except that data arrays are
+ *    replaced by views (extension_fields and source_fields are arrays
+ *    of num_extension_fields views) and the index space extents and 
+ *    grid cell sizes are taken from the ghostbox of the view of phi
+ *    and from grid, respectively
+ *
+ * Return value:  error code (see NOTES for translation)
+ *
+ * NOTES:
+ *  - The calculation is carried out over the ghostbox of the view of
+ *    phi.  All views must have the same ghostbox.
+ *
+ *  - Views of contiguous data arrays (see dataArrayViewIsContiguous())
+ *    are used in place.  Other views are copied into contiguous 
+ *    temporary arrays.
+ *
+ *  - If mask is set to a NULL pointer, then all grid points are treated
+ *    as being in the interior of the domain.
+ *
+ */
+int computeExtensionFieldsView(
+  LSM_DataArrayView *distance_function,
+  LSM_DataArrayView *extension_fields,
+  LSM_DataArrayView *phi,
+  LSM_DataArrayView *mask,
+  LSM_DataArrayView *source_fields,
+  int num_extension_fields,
+  int spatial_discretization_order,
+  Grid *grid);
+
+int computeDistanceFunctionView(
+  LSM_DataArrayView *distance_function,
+  LSM_DataArrayView *phi,
+  LSM_DataArrayView *mask,
+  int spatial_discretization_order,
+  Grid *grid);
+
+int solveEikonalEquationView(
+  LSM_DataArrayView *phi,
+  LSM_DataArrayView *speed,
+  LSM_DataArrayView *mask,
+  int spatial_discretization_order,
+  Grid *grid);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,6 +14,17 @@
 
 #include "lsm_file.h"
 
+#ifdef LSMLIB_HAVE_ZLIB
+#include <zlib.h>
+
+/* favor speed over compression ratio when writing data files */
+#define LSM_GZIP_WRITE_MODE      "wb1"
+
+/* size of zlib stream buffers and of the largest single read/write */
+#define LSM_GZIP_BUFFER_SIZE     (256*1024)
+#define LSM_GZIP_MAX_CHUNK_SIZE  (1<<30)
+#endif
+
 
 void checkUnzipFile(char *file_name,int *pzip_status, char **pfile_base)
 {
@@ -32,7 +43,7 @@ void checkUnzipFile(char *file_name,int *pzip_status, char **pfile_base)
        //printf("\n%s",command);
        
        length_base = (strlen(file_name)-3);       
-       file_base = strncpy(file_base,file_name,length_base);
+       memcpy(file_base,file_name,length_base);
        file_base[length_base] = '\0';
        //printf("\n%s",file_base); fflush(stdout); fflush(stderr);
      }
@@ -42,7 +53,7 @@ void checkUnzipFile(char *file_name,int *pzip_status, char **pfile_base)
        sprintf(command,"bunzip2 -f %s",file_name);
        system(command);
        length_base =strlen(file_name)-4;
-       file_base = strncpy(file_base,file_name,length_base);
+       memcpy(file_base,file_name,length_base);
        file_base[length_base] = '\0';
      }
      else 
@@ -67,3 +78,156 @@ void  zipFile(char *file_base,int zip_status)
         system(command);
      }
 }
+
+
+LSM_FILE *openLSMFileForWriting(char *file_name, int zip_status)
+{
+  LSM_FILE *lsm_fp = (LSM_FILE *)calloc(1,sizeof(LSM_FILE));
+  
+  lsm_fp->zip_status = zip_status;
+
+#ifdef LSMLIB_HAVE_ZLIB
+  if (zip_status == GZIP)
+  {
+    char *gz_file_name = (char *)malloc((strlen(file_name)+4)*sizeof(char));
+    sprintf(gz_file_name,"%s.gz",file_name);
+    lsm_fp->gz = (void *)gzopen(gz_file_name,LSM_GZIP_WRITE_MODE);
+    free(gz_file_name);
+
+    if (!lsm_fp->gz) 
+    {
+      free(lsm_fp);
+      return NULL;
+    }
+#if ZLIB_VERNUM >= 0x1240
+    gzbuffer((gzFile)lsm_fp->gz,LSM_GZIP_BUFFER_SIZE);
+#endif
+    return lsm_fp;
+  }
+#endif
+
+  /* write uncompressed file (compressed by closeLSMFile() if required) */
+  lsm_fp->fp = fopen(file_name,"w");
+  if (!lsm_fp->fp) 
+  {
+    free(lsm_fp);
+    return NULL;
+  }
+  lsm_fp->file_base = (char *)malloc((strlen(file_name)+1)*sizeof(char));
+  strcpy(lsm_fp->file_base,file_name);
+
+  return lsm_fp;
+}
+
+
+LSM_FILE *openLSMFileForReading(char *file_name)
+{
+  LSM_FILE *lsm_fp = (LSM_FILE *)calloc(1,sizeof(LSM_FILE));
+
+#ifdef LSMLIB_HAVE_ZLIB
+  if (strstr(file_name,".gz") != (char *)NULL)
+  {
+    /* decompress while reading instead of running gunzip on the file */
+    lsm_fp->gz = (void *)gzopen(file_name,"rb");
+    if (!lsm_fp->gz) 
+    {
+      free(lsm_fp);
+      return NULL;
+    }
+#if ZLIB_VERNUM >= 0x1240
+    gzbuffer((gzFile)lsm_fp->gz,LSM_GZIP_BUFFER_SIZE);
+#endif
+    lsm_fp->zip_status = NO_ZIP;
+    return lsm_fp;
+  }
+#endif
+
+  /* uncompress file with external program (recompressed on close) */
+  checkUnzipFile(file_name,&(lsm_fp->zip_status),&(lsm_fp->file_base));
+  lsm_fp->fp = fopen(lsm_fp->file_base,"r");
+  if (!lsm_fp->fp) 
+  {
+    zipFile(lsm_fp->file_base,lsm_fp->zip_status);
+    free(lsm_fp->file_base);
+    free(lsm_fp);
+    return NULL;
+  }
+
+  return lsm_fp;
+}
+
+
+size_t writeLSMFile(const void *ptr, size_t size, size_t nmemb, 
+                    LSM_FILE *lsm_fp)
+{
+#ifdef LSMLIB_HAVE_ZLIB
+  if (lsm_fp->gz)
+  {
+    /* gzwrite() takes an unsigned int length, so large arrays */
+    /* are written in chunks                                     */
+    const char *buf = (const char *)ptr;
+    size_t num_bytes = size*nmemb;
+    size_t num_written = 0;
+    while (num_written < num_bytes)
+    {
+      size_t chunk_size = num_bytes - num_written;
+      int    count;
+      if (chunk_size > LSM_GZIP_MAX_CHUNK_SIZE) 
+        chunk_size = LSM_GZIP_MAX_CHUNK_SIZE;
+      count = gzwrite((gzFile)lsm_fp->gz,buf+num_written,
+                      (unsigned int)chunk_size);
+      if (count <= 0) break;
+      num_written += count;
+    }
+    return (size > 0) ? num_written/size : 0;
+  }
+#endif
+
+  return fwrite(ptr,size,nmemb,lsm_fp->fp);
+}
+
+
+size_t readLSMFile(void *ptr, size_t size, size_t nmemb, LSM_FILE *lsm_fp)
+{
+#ifdef LSMLIB_HAVE_ZLIB
+  if (lsm_fp->gz)
+  {
+    char  *buf = (char *)ptr;
+    size_t num_bytes = size*nmemb;
+    size_t num_read = 0;
+    while (num_read < num_bytes)
+    {
+      size_t chunk_size = num_bytes - num_read;
+      int    count;
+      if (chunk_size > LSM_GZIP_MAX_CHUNK_SIZE) 
+        chunk_size = LSM_GZIP_MAX_CHUNK_SIZE;
+      count = gzread((gzFile)lsm_fp->gz,buf+num_read,
+                     (unsigned int)chunk_size);
+      if (count <= 0) break;
+      num_read += count;
+    }
+    return (size > 0) ? num_read/size : 0;
+  }
+#endif
+
+  return fread(ptr,size,nmemb,lsm_fp->fp);
+}
+
+
+void closeLSMFile(LSM_FILE *lsm_fp)
+{
+  if (!lsm_fp) return;
+
+#ifdef LSMLIB_HAVE_ZLIB
+  if (lsm_fp->gz) gzclose((gzFile)lsm_fp->gz);
+#endif
+
+  if (lsm_fp->fp) 
+  {
+    fclose(lsm_fp->fp);
+    zipFile(lsm_fp->file_base,lsm_fp->zip_status);
+  }
+
+  free(lsm_fp->file_base);
+  free(lsm_fp);
+}
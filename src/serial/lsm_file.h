@@ -11,6 +11,7 @@
 #ifndef included_lsm_file_h
 #define included_lsm_file_h
 
+#include <stdio.h>
 #include "LSMLIB_config.h"
 
 #define NO_ZIP 0
@@ -22,6 +23,31 @@ extern "C" {
 #endif
 
 
+/*!
+ * The 'LSM_FILE' structure is a handle for a data file that is
+ * compressed or decompressed while it is being written or read.
+ *
+ * When LSMLIB is configured with zlib (LSMLIB_HAVE_ZLIB), gzip-compressed
+ * files are streamed through zlib in-process.  Otherwise (and for bzip2 
+ * compressed files), the uncompressed file is written or read directly 
+ * and the external gzip/bzip2 programs are invoked by closeLSMFile() or 
+ * openLSMFileForReading() as in checkUnzipFile() and zipFile().
+ */
+typedef struct _LSM_FILE {
+
+  /* uncompressed file (NULL when streaming through zlib) */
+  FILE  *fp;
+
+  /* zlib stream (gzFile) */
+  void  *gz;
+
+  /* name of uncompressed file and compression to apply on close */
+  char  *file_base;
+  int    zip_status;
+
+} LSM_FILE;
+
+
 /*! 
  * checkUnzipFile() checks if file has .gz or .bz2 extention and 
  *   uncompresses the file.
@@ -58,6 +84,84 @@ void checkUnzipFile(char *file_name,int *pzip_status,char **pfile_base);
  */        
 void   zipFile(char *file_base,int zip_status);
 
+/*! 
+ * openLSMFileForWriting() opens a data file for writing.
+ *
+ *   Arguments:
+ *    - file_name(in):     name of the uncompressed file
+ *    - zip_status(in):    integer compression status of the file 
+ *                         (NO_ZIP,GZIP,BZIP2)
+ *
+ *  Return value:          pointer to LSM_FILE; NULL if the file could
+ *                         not be opened
+ *
+ *  Notes: 
+ *     - As with zipFile(), a compressed file is named by appending 
+ *       ".gz" or ".bz2" to file_name.
+ *
+ */        
+LSM_FILE *openLSMFileForWriting(char *file_name, int zip_status);
+
+/*! 
+ * openLSMFileForReading() opens a data file for reading.  Files with
+ *   a .gz or .bz2 extension are decompressed.
+ *
+ *   Arguments:
+ *    - file_name(in):     name of the file
+ *
+ *  Return value:          pointer to LSM_FILE; NULL if the file could
+ *                         not be opened
+ *
+ *  Notes: 
+ *     - gzip-compressed files written by earlier versions of LSMLIB 
+ *       (using the external gzip program) are read without change.
+ *
+ */        
+LSM_FILE *openLSMFileForReading(char *file_name);
+
+/*! 
+ * writeLSMFile() writes data to a file opened by openLSMFileForWriting().
+ *   The arguments and return value are the same as for fwrite().
+ *
+ *   Arguments:
+ *    - ptr(in):           data to write
+ *    - size(in):          size of each element (in bytes)
+ *    - nmemb(in):         number of elements to write
+ *    - lsm_fp(in):        pointer to LSM_FILE
+ *
+ *  Return value:          number of elements written
+ *
+ */        
+size_t writeLSMFile(const void *ptr, size_t size, size_t nmemb, 
+                    LSM_FILE *lsm_fp);
+
+/*! 
+ * readLSMFile() reads data from a file opened by openLSMFileForReading().
+ *   The arguments and return value are the same as for fread().
+ *
+ *   Arguments:
+ *    - ptr(out):          buffer to read data into
+ *    - size(in):          size of each element (in bytes)
+ *    - nmemb(in):         number of elements to read
+ *    - lsm_fp(in):        pointer to LSM_FILE
+ *
+ *  Return value:          number of elements read
+ *
+ */        
+size_t readLSMFile(void *ptr, size_t size, size_t nmemb, LSM_FILE *lsm_fp);
+
+/*! 
+ * closeLSMFile() closes the file, applies external compression if 
+ *   required, and frees the LSM_FILE structure.
+ *
+ *   Arguments:
+ *    - lsm_fp(in):        pointer to LSM_FILE
+ *
+ *  Return value:          none
+ *
+ */        
+void closeLSMFile(LSM_FILE *lsm_fp);
+
 #ifdef __cplusplus
 }
 #endif
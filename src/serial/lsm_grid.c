@@ -45,6 +45,9 @@ Grid *allocateGrid(void)
 
 static int lsmlib_num_ghostcells[] = {2,3,5,4};
 
+/* page size used to detect strides that cause cache-set conflicts */
+#define LSM_GRID_PAGE_SIZE  4096
+
 
 
 Grid *createGridSetDx(
@@ -109,6 +112,7 @@ Grid *createGridSetDx(
  
   
   setIndexSpaceLimits(accuracy,g);
+  setGridAllocationPadding(g,0);
   
   return g;
 }
@@ -181,6 +185,7 @@ Grid *createGridSetDxDyDz(
  
   
   setIndexSpaceLimits(accuracy,g);
+  setGridAllocationPadding(g,0);
   
   return g;
 }
@@ -244,6 +249,7 @@ Grid *createGridSetGridDims(
   }
   
   setIndexSpaceLimits(accuracy,g);
+  setGridAllocationPadding(g,0);
   
   return g;
 }
@@ -309,6 +315,16 @@ Grid *copyGrid(Grid *grid)
    new_grid->beta = grid->beta;
    new_grid->gamma = grid->gamma;
    
+   for(i = 0; i < 3; i++)
+   {
+       new_grid->grid_dims_alloc[i] = grid->grid_dims_alloc[i];
+   }
+   new_grid->num_gridpts_alloc = grid->num_gridpts_alloc;
+   new_grid->ihi_alloc = grid->ihi_alloc;
+   new_grid->jhi_alloc = grid->jhi_alloc;
+   new_grid->khi_alloc = grid->khi_alloc;
+   new_grid->alloc_alignment = grid->alloc_alignment;
+   
    return new_grid;
 }
 
@@ -594,6 +610,8 @@ Grid *readGridFromAsciiFile(char *file_name)
   fclose(fp);
   zipFile(file_base,zip_status);
   free(file_base); 
+  
+  setGridAllocationPadding(grid,0);
  
   return grid;
 }
@@ -612,151 +630,151 @@ void writeGridToAsciiFile(Grid *grid, char *file_name, int zip_status)
 
 void writeGridToBinaryFile(Grid *grid, char *file_name, int zip_status)
 {
-  FILE *fp;
+  LSM_FILE *fp;
     
-  fp = fopen(file_name,"w");
-
-  fwrite(&(grid->num_dims), sizeof(int), 1, fp);
-  fwrite(grid->x_lo, sizeof(LSMLIB_REAL), 3, fp);
-  fwrite(grid->x_hi, sizeof(LSMLIB_REAL), 3, fp);
-  fwrite(grid->x_lo_ghostbox, sizeof(LSMLIB_REAL), 3, fp);
-  fwrite(grid->x_hi_ghostbox, sizeof(LSMLIB_REAL), 3, fp);
-  fwrite(grid->grid_dims, sizeof(int), 3, fp); 
-  fwrite(grid->grid_dims_ghostbox, sizeof(int), 3, fp); 
-  fwrite(grid->dx, sizeof(LSMLIB_REAL), 3, fp);
-  fwrite(&(grid->num_gridpts), sizeof(int), 1, fp);
-
-  fwrite(&(grid->ilo_gb), sizeof(int), 1, fp);
-  fwrite(&(grid->ihi_gb), sizeof(int), 1, fp);
-  fwrite(&(grid->jlo_gb), sizeof(int), 1, fp);
-  fwrite(&(grid->jhi_gb), sizeof(int), 1, fp);  
-  fwrite(&(grid->klo_gb), sizeof(int), 1, fp);
-  fwrite(&(grid->khi_gb), sizeof(int), 1, fp);
+  fp = openLSMFileForWriting(file_name,zip_status);
+  if (!fp)
+  {
+    printf("\nCould not open file %s",file_name);
+    return;
+  }
+
+  writeLSMFile(&(grid->num_dims), sizeof(int), 1, fp);
+  writeLSMFile(grid->x_lo, sizeof(LSMLIB_REAL), 3, fp);
+  writeLSMFile(grid->x_hi, sizeof(LSMLIB_REAL), 3, fp);
+  writeLSMFile(grid->x_lo_ghostbox, sizeof(LSMLIB_REAL), 3, fp);
+  writeLSMFile(grid->x_hi_ghostbox, sizeof(LSMLIB_REAL), 3, fp);
+  writeLSMFile(grid->grid_dims, sizeof(int), 3, fp); 
+  writeLSMFile(grid->grid_dims_ghostbox, sizeof(int), 3, fp); 
+  writeLSMFile(grid->dx, sizeof(LSMLIB_REAL), 3, fp);
+  writeLSMFile(&(grid->num_gridpts), sizeof(int), 1, fp);
+
+  writeLSMFile(&(grid->ilo_gb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->ihi_gb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->jlo_gb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->jhi_gb), sizeof(int), 1, fp);  
+  writeLSMFile(&(grid->klo_gb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->khi_gb), sizeof(int), 1, fp);
  
-  fwrite(&(grid->ilo_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->ihi_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->jlo_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->jhi_fb), sizeof(int), 1, fp);  
-  fwrite(&(grid->klo_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->khi_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->ilo_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->ihi_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->jlo_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->jhi_fb), sizeof(int), 1, fp);  
+  writeLSMFile(&(grid->klo_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->khi_fb), sizeof(int), 1, fp);
   
-  fwrite(&(grid->ilo_D1_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->ihi_D1_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->jlo_D1_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->jhi_D1_fb), sizeof(int), 1, fp);  
-  fwrite(&(grid->klo_D1_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->khi_D1_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->ilo_D1_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->ihi_D1_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->jlo_D1_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->jhi_D1_fb), sizeof(int), 1, fp);  
+  writeLSMFile(&(grid->klo_D1_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->khi_D1_fb), sizeof(int), 1, fp);
   
-  fwrite(&(grid->ilo_D2_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->ihi_D2_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->jlo_D2_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->jhi_D2_fb), sizeof(int), 1, fp);  
-  fwrite(&(grid->klo_D2_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->khi_D2_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->ilo_D2_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->ihi_D2_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->jlo_D2_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->jhi_D2_fb), sizeof(int), 1, fp);  
+  writeLSMFile(&(grid->klo_D2_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->khi_D2_fb), sizeof(int), 1, fp);
   
-  fwrite(&(grid->ilo_D3_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->ihi_D3_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->jlo_D3_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->jhi_D3_fb), sizeof(int), 1, fp);  
-  fwrite(&(grid->klo_D3_fb), sizeof(int), 1, fp);
-  fwrite(&(grid->khi_D3_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->ilo_D3_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->ihi_D3_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->jlo_D3_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->jhi_D3_fb), sizeof(int), 1, fp);  
+  writeLSMFile(&(grid->klo_D3_fb), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->khi_D3_fb), sizeof(int), 1, fp);
   
-  fwrite(&(grid->num_nb_levels), sizeof(int), 1, fp);
-  fwrite(&(grid->mark_gb), sizeof(unsigned char), 1, fp);
-  fwrite(&(grid->mark_D1), sizeof(unsigned char), 1, fp);
-  fwrite(&(grid->mark_D2), sizeof(unsigned char), 1, fp);
-  fwrite(&(grid->mark_D3), sizeof(unsigned char), 1, fp);
-  fwrite(&(grid->mark_fb), sizeof(unsigned char), 1, fp);
+  writeLSMFile(&(grid->num_nb_levels), sizeof(int), 1, fp);
+  writeLSMFile(&(grid->mark_gb), sizeof(unsigned char), 1, fp);
+  writeLSMFile(&(grid->mark_D1), sizeof(unsigned char), 1, fp);
+  writeLSMFile(&(grid->mark_D2), sizeof(unsigned char), 1, fp);
+  writeLSMFile(&(grid->mark_D3), sizeof(unsigned char), 1, fp);
+  writeLSMFile(&(grid->mark_fb), sizeof(unsigned char), 1, fp);
   
-  fwrite(&(grid->beta),   sizeof(LSMLIB_REAL), 1, fp);
-  fwrite(&(grid->gamma),  sizeof(LSMLIB_REAL), 1, fp);
+  writeLSMFile(&(grid->beta),   sizeof(LSMLIB_REAL), 1, fp);
+  writeLSMFile(&(grid->gamma),  sizeof(LSMLIB_REAL), 1, fp);
   
-  fclose(fp);
-  zipFile(file_name,zip_status);
+  closeLSMFile(fp);
 }
 
 
 Grid *readGridFromBinaryFile(char *file_name)
 {
-  FILE *fp;
+  LSM_FILE *fp;
   Grid *grid;
-  char   *file_base;
-  int    zip_status;
-   
-  checkUnzipFile(file_name,&zip_status,&file_base);
   
  /* open file and allocate Grid */
-  fp = fopen(file_base,"r");
+  fp = openLSMFileForReading(file_name);
   grid = allocateGrid();
  
   if( fp != NULL)
   {
-    fread(&(grid->num_dims), sizeof(int), 1, fp);
+    readLSMFile(&(grid->num_dims), sizeof(int), 1, fp);
     
-    fread(grid->x_lo, sizeof(LSMLIB_REAL), 3, fp);
-    fread(grid->x_hi, sizeof(LSMLIB_REAL), 3, fp);
-    fread(grid->x_lo_ghostbox, sizeof(LSMLIB_REAL), 3, fp);
-    fread(grid->x_hi_ghostbox, sizeof(LSMLIB_REAL), 3, fp);
+    readLSMFile(grid->x_lo, sizeof(LSMLIB_REAL), 3, fp);
+    readLSMFile(grid->x_hi, sizeof(LSMLIB_REAL), 3, fp);
+    readLSMFile(grid->x_lo_ghostbox, sizeof(LSMLIB_REAL), 3, fp);
+    readLSMFile(grid->x_hi_ghostbox, sizeof(LSMLIB_REAL), 3, fp);
     
-    fread(grid->grid_dims, sizeof(int), 3, fp); 
-    fread(grid->grid_dims_ghostbox, sizeof(int), 3, fp);
+    readLSMFile(grid->grid_dims, sizeof(int), 3, fp); 
+    readLSMFile(grid->grid_dims_ghostbox, sizeof(int), 3, fp);
      
-    fread(grid->dx, sizeof(LSMLIB_REAL), 3, fp);
+    readLSMFile(grid->dx, sizeof(LSMLIB_REAL), 3, fp);
+    
+    readLSMFile(&(grid->num_gridpts), sizeof(int), 1, fp);
+
+    readLSMFile(&(grid->ilo_gb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->ihi_gb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->jlo_gb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->jhi_gb), sizeof(int), 1, fp);  
+    readLSMFile(&(grid->klo_gb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->khi_gb), sizeof(int), 1, fp);
+
+    readLSMFile(&(grid->ilo_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->ihi_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->jlo_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->jhi_fb), sizeof(int), 1, fp);  
+    readLSMFile(&(grid->klo_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->khi_fb), sizeof(int), 1, fp);
+
+    readLSMFile(&(grid->ilo_D1_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->ihi_D1_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->jlo_D1_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->jhi_D1_fb), sizeof(int), 1, fp);  
+    readLSMFile(&(grid->klo_D1_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->khi_D1_fb), sizeof(int), 1, fp);
+
+    readLSMFile(&(grid->ilo_D2_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->ihi_D2_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->jlo_D2_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->jhi_D2_fb), sizeof(int), 1, fp);  
+    readLSMFile(&(grid->klo_D2_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->khi_D2_fb), sizeof(int), 1, fp);
+
+    readLSMFile(&(grid->ilo_D3_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->ihi_D3_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->jlo_D3_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->jhi_D3_fb), sizeof(int), 1, fp);  
+    readLSMFile(&(grid->klo_D3_fb), sizeof(int), 1, fp);
+    readLSMFile(&(grid->khi_D3_fb), sizeof(int), 1, fp);
+
+    readLSMFile(&(grid->num_nb_levels), sizeof(int), 1, fp);
+    readLSMFile(&(grid->mark_gb), sizeof(unsigned char), 1, fp);
+    readLSMFile(&(grid->mark_D1), sizeof(unsigned char), 1, fp);
+    readLSMFile(&(grid->mark_D2), sizeof(unsigned char), 1, fp);
+    readLSMFile(&(grid->mark_D3), sizeof(unsigned char), 1, fp);
+    readLSMFile(&(grid->mark_fb), sizeof(unsigned char), 1, fp);
+
+    readLSMFile(&(grid->beta),   sizeof(LSMLIB_REAL), 1, fp);
+    readLSMFile(&(grid->gamma),  sizeof(LSMLIB_REAL), 1, fp);
+
+    closeLSMFile(fp);
     
-    fread(&(grid->num_gridpts), sizeof(int), 1, fp);
-
-    fread(&(grid->ilo_gb), sizeof(int), 1, fp);
-    fread(&(grid->ihi_gb), sizeof(int), 1, fp);
-    fread(&(grid->jlo_gb), sizeof(int), 1, fp);
-    fread(&(grid->jhi_gb), sizeof(int), 1, fp);  
-    fread(&(grid->klo_gb), sizeof(int), 1, fp);
-    fread(&(grid->khi_gb), sizeof(int), 1, fp);
-
-    fread(&(grid->ilo_fb), sizeof(int), 1, fp);
-    fread(&(grid->ihi_fb), sizeof(int), 1, fp);
-    fread(&(grid->jlo_fb), sizeof(int), 1, fp);
-    fread(&(grid->jhi_fb), sizeof(int), 1, fp);  
-    fread(&(grid->klo_fb), sizeof(int), 1, fp);
-    fread(&(grid->khi_fb), sizeof(int), 1, fp);
-
-    fread(&(grid->ilo_D1_fb), sizeof(int), 1, fp);
-    fread(&(grid->ihi_D1_fb), sizeof(int), 1, fp);
-    fread(&(grid->jlo_D1_fb), sizeof(int), 1, fp);
-    fread(&(grid->jhi_D1_fb), sizeof(int), 1, fp);  
-    fread(&(grid->klo_D1_fb), sizeof(int), 1, fp);
-    fread(&(grid->khi_D1_fb), sizeof(int), 1, fp);
-
-    fread(&(grid->ilo_D2_fb), sizeof(int), 1, fp);
-    fread(&(grid->ihi_D2_fb), sizeof(int), 1, fp);
-    fread(&(grid->jlo_D2_fb), sizeof(int), 1, fp);
-    fread(&(grid->jhi_D2_fb), sizeof(int), 1, fp);  
-    fread(&(grid->klo_D2_fb), sizeof(int), 1, fp);
-    fread(&(grid->khi_D2_fb), sizeof(int), 1, fp);
-
-    fread(&(grid->ilo_D3_fb), sizeof(int), 1, fp);
-    fread(&(grid->ihi_D3_fb), sizeof(int), 1, fp);
-    fread(&(grid->jlo_D3_fb), sizeof(int), 1, fp);
-    fread(&(grid->jhi_D3_fb), sizeof(int), 1, fp);  
-    fread(&(grid->klo_D3_fb), sizeof(int), 1, fp);
-    fread(&(grid->khi_D3_fb), sizeof(int), 1, fp);
-
-    fread(&(grid->num_nb_levels), sizeof(int), 1, fp);
-    fread(&(grid->mark_gb), sizeof(unsigned char), 1, fp);
-    fread(&(grid->mark_D1), sizeof(unsigned char), 1, fp);
-    fread(&(grid->mark_D2), sizeof(unsigned char), 1, fp);
-    fread(&(grid->mark_D3), sizeof(unsigned char), 1, fp);
-    fread(&(grid->mark_fb), sizeof(unsigned char), 1, fp);
-
-    fread(&(grid->beta),   sizeof(LSMLIB_REAL), 1, fp);
-    fread(&(grid->gamma),  sizeof(LSMLIB_REAL), 1, fp);
-
-    fclose(fp);
-    zipFile(file_base,zip_status);
-    free(file_base);
+    setGridAllocationPadding(grid,0);
   }
   else
   {
-      printf("\nCould not open file %s",file_base);
+      printf("\nCould not open file %s",file_name);
   }
   return grid;
 }
@@ -1031,5 +1049,54 @@ void setIndexSpaceLimits(LSMLIB_SPATIAL_DERIVATIVE_ACCURACY_TYPE accuracy,
        setIndexSpaceLimitsENO2(grid);
      }
   }
+
+  /* keep allocation extents consistent with the ghostbox */
+  setGridAllocationPadding(grid, grid->alloc_alignment);
 }
 
+
+void setGridAllocationPadding(Grid *grid, int alignment)
+{
+  int i;
+  int row_size, plane_size, pad;
+  
+  for (i = 0; i < 3; i++) {
+    (grid->grid_dims_alloc)[i] = (grid->grid_dims_ghostbox)[i];
+  }
+  
+  /* number of grid points in one alignment unit */
+  pad = (alignment > 0) ? alignment/sizeof(LSMLIB_REAL) : 0;
+  grid->alloc_alignment = (pad > 0) ? alignment : 0;
+  
+  if (pad > 0) {
+    
+    /* start each row at a multiple of the alignment */
+    (grid->grid_dims_alloc)[0] = 
+      ( ((grid->grid_dims_ghostbox)[0] + pad - 1)/pad )*pad;
+    
+    /* avoid distances between rows/planes that are multiples of the */
+    /* page size                                                      */
+    row_size = (grid->grid_dims_alloc)[0]*sizeof(LSMLIB_REAL);
+    if (row_size % LSM_GRID_PAGE_SIZE == 0) {
+      (grid->grid_dims_alloc)[0] += pad;
+    }
+    
+    if (grid->num_dims == 3) {
+      plane_size = 
+        (grid->grid_dims_alloc)[0]*(grid->grid_dims_alloc)[1]
+        *sizeof(LSMLIB_REAL);
+      if (plane_size % LSM_GRID_PAGE_SIZE == 0) {
+        (grid->grid_dims_alloc)[1] += 1;
+      }
+    }
+  }
+  
+  grid->num_gridpts_alloc = 1;
+  for (i = 0; i < grid->num_dims; i++) {
+    (grid->num_gridpts_alloc) *= (grid->grid_dims_alloc)[i];
+  }
+  
+  grid->ihi_alloc = grid->ilo_gb + (grid->grid_dims_alloc)[0] - 1;
+  grid->jhi_alloc = grid->jlo_gb + (grid->grid_dims_alloc)[1] - 1;
+  grid->khi_alloc = grid->klo_gb + (grid->grid_dims_alloc)[2] - 1;
+}
@@ -39,6 +39,12 @@ extern "C" {
  * - The same data structure can be used for both 2D and 3D 
  *   calculations.
  *
+ * - Data arrays are laid out with the allocation extents
+ *   (grid_dims_alloc) which may be larger than the ghostbox (see
+ *   setGridAllocationPadding()).  Toolbox kernels should be passed
+ *   (ilo_gb, ihi_alloc, jlo_gb, jhi_alloc, klo_gb, khi_alloc) as the
+ *   ghostbox index space of data arrays.
+ *
  */
 typedef struct _Grid {
 
@@ -91,6 +97,19 @@ typedef struct _Grid {
   /* inner and outer narrow band widths (local method) */
   LSMLIB_REAL beta, gamma;
   
+  /* number of grid points in each coordinate direction allocated for */
+  /* data arrays (grid_dims_ghostbox padded so that rows are aligned) */
+  int      grid_dims_alloc[3];
+  
+  /* total number of gridpoints allocated for each data array */
+  int      num_gridpts_alloc;
+  
+  /* upper limits of index space allocated for data arrays (the lower */
+  /* limits are ilo_gb, jlo_gb, klo_gb)                               */
+  int ihi_alloc, jhi_alloc, khi_alloc;
+
+  /* alignment (in bytes) used to pad data arrays (0 if not padded) */
+  int      alloc_alignment;
   
 } Grid;
  
@@ -107,6 +126,13 @@ typedef enum { LOW = 0, MEDIUM = 1, HIGH = 2, VERY_HIGH = 3 }
   LSMLIB_SPATIAL_DERIVATIVE_ACCURACY_TYPE;
 
 
+/*!
+ * Default alignment (in bytes) of rows of data arrays used by
+ * setGridAllocationPadding() (cache line size and widest SIMD width).
+ */
+#define LSM_GRID_ALIGNMENT  64
+
+
 /*! @{ 
  ****************************************************************
  *
@@ -347,9 +373,51 @@ Grid *readGridFromBinaryFile(char *file_name);
  * 
  * NOTES:
  * - Grid elements other than index space limits assumed pre-set
+ *
+ * - The allocation extents (grid_dims_alloc, num_gridpts_alloc, 
+ *   ihi_alloc, etc.) are recomputed using the alignment from the last
+ *   call to setGridAllocationPadding() (no padding if it has not been
+ *   called).
 */
 void setIndexSpaceLimits(LSMLIB_SPATIAL_DERIVATIVE_ACCURACY_TYPE accuracy, 
    Grid *grid);
+
+
+/*!
+ * setGridAllocationPadding() pads the allocation extents of data arrays 
+ * so that each row (i.e. each line of grid points in the x-direction) 
+ * starts at a multiple of the specified alignment.
+ *
+ * Arguments:
+ *  - grid (in/out):    Grid data structure containing grid configuration
+ *  - alignment (in):   alignment of rows in bytes (LSM_GRID_ALIGNMENT is
+ *                      recommended); rows are not padded if 
+ *                      alignment <= 0
+ *
+ * Return value:        none
+ *
+ * NOTES:
+ * - In 3D, the allocation extent in the y-direction is also padded
+ *   when the distance between consecutive xy-planes would be a 
+ *   multiple of the page size (4096 bytes).  Similarly, rows are padded
+ *   when the distance between them would be a multiple of the page
+ *   size.  This avoids cache-set conflicts for power-of-two grid sizes.
+ *
+ * - The logical ghostbox (grid_dims_ghostbox, ihi_gb, etc.) and
+ *   num_gridpts are not changed.  Only grid_dims_alloc, 
+ *   num_gridpts_alloc, ihi_alloc, jhi_alloc, khi_alloc, and 
+ *   alloc_alignment are set.
+ *
+ * - setGridAllocationPadding() must be called before any data arrays
+ *   are allocated for the grid.  The rows of data arrays are only 
+ *   aligned if the data arrays themselves are aligned (e.g. when 
+ *   allocated using allocateMemoryForLSMDataArrays()).
+ *
+ * - Values in the padding are not used by toolbox kernels.  Data array
+ *   files are always written without the padding.
+ *
+ */
+void setGridAllocationPadding(Grid *grid, int alignment);
    
 
 /*! @} */
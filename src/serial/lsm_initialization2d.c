@@ -45,7 +45,7 @@ void createIntersectionOfHalfSpaces2d(
   {
     for (i = 0; i < grid->grid_dims_ghostbox[0]; i++) 
     {
-      idx = i+j*grid->grid_dims_ghostbox[0];
+      idx = i+j*grid->grid_dims_alloc[0];
       x = (grid->x_lo_ghostbox)[0] + (grid->dx)[0]*i;
       y = (grid->x_lo_ghostbox)[1] + (grid->dx)[1]*j;
 
@@ -92,7 +92,7 @@ void createIntersectionOfPolyhedra2d(
   int i, l, num_sides, start, end;
      
   LSMLIB_REAL  *phi1 
-    = (LSMLIB_REAL *)malloc(grid->num_gridpts*sizeof(LSMLIB_REAL)); 
+    = (LSMLIB_REAL *)malloc(grid->num_gridpts_alloc*sizeof(LSMLIB_REAL)); 
         
   for(l = 0; l < num_polyhedra; l++) 
   {
@@ -155,7 +155,7 @@ void createIntersectionOfCircles(
   {
     for (i = 0; i < (grid->grid_dims_ghostbox)[0]; i++) 
     {
-      idx = i+j*(grid->grid_dims_ghostbox)[0];
+      idx = i+j*(grid->grid_dims_alloc)[0];
       x = (grid->x_lo_ghostbox)[0] + (grid->dx)[0]*i;
       y = (grid->x_lo_ghostbox)[1] + (grid->dx)[1]*j;
     
@@ -207,7 +207,7 @@ void createIntersectionOfRectangles(
   int i, l, num_planes;
      
   LSMLIB_REAL  *phi1 = 
-    (LSMLIB_REAL *)malloc(grid->num_gridpts*sizeof(LSMLIB_REAL)); 
+    (LSMLIB_REAL *)malloc(grid->num_gridpts_alloc*sizeof(LSMLIB_REAL)); 
         
   for(l = 0; l < num_rectangles; l++) {
     /* Each rectangle is the intersection of 4 half spaces */
@@ -44,14 +44,14 @@ void createIntersectionOfHalfSpaces3d(
   LSMLIB_REAL max;
   LSMLIB_REAL signed_dist_to_plane;
   
-  nxy = grid->grid_dims_ghostbox[0]*grid->grid_dims_ghostbox[1];
+  nxy = grid->grid_dims_alloc[0]*grid->grid_dims_alloc[1];
   for (k = 0; k < grid->grid_dims_ghostbox[2]; k++)
   {
     for (j = 0; j < grid->grid_dims_ghostbox[1]; j++)
     {
       for (i = 0; i < grid->grid_dims_ghostbox[0]; i++) 
       {
-        idx = i+j*grid->grid_dims_ghostbox[0] + k*nxy;
+        idx = i+j*grid->grid_dims_alloc[0] + k*nxy;
         x = (grid->x_lo_ghostbox)[0] + (grid->dx)[0]*i;
         y = (grid->x_lo_ghostbox)[1] + (grid->dx)[1]*j;
         z = (grid->x_lo_ghostbox)[2] + (grid->dx)[2]*k;
@@ -128,8 +128,8 @@ void createIntersectionOfSpheres(
   LSMLIB_REAL max;
   LSMLIB_REAL signed_dist_to_sphere;
   
-  nx = (grid->grid_dims_ghostbox)[0];
-  nxy = (grid->grid_dims_ghostbox)[0]*(grid->grid_dims_ghostbox)[1];
+  nx = (grid->grid_dims_alloc)[0];
+  nxy = (grid->grid_dims_alloc)[0]*(grid->grid_dims_alloc)[1];
   
   for (k = 0; k < (grid->grid_dims_ghostbox)[2]; k++)
   {
@@ -202,8 +202,8 @@ void createIntersectionOfCylinders(
 {
   int     i, j, k, l, nx, nxy;  
   
-  nx = (grid->grid_dims_ghostbox)[0];
-  nxy = (grid->grid_dims_ghostbox)[0]*(grid->grid_dims_ghostbox)[1];
+  nx = (grid->grid_dims_alloc)[0];
+  nxy = (grid->grid_dims_alloc)[0]*(grid->grid_dims_alloc)[1];
   
   for (k = 0; k < (grid->grid_dims_ghostbox)[2]; k++)
   {
@@ -288,8 +288,8 @@ void createIntersectionOfHyperboloids(
 {
   int     i, j, k, l, nx, nxy;
   
-  nx = (grid->grid_dims_ghostbox)[0];
-  nxy = (grid->grid_dims_ghostbox)[0]*(grid->grid_dims_ghostbox)[1];
+  nx = (grid->grid_dims_alloc)[0];
+  nxy = (grid->grid_dims_alloc)[0]*(grid->grid_dims_alloc)[1];
   
   for (k = 0; k < (grid->grid_dims_ghostbox)[2]; k++)
   {
@@ -379,8 +379,8 @@ void createIntersectionOfCones(
 {
   int     i, j, k, l, nx, nxy;
   
-  nx = (grid->grid_dims_ghostbox)[0];
-  nxy = (grid->grid_dims_ghostbox)[0]*(grid->grid_dims_ghostbox)[1];
+  nx = (grid->grid_dims_alloc)[0];
+  nxy = (grid->grid_dims_alloc)[0]*(grid->grid_dims_alloc)[1];
   
   for (k = 0; k < (grid->grid_dims_ghostbox)[2]; k++)
   {
@@ -465,7 +465,7 @@ void createIntersectionOfBoxes(
   int     i, l, num_planes;
      
   LSMLIB_REAL  *phi1 = 
-    (LSMLIB_REAL *)malloc(grid->num_gridpts*sizeof(LSMLIB_REAL)); 
+    (LSMLIB_REAL *)malloc(grid->num_gridpts_alloc*sizeof(LSMLIB_REAL)); 
         
   for(l = 0; l < num_cuboids; l++)
   {
@@ -35,7 +35,7 @@ extern "C" {
  * SET_DATA_TO_CONSTANT() sets entire data array to a constant value. 
  *
  * Arguments:
- *  - data (out):  data array of size (grid->num_gridpts) 
+ *  - data (out):  data array of size (grid->num_gridpts_alloc)
  *  - grid (in):   pointer to Grid 
  *  - value (in):  constant value to set data to
  *
@@ -43,7 +43,7 @@ extern "C" {
 #define SET_DATA_TO_CONSTANT(data, grid, value)                            \
 {                                                                          \
   int idx;                                                                 \
-  for (idx = 0; idx < grid->num_gridpts; idx++)                            \
+  for (idx = 0; idx < grid->num_gridpts_alloc; idx++)                      \
   {                                                                        \
     data[idx] = value;                                                     \
   }                                                                        \
@@ -54,14 +54,14 @@ extern "C" {
  * NEGATE_DATA() sets each data value to its negative.
  *
  * Arguments:
- *  - data (in/out):  data array of size (grid->num_gridpts) 
+ *  - data (in/out):  data array of size (grid->num_gridpts_alloc)
  *  - grid (in):      pointer to Grid 
  *
  */
 #define NEGATE_DATA(data, grid)                                            \
 {                                                                          \
   int idx;                                                                 \
-  for (idx = 0; idx < grid->num_gridpts; idx++)                            \
+  for (idx = 0; idx < grid->num_gridpts_alloc; idx++)                      \
   {                                                                        \
      data[idx] = -data[idx];                                               \
   }                                                                        \
@@ -84,7 +84,7 @@ extern "C" {
 #define IMPOSE_MASK(phi_masked, mask, phi, grid)                           \
 {                                                                          \
   int idx;                                                                 \
-  for(idx = 0; idx < grid->num_gridpts; idx++)                             \
+  for(idx = 0; idx < grid->num_gridpts_alloc; idx++)                       \
   {                                                                        \
     phi_masked[idx] = (mask[idx] > phi[idx]) ? mask[idx] : phi[idx];       \
   }                                                                        \
@@ -137,7 +137,7 @@ extern "C" {
 #define IMPOSE_MIN(phi_min, phi1, phi2, grid)                            \
 {                                                                        \
   int idx;                                                               \
-  for(idx = 0; idx < grid->num_gridpts; idx++)                           \
+  for(idx = 0; idx < grid->num_gridpts_alloc; idx++)                     \
   {                                                                      \
     phi_min[idx] = (phi1[idx] < phi2[idx]) ? phi1[idx] : phi2[idx];      \
   }                                                                      \
@@ -155,7 +155,7 @@ extern "C" {
 #define COPY_DATA(data_dst, data_src, grid)                                \
 {                                                                          \
   int idx;                                                                 \
-  for(idx = 0; idx < grid->num_gridpts; idx++)                             \
+  for(idx = 0; idx < grid->num_gridpts_alloc; idx++)                       \
   {                                                                        \
     data_dst[idx] = data_src[idx];                                         \
   }                                                                        \
@@ -178,7 +178,7 @@ extern "C" {
   int idx;                                                                 \
   LSMLIB_REAL min_err, max_err, err1, err2, err;                           \
   min_err = FLT_MAX; max_err = 0.0;                                        \
-  for(idx = 0; idx < grid->num_gridpts; idx++)                             \
+  for(idx = 0; idx < grid->num_gridpts_alloc; idx++)                       \
   {                                                                        \
     err = data1[idx] - data2[idx];                                         \
       if(err < min_err) min_err = err;                                     \
@@ -204,7 +204,7 @@ extern "C" {
   int idx;                                                                 \
   LSMLIB_REAL min_err, max_err, err1, err2, err;                           \
   min_err = FLT_MAX; max_err = 0.0;                                        \
-  for(idx = 0; idx < grid->num_gridpts; idx++)                             \
+  for(idx = 0; idx < grid->num_gridpts_alloc; idx++)                       \
   {                                                                        \
     err = data[idx];                                                       \
     if(err < min_err) min_err = err;                                       \
@@ -230,7 +230,7 @@ extern "C" {
   int idx;                                                                 \
   LSMLIB_REAL min = FLT_MAX, max = -FLT_MAX;                               \
   LSMLIB_REAL abs_min = FLT_MAX, abs_val;                                  \
-  for(idx=0; idx < g->num_gridpts; idx++)                                  \
+  for(idx=0; idx < g->num_gridpts_alloc; idx++)                            \
   {                                                                        \
     if (isnan(data[idx])) printf("\nNaN at position %d",idx);              \
     if (isinf(data[idx])) printf("\ninf at position %d",idx);              \
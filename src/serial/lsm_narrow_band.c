@@ -0,0 +1,113 @@
+/*
+ * File:        lsm_narrow_band.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Implementation file for narrow band rebuild management for
+ *              localized serial LSMLIB calculations
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "lsm_narrow_band.h"
+
+
+NarrowBandManager *createNarrowBandManager(
+  LSMLIB_REAL beta,
+  LSMLIB_REAL gamma)
+{
+  NarrowBandManager *nbm =
+    (NarrowBandManager *)calloc(1,sizeof(NarrowBandManager));
+
+  nbm->beta = beta;
+  nbm->gamma = gamma;
+
+  /* the interface sits at the center of the narrow band right after */
+  /* a rebuild, so it can move by beta before it may leave the inner  */
+  /* band where |phi| < beta                                          */
+  nbm->max_displacement = beta;
+  nbm->displacement = 0.0;
+
+  nbm->rebuild_needed = 1;
+
+  return nbm;
+}
+
+
+void destroyNarrowBandManager(NarrowBandManager *nb_manager)
+{
+  if (nb_manager) free(nb_manager);
+}
+
+
+int narrowBandRebuildNeeded(NarrowBandManager *nb_manager)
+{
+  return nb_manager->rebuild_needed;
+}
+
+
+void recordNarrowBandRebuild(NarrowBandManager *nb_manager)
+{
+  nb_manager->num_rebuilds++;
+  nb_manager->num_steps_since_rebuild = 0;
+  nb_manager->displacement = 0.0;
+  nb_manager->rebuild_needed = 0;
+}
+
+
+void requestNarrowBandRebuild(NarrowBandManager *nb_manager)
+{
+  if (!nb_manager->rebuild_needed) {
+    nb_manager->num_requested_rebuilds++;
+    nb_manager->rebuild_needed = 1;
+  }
+}
+
+
+int updateNarrowBandManager(
+  NarrowBandManager *nb_manager,
+  LSMLIB_REAL displacement,
+  int change_sign)
+{
+  nb_manager->num_steps++;
+  nb_manager->num_steps_since_rebuild++;
+  nb_manager->displacement += fabs(displacement);
+
+  if (nb_manager->rebuild_needed) return 1;
+
+  if (change_sign) {
+    nb_manager->num_sign_change_rebuilds++;
+    nb_manager->rebuild_needed = 1;
+  } else if (nb_manager->displacement >= nb_manager->max_displacement) {
+    nb_manager->num_displacement_rebuilds++;
+    nb_manager->rebuild_needed = 1;
+  }
+
+  return nb_manager->rebuild_needed;
+}
+
+
+void printNarrowBandManagerStatistics(
+  NarrowBandManager *nb_manager,
+  FILE *fp)
+{
+  LSMLIB_REAL ave_steps = 0.0;
+
+  if (nb_manager->num_rebuilds > 0) {
+    ave_steps = ((LSMLIB_REAL) nb_manager->num_steps)
+              / ((LSMLIB_REAL) nb_manager->num_rebuilds);
+  }
+
+  fprintf(fp,"\nNarrow band: total steps %d  rebuilds %d ",
+          nb_manager->num_steps, nb_manager->num_rebuilds);
+  fprintf(fp,"(displacement %d, change sign %d, requested %d)",
+          nb_manager->num_displacement_rebuilds,
+          nb_manager->num_sign_change_rebuilds,
+          nb_manager->num_requested_rebuilds);
+  fprintf(fp,"\nNarrow band rebuilt on average every %g steps.\n",
+          ave_steps);
+}
@@ -0,0 +1,205 @@
+/*
+ * File:        lsm_narrow_band.h
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Header file for narrow band rebuild management for
+ *              localized serial LSMLIB calculations
+ */
+
+#ifndef included_lsm_narrow_band_h
+#define included_lsm_narrow_band_h
+
+#include <stdio.h>
+#include "LSMLIB_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*! \file lsm_narrow_band.h
+ *
+ * \brief
+ * @ref lsm_narrow_band.h provides support for deciding when the narrow
+ * band used by localized (i.e. narrow band) level set method calculations
+ * needs to be rebuilt.
+ *
+ * Rebuilding the narrow band (e.g. with LSM3D_DETERMINE_NARROW_BAND())
+ * requires a sweep over the entire grid, so it is wasteful to rebuild it
+ * every time step.  The narrow band remains valid as long as the zero
+ * level set stays well inside of it.  The NarrowBandManager tracks an
+ * upper bound on the interface displacement since the last rebuild
+ * (accumulated from the max norm of the change in phi within the
+ * narrow band for each time step) together with sign changes of phi
+ * in the outer layer of the narrow band (beta <= |phi| < gamma), and
+ * only requests a rebuild when the interface could have left the
+ * inner band.
+ *
+ */
+
+
+/*!
+ * The 'NarrowBandManager' structure holds the state used to decide
+ * when the narrow band needs to be rebuilt together with statistics
+ * on how often rebuilds occur.
+ */
+typedef struct _NarrowBandManager {
+
+  /* inner and outer narrow band widths */
+  LSMLIB_REAL beta, gamma;
+
+  /* displacement of the interface that triggers a rebuild (beta) */
+  LSMLIB_REAL max_displacement;
+
+  /* bound on interface displacement since the last rebuild */
+  LSMLIB_REAL displacement;
+
+  /* flag indicating that a rebuild is required before the next step */
+  int  rebuild_needed;
+
+  /* statistics */
+  int  num_steps;
+  int  num_steps_since_rebuild;
+  int  num_rebuilds;
+  int  num_displacement_rebuilds;
+  int  num_sign_change_rebuilds;
+  int  num_requested_rebuilds;
+
+} NarrowBandManager;
+
+
+/*! @{
+ ****************************************************************
+ *
+ * @name Narrow band management functions
+ *
+ ****************************************************************/
+
+/*!
+ * createNarrowBandManager() allocates and initializes a NarrowBandManager
+ * structure.
+ *
+ * Arguments:
+ *  - beta (in):   inner narrow band width (where the cut-off
+ *                 function starts taking effect)
+ *  - gamma (in):  outer narrow band width
+ *
+ * Return value:   pointer to the newly created NarrowBandManager
+ *
+ * NOTES:
+ * - The narrow band is flagged as requiring a rebuild so that the
+ *   first call to narrowBandRebuildNeeded() returns true.
+ *
+ */
+NarrowBandManager *createNarrowBandManager(
+  LSMLIB_REAL beta,
+  LSMLIB_REAL gamma);
+
+/*!
+ * destroyNarrowBandManager() frees the memory occupied by the
+ * NarrowBandManager structure.
+ *
+ * Arguments:
+ *  - nb_manager (in):  pointer to NarrowBandManager to be destroyed
+ *
+ * Return value:        none
+ *
+ */
+void destroyNarrowBandManager(NarrowBandManager *nb_manager);
+
+/*!
+ * narrowBandRebuildNeeded() returns whether the narrow band must be
+ * rebuilt before the next time step.
+ *
+ * Arguments:
+ *  - nb_manager (in):  pointer to NarrowBandManager
+ *
+ * Return value:        1 if the narrow band needs to be rebuilt;
+ *                      0 otherwise
+ *
+ */
+int narrowBandRebuildNeeded(NarrowBandManager *nb_manager);
+
+/*!
+ * recordNarrowBandRebuild() resets the displacement bound after the
+ * narrow band has been rebuilt and updates the rebuild statistics.
+ *
+ * Arguments:
+ *  - nb_manager (in):  pointer to NarrowBandManager
+ *
+ * Return value:        none
+ *
+ */
+void recordNarrowBandRebuild(NarrowBandManager *nb_manager);
+
+/*!
+ * requestNarrowBandRebuild() forces a rebuild of the narrow band before
+ * the next time step (e.g. after reinitialization of the level set
+ * function).
+ *
+ * Arguments:
+ *  - nb_manager (in):  pointer to NarrowBandManager
+ *
+ * Return value:        none
+ *
+ */
+void requestNarrowBandRebuild(NarrowBandManager *nb_manager);
+
+/*!
+ * updateNarrowBandManager() accounts for the interface motion during
+ * a single time step and flags the narrow band for a rebuild if the
+ * interface may have reached the outer layer of the narrow band.
+ *
+ * Arguments:
+ *  - nb_manager (in):    pointer to NarrowBandManager
+ *  - displacement (in):  bound on the interface displacement during
+ *                        the time step (i.e. the max norm of the
+ *                        change in phi within the narrow band)
+ *  - change_sign (in):   result of the outer layer sign check (e.g.
+ *                        from LSM3D_CHECK_OUTER_NARROW_BAND_LAYER());
+ *                        nonzero if phi changed sign in the outer layer
+ *
+ * Return value:          1 if the narrow band needs to be rebuilt;
+ *                        0 otherwise
+ *
+ * NOTES:
+ * - A rebuild is requested when the accumulated displacement reaches
+ *   beta (i.e. the interface could have moved from the center of the
+ *   narrow band out of its inner band) or when phi changes sign in
+ *   the outer layer.
+ *
+ * - The max norm of the change in phi bounds the displacement of the
+ *   interface only when phi is close to a signed distance function
+ *   (|grad(phi)| ~ 1), so phi should be reinitialized regularly.
+ *
+ */
+int updateNarrowBandManager(
+  NarrowBandManager *nb_manager,
+  LSMLIB_REAL displacement,
+  int change_sign);
+
+/*!
+ * printNarrowBandManagerStatistics() prints statistics on how often
+ * the narrow band was rebuilt.
+ *
+ * Arguments:
+ *  - nb_manager (in):  pointer to NarrowBandManager
+ *  - fp (in):          FILE pointer to output file
+ *
+ * Return value:        none
+ *
+ */
+void printNarrowBandManagerStatistics(
+  NarrowBandManager *nb_manager,
+  FILE *fp);
+
+/*! @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,213 @@
+/*
+ * File:        lsm_semi_implicit_curvature.c
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Implementation file for semi-implicit time integration of 
+ *              the curvature term for serial LSMLIB calculations
+ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "lsm_semi_implicit_curvature.h"
+#include "lsm_level_set_evolution2d.h"
+#include "lsm_level_set_evolution3d.h"
+
+
+/*================== Helper function declarations ==================*/
+
+/* applies A = I - b_dt*Laplacian to u on the fillbox */
+static void applySemiImplicitCurvOperator(
+  LSMLIB_REAL *Au,
+  LSMLIB_REAL *u,
+  LSMLIB_REAL b_dt,
+  Grid *grid);
+
+/* computes the dot product of u and v over the fillbox */
+static LSMLIB_REAL fillboxDotProduct(
+  LSMLIB_REAL *u,
+  LSMLIB_REAL *v,
+  Grid *grid);
+
+/* matrix-free conjugate gradient solver shared by 2D and 3D */
+static int solveSemiImplicitCurvatureSystem(
+  LSMLIB_REAL *phi,
+  LSMLIB_REAL *f,
+  LSMLIB_REAL b_dt,
+  Grid *grid,
+  LSMLIB_REAL tol,
+  int max_iters);
+
+
+/* macro for looping over the fillbox; k is fixed at 0 in 2D */
+#define LSM_FILLBOX_LOOP_BEGIN(grid, idx)                             \
+{                                                                     \
+  int i_, j_, k_;                                                     \
+  int nx_ = (grid)->grid_dims_alloc[0];                               \
+  int nxy_ = nx_*(grid)->grid_dims_alloc[1];                          \
+  int klo_ = ((grid)->num_dims == 3) ? (grid)->klo_fb : 0;            \
+  int khi_ = ((grid)->num_dims == 3) ? (grid)->khi_fb : 0;            \
+  for (k_ = klo_; k_ <= khi_; k_++) {                                 \
+    for (j_ = (grid)->jlo_fb; j_ <= (grid)->jhi_fb; j_++) {           \
+      for (i_ = (grid)->ilo_fb; i_ <= (grid)->ihi_fb; i_++) {         \
+        int idx = i_ + j_*nx_ + k_*nxy_;
+
+#define LSM_FILLBOX_LOOP_END                                          \
+      }                                                               \
+    }                                                                 \
+  }                                                                   \
+}
+
+
+/*================= Semi-implicit curvature solvers =================*/
+
+int solveSemiImplicitCurvatureSystem2d(
+  LSMLIB_REAL *phi,
+  LSMLIB_REAL *f,
+  LSMLIB_REAL b_dt,
+  Grid *grid,
+  LSMLIB_REAL tol,
+  int max_iters)
+{
+  return solveSemiImplicitCurvatureSystem(phi, f, b_dt, grid, 
+                                          tol, max_iters);
+}
+
+
+int solveSemiImplicitCurvatureSystem3d(
+  LSMLIB_REAL *phi,
+  LSMLIB_REAL *f,
+  LSMLIB_REAL b_dt,
+  Grid *grid,
+  LSMLIB_REAL tol,
+  int max_iters)
+{
+  return solveSemiImplicitCurvatureSystem(phi, f, b_dt, grid, 
+                                          tol, max_iters);
+}
+
+
+/*==================== Helper function definitions ====================*/
+
+static int solveSemiImplicitCurvatureSystem(
+  LSMLIB_REAL *phi,
+  LSMLIB_REAL *f,
+  LSMLIB_REAL b_dt,
+  Grid *grid,
+  LSMLIB_REAL tol,
+  int max_iters)
+{
+  LSMLIB_REAL *r, *p, *q;
+  LSMLIB_REAL r_dot_r, r_dot_r_new, p_dot_q, alpha, beta;
+  LSMLIB_REAL stop_tol;
+  int num_iters = 0;
+  int converged = 0;
+
+  /* allocate work arrays; calloc() zeros the ghostcells of p so   */
+  /* that A*p only involves the homogeneous part of the operator   */
+  r = (LSMLIB_REAL*) calloc(grid->num_gridpts_alloc, sizeof(LSMLIB_REAL));
+  p = (LSMLIB_REAL*) calloc(grid->num_gridpts_alloc, sizeof(LSMLIB_REAL));
+  q = (LSMLIB_REAL*) calloc(grid->num_gridpts_alloc, sizeof(LSMLIB_REAL));
+
+  stop_tol = tol*tol*fillboxDotProduct(f, f, grid);
+
+  /* r = f - A*phi (includes the Dirichlet data in the ghostcells), */
+  /* p = r                                                          */
+  applySemiImplicitCurvOperator(q, phi, b_dt, grid);
+  LSM_FILLBOX_LOOP_BEGIN(grid, idx)
+    r[idx] = f[idx] - q[idx];
+    p[idx] = r[idx];
+  LSM_FILLBOX_LOOP_END
+  r_dot_r = fillboxDotProduct(r, r, grid);
+
+  /* { begin CG iteration */
+  while (1) {
+
+    if (r_dot_r <= stop_tol) {
+      converged = 1;
+      break;
+    }
+    if (num_iters >= max_iters) break;
+
+    applySemiImplicitCurvOperator(q, p, b_dt, grid);
+    p_dot_q = fillboxDotProduct(p, q, grid);
+    if (p_dot_q <= 0.0) break;
+
+    alpha = r_dot_r/p_dot_q;
+    LSM_FILLBOX_LOOP_BEGIN(grid, idx)
+      phi[idx] += alpha*p[idx];
+      r[idx] -= alpha*q[idx];
+    LSM_FILLBOX_LOOP_END
+
+    r_dot_r_new = fillboxDotProduct(r, r, grid);
+    beta = r_dot_r_new/r_dot_r;
+    r_dot_r = r_dot_r_new;
+    LSM_FILLBOX_LOOP_BEGIN(grid, idx)
+      p[idx] = r[idx] + beta*p[idx];
+    LSM_FILLBOX_LOOP_END
+
+    num_iters++;
+
+  } /* } end CG iteration */
+
+  free(r);
+  free(p);
+  free(q);
+
+  return (converged ? num_iters : -num_iters - 1);
+}
+
+
+static void applySemiImplicitCurvOperator(
+  LSMLIB_REAL *Au,
+  LSMLIB_REAL *u,
+  LSMLIB_REAL b_dt,
+  Grid *grid)
+{
+  if (grid->num_dims == 3) {
+    LSM3D_SEMI_IMPLICIT_CURV_OPERATOR(
+      Au,
+      &(grid->ilo_gb), &(grid->ihi_alloc),
+      &(grid->jlo_gb), &(grid->jhi_alloc),
+      &(grid->klo_gb), &(grid->khi_alloc),
+      u,
+      &(grid->ilo_gb), &(grid->ihi_alloc),
+      &(grid->jlo_gb), &(grid->jhi_alloc),
+      &(grid->klo_gb), &(grid->khi_alloc),
+      &b_dt,
+      &(grid->dx[0]), &(grid->dx[1]), &(grid->dx[2]),
+      &(grid->ilo_fb), &(grid->ihi_fb),
+      &(grid->jlo_fb), &(grid->jhi_fb),
+      &(grid->klo_fb), &(grid->khi_fb));
+  } else {
+    LSM2D_SEMI_IMPLICIT_CURV_OPERATOR(
+      Au,
+      &(grid->ilo_gb), &(grid->ihi_alloc),
+      &(grid->jlo_gb), &(grid->jhi_alloc),
+      u,
+      &(grid->ilo_gb), &(grid->ihi_alloc),
+      &(grid->jlo_gb), &(grid->jhi_alloc),
+      &b_dt,
+      &(grid->dx[0]), &(grid->dx[1]),
+      &(grid->ilo_fb), &(grid->ihi_fb),
+      &(grid->jlo_fb), &(grid->jhi_fb));
+  }
+}
+
+
+static LSMLIB_REAL fillboxDotProduct(
+  LSMLIB_REAL *u,
+  LSMLIB_REAL *v,
+  Grid *grid)
+{
+  LSMLIB_REAL sum = 0.0;
+
+  LSM_FILLBOX_LOOP_BEGIN(grid, idx)
+    sum += u[idx]*v[idx];
+  LSM_FILLBOX_LOOP_END
+
+  return sum;
+}
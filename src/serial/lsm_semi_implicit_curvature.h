@@ -0,0 +1,155 @@
+/*
+ * File:        lsm_semi_implicit_curvature.h
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Header file for semi-implicit time integration of the
+ *              curvature term for serial LSMLIB calculations
+ */
+
+#ifndef included_lsm_semi_implicit_curvature_h
+#define included_lsm_semi_implicit_curvature_h
+
+#include "LSMLIB_config.h"
+#include "lsm_grid.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*! \file lsm_semi_implicit_curvature.h
+ *
+ * \brief
+ * @ref lsm_semi_implicit_curvature.h provides support for semi-implicit
+ * time integration of level set equations containing a constant
+ * curvature term
+ *
+ * \f[
+ *
+ *    \phi_t = b \kappa |\nabla \phi| + ...
+ *
+ * \f]
+ *
+ * Explicit treatment of the curvature term restricts the time step
+ * to \f$ dt = O(dx^2 / b) \f$.  Following the standard linearization,
+ * the curvature term is split into \f$ b \nabla^2 \phi \f$, which is
+ * treated implicitly, and the remainder, which is added to the
+ * right-hand side explicitly using
+ * LSM2D_ADD_SEMI_IMPLICIT_CURV_CORRECTION_TO_LSE_RHS() or
+ * LSM3D_ADD_SEMI_IMPLICIT_CURV_CORRECTION_TO_LSE_RHS().  
+ * A first-order (IMEX Euler) step then reads
+ *
+ * \f[
+ *
+ *    (I - b \, dt \nabla^2) \phi^{n+1} = \phi^n + dt \cdot RHS(\phi^n)
+ *
+ * \f]
+ *
+ * The linear system is solved by the functions in this file using a 
+ * matrix-free conjugate gradient method, so the time step is limited 
+ * only by the advective and normal velocity CFL conditions.
+ *
+ */
+
+
+/*! @{
+ ****************************************************************
+ *
+ * @name Semi-implicit curvature solvers
+ *
+ ****************************************************************/
+
+/*!
+ * solveSemiImplicitCurvatureSystem2d() solves the linear system
+ *
+ * \f[
+ *
+ *    (I - b \, dt \nabla^2) \phi = f
+ *
+ * \f]
+ *
+ * on the fillbox of a 2D grid using the conjugate gradient method.
+ *
+ * Arguments:
+ *  - phi (in/out):   on input, initial guess for the solution together
+ *                    with the values of phi in the ghostcells (which
+ *                    are held fixed); on output, the solution
+ *  - f (in):         right-hand side of the linear system
+ *  - b_dt (in):      coefficient of the Laplacian (i.e. b*dt)
+ *  - grid (in):      pointer to Grid
+ *  - tol (in):       relative tolerance (the iteration stops when
+ *                    the residual satisfies ||r|| <= tol ||f||)
+ *  - max_iters (in): maximum number of iterations
+ *
+ * Return value:      number of iterations taken; a negative value
+ *                    indicates that the iteration did not converge
+ *                    within max_iters iterations
+ *
+ * NOTES:
+ * - The ghostcell values of phi act as Dirichlet boundary data for
+ *   the linear system, so boundary conditions should be imposed on 
+ *   the initial guess before calling this function (e.g. by copying
+ *   the explicit predictor into phi).
+ *
+ * - The matrix is symmetric positive definite with a constant diagonal,
+ *   so no preconditioner is used (Jacobi preconditioning would only
+ *   rescale the iteration).  Because the initial guess is usually a
+ *   good predictor, only a few iterations are typically required.
+ *
+ */
+int solveSemiImplicitCurvatureSystem2d(
+  LSMLIB_REAL *phi,
+  LSMLIB_REAL *f,
+  LSMLIB_REAL b_dt,
+  Grid *grid,
+  LSMLIB_REAL tol,
+  int max_iters);
+
+/*!
+ * solveSemiImplicitCurvatureSystem3d() solves the linear system
+ *
+ * \f[
+ *
+ *    (I - b \, dt \nabla^2) \phi = f
+ *
+ * \f]
+ *
+ * on the fillbox of a 3D grid using the conjugate gradient method.
+ *
+ * Arguments:
+ *  - phi (in/out):   on input, initial guess for the solution together
+ *                    with the values of phi in the ghostcells (which
+ *                    are held fixed); on output, the solution
+ *  - f (in):         right-hand side of the linear system
+ *  - b_dt (in):      coefficient of the Laplacian (i.e. b*dt)
+ *  - grid (in):      pointer to Grid
+ *  - tol (in):       relative tolerance (the iteration stops when
+ *                    the residual satisfies ||r|| <= tol ||f||)
+ *  - max_iters (in): maximum number of iterations
+ *
+ * Return value:      number of iterations taken; a negative value
+ *                    indicates that the iteration did not converge
+ *                    within max_iters iterations
+ *
+ * NOTES:
+ * - See notes for solveSemiImplicitCurvatureSystem2d().
+ *
+ */
+int solveSemiImplicitCurvatureSystem3d(
+  LSMLIB_REAL *phi,
+  LSMLIB_REAL *f,
+  LSMLIB_REAL b_dt,
+  Grid *grid,
+  LSMLIB_REAL tol,
+  int max_iters);
+
+/*! @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -31,6 +31,7 @@
 #define LSM_FMM_ERR_SUCCESS                                 (0)
 #define LSM_FMM_ERR_FMM_DATA_CREATION_ERROR                 (1)
 #define LSM_FMM_ERR_INVALID_SPATIAL_DISCRETIZATION_ORDER    (2)
+#define LSM_FMM_ERR_INCOMPATIBLE_DATA_ARRAY_VIEWS           (3)
 
 
 /*======================= Helper Functions ==========================*/
@@ -45,6 +45,14 @@ extern "C" {
 #define LSM2D_ADD_EXTERNAL_AND_NORMAL_VEL_TERM_TO_LSE_RHS \
                                     lsm2daddexternalandnormalveltermtolserhs_				
 
+#define LSM2D_TVD_RK_STAGE_ADVECTION          lsm2dtvdrkstageadvection_
+#define LSM2D_TVD_RK_STAGE_NORMAL_VEL         lsm2dtvdrkstagenormalvel_
+#define LSM2D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV  \
+                                       lsm2dtvdrkstageconstnormalvelcurv_
+#define LSM2D_ADD_SEMI_IMPLICIT_CURV_CORRECTION_TO_LSE_RHS \
+                            lsm2daddsemiimplicitcurvcorrectiontolserhs_
+#define LSM2D_SEMI_IMPLICIT_CURV_OPERATOR     lsm2dsemiimplicitcurvoperator_
+
 /*!
  * LSM2D_ZERO_OUT_LEVEL_SET_EQN_RHS() zeros out the right-hand side of 
  * the level set equation when it is written in the form:
@@ -367,6 +375,366 @@ void LSM2D_ADD_EXTERNAL_AND_NORMAL_VEL_TERM_TO_LSE_RHS(
   const int *ihi_rhs_fb,
   const int *jlo_rhs_fb, 
   const int *jhi_rhs_fb);
+
+
+/*!
+ * LSM2D_TVD_RK_STAGE_ADVECTION() advances the solution through a single
+ * stage of a TVD Runge-Kutta step for the level set equation with an
+ * advection term (external vector velocity field):
+ *
+ * \f[
+ *
+ *    \phi_t = -\vec{V} \cdot \nabla \phi
+ *
+ * \f]
+ *
+ * The right-hand side is never stored.  The stage is computed as
+ *
+ * \f[
+ *
+ *    u_{out} = \alpha u_{cur} + (1-\alpha) ( u_{stage} + dt \cdot RHS(u_{stage}) )
+ *
+ * \f]
+ *
+ * where alpha = 0 for RK1 and the first stage of TVD-RK2 and TVD-RK3,
+ * alpha = 1/2 for the second stage of TVD-RK2, and alpha = 3/4 and
+ * alpha = 1/3 for the second and third stages of TVD-RK3.
+ *
+ * Arguments:
+ *  - u_out (out):       u at the end of the stage
+ *  - u_cur (in):        u(t_cur)
+ *  - u_stage (in):      u at the beginning of the stage
+ *  - phi_* (in):        components of \f$ \nabla \phi \f$ computed 
+ *                       from u_stage
+ *  - vel_* (in):        components of velocity
+ *  - *_gb (in):         index range for ghostbox
+ *  - *_fb (in):         index range for fillbox
+ *  - alpha (in):        weight of u_cur for the stage
+ *  - dt (in):           step size
+ *
+ * Return value:         none
+ *
+ * NOTES:
+ *  - u_out may be the same array as u_cur or u_stage.
+ */
+void LSM2D_TVD_RK_STAGE_ADVECTION(
+  LSMLIB_REAL *u_out,
+  const int *ilo_u_out_gb, 
+  const int *ihi_u_out_gb,
+  const int *jlo_u_out_gb, 
+  const int *jhi_u_out_gb,
+  const LSMLIB_REAL *u_cur,
+  const int *ilo_u_cur_gb, 
+  const int *ihi_u_cur_gb,
+  const int *jlo_u_cur_gb, 
+  const int *jhi_u_cur_gb,
+  const LSMLIB_REAL *u_stage,
+  const int *ilo_u_stage_gb, 
+  const int *ihi_u_stage_gb,
+  const int *jlo_u_stage_gb, 
+  const int *jhi_u_stage_gb,
+  const LSMLIB_REAL *phi_x,
+  const LSMLIB_REAL *phi_y,
+  const int *ilo_grad_phi_gb, 
+  const int *ihi_grad_phi_gb,
+  const int *jlo_grad_phi_gb, 
+  const int *jhi_grad_phi_gb,
+  const LSMLIB_REAL *vel_x,
+  const LSMLIB_REAL *vel_y,
+  const int *ilo_vel_gb, 
+  const int *ihi_vel_gb,
+  const int *jlo_vel_gb, 
+  const int *jhi_vel_gb,
+  const int *ilo_fb, 
+  const int *ihi_fb,
+  const int *jlo_fb, 
+  const int *jhi_fb,
+  const LSMLIB_REAL *alpha,
+  const LSMLIB_REAL *dt);
+
+/*!
+ * LSM2D_TVD_RK_STAGE_NORMAL_VEL() advances the solution through a single
+ * stage of a TVD Runge-Kutta step for the level set equation with a 
+ * normal (scalar) velocity term:
+ *
+ * \f[
+ *
+ *    \phi_t = -V_n |\nabla \phi|
+ *
+ * \f]
+ *
+ * The right-hand side is never stored.  The stage is computed as
+ *
+ * \f[
+ *
+ *    u_{out} = \alpha u_{cur} + (1-\alpha) ( u_{stage} + dt \cdot RHS(u_{stage}) )
+ *
+ * \f]
+ *
+ * where alpha = 0 for RK1 and the first stage of TVD-RK2 and TVD-RK3,
+ * alpha = 1/2 for the second stage of TVD-RK2, and alpha = 3/4 and
+ * alpha = 1/3 for the second and third stages of TVD-RK3.
+ *
+ * Arguments:
+ *  - u_out (out):       u at the end of the stage
+ *  - u_cur (in):        u(t_cur)
+ *  - u_stage (in):      u at the beginning of the stage
+ *  - phi_*_plus (in):   components of forward approx to 
+ *                       \f$ \nabla \phi \f$ computed from u_stage
+ *  - phi_*_minus (in):  components of backward approx to 
+ *                       \f$ \nabla \phi \f$ computed from u_stage
+ *  - vel_n (in):        normal velocity
+ *  - *_gb (in):         index range for ghostbox
+ *  - *_fb (in):         index range for fillbox
+ *  - alpha (in):        weight of u_cur for the stage
+ *  - dt (in):           step size
+ *
+ * Return value:         none
+ *
+ * NOTES:
+ *  - u_out may be the same array as u_cur or u_stage.
+ */
+void LSM2D_TVD_RK_STAGE_NORMAL_VEL(
+  LSMLIB_REAL *u_out,
+  const int *ilo_u_out_gb, 
+  const int *ihi_u_out_gb,
+  const int *jlo_u_out_gb, 
+  const int *jhi_u_out_gb,
+  const LSMLIB_REAL *u_cur,
+  const int *ilo_u_cur_gb, 
+  const int *ihi_u_cur_gb,
+  const int *jlo_u_cur_gb, 
+  const int *jhi_u_cur_gb,
+  const LSMLIB_REAL *u_stage,
+  const int *ilo_u_stage_gb, 
+  const int *ihi_u_stage_gb,
+  const int *jlo_u_stage_gb, 
+  const int *jhi_u_stage_gb,
+  const LSMLIB_REAL *phi_x_plus,
+  const LSMLIB_REAL *phi_y_plus,
+  const int *ilo_grad_phi_plus_gb, 
+  const int *ihi_grad_phi_plus_gb,
+  const int *jlo_grad_phi_plus_gb, 
+  const int *jhi_grad_phi_plus_gb,
+  const LSMLIB_REAL *phi_x_minus,
+  const LSMLIB_REAL *phi_y_minus,
+  const int *ilo_grad_phi_minus_gb, 
+  const int *ihi_grad_phi_minus_gb,
+  const int *jlo_grad_phi_minus_gb, 
+  const int *jhi_grad_phi_minus_gb,
+  const LSMLIB_REAL *vel_n,
+  const int *ilo_vel_gb, 
+  const int *ihi_vel_gb,
+  const int *jlo_vel_gb, 
+  const int *jhi_vel_gb,
+  const int *ilo_fb, 
+  const int *ihi_fb,
+  const int *jlo_fb, 
+  const int *jhi_fb,
+  const LSMLIB_REAL *alpha,
+  const LSMLIB_REAL *dt);
+
+/*!
+ * LSM2D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV() advances the solution 
+ * through a single stage of a TVD Runge-Kutta step for the level set 
+ * equation with constant normal velocity and constant curvature terms:
+ *
+ * \f[
+ *
+ *    \phi_t = -V_n |\nabla \phi| + b \kappa |\nabla \phi|
+ *
+ * \f]
+ *
+ * The right-hand side is never stored.  The stage is computed as
+ *
+ * \f[
+ *
+ *    u_{out} = \alpha u_{cur} + (1-\alpha) ( u_{stage} + dt \cdot RHS(u_{stage}) )
+ *
+ * \f]
+ *
+ * where alpha = 0 for RK1 and the first stage of TVD-RK2 and TVD-RK3,
+ * alpha = 1/2 for the second stage of TVD-RK2, and alpha = 3/4 and
+ * alpha = 1/3 for the second and third stages of TVD-RK3.
+ *
+ * Arguments:
+ *  - u_out (out):       u at the end of the stage
+ *  - u_cur (in):        u(t_cur)
+ *  - u_stage (in):      u at the beginning of the stage
+ *  - phi_*_plus (in):   components of forward approx to 
+ *                       \f$ \nabla \phi \f$ computed from u_stage
+ *  - phi_*_minus (in):  components of backward approx to 
+ *                       \f$ \nabla \phi \f$ computed from u_stage
+ *  - phi_* (in):        first- and second-order central derivatives
+ *                       computed from u_stage
+ *  - vel_n (in):        constant normal velocity
+ *  - b (in):            constant curvature coefficient
+ *  - *_gb (in):         index range for ghostbox
+ *  - *_fb (in):         index range for fillbox
+ *  - alpha (in):        weight of u_cur for the stage
+ *  - dt (in):           step size
+ *
+ * Return value:         none
+ *
+ * NOTES:
+ *  - u_out may be the same array as u_cur or u_stage.
+ *  - the normal velocity (curvature) derivatives are not accessed
+ *    when vel_n (b) is zero.
+ */
+void LSM2D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV(
+  LSMLIB_REAL *u_out,
+  const int *ilo_u_out_gb, 
+  const int *ihi_u_out_gb,
+  const int *jlo_u_out_gb, 
+  const int *jhi_u_out_gb,
+  const LSMLIB_REAL *u_cur,
+  const int *ilo_u_cur_gb, 
+  const int *ihi_u_cur_gb,
+  const int *jlo_u_cur_gb, 
+  const int *jhi_u_cur_gb,
+  const LSMLIB_REAL *u_stage,
+  const int *ilo_u_stage_gb, 
+  const int *ihi_u_stage_gb,
+  const int *jlo_u_stage_gb, 
+  const int *jhi_u_stage_gb,
+  const LSMLIB_REAL *phi_x_plus,
+  const LSMLIB_REAL *phi_y_plus,
+  const int *ilo_grad_phi_plus_gb, 
+  const int *ihi_grad_phi_plus_gb,
+  const int *jlo_grad_phi_plus_gb, 
+  const int *jhi_grad_phi_plus_gb,
+  const LSMLIB_REAL *phi_x_minus,
+  const LSMLIB_REAL *phi_y_minus,
+  const int *ilo_grad_phi_minus_gb, 
+  const int *ihi_grad_phi_minus_gb,
+  const int *jlo_grad_phi_minus_gb, 
+  const int *jhi_grad_phi_minus_gb,
+  const LSMLIB_REAL *phi_x,
+  const LSMLIB_REAL *phi_y,
+  const int *ilo_grad_phi_gb, 
+  const int *ihi_grad_phi_gb,
+  const int *jlo_grad_phi_gb, 
+  const int *jhi_grad_phi_gb,
+  const LSMLIB_REAL *phi_xx,
+  const LSMLIB_REAL *phi_xy,
+  const LSMLIB_REAL *phi_yy,
+  const int *ilo_grad2_phi_gb, 
+  const int *ihi_grad2_phi_gb,
+  const int *jlo_grad2_phi_gb, 
+  const int *jhi_grad2_phi_gb,
+  const LSMLIB_REAL *vel_n,
+  const LSMLIB_REAL *b,
+  const int *ilo_fb, 
+  const int *ihi_fb,
+  const int *jlo_fb, 
+  const int *jhi_fb,
+  const LSMLIB_REAL *alpha,
+  const LSMLIB_REAL *dt);
+
+/*!
+ * LSM2D_ADD_SEMI_IMPLICIT_CURV_CORRECTION_TO_LSE_RHS() adds the 
+ * explicit part of a semi-implicit discretization of the curvature 
+ * term to the right-hand side of the level set equation.  The 
+ * curvature term is split as
+ *   
+ * \f[
+ *   
+ *    b \kappa |\nabla \phi| = b \nabla^2 \phi 
+ *      - b \frac{ \nabla \phi \cdot H(\phi) \nabla \phi }{ |\nabla \phi|^2 }
+ *   
+ * \f]
+ *  
+ * where \f$ H(\phi) \f$ is the Hessian of \f$ \phi \f$.  Only the 
+ * second term is added to lse_rhs; the Laplacian is treated implicitly 
+ * using LSM2D_SEMI_IMPLICIT_CURV_OPERATOR().
+ *
+ * Arguments:
+ *  - lse_rhs (in/out):  right-hand of level set equation
+ *  - phi_* (in):        first- and second-order partial derivatives 
+ *                       of \f$ \phi \f$ 
+ *  - b (in):            constant curvature coefficient
+ *  - *_gb (in):         index range for ghostbox
+ *  - *_fb (in):         index range for fillbox
+ *
+ * Return value:         none
+ *
+ * NOTES:
+ *  - where \f$ |\nabla \phi| \f$ vanishes, the curvature term is
+ *    taken to be zero (as in LSM2D_ADD_CONST_CURV_TERM_TO_LSE_RHS()),
+ *    so \f$ -b \nabla^2 \phi \f$ is added to cancel the implicit part.
+ */
+void LSM2D_ADD_SEMI_IMPLICIT_CURV_CORRECTION_TO_LSE_RHS(
+  LSMLIB_REAL *lse_rhs,
+  const int *ilo_lse_rhs_gb, 
+  const int *ihi_lse_rhs_gb,
+  const int *jlo_lse_rhs_gb, 
+  const int *jhi_lse_rhs_gb,
+  const LSMLIB_REAL *phi_x, 
+  const LSMLIB_REAL *phi_y,
+  const int *ilo_grad_phi_gb,
+  const int *ihi_grad_phi_gb,
+  const int *jlo_grad_phi_gb,
+  const int *jhi_grad_phi_gb,
+  const LSMLIB_REAL *phi_xx,
+  const LSMLIB_REAL *phi_xy,
+  const LSMLIB_REAL *phi_yy,
+  const int *ilo_grad2_phi_gb,
+  const int *ihi_grad2_phi_gb,
+  const int *jlo_grad2_phi_gb, 
+  const int *jhi_grad2_phi_gb,
+  const LSMLIB_REAL *b,
+  const int *ilo_fb, 
+  const int *ihi_fb,
+  const int *jlo_fb, 
+  const int *jhi_fb);
+
+/*!
+ * LSM2D_SEMI_IMPLICIT_CURV_OPERATOR() applies the operator
+ *   
+ * \f[
+ *   
+ *    A u = u - coef \nabla^2 u
+ *   
+ * \f]
+ *  
+ * that arises from the implicit treatment of the Laplacian part of the
+ * curvature term (with coef = b*dt for a backward Euler step).  The 
+ * Laplacian is discretized using the standard second-order 5-point
+ * stencil.
+ *
+ * Arguments:
+ *  - Au (out):          A applied to u
+ *  - u (in):            grid function that A is applied to
+ *  - coef (in):         coefficient of the Laplacian
+ *  - dx, dy (in):      grid spacing
+ *  - *_gb (in):         index range for ghostbox
+ *  - *_fb (in):         index range for fillbox
+ *
+ * Return value:         none
+ *
+ * NOTES:
+ *  - u must be defined on the fillbox grown by one cell in each
+ *    coordinate direction.
+ */
+void LSM2D_SEMI_IMPLICIT_CURV_OPERATOR(
+  LSMLIB_REAL *Au,
+  const int *ilo_Au_gb, 
+  const int *ihi_Au_gb,
+  const int *jlo_Au_gb, 
+  const int *jhi_Au_gb,
+  const LSMLIB_REAL *u,
+  const int *ilo_u_gb, 
+  const int *ihi_u_gb,
+  const int *jlo_u_gb, 
+  const int *jhi_u_gb,
+  const LSMLIB_REAL *coef,
+  const LSMLIB_REAL *dx,
+  const LSMLIB_REAL *dy,
+  const int *ilo_fb, 
+  const int *ihi_fb,
+  const int *jlo_fb, 
+  const int *jhi_fb);
+
 #ifdef __cplusplus
 }
 #endif
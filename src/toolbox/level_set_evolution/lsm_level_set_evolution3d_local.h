@@ -49,6 +49,9 @@ extern "C" {
                                   lsm3daddexternalandnormalveltermtolserhslocal_						
 
 
+#define LSM3D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV_LOCAL \
+                                  lsm3dtvdrkstageconstnormalvelcurvlocal_
+
 /*!
 *
 *  LSM3D_ZERO_OUT_LEVEL_SET_EQN_RHS_LOCAL() zeros out the right-hand side of the
@@ -495,7 +498,127 @@ void LSM3D_ADD_EXTERNAL_AND_NORMAL_VEL_TERM_TO_LSE_RHS_LOCAL(
   const int *klo_nb_gb,
   const int *khi_nb_gb,
   const unsigned char *mark_fb);
-  
+
+/*!
+*
+*  LSM3D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV_LOCAL() advances the solution 
+*  through a single stage of a TVD Runge-Kutta step for the level set 
+*  equation with constant normal velocity and constant curvature terms
+*
+*    phi_t = -vel_n*|grad(phi)| + b*kappa*|grad(phi)|
+*
+*  multiplied by the cut-off function of the localized method (see 
+*  LSM3D_MULTIPLY_CUT_OFF_LSE_RHS_LOCAL()).  The right-hand side is 
+*  never stored; the stage is computed as
+*
+*    u_out = alpha*u_cur + (1-alpha)*( u_stage + dt*RHS(u_stage) )
+*
+*  (see LSM3D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV() for the values of 
+*  alpha).  The routine loops only over local (narrow band) points.
+*
+*  Arguments:
+*    u_out (out):      u at the end of the stage
+*    u_cur (in):       u(t_cur)
+*    u_stage (in):     u at the beginning of the stage
+*    phi_*_plus (in):  forward approx to grad(phi) computed from u_stage
+*    phi_*_minus (in): backward approx to grad(phi) computed from u_stage
+*    phi_* (in):       first- and second-order central derivatives 
+*                      computed from u_stage
+*    vel_n (in):       constant normal velocity
+*    b (in):           constant curvature coefficient
+*    alpha (in):       weight of u_cur for the stage
+*    dt (in):          step size
+*    *_gb (in):        index range for ghostbox
+*    index_[xyz](in):  [xyz] coordinates of local (narrow band) points
+*    n*_index(in):     index range of points in index_*
+*    narrow_band(in):  array that marks voxels outside desired fillbox
+*    mark_fb(in):      upper limit narrow band value for voxels in 
+*                      fillbox
+*    beta, gamma (in): inner and outer narrow band widths used in the
+*                      cut-off function
+*
+*/
+void LSM3D_TVD_RK_STAGE_CONST_NORMAL_VEL_CURV_LOCAL(
+  LSMLIB_REAL *u_out,
+  const int *ilo_u_out_gb, 
+  const int *ihi_u_out_gb,
+  const int *jlo_u_out_gb, 
+  const int *jhi_u_out_gb,
+  const int *klo_u_out_gb, 
+  const int *khi_u_out_gb,
+  const LSMLIB_REAL *u_cur,
+  const int *ilo_u_cur_gb, 
+  const int *ihi_u_cur_gb,
+  const int *jlo_u_cur_gb, 
+  const int *jhi_u_cur_gb,
+  const int *klo_u_cur_gb, 
+  const int *khi_u_cur_gb,
+  const LSMLIB_REAL *u_stage,
+  const int *ilo_u_stage_gb, 
+  const int *ihi_u_stage_gb,
+  const int *jlo_u_stage_gb, 
+  const int *jhi_u_stage_gb,
+  const int *klo_u_stage_gb, 
+  const int *khi_u_stage_gb,
+  const LSMLIB_REAL *phi_x_plus,
+  const LSMLIB_REAL *phi_y_plus,
+  const LSMLIB_REAL *phi_z_plus,
+  const int *ilo_grad_phi_plus_gb, 
+  const int *ihi_grad_phi_plus_gb,
+  const int *jlo_grad_phi_plus_gb, 
+  const int *jhi_grad_phi_plus_gb,
+  const int *klo_grad_phi_plus_gb, 
+  const int *khi_grad_phi_plus_gb,
+  const LSMLIB_REAL *phi_x_minus,
+  const LSMLIB_REAL *phi_y_minus,
+  const LSMLIB_REAL *phi_z_minus,
+  const int *ilo_grad_phi_minus_gb, 
+  const int *ihi_grad_phi_minus_gb,
+  const int *jlo_grad_phi_minus_gb, 
+  const int *jhi_grad_phi_minus_gb,
+  const int *klo_grad_phi_minus_gb, 
+  const int *khi_grad_phi_minus_gb,
+  const LSMLIB_REAL *phi_x,
+  const LSMLIB_REAL *phi_y,
+  const LSMLIB_REAL *phi_z,
+  const int *ilo_grad_phi_gb, 
+  const int *ihi_grad_phi_gb,
+  const int *jlo_grad_phi_gb, 
+  const int *jhi_grad_phi_gb,
+  const int *klo_grad_phi_gb, 
+  const int *khi_grad_phi_gb,
+  const LSMLIB_REAL *phi_xx,
+  const LSMLIB_REAL *phi_xy,
+  const LSMLIB_REAL *phi_xz,
+  const LSMLIB_REAL *phi_yy,
+  const LSMLIB_REAL *phi_yz,
+  const LSMLIB_REAL *phi_zz,
+  const int *ilo_grad2_phi_gb, 
+  const int *ihi_grad2_phi_gb,
+  const int *jlo_grad2_phi_gb, 
+  const int *jhi_grad2_phi_gb,
+  const int *klo_grad2_phi_gb, 
+  const int *khi_grad2_phi_gb,
+  const LSMLIB_REAL *vel_n,
+  const LSMLIB_REAL *b,
+  const LSMLIB_REAL *alpha,
+  const LSMLIB_REAL *dt,
+  const int *index_x,
+  const int *index_y, 
+  const int *index_z,
+  const int *nlo_index,
+  const int *nhi_index,
+  const unsigned char *narrow_band,
+  const int *ilo_nb_gb,
+  const int *ihi_nb_gb,
+  const int *jlo_nb_gb,
+  const int *jhi_nb_gb,
+  const int *klo_nb_gb,
+  const int *khi_nb_gb,
+  const unsigned char *mark_fb,
+  const LSMLIB_REAL *beta,
+  const LSMLIB_REAL *gamma);
+
 #ifdef __cplusplus
 }
 #endif
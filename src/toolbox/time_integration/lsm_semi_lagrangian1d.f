@@ -0,0 +1,143 @@
+c***********************************************************************
+c
+c  File:        lsm_semi_lagrangian1d.f
+c  Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+c                   Regents of the University of Texas.  All rights reserved.
+c               (c) 2009 Kevin T. Chu.  All rights reserved.
+c  Revision:    $Revision$
+c  Modified:    $Date$
+c  Description: F77 routines for 1D semi-Lagrangian advection
+c
+c***********************************************************************
+
+c***********************************************************************
+c The BFECC (back and forth error compensation and correction) scheme
+c that these subroutines are designed to support is discussed in 
+c Dupont & Liu (2003) and Kim, Liu, Llamas & Rossignac (2005).
+c***********************************************************************
+
+c***********************************************************************
+c
+c  lsm1dSemiLagrangianAdvectionStep() takes a single semi-Lagrangian
+c  step for the advection equation 
+c
+c    u_t + vel u_x = 0
+c
+c  The characteristic through each grid point x is traced back to its
+c  departure point x - dt*vel(x - dt/2*vel(x)) (i.e. the midpoint rule)
+c  and u_in is interpolated there using
+c  linear interpolation.  The result is blended with u_cur:
+c
+c    u_next = alpha*u_cur + (1-alpha)*u_in(x - dt*vel(x))
+c
+c  A plain semi-Lagrangian step uses alpha = 0.  The BFECC corrected
+c  field is obtained from the backward step (dt -> -dt) by setting 
+c  alpha = 3/2 and u_cur = u(t_cur).
+c  
+c  Arguments:
+c    u_next (out):    u at the end of the step
+c    u_cur (in):      u(t_cur) (only used when alpha is nonzero)
+c    u_in (in):       u to interpolate at the departure points
+c    vel (in):        velocity
+c    dx (in):         grid spacing
+c    alpha (in):      weight of u_cur
+c    dt (in):         step size (negative for backward steps)
+c    *_gb (in):       index range for ghostbox
+c    *_fb (in):       index range for fillbox
+c
+c  NOTES:
+c    - departure points that fall outside of the ghostbox of u_in are
+c      moved to the nearest point of the ghostbox, so the ghostbox of
+c      u_in should be at least int(CFL)+1 cells wider than the fillbox.
+c      Similarly, midpoints of the characteristics are moved into the
+c      ghostbox of the velocity.
+c    - u_next may be the same array as u_cur but NOT u_in.
+c
+c***********************************************************************
+      subroutine lsm1dSemiLagrangianAdvectionStep(
+     &  u_next,
+     &  ilo_u_next_gb, ihi_u_next_gb,
+     &  u_cur,
+     &  ilo_u_cur_gb, ihi_u_cur_gb,
+     &  u_in,
+     &  ilo_u_in_gb, ihi_u_in_gb,
+     &  vel,
+     &  ilo_vel_gb, ihi_vel_gb,
+     &  ilo_fb, ihi_fb, 
+     &  dx,
+     &  alpha, dt)
+c***********************************************************************
+c { begin subroutine
+      implicit none
+
+      integer ilo_u_next_gb, ihi_u_next_gb
+      integer ilo_u_cur_gb, ihi_u_cur_gb
+      integer ilo_u_in_gb, ihi_u_in_gb
+      integer ilo_vel_gb, ihi_vel_gb
+      integer ilo_fb, ihi_fb
+      real u_next(ilo_u_next_gb:ihi_u_next_gb)
+      real u_cur(ilo_u_cur_gb:ihi_u_cur_gb)
+      real u_in(ilo_u_in_gb:ihi_u_in_gb)
+      real vel(ilo_vel_gb:ihi_vel_gb)
+      real dx
+      real alpha, dt
+      integer i
+      integer i0
+      real x
+      real wx
+      real cx
+      real beta
+      real x_lo, x_hi
+      real xv_lo, xv_hi
+      real v_mid
+      real u_dep
+
+c     weight of the interpolated value
+      beta = 1.d0 - alpha
+
+c     dt divided by grid spacing (i.e. departure offsets in index space)
+      cx = dt/dx
+
+c     limits of ghostbox of u_in in index space
+      x_lo = ilo_u_in_gb
+      x_hi = ihi_u_in_gb
+
+c     limits of ghostbox of velocity in index space
+      xv_lo = ilo_vel_gb
+      xv_hi = ihi_vel_gb
+
+c     { begin loop over grid
+      do i=ilo_fb,ihi_fb
+
+c       trace characteristic back to the midpoint of the step
+        x = i - 0.5d0*cx*vel(i)
+
+c       interpolate velocity at the midpoint (the midpoint is moved 
+c       into the ghostbox of the velocity if necessary)
+        x = min(max(x,xv_lo),xv_hi)
+        i0 = min(int(x - ilo_vel_gb) + ilo_vel_gb, ihi_vel_gb-1)
+        wx = x - i0
+        v_mid = (1.d0-wx)*vel(i0) + wx*vel(i0+1)
+
+c       compute departure point in index space
+        x = i - cx*v_mid
+
+c       move departure point into ghostbox of u_in
+        x = min(max(x,x_lo),x_hi)
+
+c       find lower corner of interpolation cell and weight
+        i0 = min(int(x - ilo_u_in_gb) + ilo_u_in_gb, ihi_u_in_gb-1)
+        wx = x - i0
+
+c       linear interpolation
+        u_dep = (1.d0-wx)*u_in(i0) + wx*u_in(i0+1)
+
+        u_next(i) = alpha*u_cur(i) + beta*u_dep
+
+      enddo
+c     } end loop over grid
+
+      return
+      end
+c } end subroutine
+c***********************************************************************
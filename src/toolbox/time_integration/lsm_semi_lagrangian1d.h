@@ -0,0 +1,113 @@
+/*
+ * File:        lsm_semi_lagrangian1d.h
+ * Copyrights:  (c) 2005 The Trustees of Princeton University and Board of
+ *                  Regents of the University of Texas.  All rights reserved.
+ *              (c) 2009 Kevin T. Chu.  All rights reserved.
+ * Revision:    $Revision$
+ * Modified:    $Date$
+ * Description: Header file for Fortran 77 1D semi-Lagrangian routines
+ */
+
+#ifndef INCLUDED_LSM_SEMI_LAGRANGIAN_1D_H
+#define INCLUDED_LSM_SEMI_LAGRANGIAN_1D_H
+
+#include "LSMLIB_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \file lsm_semi_lagrangian1d.h
+ *
+ * \brief
+ * @ref lsm_semi_lagrangian1d.h provides support for semi-Lagrangian 
+ * time integration of advection equations in one space dimension.
+ * Semi-Lagrangian steps are not restricted by the CFL condition, so
+ * they permit time steps several times larger than TVD Runge-Kutta
+ * methods for smooth, externally prescribed velocity fields.
+ *
+ * A BFECC (back and forth error compensation and correction) step 
+ * of size dt is built from three calls to 
+ * LSM1D_SEMI_LAGRANGIAN_ADVECTION_STEP():
+ *
+ *  -# u_fwd  = SL(u_cur; dt)                     (alpha = 0)
+ *  -# u_corr = 3/2 u_cur - 1/2 SL(u_fwd; -dt)    (alpha = 3/2)
+ *  -# u_next = SL(u_corr; dt)                    (alpha = 0)
+ *
+ * where SL(u; dt) denotes interpolation of u at the departure points
+ * x - dt*vel(x).  Ghostcells of u_fwd and u_corr must be filled 
+ * before they are used as u_in.
+ *
+ */
+
+
+/* Link between C/C++ and Fortran function names
+ *
+ *      name in                             name in
+ *      C/C++ code                          Fortran code
+ *      ----------                          ------------
+ */
+#define LSM1D_SEMI_LAGRANGIAN_ADVECTION_STEP  lsm1dsemilagrangianadvectionstep_
+
+
+/*!
+ * LSM1D_SEMI_LAGRANGIAN_ADVECTION_STEP() takes a single semi-Lagrangian
+ * step for the advection equation 
+ *
+ *   u_t + vel \cdot \nabla u = 0
+ *
+ * by tracing the characteristic through each grid point x back to its
+ * departure point x - dt*vel(x - dt/2*vel(x)) (i.e. using the midpoint 
+ * rule) and linearly interpolating u_in 
+ * there.  The result is blended with u_cur:
+ *
+ *   u_next = alpha*u_cur + (1-alpha)*u_in(x - dt*vel(x))
+ *
+ * Arguments:
+ *  - u_next (out):     u at the end of the step
+ *  - u_cur (in):       u(t_cur) (only used when alpha is nonzero)
+ *  - u_in (in):        u to interpolate at the departure points
+ *  - vel (in):         velocity
+ *  - dx (in):          grid spacing
+ *  - alpha (in):       weight of u_cur
+ *  - dt (in):          step size (negative for backward steps)
+ *  - *_gb (in):        index range for ghostbox
+ *  - *_fb (in):        index range for fillbox
+ *
+ * Return value:        none
+ *
+ * NOTES:
+ *  - departure points outside of the ghostbox of u_in are moved to the
+ *    nearest point of the ghostbox, so the ghostbox of u_in should be
+ *    at least int(CFL)+1 cells wider than the fillbox.
+ *  - the velocity is interpolated at the midpoints of the 
+ *    characteristics.  Midpoints outside of the ghostbox of the
+ *    velocity are moved to the nearest point of the ghostbox, so the 
+ *    velocity should have at least int(CFL/2)+1 ghostcells for the 
+ *    trace to be second-order accurate near patch boundaries.
+ *  - u_next may be the same array as u_cur but NOT u_in.
+ */
+void LSM1D_SEMI_LAGRANGIAN_ADVECTION_STEP(
+  LSMLIB_REAL *u_next,
+  const int *ilo_u_next_gb,
+  const int *ihi_u_next_gb,
+  const LSMLIB_REAL *u_cur,
+  const int *ilo_u_cur_gb,
+  const int *ihi_u_cur_gb,
+  const LSMLIB_REAL *u_in,
+  const int *ilo_u_in_gb,
+  const int *ihi_u_in_gb,
+  const LSMLIB_REAL *vel,
+  const int *ilo_vel_gb,
+  const int *ihi_vel_gb,
+  const int *ilo_fb,
+  const int *ihi_fb,
+  const LSMLIB_REAL *dx,
+  const LSMLIB_REAL *alpha,
+  const LSMLIB_REAL *dt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
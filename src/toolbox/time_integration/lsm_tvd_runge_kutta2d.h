@@ -23,7 +23,8 @@ extern "C" {
  * @ref lsm_tvd_runge_kutta2d.h provides support for time integration of
  * partial differential equations in two space dimensions via 
  * total-variation diminishing Runge-Kutta methods.  Support is provided 
- * for first-, second-, and third-order time integration.
+ * for first-, second-, and third-order time integration as well as
+ * for low-storage strong stability preserving (SSP) Runge-Kutta methods.
  * 
  */
 
@@ -40,6 +41,7 @@ extern "C" {
 #define LSM2D_TVD_RK3_STAGE1                lsm2dtvdrk3stage1_
 #define LSM2D_TVD_RK3_STAGE2                lsm2dtvdrk3stage2_
 #define LSM2D_TVD_RK3_STAGE3                lsm2dtvdrk3stage3_
+#define LSM2D_SSP_RK_STAGE                  lsm2dssprkstage_
 
 
 /*!
@@ -289,6 +291,63 @@ void LSM2D_TVD_RK3_STAGE3(
   const int *jhi_fb,
   const LSMLIB_REAL *dt);
 
+/*!
+ * LSM2D_SSP_RK_STAGE() advances the solution through a single stage
+ * of a low-storage strong stability preserving (SSP) Runge-Kutta method.
+ * Each stage has the form
+ *
+ * \f[
+ *
+ *    u_{next} = \alpha u_{cur} + (1-\alpha) ( u_{stage} + dt \cdot rhs )
+ *
+ * \f]
+ *
+ * so only u_cur and a single stage array need to be stored.
+ *
+ * Arguments:
+ *  - u_next (out):   u at the end of the stage
+ *  - u_stage (in):   u at the beginning of the stage
+ *  - u_cur (in):     u(t_cur)
+ *  - rhs (in):       right-hand side of time evolution equation
+ *                    computed from u_stage
+ *  - alpha (in):     weight of u_cur for the stage
+ *  - dt (in):        step size for the stage
+ *  - *_gb (in):      index range for ghostbox
+ *  - *_fb (in):      index range for fillbox
+ *
+ * Return value:      none
+ *
+ * NOTES:
+ *  - u_next may be the same array as u_stage or u_cur.
+ */
+void LSM2D_SSP_RK_STAGE(
+  LSMLIB_REAL *u_next,
+  const int *ilo_u_next_gb,
+  const int *ihi_u_next_gb,
+  const int *jlo_u_next_gb,
+  const int *jhi_u_next_gb,
+  const LSMLIB_REAL *u_stage,
+  const int *ilo_u_stage_gb,
+  const int *ihi_u_stage_gb,
+  const int *jlo_u_stage_gb,
+  const int *jhi_u_stage_gb,
+  const LSMLIB_REAL *u_cur,
+  const int *ilo_u_cur_gb,
+  const int *ihi_u_cur_gb,
+  const int *jlo_u_cur_gb,
+  const int *jhi_u_cur_gb,
+  const LSMLIB_REAL *rhs, 
+  const int *ilo_rhs_gb,
+  const int *ihi_rhs_gb,
+  const int *jlo_rhs_gb,
+  const int *jhi_rhs_gb,
+  const int *ilo_fb,
+  const int *ihi_fb,
+  const int *jlo_fb,
+  const int *jhi_fb,
+  const LSMLIB_REAL *alpha,
+  const LSMLIB_REAL *dt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -500,3 +500,101 @@ c     } end loop over grid
       end
 c } end subroutine
 c***********************************************************************
+
+c***********************************************************************
+c
+c  lsm3dSSPRKStage() advances the solution through a single stage of
+c  a low-storage strong stability preserving (SSP) Runge-Kutta method.
+c  Each stage has the form
+c
+c    u_next = alpha*u_cur + (1-alpha)*( u_stage + dt*rhs )
+c
+c  so that only u_cur and a single stage array need to be stored.
+c  u_next may be the same array as u_stage or u_cur (the update is
+c  pointwise).  The low-storage SSP methods used with this subroutine
+c  are discussed in Ketcheson (2008) and Spiteri & Ruuth (2002).
+c  
+c  Arguments:
+c    u_next (out):    u at the end of the stage
+c    u_stage (in):    u at the beginning of the stage
+c    u_cur (in):      u(t_cur)
+c    rhs (in):        right-hand side of time evolution equation
+c                     computed from u_stage
+c    alpha (in):      weight of u_cur for the stage
+c    dt (in):         step size for the stage
+c    *_gb (in):       index range for ghostbox
+c    *_fb (in):       index range for fillbox
+c
+c***********************************************************************
+      subroutine lsm3dSSPRKStage(
+     &  u_next,
+     &  ilo_u_next_gb, ihi_u_next_gb,
+     &  jlo_u_next_gb, jhi_u_next_gb,
+     &  klo_u_next_gb, khi_u_next_gb,
+     &  u_stage,
+     &  ilo_u_stage_gb, ihi_u_stage_gb,
+     &  jlo_u_stage_gb, jhi_u_stage_gb,
+     &  klo_u_stage_gb, khi_u_stage_gb,
+     &  u_cur,
+     &  ilo_u_cur_gb, ihi_u_cur_gb,
+     &  jlo_u_cur_gb, jhi_u_cur_gb,
+     &  klo_u_cur_gb, khi_u_cur_gb,
+     &  rhs,
+     &  ilo_rhs_gb, ihi_rhs_gb,
+     &  jlo_rhs_gb, jhi_rhs_gb,
+     &  klo_rhs_gb, khi_rhs_gb,
+     &  ilo_fb, ihi_fb, jlo_fb, jhi_fb, klo_fb, khi_fb,
+     &  alpha, dt)
+c***********************************************************************
+c { begin subroutine
+      implicit none
+
+      integer ilo_u_next_gb, ihi_u_next_gb
+      integer jlo_u_next_gb, jhi_u_next_gb
+      integer klo_u_next_gb, khi_u_next_gb
+      integer ilo_u_stage_gb, ihi_u_stage_gb
+      integer jlo_u_stage_gb, jhi_u_stage_gb
+      integer klo_u_stage_gb, khi_u_stage_gb
+      integer ilo_u_cur_gb, ihi_u_cur_gb
+      integer jlo_u_cur_gb, jhi_u_cur_gb
+      integer klo_u_cur_gb, khi_u_cur_gb
+      integer ilo_rhs_gb, ihi_rhs_gb
+      integer jlo_rhs_gb, jhi_rhs_gb
+      integer klo_rhs_gb, khi_rhs_gb
+      integer ilo_fb, ihi_fb, jlo_fb, jhi_fb, klo_fb, khi_fb
+      real u_next(ilo_u_next_gb:ihi_u_next_gb,
+     &            jlo_u_next_gb:jhi_u_next_gb,
+     &            klo_u_next_gb:khi_u_next_gb)
+      real u_stage(ilo_u_stage_gb:ihi_u_stage_gb,
+     &             jlo_u_stage_gb:jhi_u_stage_gb,
+     &             klo_u_stage_gb:khi_u_stage_gb)
+      real u_cur(ilo_u_cur_gb:ihi_u_cur_gb,
+     &           jlo_u_cur_gb:jhi_u_cur_gb,
+     &           klo_u_cur_gb:khi_u_cur_gb)
+      real rhs(ilo_rhs_gb:ihi_rhs_gb,
+     &         jlo_rhs_gb:jhi_rhs_gb,
+     &         klo_rhs_gb:khi_rhs_gb)
+      integer i, j, k
+      real alpha, dt
+      real beta
+
+c     weight of the forward Euler update
+      beta = 1.d0 - alpha
+
+c     { begin loop over grid
+      do k=klo_fb,khi_fb
+        do j=jlo_fb,jhi_fb
+          do i=ilo_fb,ihi_fb
+
+            u_next(i,j,k) = alpha*u_cur(i,j,k)
+     &                    + beta*( u_stage(i,j,k) + dt*rhs(i,j,k) )
+
+          enddo
+        enddo
+      enddo
+c     } end loop over grid
+
+      return
+      end
+c } end subroutine
+c***********************************************************************
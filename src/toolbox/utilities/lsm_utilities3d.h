@@ -69,6 +69,8 @@ extern "C" {
                                    lsm3dvoxelcountgreaterthanzerocontrolvolume_
 #define LSM3D_VOXEL_COUNT_LESS_THAN_ZERO_CONTROL_VOLUME  \
                                    lsm3dvoxelcountlessthanzerocontrolvolume_
+#define LSM3D_GRAD_PHI_DEVIATION_CONTROL_VOLUME                             \
+                       lsm3dgradphideviationcontrolvolume_
 /*!
  * LSM3D_MAX_NORM_DIFF() computes the max norm of the difference
  * between the two specified scalar fields.
@@ -1026,6 +1028,66 @@ void LSM3D_VOXEL_COUNT_LESS_THAN_ZERO_CONTROL_VOLUME(
   const int *jhi_fb,
   const int *klo_fb,
   const int *khi_fb); 
+/*!
+ * LSM3D_GRAD_PHI_DEVIATION_CONTROL_VOLUME() computes the sum of
+ * | |grad(phi)| - 1 | and the number of grid cells over the cells
+ * within a band of the zero level set (i.e. |phi| < band_width) in the
+ * region of the computational domain included by the control volume data.
+ * The ratio of the two is a measure of how far phi has drifted from a
+ * signed distance function.
+ *
+ * Arguments:
+ *  - deviation_sum (out):      sum of | |grad(phi)| - 1 | over cells in
+ *                              the band
+ *  - num_cells_in_band (out):  number of cells in the band
+ *  - phi (in):                 level set function
+ *  - control_vol (in):         control volume data (used to exclude cells
+ *                              from the calculation)
+ *  - control_vol_sgn (in):     1 (-1) if positive (negative) control
+ *                              volume points should be used
+ *  - band_width (in):          half-width of band about zero level set
+ *  - dx, dy, dz (in):          grid spacing
+ *  - *_gb (in):                index range for ghostbox
+ *  - *_ib (in):                index range for box to include in
+ *                              calculation
+ *
+ * Return value:                none
+ *
+ * NOTES:
+ * - grad(phi) is computed using second-order central differences, so
+ *   *_ib must lie at least one cell inside of the ghostbox of phi.
+ *
+ */
+void LSM3D_GRAD_PHI_DEVIATION_CONTROL_VOLUME(
+  LSMLIB_REAL *deviation_sum,
+  LSMLIB_REAL *num_cells_in_band,
+  const LSMLIB_REAL *phi,
+  const int *ilo_phi_gb, 
+  const int *ihi_phi_gb,
+  const int *jlo_phi_gb, 
+  const int *jhi_phi_gb,
+  const int *klo_phi_gb, 
+  const int *khi_phi_gb,
+  const LSMLIB_REAL *control_vol,
+  const int *ilo_control_vol_gb, 
+  const int *ihi_control_vol_gb,
+  const int *jlo_control_vol_gb, 
+  const int *jhi_control_vol_gb,
+  const int *klo_control_vol_gb, 
+  const int *khi_control_vol_gb,
+  const int *control_vol_sgn,
+  const LSMLIB_REAL *band_width,
+  const int *ilo_ib, 
+  const int *ihi_ib,
+  const int *jlo_ib, 
+  const int *jhi_ib,
+  const int *klo_ib, 
+  const int *khi_ib,
+  const LSMLIB_REAL *dx,
+  const LSMLIB_REAL *dy,
+  const LSMLIB_REAL *dz);
+
+
 #ifdef __cplusplus
 }
 #endif